@@ -24,6 +24,14 @@
 #include "../src/Graphics/Loaders/ShaderProperties.cpp"
 
 #include "../src/Graphics/Memory/DescriptorManager.cpp"
+#include "../src/Graphics/Memory/DescriptorSetCache.cpp"
+#include "../src/Graphics/Memory/BindlessTextureTable.cpp"
+#include "../src/Graphics/Memory/TextureStreamer.cpp"
+#include "../src/Graphics/Memory/GeometryPool.cpp"
+#include "../src/Graphics/Memory/IndirectDrawBuffer.cpp"
+#include "../src/Graphics/Memory/ResourceReleaseQueue.cpp"
+#include "../src/Graphics/Memory/FramebufferPool.cpp"
+#include "../src/Graphics/Memory/MemoryBudget.cpp"
 #include "../src/Graphics/Memory/SSBOManager.cpp"
 #include "../src/Graphics/Memory/TextureConfigs.cpp"
 #include "../src/Graphics/Memory/MeshManager.cpp"
@@ -62,6 +70,11 @@
 #include "../src/Graphics/Render/RenderStrategy.cpp"
 #include "../src/Graphics/Render/FrameBufferController.cpp"
 #include "../src/Graphics/Render/FrustumCulling.cpp"
+#include "../src/Graphics/Render/HiZPyramid.cpp"
+#include "../src/Graphics/Render/RenderGraph.cpp"
+#include "../src/Graphics/Render/DynamicResolution.cpp"
+#include "../src/Graphics/Render/OffScreenCameraScheduler.cpp"
+#include "../src/Graphics/Render/FrameProfiler.cpp"
 #include "../src/Graphics/Render/HTML/HTMLDrawableElement.cpp"
 
 #include "../src/Graphics/Types/Geometry/DebugWireframeMesh.cpp"
@@ -85,6 +98,7 @@
 #include "../src/Graphics/Types/RenderTexture.cpp"
 
 #include "../src/Graphics/Material/MaterialProperty.cpp"
+#include "../src/Graphics/Material/MaterialParameterBlock.cpp"
 #include "../src/Graphics/Material/MeshMaterialProperty.cpp"
 #include "../src/Graphics/Material/BaseMaterial.cpp"
 #include "../src/Graphics/Material/FileMaterial.cpp"
@@ -92,6 +106,11 @@
 
 #include "../src/Graphics/Utils/MeshUtils.cpp"
 #include "../src/Graphics/Utils/AtlasBuilder.cpp"
+#include "../src/Graphics/Utils/MeshSimplifier.cpp"
+#include "../src/Graphics/Utils/MeshletBuilder.cpp"
+#include "../src/Graphics/Utils/MeshOptimizer.cpp"
+#include "../src/Graphics/Utils/MeshCache.cpp"
+#include "../src/Graphics/Utils/PostProcessComposer.cpp"
 
 #include "../src/Graphics/Window/Window.cpp"
 #include "../src/Graphics/Window/BasicWindowImpl.cpp"
@@ -103,6 +122,8 @@
 #if defined(SR_USE_VULKAN)
     #include "../src/Graphics/Pipeline/Vulkan/VulkanPipeline.cpp"
     #include "../src/Graphics/Pipeline/Vulkan/VulkanMemory.cpp"
+    #include "../src/Graphics/Pipeline/Vulkan/VulkanUploadManager.cpp"
+    #include "../src/Graphics/Pipeline/Vulkan/VulkanUniformPages.cpp"
     #include "../src/Graphics/Pipeline/Vulkan/VulkanKernel.cpp"
 
     #if defined(SR_LINUX)
@@ -16,9 +16,11 @@
 #include "../src/Graphics/Pass/OpaquePass.cpp"
 #include "../src/Graphics/Pass/TransparentPass.cpp"
 #include "../src/Graphics/Pass/PostProcessPass.cpp"
+#include "../src/Graphics/Pass/UberPostProcessPass.cpp"
 #include "../src/Graphics/Pass/DebugPass.cpp"
 #include "../src/Graphics/Pass/ColorBufferPass.cpp"
 #include "../src/Graphics/Pass/DepthBufferPass.cpp"
+#include "../src/Graphics/Pass/DepthPrePass.cpp"
 #include "../src/Graphics/Pass/ShaderOverridePass.cpp"
 #include "../src/Graphics/Pass/SSAOPass.cpp"
 #include "../src/Graphics/Pass/ShadowMapPass.cpp"
@@ -26,4 +28,7 @@
 #include "../src/Graphics/Pass/IMeshClusterPass.cpp"
 #include "../src/Graphics/Pass/IMesh3DClusterPass.cpp"
 #include "../src/Graphics/Pass/VarianceShadowMapPass.cpp"
-#include "../src/Graphics/Pass/FlatClusterPass.cpp"
\ No newline at end of file
+#include "../src/Graphics/Pass/SeparableBlurPass.cpp"
+#include "../src/Graphics/Pass/FlatClusterPass.cpp"
+#include "../src/Graphics/Pass/DepthNormalDownsamplePass.cpp"
+#include "../src/Graphics/Pass/BilateralUpsamplePass.cpp"
\ No newline at end of file
@@ -89,6 +89,8 @@ namespace SR_GRAPH_NS {
         uint32_t samplerId = SR_ID_INVALID;
         bool isArray = false;
         bool isAttachment = false;
+        /// Массив текстур из BindlessTextureTable, samplerId не используется
+        bool isBindless = false;
         SR_UTILS_NS::StringAtom defaultValue;
     };
     typedef std::map<SR_UTILS_NS::StringAtom, ShaderSampler> ShaderSamplers;
@@ -27,6 +27,8 @@ namespace SR_GRAPH_NS {
     public:
         static TextureData::Ptr Load(const SR_UTILS_NS::Path& path, ImageLoadFormat format = ImageLoadFormat::RGBA);
         static TextureData::Ptr Create(uint32_t width, uint32_t height, uint8_t* pData, DeleterFn&& deleter, ImageLoadFormat format = ImageLoadFormat::RGBA);
+        /// Копия нулевого уровня вместе с построенной мип-цепочкой
+        static TextureData::Ptr CreateMipChain(const TextureData::Ptr& pSource, const MipChainInfo& info);
 
         SR_NODISCARD bool Save(const SR_UTILS_NS::Path& path) const;
 
@@ -40,7 +42,15 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD SR_UTILS_NS::Path GetPath() const { return m_path; }
         SR_NODISCARD ImageLoadFormat GetFormat() const { return m_format; }
 
+        SR_NODISCARD bool HasMipChain() const { return !m_mipLevels.empty(); }
+        SR_NODISCARD uint8_t GetMipCount() const { return HasMipChain() ? static_cast<uint8_t>(m_mipLevels.size()) : 1; }
+        SR_NODISCARD MipLevel GetMipLevel(uint8_t level) const;
+        SR_NODISCARD const uint8_t* GetMipData(uint8_t level) const;
+        /// Размер всех уровней в байтах, данные всегда RGBA8
+        SR_NODISCARD uint64_t GetMipChainBytes() const;
+
         void SetPath(const SR_UTILS_NS::Path& path) { m_path = path; }
+        void SetMipLevels(std::vector<MipLevel> levels) { m_mipLevels = std::move(levels); }
 
     private:
         uint32_t m_width = 0;
@@ -49,11 +59,14 @@ namespace SR_GRAPH_NS {
         uint8_t* m_data = nullptr;
         SR_UTILS_NS::Path m_path;
         ImageLoadFormat m_format = ImageLoadFormat::Unknown;
+        std::vector<MipLevel> m_mipLevels;
         DeleterFn m_deleter;
     };
 
     class TextureLoader {
         using TexturePtr = SR_GTYPES_NS::Texture*;
+        /// Увеличивается при изменении формата файлов кэша
+        static constexpr uint64_t TEXTURE_CACHE_VERSION = 2;
     public:
         TextureLoader() = delete;
         TextureLoader(const TextureLoader&) = delete;
@@ -61,7 +74,8 @@ namespace SR_GRAPH_NS {
         ~TextureLoader() = delete;
 
     public:
-        static TextureData::Ptr Load(const SR_UTILS_NS::Path& path);
+        /// Если конфигу нужны мип-уровни, строит их на процессоре, цепочка загружается в видеопамять как есть
+        static TextureData::Ptr Load(const SR_UTILS_NS::Path& path, const std::optional<Memory::TextureConfig>& config = std::nullopt);
         static TextureData::Ptr LoadFromMemory(const std::string& data, const Memory::TextureConfig& config);
 
         static bool Free(unsigned char* data);
@@ -10,11 +10,13 @@
 #include <Utils/Math/Vector3.h>
 #include <Utils/Math/Vector4.h>
 #include <Utils/Types/ObjectPool.h>
+#include <Utils/Types/Function.h>
 
 #include <Graphics/Loaders/ShaderProperties.h>
 #include <Graphics/Pipeline/IShaderProgram.h>
 #include <Graphics/Material/MaterialType.h>
 #include <Graphics/Material/MaterialProperty.h>
+#include <Graphics/Material/MaterialParameterBlock.h>
 
 namespace SR_GTYPES_NS {
     class Mesh;
@@ -49,6 +51,7 @@ namespace SR_GRAPH_NS {
         void SR_FASTCALL SetTexture(SR_UTILS_NS::StringAtom id, SR_GTYPES_NS::Texture* pTexture) noexcept;
 
         SR_NODISCARD bool ContainsTexture(SR_GTYPES_NS::Texture* pTexture) const;
+        void ForEachTexture(const SR_HTYPES_NS::Function<void(TexturePtr)>& callback) const;
         SR_NODISCARD bool IsTransparent() const;
         SR_NODISCARD ShaderPtr GetShader() const { return m_shader; }
         SR_NODISCARD MaterialProperties& GetProperties() { return m_properties; }
@@ -81,6 +84,7 @@ namespace SR_GRAPH_NS {
         ShaderPtr m_shader = nullptr;
         std::atomic<bool> m_dirtyShader = false;
         MaterialProperties m_properties;
+        MaterialParameterBlock m_parameterBlock;
         RenderContextPtr m_context;
         SR_UTILS_NS::Subscription m_shaderReloadDoneSubscription;
 
@@ -6,9 +6,10 @@
 #define SR_ENGINE_GRAPHICS_FILE_MATERIAL_H
 
 #include <Graphics/Material/BaseMaterial.h>
+#include <Graphics/Memory/ContextResource.h>
 
 namespace SR_GRAPH_NS {
-    class FileMaterial : public BaseMaterial, public SR_UTILS_NS::IResource {
+    class FileMaterial : public BaseMaterial, public Memory::ContextResource<FileMaterial> {
     public:
         using Ptr = FileMaterial*;
 
@@ -0,0 +1,70 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_MATERIAL_PARAMETER_BLOCK_H
+#define SR_ENGINE_GRAPHICS_MATERIAL_PARAMETER_BLOCK_H
+
+#include <Graphics/Material/MaterialProperty.h>
+
+namespace SR_GTYPES_NS {
+    class Shader;
+}
+
+namespace SR_GRAPH_NS {
+    /**
+     * Скомпилированное представление свойств материала.
+     * Хранит упакованную (std140, со смещениями из UBO блока шейдера) копию значений
+     * и заранее разрешенные хендлы свойств, чтобы не искать их по имени при каждом использовании.
+     */
+    class MaterialParameterBlock final : public SR_UTILS_NS::NonCopyable {
+        struct Handle {
+            MaterialProperty* pProperty = nullptr;
+            uint32_t packedOffset = 0;
+            uint32_t size = 0;
+        };
+
+        /// Непрерывный участок UBO блока шейдера, копируется одним memcpy
+        struct Range {
+            uint32_t packedOffset = 0;
+            uint32_t blockOffset = 0;
+            uint32_t size = 0;
+        };
+
+    public:
+        MaterialParameterBlock() = default;
+        ~MaterialParameterBlock() override = default;
+
+    public:
+        void Compile(SR_GTYPES_NS::Shader* pShader, MaterialProperties& properties);
+        void Clear();
+
+        /// Копирует упакованный блок в UBO блок шейдера. Вернет false, если блок собран под другой шейдер.
+        bool Upload(SR_GTYPES_NS::Shader* pShader, MaterialProperties& properties);
+
+        void MarkDataDirty() noexcept { m_dataDirty = true; }
+        void MarkLayoutDirty() noexcept { m_layoutDirty = true; }
+
+        SR_NODISCARD MaterialProperty* Find(uint64_t hashId) const noexcept;
+        SR_NODISCARD bool IsCompiled() const noexcept { return m_shader != nullptr; }
+        SR_NODISCARD uint32_t GetPackedSize() const noexcept { return static_cast<uint32_t>(m_memory.size()); }
+
+    private:
+        void Pack();
+
+    private:
+        SR_GTYPES_NS::Shader* m_shader = nullptr;
+
+        std::atomic<bool> m_dataDirty = true;
+        std::atomic<bool> m_layoutDirty = false;
+
+        std::vector<Handle> m_handles;
+        std::vector<Range> m_ranges;
+        std::vector<uint8_t> m_memory;
+
+        ska::flat_hash_map<uint64_t, MaterialProperty*> m_lookup;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_MATERIAL_PARAMETER_BLOCK_H
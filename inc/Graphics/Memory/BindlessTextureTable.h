@@ -0,0 +1,78 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_BINDLESS_TEXTURE_TABLE_H
+#define SR_ENGINE_GRAPHICS_BINDLESS_TEXTURE_TABLE_H
+
+#include <Utils/Common/Singleton.h>
+
+#include <Graphics/Pipeline/IShaderProgram.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Таблица текстур для массива BINDLESS_TEXTURES.
+     * Текстура получает слот при первом обращении и теряет его при освобождении видеопамяти,
+     * освобожденный слот переиспользуется только после того, как его перестанут читать кадры в полете.
+     * Нулевой слот всегда указывает на запасную текстуру.
+     * Измененные слоты дописываются в уже записанные наборы, поколение меняется, только когда наборы нужно записать заново.
+     */
+    class BindlessTextureTable : public SR_UTILS_NS::Singleton<BindlessTextureTable> {
+        SR_REGISTER_SINGLETON(BindlessTextureTable)
+        using TextureId = int32_t;
+    public:
+        using Slot = int32_t;
+
+    private:
+        struct PendingSlot {
+            Slot slot = SR_ID_INVALID;
+            uint64_t frame = 0;
+        };
+
+    public:
+        SR_NODISCARD Slot Acquire(TextureId textureId);
+        void OnTextureFreed(TextureId textureId);
+        /// Образ под идентификатором пересоздан, слот остается за текстурой и записывается заново
+        void OnTextureReCreated(TextureId textureId);
+
+        /// Вернет true, если с прошлого кадра изменились слоты
+        bool NextFrame(uint32_t framesInFlight);
+        void ClearDirtySlots() { m_dirtySlots.clear(); }
+        /// Записанные наборы больше не годятся, их нужно получить заново
+        void Invalidate() { ++m_generation; }
+        void Clear();
+
+        void SetFallbackTexture(TextureId textureId);
+
+        /// Идентификаторы текстур по слотам, пустые слоты указывают на запасную текстуру
+        SR_NODISCARD const std::vector<TextureId>& GetTextures() const noexcept { return m_textures; }
+        SR_NODISCARD const std::vector<Slot>& GetDirtySlots() const noexcept { return m_dirtySlots; }
+        SR_NODISCARD TextureId GetFallbackTexture() const noexcept { return m_fallbackTexture; }
+        SR_NODISCARD uint64_t GetGeneration() const noexcept { return m_generation; }
+        SR_NODISCARD uint32_t GetCapacity() const noexcept { return SHADER_BINDLESS_TEXTURES_CAPACITY; }
+        SR_NODISCARD uint32_t GetUsedCount() const noexcept { return static_cast<uint32_t>(m_slots.size()); }
+
+    private:
+        void SetSlot(Slot slot, TextureId textureId);
+        void MarkDirty(Slot slot);
+
+    private:
+        std::vector<TextureId> m_textures;
+        ska::flat_hash_map<TextureId, Slot> m_slots;
+        std::vector<Slot> m_freeSlots;
+        std::vector<PendingSlot> m_pendingSlots;
+        std::vector<Slot> m_dirtySlots;
+
+        TextureId m_fallbackTexture = SR_ID_INVALID;
+        /// нулевой слот зарезервирован под запасную текстуру
+        Slot m_nextSlot = 1;
+
+        uint64_t m_generation = 0;
+        uint64_t m_frame = 0;
+
+        bool m_isFullWarned = false;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_BINDLESS_TEXTURE_TABLE_H
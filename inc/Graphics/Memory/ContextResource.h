@@ -0,0 +1,26 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_CONTEXT_RESOURCE_H
+#define SR_ENGINE_GRAPHICS_CONTEXT_RESOURCE_H
+
+#include <Utils/Resources/IResource.h>
+
+namespace SR_GRAPH_NS::Memory {
+    /**
+     * Ресурс, одна из точек использования которого принадлежит контексту рендера.
+     * Когда снимается последняя точка, кроме контекстной, ресурс передается контексту на отложенное освобождение.
+     * Решение принимается здесь для всех типов ресурсов контекста, определение в RenderContext.h.
+     */
+    template<typename T> class ContextResource : public SR_UTILS_NS::IResource {
+    protected:
+        using SR_UTILS_NS::IResource::IResource;
+
+    public:
+        RemoveUPResult RemoveUsePoint() override;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_CONTEXT_RESOURCE_H
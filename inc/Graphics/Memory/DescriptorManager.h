@@ -10,6 +10,7 @@
 #include <Utils/Types/SharedPtr.h>
 
 #include <Graphics/Types/Descriptors.h>
+#include <Graphics/Memory/DescriptorSetCache.h>
 
 namespace SR_GTYPES_NS {
     class Shader;
@@ -23,7 +24,18 @@ namespace SR_GRAPH_NS {
         using DescriptorSet = int32_t;
         struct DescriptorSetInfo {
             void* pShaderHandle = nullptr;
-            DescriptorSet descriptorSet = SR_ID_INVALID;
+            DescriptorSetCache::Handle cacheHandle = SR_ID_INVALID;
+            /// шейдеру не нужен набор дескрипторов
+            bool isEmpty = false;
+            /// набор из пула временных наборов, в кэш не попадает
+            DescriptorSet transientSet = SR_ID_INVALID;
+            /// поколение BindlessTextureTable, с которым был записан набор
+            bool hasBindlessTextures = false;
+            uint64_t bindlessGeneration = 0;
+        };
+        struct VirtualDescriptorSetInfo {
+            std::vector<DescriptorSetInfo> descriptorSets;
+            bool transient = false;
         };
     public:
         using VirtualDescriptorSet = int32_t;
@@ -35,23 +47,47 @@ namespace SR_GRAPH_NS {
         };
     public:
         void CollectUnused();
+        /// Вызывается один раз за кадр, освобождает наборы, вытесненные из кэша
+        void NextFrame();
+        void Clear();
 
-        SR_NODISCARD VirtualDescriptorSet AllocateDescriptorSet(VirtualDescriptorSet reallocation = SR_ID_INVALID);
+        /// transient - наборы берутся из пулов временных наборов, которые сбрасываются целиком,
+        /// и не сохраняются в кэше. Если пул исчерпан, набор уходит в кэш и освобождается на смене кадра
+        SR_NODISCARD VirtualDescriptorSet AllocateDescriptorSet(VirtualDescriptorSet reallocation = SR_ID_INVALID, bool transient = false);
         BindResult Bind(VirtualDescriptorSet virtualDescriptorSet);
         void Flush();
 
         bool FreeDescriptorSet(VirtualDescriptorSet* pVirtualDescriptorSet);
 
+        /// Идентификатор ресурса может быть переиспользован, наборы с ним больше нельзя отдавать из кэша
+        void OnResourceFreed(DescriptorType type, int32_t resource);
+
         void SetPipeline(SR_HTYPES_NS::SharedPtr<Pipeline> pipeline) noexcept { m_pipeline = std::move(pipeline); }
+        void SetCacheCapacity(uint32_t capacity) noexcept { m_cache.SetCapacity(capacity); }
+
+        SR_NODISCARD const DescriptorSetCache::Statistics& GetCacheStatistics() const noexcept { return m_cache.GetStatistics(); }
 
     private:
+        SR_NODISCARD const std::vector<DescriptorType>& GetAllocationTypes(SR_GTYPES_NS::Shader* pShader) const;
         SR_NODISCARD DescriptorSet AllocateMemory(SR_GTYPES_NS::Shader* pShader) const;
+        SR_NODISCARD bool FlushTransient(VirtualDescriptorSetInfo& info, DescriptorSetInfo*& pElement, SR_GTYPES_NS::Shader* pShader);
+        void ReleaseElement(DescriptorSetInfo& element);
+        SR_NODISCARD bool IsDescriptorSetRequired(SR_GTYPES_NS::Shader* pShader) const;
+        void Release(VirtualDescriptorSetInfo& info);
+        void FreeGarbage();
 
     private:
-        SR_HTYPES_NS::ObjectPool<std::vector<DescriptorSetInfo>, VirtualDescriptorSet> m_descriptorPool;
+        SR_HTYPES_NS::ObjectPool<VirtualDescriptorSetInfo, VirtualDescriptorSet> m_descriptorPool;
         SR_HTYPES_NS::SharedPtr<Pipeline> m_pipeline;
 
+        DescriptorSetCache m_cache;
+
+        /// Последний привязанный виртуальный набор, в него записывает Flush
+        VirtualDescriptorSet m_currentVirtualSet = SR_ID_INVALID;
+
         mutable std::vector<DescriptorType> m_allocationTypesCache;
+        DescriptorBindings m_bindingsCache;
+        std::vector<DescriptorSet> m_garbage;
 
     };
 }
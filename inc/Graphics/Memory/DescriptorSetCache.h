@@ -0,0 +1,103 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_DESCRIPTOR_SET_CACHE_H
+#define SR_ENGINE_GRAPHICS_DESCRIPTOR_SET_CACHE_H
+
+#include <Utils/Types/ObjectPool.h>
+
+#include <Graphics/Types/Descriptors.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Кэш физических наборов дескрипторов.
+     * Ключ - layout (хендл шейдера) и содержимое биндингов, поэтому объекты с одинаковыми
+     * ресурсами используют один и тот же набор. Буфер юниформ объекта в ключ не входит,
+     * только страница, в которой он лежит: участок выбирается динамическим смещением при привязке,
+     * так что меши одного материала делят набор.
+     * Неиспользуемые постоянные наборы живут в LRU до превышения емкости,
+     * временные освобождаются на ближайшей смене кадра.
+     * Освобождение всегда отложено на количество кадров в полете.
+     */
+    class DescriptorSetCache final : public SR_UTILS_NS::NonCopyable {
+    public:
+        using DescriptorSet = int32_t;
+        using Handle = int32_t;
+
+        struct Statistics {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evicted = 0;
+            uint64_t invalidated = 0;
+            uint32_t alive = 0;
+            uint32_t unused = 0;
+        };
+
+    private:
+        struct Entry {
+            void* pLayout = nullptr;
+            uint64_t hash = 0;
+            DescriptorBindings bindings;
+            DescriptorSet descriptorSet = SR_ID_INVALID;
+            uint32_t refCount = 0;
+            uint64_t lastUseFrame = 0;
+            bool transient = false;
+            bool invalid = false;
+        };
+
+        struct Garbage {
+            DescriptorSet descriptorSet = SR_ID_INVALID;
+            uint64_t frame = 0;
+        };
+
+    public:
+        ~DescriptorSetCache() override;
+
+    public:
+        SR_NODISCARD static uint64_t CalculateHash(void* pLayout, const DescriptorBindings& bindings) noexcept;
+
+        /// При попадании увеличивает счетчик ссылок
+        SR_NODISCARD Handle Acquire(void* pLayout, uint64_t hash, const DescriptorBindings& bindings);
+        SR_NODISCARD Handle Insert(void* pLayout, uint64_t hash, DescriptorSet descriptorSet, const DescriptorBindings& bindings, bool transient);
+        void Release(Handle handle);
+
+        SR_NODISCARD bool IsValid(Handle handle) const noexcept;
+        SR_NODISCARD DescriptorSet GetDescriptorSet(Handle handle) const noexcept;
+        SR_NODISCARD uint64_t GetHash(Handle handle) const noexcept;
+
+        /// Ресурс был освобожден, его идентификатор может быть переиспользован
+        void InvalidateResource(DescriptorType type, int32_t resource);
+        void InvalidateLayouts(const std::set<void*>& aliveLayouts);
+
+        /// Возвращает наборы, которые больше не используются ни одним кадром в полете
+        void NextFrame(uint32_t framesInFlight, std::vector<DescriptorSet>& garbage);
+        void Clear(std::vector<DescriptorSet>& garbage);
+
+        void SetCapacity(uint32_t capacity) noexcept { m_capacity = capacity; }
+
+        SR_NODISCARD const Statistics& GetStatistics() const noexcept { return m_statistics; }
+
+    private:
+        void Invalidate(Handle handle, Entry& entry);
+        void Destroy(Handle handle);
+
+    private:
+        SR_HTYPES_NS::ObjectPool<Entry, Handle> m_entries;
+        ska::flat_hash_map<uint64_t, Handle> m_lookup;
+
+        /// Наборы без ссылок, от старых к новым
+        std::list<Handle> m_unused;
+        ska::flat_hash_map<Handle, std::list<Handle>::iterator> m_unusedIterators;
+
+        std::vector<Garbage> m_garbage;
+
+        uint64_t m_frame = 0;
+        uint32_t m_capacity = 4096;
+
+        Statistics m_statistics;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_DESCRIPTOR_SET_CACHE_H
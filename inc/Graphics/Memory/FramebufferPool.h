@@ -0,0 +1,64 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_FRAMEBUFFER_POOL_H
+#define SR_ENGINE_GRAPHICS_FRAMEBUFFER_POOL_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Math/Vector2.h>
+
+namespace SR_GTYPES_NS {
+    class Framebuffer;
+}
+
+namespace SR_GRAPH_NS::Memory {
+    /**
+     * Отпущенные кадровые буферы, видеопамять которых еще не освобождена.
+     * Буфер ищется по описанию вложений и классу размера, сторона которого округляется вверх до SIZE_CLASS_STEP.
+     * Память буфера выделяется по классу, а содержимое рисуется в его часть (Framebuffer::SetContentSize),
+     * поэтому буфер того же класса подходит без пересоздания памяти.
+     * Долго не востребованные буферы возвращаются контексту на освобождение.
+     */
+    class FramebufferPool : public SR_UTILS_NS::NonCopyable {
+        using FramebufferPtr = SR_GTYPES_NS::Framebuffer*;
+    public:
+        static constexpr int32_t SIZE_CLASS_STEP = 64;
+        static constexpr uint32_t MAX_COUNT = 16;
+        static constexpr uint64_t LIFETIME_FRAMES = 600;
+
+        struct Statistics {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+        };
+
+    public:
+        /// Вернет false, если пул полон и буфер нужно освободить
+        bool Put(FramebufferPtr pFramebuffer, uint64_t frame);
+        SR_NODISCARD FramebufferPtr Take(uint64_t description, const SR_MATH_NS::IVector2& size);
+        /// Буферы, пролежавшие дольше LIFETIME_FRAMES, при force - все
+        SR_NODISCARD std::vector<FramebufferPtr> Trim(uint64_t frame, bool force);
+
+        /// Размер, округленный вверх до SIZE_CLASS_STEP
+        SR_NODISCARD static SR_MATH_NS::IVector2 GetSizeClass(const SR_MATH_NS::IVector2& size) noexcept;
+
+        SR_NODISCARD bool IsEmpty() const noexcept { return m_entries.empty(); }
+        SR_NODISCARD uint32_t GetCount() const noexcept { return static_cast<uint32_t>(m_entries.size()); }
+        SR_NODISCARD const Statistics& GetStatistics() const noexcept { return m_statistics; }
+
+    private:
+        struct Entry {
+            FramebufferPtr pFramebuffer = nullptr;
+            uint64_t description = 0;
+            SR_MATH_NS::IVector2 size;
+            uint64_t frame = 0;
+        };
+
+    private:
+        std::vector<Entry> m_entries;
+        Statistics m_statistics;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_FRAMEBUFFER_POOL_H
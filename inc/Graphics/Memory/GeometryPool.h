@@ -0,0 +1,142 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_GEOMETRY_POOL_H
+#define SR_ENGINE_GRAPHICS_GEOMETRY_POOL_H
+
+#include <Utils/Common/Singleton.h>
+#include <Utils/Types/SharedPtr.h>
+#include <Utils/Types/ObjectPool.h>
+#include <Utils/Types/Thread.h>
+
+#include <Graphics/Memory/MeshManager.h>
+
+namespace SR_GRAPH_NS {
+    class Pipeline;
+
+    /**
+     * Общие буферы геометрии.
+     * Вершины одного формата и индексы всех мешей лежат в нескольких больших буферах (страницах),
+     * меш получает участок страницы и рисуется через firstIndex/vertexOffset, поэтому
+     * буферы переключаются только при смене страницы.
+     * Свободные участки хранятся в двух индексах: по смещению для слияния соседей и по размеру для поиска наилучшего.
+     */
+    class GeometryPool : public SR_UTILS_NS::Singleton<GeometryPool> {
+        SR_REGISTER_SINGLETON(GeometryPool)
+        using PipelinePtr = SR_HTYPES_NS::SharedPtr<Pipeline>;
+    public:
+        using AllocationId = int32_t;
+
+        static constexpr uint64_t VERTEX_PAGE_SIZE = 16ULL * 1024 * 1024;
+        static constexpr uint64_t INDEX_PAGE_SIZE = 8ULL * 1024 * 1024;
+
+        struct Statistics {
+            uint64_t reservedBytes = 0;
+            uint64_t usedBytes = 0;
+            uint64_t uploadedBytes = 0;
+            uint32_t pages = 0;
+            uint32_t allocations = 0;
+            uint32_t freeBlocks = 0;
+        };
+
+    private:
+        struct Page {
+            int32_t buffer = SR_ID_INVALID;
+            /// Размеры в элементах: вершинах или индексах
+            uint32_t capacity = 0;
+            uint32_t used = 0;
+            /// Копия содержимого буфера, измененные участки загружаются в Flush
+            std::vector<uint8_t> shadow;
+            /// Измененные участки в байтах, begin -> end, соседние сливаются
+            std::map<uint64_t, uint64_t> dirtyRanges;
+            /// offset -> count
+            std::map<uint32_t, uint32_t> freeBlocks;
+            /// (count, offset)
+            std::set<std::pair<uint32_t, uint32_t>> freeBySize;
+        };
+
+        struct Heap {
+            Memory::MeshMemoryType memoryType = Memory::MeshMemoryType::Unknown;
+            Vertices::VertexType vertexType = Vertices::VertexType::Unknown;
+            uint32_t stride = 0;
+            std::vector<Page> pages;
+        };
+
+        struct Allocation {
+            uint32_t heap = 0;
+            uint32_t page = 0;
+            uint32_t offset = 0;
+            uint32_t count = 0;
+        };
+
+        struct PendingBlock {
+            Allocation allocation;
+            uint64_t frame = 0;
+        };
+
+        struct RetiredPage {
+            uint32_t heap = 0;
+            uint32_t page = 0;
+            uint64_t frame = 0;
+        };
+
+    public:
+        void SetPipeline(PipelinePtr pipeline);
+
+        SR_NODISCARD bool IsEnabled() const noexcept { return m_enabled; }
+
+        SR_NODISCARD AllocationId AllocateVertices(Vertices::VertexType type, const void* pData, uint32_t count);
+        SR_NODISCARD AllocationId AllocateIndices(const uint32_t* pData, uint32_t count);
+        bool Free(AllocationId id);
+
+        /// Идентификатор VBO/IBO страницы, в которой лежит участок
+        SR_NODISCARD int32_t GetBuffer(AllocationId id) const;
+        /// Смещение участка в элементах
+        SR_NODISCARD uint32_t GetOffset(AllocationId id) const;
+        /// Содержимое участка побайтово совпадает с pData, сравнение идет по копии страницы
+        SR_NODISCARD bool IsEqual(AllocationId id, const void* pData, uint64_t size) const;
+
+        /// Загружает в видеопамять измененные страницы, вызывается перед отправкой кадра
+        void Flush();
+        /// Возвращает в оборот участки, которые больше не читают кадры в полете
+        void NextFrame(uint32_t framesInFlight);
+        /// Переносит живые участки фрагментированных страниц плотно в новые страницы. Вернет true, если смещения изменились
+        bool Compact(float_t fragmentationThreshold);
+        void Clear();
+
+        SR_NODISCARD Statistics GetStatistics() const;
+
+    private:
+        SR_NODISCARD AllocationId Allocate(uint32_t heapIndex, const void* pData, uint32_t count);
+        SR_NODISCARD uint32_t GetHeap(Memory::MeshMemoryType memoryType, Vertices::VertexType vertexType);
+
+        SR_NODISCARD bool CreatePage(uint32_t heapIndex, uint32_t minCount, uint32_t& pageIndex);
+        void FreePage(const Heap& heap, Page& page);
+
+        SR_NODISCARD static bool TakeBlock(Page& page, uint32_t count, uint32_t& offset);
+        static void ReleaseBlock(Page& page, uint32_t offset, uint32_t count);
+        static void InsertFreeBlock(Page& page, uint32_t offset, uint32_t count);
+        static void EraseFreeBlock(Page& page, std::map<uint32_t, uint32_t>::iterator pIt);
+        static void MarkDirty(Page& page, uint64_t begin, uint64_t end);
+
+    private:
+        mutable std::recursive_mutex m_mutex;
+
+        PipelinePtr m_pipeline;
+
+        std::vector<Heap> m_heaps;
+        SR_HTYPES_NS::ObjectPool<Allocation, AllocationId> m_allocations;
+        std::vector<PendingBlock> m_pendingBlocks;
+        /// Страницы, из которых участки перенесены при сжатии, но которые еще читают кадры в полете
+        std::vector<RetiredPage> m_retiredPages;
+
+        uint64_t m_frame = 0;
+        uint64_t m_uploadedBytes = 0;
+
+        bool m_enabled = false;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_GEOMETRY_POOL_H
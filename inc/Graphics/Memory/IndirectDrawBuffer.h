@@ -0,0 +1,74 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_INDIRECT_DRAW_BUFFER_H
+#define SR_ENGINE_GRAPHICS_INDIRECT_DRAW_BUFFER_H
+
+#include <Utils/Common/NonCopyable.h>
+
+namespace SR_GRAPH_NS {
+    class Pipeline;
+}
+
+namespace SR_GRAPH_NS::Memory {
+    /// Раскладка совпадает с VkDrawIndexedIndirectCommand
+    struct DrawIndexedCommand {
+        uint32_t indicesCount = 0;
+        uint32_t instancesCount = 0;
+        uint32_t firstIndex = 0;
+        int32_t vertexOffset = 0;
+        uint32_t firstInstance = 0;
+
+        SR_NODISCARD bool operator==(const DrawIndexedCommand& other) const noexcept {
+            return indicesCount == other.indicesCount && instancesCount == other.instancesCount
+                && firstIndex == other.firstIndex && vertexOffset == other.vertexOffset && firstInstance == other.firstInstance;
+        }
+    };
+
+    /**
+     * Параметры отрисовок, которые меняются каждый кадр без перезаписи командных буферов.
+     * В команды попадает только ссылка на слот буфера, а содержимое слота обновляется перед отправкой кадра.
+     * Буфер лежит в памяти, видимой процессору, и обновляется на месте, так же как буферы юниформ.
+     */
+    class IndirectDrawBuffer : public SR_UTILS_NS::NonCopyable {
+    public:
+        static constexpr uint32_t STRIDE = sizeof(DrawIndexedCommand);
+        static constexpr uint32_t MIN_CAPACITY = 64;
+
+    public:
+        ~IndirectDrawBuffer() override;
+
+    public:
+        void SetPipeline(Pipeline* pPipeline) noexcept { m_pipeline = pPipeline; }
+
+        /// Место под count слотов. При росте старый буфер освобождается, когда его перестанут читать кадры в полете
+        bool Reserve(uint32_t count, uint64_t frame);
+        void Set(uint32_t slot, const DrawIndexedCommand& command);
+
+        /// Загружает измененные слоты и освобождает отложенные буферы
+        void Flush(uint64_t frame, uint32_t framesInFlight);
+        void Free();
+
+        SR_NODISCARD int32_t GetBuffer() const noexcept { return m_buffer; }
+        SR_NODISCARD static uint32_t GetOffset(uint32_t slot) noexcept { return slot * STRIDE; }
+
+    private:
+        struct RetiredBuffer {
+            int32_t buffer = SR_ID_INVALID;
+            uint64_t frame = 0;
+        };
+
+    private:
+        Pipeline* m_pipeline = nullptr;
+
+        int32_t m_buffer = SR_ID_INVALID;
+        std::vector<DrawIndexedCommand> m_commands;
+        std::vector<RetiredBuffer> m_retired;
+
+        bool m_dirty = false;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_INDIRECT_DRAW_BUFFER_H
@@ -0,0 +1,112 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_MEMORY_BUDGET_H
+#define SR_ENGINE_GRAPHICS_MEMORY_BUDGET_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/Types/Function.h>
+
+namespace SR_GRAPH_NS::Memory {
+    SR_ENUM_NS_CLASS_T(MemoryCategory, uint8_t,
+       UBO,
+       VBO,
+       IBO,
+       SSBO,
+       Texture,
+       FBO,
+       Unknown
+    );
+
+    SR_ENUM_NS_CLASS_T(MemoryHeap, uint8_t,
+       Device,
+       Host,
+       Unknown
+    );
+
+    SR_ENUM_NS_CLASS_T(MemoryBudgetState, uint8_t,
+       Normal,
+       Soft,
+       Hard
+    );
+
+    /**
+     * Учет видеопамяти по категориям пулов и кучам.
+     * Размеры выделений учитываются на стороне процессора, а занятость и бюджет куч сообщает API, если оно это умеет.
+     * Без данных от API (например, без устройства) учет сам служит занятостью куч, а бюджет задается вручную.
+     * При пересечении мягкого и жесткого порога вызываются обработчики, повторно - только после возврата под порог.
+     */
+    class MemoryBudget : public SR_UTILS_NS::NonCopyable {
+        static constexpr uint8_t CATEGORIES_COUNT = static_cast<uint8_t>(MemoryCategory::Unknown);
+        static constexpr uint8_t HEAPS_COUNT = static_cast<uint8_t>(MemoryHeap::Unknown);
+    public:
+        struct HeapInfo {
+            /// Сколько памяти кучи занято процессом
+            uint64_t usage = 0;
+            /// Сколько памяти процесс может занять, 0 - без ограничения
+            uint64_t budget = 0;
+            /// Выделено блоками аллокатора и занято в них ресурсами. Разница - свободное место в блоках
+            uint64_t blockBytes = 0;
+            uint64_t allocationBytes = 0;
+        };
+
+        using Callback = SR_HTYPES_NS::Function<void(MemoryHeap heap, const HeapInfo& info)>;
+
+    private:
+        struct Allocation {
+            MemoryHeap heap = MemoryHeap::Unknown;
+            uint64_t bytes = 0;
+        };
+
+    public:
+        /// Повторное выделение с тем же идентификатором заменяет прошлую запись, например при пересоздании кадрового буфера
+        void OnAllocated(MemoryCategory category, MemoryHeap heap, int32_t id, uint64_t bytes);
+        void OnFreed(MemoryCategory category, int32_t id);
+        void Clear();
+
+        /// Данные API о куче, заменяют учет на стороне процессора
+        void SetHeapInfo(MemoryHeap heap, const HeapInfo& info);
+        /// Бюджет кучи, если API его не сообщает
+        void SetFallbackBudget(MemoryHeap heap, uint64_t bytes);
+        /// Наибольший непрерывный свободный участок в блоках аллокатора
+        void SetLargestFreeRange(MemoryHeap heap, uint64_t bytes);
+
+        void SetLimits(float_t soft, float_t hard);
+        void SetSoftCallback(Callback callback) { m_softCallback = std::move(callback); }
+        void SetHardCallback(Callback callback) { m_hardCallback = std::move(callback); }
+
+        /// Проверяет пороги, вызывается раз в кадр
+        void Update();
+
+        SR_NODISCARD uint64_t GetBytes(MemoryCategory category) const;
+        SR_NODISCARD uint64_t GetBytes(MemoryCategory category, MemoryHeap heap) const;
+        SR_NODISCARD uint32_t GetCount(MemoryCategory category) const;
+        SR_NODISCARD HeapInfo GetHeapInfo(MemoryHeap heap) const;
+        /// Доля свободного места в блоках, которая не входит в наибольший свободный участок.
+        /// Незанятый хвост блока - один участок, поэтому сам по себе фрагментацией не считается
+        SR_NODISCARD float_t GetFragmentation(MemoryHeap heap) const;
+        SR_NODISCARD MemoryBudgetState GetState(MemoryHeap heap) const;
+
+    private:
+        mutable std::mutex m_mutex;
+
+        std::array<ska::flat_hash_map<int32_t, Allocation>, CATEGORIES_COUNT> m_allocations;
+        std::array<std::array<uint64_t, HEAPS_COUNT>, CATEGORIES_COUNT> m_bytes = { };
+
+        std::array<std::optional<HeapInfo>, HEAPS_COUNT> m_reported;
+        std::array<uint64_t, HEAPS_COUNT> m_fallbackBudget = { };
+        std::array<std::optional<uint64_t>, HEAPS_COUNT> m_largestFreeRange;
+        std::array<MemoryBudgetState, HEAPS_COUNT> m_states = { };
+
+        float_t m_softLimit = 0.8f;
+        float_t m_hardLimit = 0.95f;
+
+        Callback m_softCallback;
+        Callback m_hardCallback;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_MEMORY_BUDGET_H
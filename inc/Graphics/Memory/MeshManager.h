@@ -21,144 +21,175 @@ namespace SR_GRAPH_NS {
             Unknown, VBO, IBO
         };
 
-        class MeshVidMemInfo {
-            friend class MeshManager;
-        public:
-            MeshVidMemInfo() = default;
-
-            explicit MeshVidMemInfo(uint32_t size, uint32_t id, MeshMemoryType type)
-                : m_vidId(id)
-                , m_usages(1)
-                , m_size(size)
-                , m_type(type)
-            { }
-
-        public:
-            SR_NODISCARD uint32_t Copy();
-            SR_NODISCARD uint32_t Size() { return m_size; }
-
-            SR_NODISCARD uint32_t GetUsages() const noexcept { return m_usages; }
-
-        private:
-            uint32_t m_vidId = SR_UINT32_MAX;
-            uint32_t m_usages = 0;
-            uint32_t m_size = 0;
-            MeshMemoryType m_type = MeshMemoryType::Unknown;
-
-        };
-
+        /**
+         * Общие буферы геометрии.
+         * Буфер ищется по 64-битному хэшу содержимого вместе с форматом вершин, поэтому одинаковая геометрия,
+         * загруженная под разными именами, лежит в памяти один раз. Совпадение хэша проверяет вызывающий,
+         * сравнивая байты, а буфер без ключа содержимого доступен только по псевдониму.
+         * Имя меша хранится как псевдоним буфера, чтобы повторная загрузка того же меша не строила вершины заново.
+         * Поиск не берет блокировок, число использований меняется атомарно.
+         * Регистрация и освобождение выполняются последовательно, таблицы и слоты растут по мере надобности.
+         */
         class MeshManager : public SR_UTILS_NS::Singleton<MeshManager> {
             SR_REGISTER_SINGLETON(MeshManager)
-            using Hash = uint64_t;
-            using HashTable = std::vector<uint64_t>;
         public:
-            typedef std::unordered_map<Hash, MeshVidMemInfo> VideoResources;
-            typedef std::optional<VideoResources::iterator> VideoResourcesIter;
+            using Hash = uint64_t;
+            /// Поколение слота в старших 32 битах, идентификатор буфера в младших
+            using Handle = uint64_t;
+
+            /// Слоты выделяются блоками, которые не перемещаются, поэтому читатели обходятся без блокировок
+            static constexpr uint32_t SLOT_CHUNK_SIZE = 4096;
+            static constexpr uint32_t MAX_SLOT_CHUNKS = 4096;
+            static constexpr uint32_t MAX_BUFFER_ID = SLOT_CHUNK_SIZE * MAX_SLOT_CHUNKS - 1;
 
             enum class FreeResult {
                 Unknown, Freed, EndUse, NotFound, UnknownMem
             };
 
         private:
-            MeshManager();
-            ~MeshManager() override = default;
+            /**
+             * Открытая адресация. Читатели не блокируются, писатели сериализуются m_mutex.
+             * При заполнении или накоплении удаленных записей таблица пересобирается в новый массив,
+             * старый освобождается, когда в таблице нет ни одного читателя.
+             */
+            class HashTable {
+                static constexpr Hash EMPTY = 0;
+                static constexpr Hash TOMBSTONE = 1;
+
+                static constexpr uint32_t INITIAL_CAPACITY = 4096;
+
+                struct Entry {
+                    std::atomic<Hash> key { EMPTY };
+                    std::atomic<uint64_t> value { 0 };
+                };
+
+                struct Table {
+                    explicit Table(uint32_t capacity)
+                        : capacity(capacity)
+                        , entries(std::make_unique<Entry[]>(capacity))
+                    { }
+
+                    uint32_t capacity = 0;
+                    std::unique_ptr<Entry[]> entries;
+                };
+
+            public:
+                HashTable();
+
+            public:
+                SR_NODISCARD bool Find(Hash key, uint64_t& value) const;
+                bool Insert(Hash key, uint64_t value);
+                /// Удалит ключ, только если он указывает на value
+                void Erase(Hash key, uint64_t value);
+                void Clear();
+
+                SR_NODISCARD static Hash Normalize(Hash key) noexcept { return key <= TOMBSTONE ? key + 2 : key; }
+
+            private:
+                void Rehash(uint32_t capacity);
+                void FreeRetiredTables();
+
+            private:
+                std::atomic<Table*> m_table { nullptr };
+                mutable std::atomic<uint32_t> m_readers { 0 };
+                /// Текущая таблица и пересобранные, которые еще могут читать
+                std::vector<std::unique_ptr<Table>> m_tables;
+
+                uint32_t m_count = 0;
+                uint32_t m_tombstones = 0;
 
-        private:
-            VideoResourcesIter FindById(int32_t id, MeshMemoryType memType);
-            VideoResourcesIter FindImpl(Hash hash, MeshMemoryType memType);
+            };
 
-            bool RegisterImpl(const std::string& identifier, MeshMemoryType memType, uint32_t size, uint32_t id);
-            FreeResult FreeImpl(VideoResourcesIter iter, MeshMemoryType memType);
+            struct Slot {
+                /// (поколение << 32) | число использований
+                std::atomic<uint64_t> state { 0 };
+                std::atomic<uint32_t> size { 0 };
+                /// Изменяются только под m_mutex. 0 - буфер не ищется по содержимому
+                Hash key = 0;
+                std::vector<Hash> aliases;
+            };
 
-            void OnSingletonDestroy() override;
+            struct Storage {
+                Storage();
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> VideoResourcesIter Find(const std::string& identifier) {
-                if constexpr (memType == MeshMemoryType::VBO) {
-                    const Hash hash = SR_HASH_STR(identifier + SR_UTILS_NS::EnumReflector::ToStringAtom<Vertices::VertexType>(vertexType).ToStringRef());
-                    return FindImpl(hash, memType);
-                }
+                HashTable buffers;
+                /// Псевдоним -> дескриптор буфера
+                HashTable aliases;
+                std::unique_ptr<std::atomic<Slot*>[]> chunks;
+                /// Владеют блоками слотов, изменяются только под m_mutex
+                std::vector<std::unique_ptr<Slot[]>> ownedChunks;
+                uint32_t count = 0;
+            };
 
-                if constexpr (memType == MeshMemoryType::IBO) {
-                    const Hash hash = SR_HASH_STR(identifier);
-                    return FindImpl(hash, memType);
-                }
+        private:
+            MeshManager();
+            ~MeshManager() override = default;
 
-                SRHalt("Unknown memory type!");
+        public:
+            SR_NODISCARD static Hash HashContent(const void* pData, uint64_t size, Vertices::VertexType vertexType);
+            SR_NODISCARD static Hash HashIdentifier(const std::string& identifier, Vertices::VertexType vertexType);
 
-                return std::nullopt;
+            /// Вернет идентификатор буфера с таким хэшем содержимого и увеличит число его использований.
+            /// Хэш может совпасть у разной геометрии, перед использованием буфера байты нужно сравнить
+            template<MeshMemoryType memType> SR_NODISCARD int32_t CopyIfExists(Hash key) {
+                return CopyImpl(GetStorage<memType>(), key, false);
             }
 
-        public:
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> bool Register(const std::string_view& identifier, uint32_t size, uint32_t id) {
-                return Register<vertexType, memType>(std::string(identifier), size, id);
+            /// То же по псевдониму, без построения геометрии
+            template<MeshMemoryType memType> SR_NODISCARD int32_t CopyByAlias(Hash alias) {
+                return CopyImpl(GetStorage<memType>(), alias, true);
             }
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> bool Register(const std::string& identifier, uint32_t size, uint32_t id) {
-                SR_TRACY_ZONE;
-                SR_LOCK_GUARD;
+            template<MeshMemoryType memType> SR_NODISCARD uint32_t Size(int32_t id) const {
+                return SizeImpl(GetStorage<memType>(), id);
+            }
 
-                if (Find<vertexType, memType>(identifier).has_value()) {
-                    SRHalt("MeshManager::Register() : memory already registered!");
-                    return false;
-                }
+            /// key == 0 - буфер доступен только по псевдониму
+            template<MeshMemoryType memType> bool Register(Hash key, Hash alias, uint32_t size, int32_t id) {
+                return RegisterImpl(GetStorage<memType>(), key, alias, size, id);
+            }
 
-                if constexpr (memType == MeshMemoryType::VBO) {
-                    return RegisterImpl(identifier + SR_UTILS_NS::EnumReflector::ToStringAtom(vertexType).ToStringRef(), memType, size, id);
-                }
-                else
-                    return RegisterImpl(identifier, memType, size, id);
+            /// Связывает имя меша с уже загруженной одинаковой геометрией
+            template<MeshMemoryType memType> void AddAlias(Hash key, Hash alias) {
+                AddAliasImpl(GetStorage<memType>(), key, alias);
             }
 
             template<MeshMemoryType memType> FreeResult Free(int32_t id) {
-                SR_TRACY_ZONE;
-                SR_LOCK_GUARD;
-
-                if (auto iter = FindById(id, memType); !iter.has_value()) {
-                    SRHalt("Memory isn't registered!");
-                    return FreeResult::NotFound;
-                }
-                else {
-                    return FreeImpl(iter, memType);
-                }
+                return FreeImpl(GetStorage<memType>(), id);
             }
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> int32_t CopyIfExists(const std::string& identifier) {
-                SR_LOCK_GUARD;
-                SR_TRACY_ZONE;
-
-                if (auto memory = Find<vertexType, memType>(identifier); memory.has_value()) {
-                    return memory.value()->second.Copy();
-                }
-
-                return SR_ID_INVALID;
+        private:
+            template<MeshMemoryType memType> SR_NODISCARD Storage& GetStorage() {
+                static_assert(memType == MeshMemoryType::VBO || memType == MeshMemoryType::IBO, "Unknown memory type!");
+                return memType == MeshMemoryType::VBO ? m_VBOs : m_IBOs;
             }
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> uint32_t Size(const std::string& identifier) {
-                SR_LOCK_GUARD;
-
-                if (auto memory = Find<vertexType, memType>(std::string(identifier)); memory.has_value()) {
-                    return memory.value()->second.Size();
-                }
-
-                return 0;
+            template<MeshMemoryType memType> SR_NODISCARD const Storage& GetStorage() const {
+                static_assert(memType == MeshMemoryType::VBO || memType == MeshMemoryType::IBO, "Unknown memory type!");
+                return memType == MeshMemoryType::VBO ? m_VBOs : m_IBOs;
             }
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> int32_t CopyIfExists(const std::string_view& identifier) {
-                SR_LOCK_GUARD;
+            SR_NODISCARD int32_t CopyImpl(Storage& storage, Hash key, bool isAlias);
+            SR_NODISCARD uint32_t SizeImpl(const Storage& storage, int32_t id) const;
+            bool RegisterImpl(Storage& storage, Hash key, Hash alias, uint32_t size, int32_t id);
+            void AddAliasImpl(Storage& storage, Hash key, Hash alias);
+            /// Вызывается под m_mutex
+            void InsertAlias(Storage& storage, Handle handle, Hash alias);
+            FreeResult FreeImpl(Storage& storage, int32_t id);
 
-                if (auto memory = Find<vertexType, memType>(std::string(identifier)); memory.has_value()) {
-                    return memory.value()->second.Copy();
-                }
+            SR_NODISCARD static Slot* GetSlot(const Storage& storage, uint32_t id);
+            /// Вызывается под m_mutex, выделяет блок слота при необходимости
+            SR_NODISCARD static Slot* GetOrCreateSlot(Storage& storage, uint32_t id);
+            SR_NODISCARD static bool AcquireHandle(Storage& storage, Handle handle);
+            static void ClearStorage(Storage& storage);
 
-                return SR_ID_INVALID;
-            }
+            void OnSingletonDestroy() override;
 
         private:
-            VideoResources m_IBOs;
-            VideoResources m_VBOs;
+            std::mutex m_mutex;
 
-            HashTable m_IBOTable;
-            HashTable m_VBOTable;
+            Storage m_IBOs;
+            Storage m_VBOs;
 
         };
     }
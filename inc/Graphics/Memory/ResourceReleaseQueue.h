@@ -0,0 +1,90 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_RESOURCE_RELEASE_QUEUE_H
+#define SR_ENGINE_GRAPHICS_RESOURCE_RELEASE_QUEUE_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/Types/Function.h>
+
+namespace SR_UTILS_NS {
+    class IResource;
+}
+
+namespace SR_GRAPH_NS {
+    SR_ENUM_NS_CLASS_T(RCResourceType, uint8_t,
+       Framebuffer,
+       Shader,
+       Texture,
+       Technique,
+       Material,
+       Skybox,
+       Unknown
+    );
+}
+
+namespace SR_GRAPH_NS::Memory {
+    class IGraphicsResource;
+
+    /**
+     * Очередь отложенного освобождения контекстных ресурсов.
+     * Ресурс попадает в очередь в момент, когда у него остается только точка использования контекста,
+     * и помечается номером кадра. Видеопамять освобождается пачкой, когда этот кадр перестанут читать кадры в полете,
+     * поэтому контексту не нужно каждый кадр обходить все ресурсы.
+     */
+    class ResourceReleaseQueue : public SR_UTILS_NS::NonCopyable {
+        static constexpr uint8_t TYPES_COUNT = static_cast<uint8_t>(RCResourceType::Unknown);
+    public:
+        struct Candidate {
+            void* pResource = nullptr;
+            RCResourceType type = RCResourceType::Unknown;
+        };
+
+        struct Entry {
+            /// Указатель того типа, в списке которого ресурс лежал в контексте
+            void* pRenderResource = nullptr;
+            /// Может отсутствовать, например у материала
+            IGraphicsResource* pGraphicsResource = nullptr;
+            SR_UTILS_NS::IResource* pResource = nullptr;
+            RCResourceType type = RCResourceType::Unknown;
+            uint64_t frame = 0;
+        };
+
+        /// Вернет false, если ресурс снова начали использовать и он не был освобожден
+        using ReleaseFn = SR_HTYPES_NS::Function<bool(const Entry&)>;
+
+    public:
+        /// Можно вызывать из любого потока, ресурс будет проверен контекстом при следующем обновлении
+        void Schedule(void* pResource, RCResourceType type);
+        SR_NODISCARD std::vector<Candidate> TakeScheduled();
+
+        void Push(void* pRenderResource, IGraphicsResource* pGraphicsResource, SR_UTILS_NS::IResource* pResource, RCResourceType type);
+
+        /// При framesInFlight == 0 освобождает все ресурсы, не дожидаясь кадров. Вернет число обработанных ресурсов
+        uint32_t Release(uint32_t framesInFlight, const ReleaseFn& release);
+
+        void NextFrame() noexcept { ++m_frame; }
+
+        SR_NODISCARD bool IsEmpty() const noexcept { return m_pending.empty(); }
+        SR_NODISCARD uint64_t GetFrame() const noexcept { return m_frame; }
+        SR_NODISCARD uint32_t GetPendingCount(RCResourceType type) const noexcept;
+        SR_NODISCARD uint64_t GetFreedCount(RCResourceType type) const noexcept;
+
+    private:
+        std::mutex m_mutex;
+        std::vector<Candidate> m_scheduled;
+
+        /// Упорядочены по номеру кадра
+        std::vector<Entry> m_pending;
+
+        std::array<uint32_t, TYPES_COUNT> m_pendingCount = { };
+        std::array<uint64_t, TYPES_COUNT> m_freedCount = { };
+
+        uint64_t m_frame = 0;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_RESOURCE_RELEASE_QUEUE_H
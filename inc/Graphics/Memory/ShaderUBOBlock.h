@@ -24,6 +24,12 @@ namespace SR_GRAPH_NS::Memory {
             bool hidden;
         };
 
+    public:
+        struct FieldLocation {
+            uint32_t offset = 0;
+            uint32_t size = 0;
+        };
+
     public:
         ~ShaderUBOBlock() override;
 
@@ -35,8 +41,11 @@ namespace SR_GRAPH_NS::Memory {
 
         void SR_FASTCALL SetField(uint64_t hashId, const void* data) noexcept;
         void SR_FASTCALL SetField(uint64_t hashId, const ShaderPropertyVariant& property) noexcept;
+        void SR_FASTCALL SetRange(uint32_t offset, const void* pData, uint32_t size) noexcept;
 
         SR_NODISCARD bool HasField(uint64_t hashId) const noexcept;
+        SR_NODISCARD bool FindField(uint64_t hashId, FieldLocation& location) const noexcept;
+        SR_NODISCARD uint32_t GetSize() const noexcept { return m_size; }
 
         SR_NODISCARD uint32_t GetBinding() const { return m_binding; }
         SR_NODISCARD bool Valid() const noexcept { return m_binding != SR_ID_INVALID; }
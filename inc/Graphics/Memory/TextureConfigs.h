@@ -17,7 +17,9 @@ namespace SR_GRAPH_NS::Memory {
             TextureCompression compression,
             uint32_t mipLevels,
             SR_UTILS_NS::BoolExt alpha,
-            bool cpuUsage
+            bool cpuUsage,
+            MipFilter mipFilter = MipFilter::Box,
+            bool normalMap = false
         )
             : m_format(format)
             , m_filter(filter)
@@ -25,6 +27,8 @@ namespace SR_GRAPH_NS::Memory {
             , m_mipLevels(mipLevels)
             , m_alpha(alpha)
             , m_cpuUsage(cpuUsage)
+            , m_mipFilter(mipFilter)
+            , m_normalMap(normalMap)
         { }
 
         TextureConfig()
@@ -34,14 +38,31 @@ namespace SR_GRAPH_NS::Memory {
             , m_mipLevels(1)
             , m_alpha(SR_UTILS_NS::BoolExt::None)
             , m_cpuUsage(false)
+            , m_mipFilter(MipFilter::Box)
+            , m_normalMap(false)
         { }
 
+        /// Мип-цепочка строится на процессоре, если текстуре нужны мип-уровни
+        SR_NODISCARD bool IsMipChainRequired() const noexcept {
+            return m_mipLevels != 1 && !m_cpuUsage;
+        }
+
+        SR_NODISCARD MipChainInfo GetMipChainInfo() const noexcept {
+            return MipChainInfo {
+                .filter = m_mipFilter,
+                .sRGB = m_format == ImageFormat::RGBA8_SRGB || m_format == ImageFormat::RGB8_SRGB,
+                .normalMap = m_normalMap,
+            };
+        }
+
         ImageFormat m_format;
         TextureFilter m_filter;
         TextureCompression m_compression;
         uint32_t m_mipLevels;
         SR_UTILS_NS::BoolExt m_alpha;
         bool m_cpuUsage;
+        MipFilter m_mipFilter;
+        bool m_normalMap;
 
         bool operator==(const TextureConfig& lrs) const {
             return m_format == lrs.m_format
@@ -49,7 +70,9 @@ namespace SR_GRAPH_NS::Memory {
                    && m_compression == lrs.m_compression
                    && m_mipLevels == lrs.m_mipLevels
                    && (m_alpha == lrs.m_alpha || m_alpha == SR_UTILS_NS::BoolExt::None || lrs.m_alpha == SR_UTILS_NS::BoolExt::None)
-                   && m_cpuUsage == lrs.m_cpuUsage;
+                   && m_cpuUsage == lrs.m_cpuUsage
+                   && m_mipFilter == lrs.m_mipFilter
+                   && m_normalMap == lrs.m_normalMap;
         }
 
         bool operator!=(const TextureConfig& lrs) const {
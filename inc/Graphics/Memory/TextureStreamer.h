@@ -0,0 +1,165 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_TEXTURE_STREAMER_H
+#define SR_ENGINE_GRAPHICS_TEXTURE_STREAMER_H
+
+#include <Utils/Common/Singleton.h>
+#include <Utils/Types/SharedPtr.h>
+
+#include <Graphics/Loaders/TextureLoader.h>
+
+namespace SR_GTYPES_NS {
+    class Texture;
+}
+
+namespace SR_GRAPH_NS {
+    class Pipeline;
+
+    /**
+     * Асинхронная загрузка текстур.
+     * Декодирование выполняется рабочими потоками, первой загружается заглушка. Более крупный уровень
+     * догружается только до размера текстуры на экране и только в пределах бюджета видеопамяти,
+     * он строится из сохраненной декодированной цепочки без повторного чтения файла.
+     * При превышении бюджета давно не использованные текстуры опускаются обратно до заглушки.
+     */
+    class TextureStreamer : public SR_UTILS_NS::Singleton<TextureStreamer> {
+        SR_REGISTER_SINGLETON(TextureStreamer)
+        using TexturePtr = SR_GTYPES_NS::Texture*;
+        using PipelinePtr = SR_HTYPES_NS::SharedPtr<Pipeline>;
+    public:
+        /// Максимальная сторона заглушки в пикселях
+        static constexpr uint32_t PLACEHOLDER_SIZE = 64;
+        /// Сколько кадров текстура считается используемой после последнего обращения
+        static constexpr uint64_t STALE_FRAMES = 300;
+
+        struct Statistics {
+            uint64_t residentBytes = 0;
+            uint64_t uploadedBytes = 0;
+            uint64_t decodedBytes = 0;
+            uint32_t textures = 0;
+            uint32_t pending = 0;
+            uint32_t promotions = 0;
+            uint32_t demotions = 0;
+        };
+
+    private:
+        /// Уровень задания, по которому строится заглушка
+        static constexpr uint8_t PLACEHOLDER_LEVEL = UINT8_MAX;
+
+        struct Job {
+            TexturePtr pTexture = nullptr;
+            uint64_t ticket = 0;
+            SR_UTILS_NS::Path path;
+            Memory::TextureConfig config;
+            /// Декодированная цепочка, если ее нет - файл читается заново
+            TextureData::Ptr pSource;
+            uint8_t level = 0;
+        };
+
+        struct Result {
+            TexturePtr pTexture = nullptr;
+            uint64_t ticket = 0;
+            uint8_t level = 0;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            TextureData::Ptr pData;
+            /// Заполняется, только если задание читало файл
+            TextureData::Ptr pDecoded;
+            bool isPlaceholder = false;
+        };
+
+        struct Record {
+            SR_UTILS_NS::Path path;
+            uint64_t ticket = 0;
+            uint64_t lastUseFrame = 0;
+            /// Кадр, в котором очереди отрисовки последний раз сообщили размер на экране
+            uint64_t coverageFrame = 0;
+            uint64_t residentBytes = 0;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            TextureData::Ptr pDecoded;
+            TextureData::Ptr pPlaceholder;
+            TextureData::Ptr pPendingData;
+            uint8_t pendingLevel = 0;
+            uint8_t placeholderLevel = 0;
+            uint8_t residentLevel = UINT8_MAX;
+            uint8_t desiredLevel = 0;
+            bool inFlight = false;
+        };
+
+        struct RetiredTexture {
+            int32_t id = SR_ID_INVALID;
+            uint64_t frame = 0;
+        };
+
+    public:
+        SR_NODISCARD bool IsEnabled() const noexcept { return m_enabled; }
+
+        void Start(PipelinePtr pipeline);
+        void Stop();
+
+        /// Вызывается из потока рендера раз в кадр
+        void Update();
+
+        bool Register(TexturePtr pTexture, const SR_UTILS_NS::Path& path);
+        void Unregister(TexturePtr pTexture);
+        void OnFreeVideoMemory(TexturePtr pTexture);
+
+        /// Отмечает использование текстуры. pixels - наибольший размер на экране за кадр,
+        /// 0 - размер неизвестен, тогда остается уровень, оцененный очередями отрисовки
+        void Touch(TexturePtr pTexture, uint32_t pixels = 0);
+
+        void SetBudget(uint64_t bytes) noexcept { m_budget = bytes; }
+        void SetUploadBudget(uint64_t bytesPerFrame) noexcept { m_uploadBudget = bytesPerFrame; }
+        void SetPlaceholderTexture(int32_t textureId) noexcept { m_placeholderTexture = textureId; }
+
+        SR_NODISCARD int32_t GetPlaceholderTexture() const noexcept { return m_placeholderTexture; }
+        SR_NODISCARD Statistics GetStatistics() const;
+
+    private:
+        void WorkerThread();
+        void Enqueue(TexturePtr pTexture, Record& record, uint8_t level);
+        bool Upload(TexturePtr pTexture, Record& record, const TextureData::Ptr& pData, uint8_t level);
+        /// Опускает давно не использованные текстуры до заглушки, пока занятая память больше budget
+        bool EnforceBudget(uint64_t budget);
+        /// Освобождает замененные образы, которые больше не читают кадры в полете
+        void FreeRetired(bool force);
+
+        SR_NODISCARD static TextureData::Ptr Downsample(const TextureData::Ptr& pData, uint8_t levels);
+        SR_NODISCARD static uint8_t CalculatePlaceholderLevel(uint32_t width, uint32_t height);
+        SR_NODISCARD static uint64_t CalculateBytes(uint32_t width, uint32_t height, uint32_t mipLevels);
+        SR_NODISCARD static uint8_t CalculateMipLevels(uint32_t width, uint32_t height, uint32_t mipLevels);
+
+    private:
+        PipelinePtr m_pipeline;
+
+        std::vector<std::thread> m_workers;
+        std::atomic<bool> m_isRunning = false;
+
+        std::mutex m_queueMutex;
+        std::condition_variable m_condition;
+        std::deque<Job> m_jobs;
+        std::vector<Result> m_results;
+
+        mutable std::recursive_mutex m_mutex;
+        std::unordered_map<TexturePtr, Record> m_records;
+        std::vector<RetiredTexture> m_retired;
+
+        std::atomic<uint64_t> m_frame = 0;
+        uint64_t m_nextTicket = 0;
+
+        uint64_t m_budget = 512ULL * 1024 * 1024;
+        uint64_t m_uploadBudget = 32ULL * 1024 * 1024;
+
+        int32_t m_placeholderTexture = SR_ID_INVALID;
+
+        bool m_enabled = false;
+
+        Statistics m_statistics;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_TEXTURE_STREAMER_H
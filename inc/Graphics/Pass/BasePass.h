@@ -102,6 +102,7 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD bool IsInit() const { return m_isInit; }
         SR_NODISCARD SR_UTILS_NS::StringAtom GetName() const;
         SR_NODISCARD BasePass* GetParent() const { return m_parent; }
+        SR_NODISCARD CameraPtr GetCamera() const noexcept { return m_camera; }
 
     protected:
         CameraPtr m_camera = nullptr;
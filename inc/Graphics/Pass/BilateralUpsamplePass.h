@@ -0,0 +1,42 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_BILATERAL_UPSAMPLE_PASS_H
+#define SR_ENGINE_GRAPHICS_BILATERAL_UPSAMPLE_PASS_H
+
+#include <Graphics/Pass/PostProcessPass.h>
+#include <Graphics/Pass/IFramebufferPass.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Восстановление SSAO пониженного разрешения до полного с учетом глубины.
+     * Шейдер берет четыре соседних texel'а уменьшенного буфера и взвешивает их по разнице
+     * уменьшенной глубины с глубиной пикселя полного разрешения (UPSAMPLE_DEPTH_SIGMA),
+     * так затенение не перетекает через границы объектов. Буфер прохода полного разрешения,
+     * коэффициент уменьшения берется из тех же Quality/ResolutionScale, что и у SSAOPass.
+     */
+    class BilateralUpsamplePass : public PostProcessPass, public IFramebufferPass {
+        SR_REGISTER_LOGICAL_NODE(BilateralUpsamplePass, Bilateral Upsample Pass, { "Passes" })
+        using Super = PostProcessPass;
+    public:
+        bool Load(const SR_XML_NS::Node& passNode) override;
+
+        bool Render() override;
+        void Update() override;
+
+        SR_NODISCARD std::vector<SR_GTYPES_NS::Framebuffer*> GetFrameBuffers() const override;
+
+    protected:
+        void RenderFrameBufferInner() override;
+
+        SR_NODISCARD IRenderTechnique* GetFrameBufferRenderTechnique() const override { return GetTechnique(); }
+
+    private:
+        uint32_t m_factor = 1;
+        float_t m_depthSigma = 0.05f;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_BILATERAL_UPSAMPLE_PASS_H
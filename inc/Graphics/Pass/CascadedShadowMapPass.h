@@ -19,7 +19,18 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD const std::vector<SR_MATH_NS::Matrix4x4>& GetCascadeMatrices() const { return m_cascadeMatrices; }
         SR_NODISCARD const std::vector<float_t>& GetSplitDepths() const { return m_cascadeSplitDepths; }
 
+        /// Юниформы, нужные проходам, которые принимают тени этого прохода
+        virtual void UseReceiverUniforms(SR_GTYPES_NS::Shader* pShader) const;
+
+        /// Заслонитель проверяется вместе с тенью, протянутой от него вдоль света
+        SR_NODISCARD bool IsOccluded(const SR_MATH_NS::FVector3& center, float_t radius) const override;
+
     protected:
+        /// тени допускают более грубую геометрию
+        SR_NODISCARD int32_t GetDefaultLodBias() const noexcept override { return 1; }
+        /// каскады видят геометрию вне пирамиды камеры
+        SR_NODISCARD bool IsClusterCullingByDefault() const noexcept override { return false; }
+
         void UseConstants(ShaderUseInfo info) override;
         void UseUniforms(ShaderUseInfo info, MeshPtr pMesh) override;
         void UseSharedUniforms(ShaderUseInfo info) override;
@@ -37,6 +48,8 @@ namespace SR_GRAPH_NS {
         float_t m_far = 0.f;
 
         float_t m_cascadeSplitLambda = 0.95f;
+        /// Как далеко от заслонителя может лечь видимая тень
+        float_t m_occlusionShadowDistance = 10.f;
 
         bool m_usePerspective = false;
 
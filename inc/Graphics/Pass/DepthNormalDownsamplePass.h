@@ -0,0 +1,40 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_DEPTH_NORMAL_DOWNSAMPLE_PASS_H
+#define SR_ENGINE_GRAPHICS_DEPTH_NORMAL_DOWNSAMPLE_PASS_H
+
+#include <Graphics/Pass/PostProcessPass.h>
+#include <Graphics/Pass/IFramebufferPass.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Уменьшенные глубина и нормали для SSAO пониженного разрешения.
+     * Размер буфера задается тем же Quality/ResolutionScale, что и у SSAOPass, поэтому буферы совпадают.
+     * Шейдер выбирает из блока DOWNSAMPLE_FACTOR x DOWNSAMPLE_FACTOR полного разрешения одну выборку
+     * глубины и нормаль к ней, а не усредняет их: среднее на границе объектов дает несуществующую поверхность.
+     */
+    class DepthNormalDownsamplePass : public PostProcessPass, public IFramebufferPass {
+        SR_REGISTER_LOGICAL_NODE(DepthNormalDownsamplePass, Depth Normal Downsample Pass, { "Passes" })
+        using Super = PostProcessPass;
+    public:
+        bool Load(const SR_XML_NS::Node& passNode) override;
+
+        bool Render() override;
+        void Update() override;
+
+        SR_NODISCARD std::vector<SR_GTYPES_NS::Framebuffer*> GetFrameBuffers() const override;
+
+    protected:
+        void RenderFrameBufferInner() override;
+
+        SR_NODISCARD IRenderTechnique* GetFrameBufferRenderTechnique() const override { return GetTechnique(); }
+
+    private:
+        uint32_t m_factor = 1;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_DEPTH_NORMAL_DOWNSAMPLE_PASS_H
@@ -0,0 +1,65 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_DEPTH_PRE_PASS_H
+#define SR_ENGINE_GRAPHICS_DEPTH_PRE_PASS_H
+
+#include <Graphics/Pass/OffScreenMeshDrawerPass.h>
+#include <Graphics/Render/HiZPyramid.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Глубина непрозрачной геометрии в небольшой кадровый буфер и пирамида перекрытий по ней.
+     * Шейдер прохода пишет gl_FragCoord.z, упакованную в RGB первого цветового слоя (старший байт в R),
+     * буфер очищается белым. Видеокарта копирует глубину прошлого кадра в память процессора,
+     * копия читается через кадры в полете и проверяется с матрицей кадра, в котором нарисована.
+     * Проходы, которые отсекают по пирамиде, должны стоять в технике после него.
+     */
+    class DepthPrePass : public OffScreenMeshDrawerPass {
+        SR_REGISTER_LOGICAL_NODE(DepthPrePass, Depth Pre Pass, { "Passes" })
+        using Super = OffScreenMeshDrawerPass;
+    public:
+        /// Пирамида строится на процессоре из каждой копии, больший буфер займет кадр
+        static constexpr uint32_t MAX_READBACK_TEXELS = 256 * 256;
+        /// Сколько запрошенных копий ждут своих матриц, больше их не бывает в полете
+        static constexpr uint32_t MAX_PENDING_READBACKS = 8;
+
+    public:
+        bool Load(const SR_XML_NS::Node& passNode) override;
+        void DeInit() override;
+
+        void Update() override;
+
+        SR_NODISCARD bool IsNeedUseMaterials() const noexcept override { return false; }
+        SR_NODISCARD bool IsMaterialAllowed(BaseMaterial* pMaterial) const override;
+
+        SR_NODISCARD const HiZPyramid& GetPyramid() const noexcept { return m_pyramid; }
+
+    protected:
+        void UseUniforms(ShaderUseInfo info, MeshPtr pMesh) override;
+        SR_NODISCARD bool IsClusterCullingByDefault() const noexcept override { return false; }
+
+    private:
+        void RequestReadback(const SR_MATH_NS::Matrix4x4& viewProjection);
+        void BuildPyramid();
+
+    private:
+        HiZPyramid m_pyramid;
+
+        /// Матрица, с которой нарисовано содержимое буфера
+        std::optional<SR_MATH_NS::Matrix4x4> m_renderedViewProjection;
+
+        /// Номер копии и матрица, с которой нарисовано скопированное
+        std::deque<std::pair<uint64_t, SR_MATH_NS::Matrix4x4>> m_pendingReadbacks;
+        std::vector<uint8_t> m_readbackData;
+        uint64_t m_builtReadback = 0;
+
+        uint32_t m_readbackInterval = 1;
+        uint32_t m_framesSinceReadback = 0;
+        bool m_isReadbackTooLarge = false;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_DEPTH_PRE_PASS_H
@@ -39,6 +39,7 @@ namespace SR_GRAPH_NS {
 
     protected:
         SR_NODISCARD virtual IRenderTechnique* GetFrameBufferRenderTechnique() const = 0;
+        SR_NODISCARD const SR_HTYPES_NS::SharedPtr<FrameBufferController>& GetFrameBufferController() const noexcept { return m_frameBufferController; }
 
         void LoadFramebufferSettings(const SR_XML_NS::Node& passNode);
 
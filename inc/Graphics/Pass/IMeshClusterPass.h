@@ -20,6 +20,8 @@ namespace SR_GRAPH_NS {
             uint32_t fboId = SR_ID_INVALID;
             SR_UTILS_NS::StringAtom id;
             SR_UTILS_NS::StringAtom fboName;
+            /// Имя vec2 с долей буфера, в которую был вывод: "<Id>_SCALE"
+            SR_UTILS_NS::StringAtom scaleId;
             uint64_t index = 0;
             bool depth = false;
         };
@@ -39,6 +41,8 @@ namespace SR_GRAPH_NS {
         void OnResize(const SR_MATH_NS::UVector2& size) override;
         void OnMultisampleChanged() override;
 
+        SR_NODISCARD std::vector<SR_UTILS_NS::StringAtom> GetSamplersFrameBuffers() const;
+
     protected:
         SR_NODISCARD virtual MeshClusterTypeFlag GetClusterType() const noexcept;
         SR_NODISCARD virtual ShaderPtr GetShader(SR_SRSL_NS::ShaderType shaderType) const { return nullptr; }
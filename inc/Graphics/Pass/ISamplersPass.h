@@ -26,6 +26,8 @@ namespace SR_GRAPH_NS {
             uint32_t fboId = SR_ID_INVALID;
             SR_UTILS_NS::StringAtom id;
             SR_UTILS_NS::StringAtom fboName;
+            /// Имя vec2 с долей буфера, в которую был вывод: "<Id>_SCALE"
+            SR_UTILS_NS::StringAtom scaleId;
             SR_GTYPES_NS::Texture* pTexture = nullptr;
             uint64_t index = 0;
             bool depth = false;
@@ -39,9 +41,14 @@ namespace SR_GRAPH_NS {
         void LoadSamplersPass(const SR_XML_NS::Node& passNode);
 
         virtual void UseSamplers(ShaderUseInfo info);
+        /// Масштаб UV для каждого читаемого кадрового буфера, RESOLUTION_SCALE - масштаб первого из них.
+        /// Меняется без пересоздания буферов, поэтому пишется в общий блок каждый кадр
+        void UseSamplersScale(SR_GTYPES_NS::Shader* pShader) const;
 
         SR_NODISCARD bool HasSamplers() const noexcept { return !m_samplers.empty(); }
         SR_NODISCARD bool IsSamplersDirty() const noexcept { return m_dirtySamplers; }
+        /// Имена кадровых буферов, из которых читает проход
+        SR_NODISCARD std::vector<SR_UTILS_NS::StringAtom> GetSamplersFrameBuffers() const;
 
     protected:
         virtual void OnSamplersChanged() { }
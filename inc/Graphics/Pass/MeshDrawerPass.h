@@ -16,6 +16,8 @@ namespace SR_GRAPH_NS {
     class RenderQueue;
     class CascadedShadowMapPass;
     class ShadowMapPass;
+    class DepthPrePass;
+    class BaseMaterial;
 
     class MeshDrawerPass : public BasePass, public ISamplersPass, public LayerFilterPredicate, public ShaderReplacePredicate, public PriorityFilterPredicate {
         SR_REGISTER_LOGICAL_NODE(MeshDrawerPass, Mesh Drawer Pass, { "Passes" })
@@ -49,6 +51,14 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD virtual bool IsNeedUpdate() const noexcept { return false; }
         SR_NODISCARD virtual bool IsNeedUseMaterials() const noexcept { return m_useMaterials; }
         SR_NODISCARD virtual uint8_t GetMeshDrawerFBOLayers() const noexcept { return 1; }
+        /// Сдвиг выбранного уровня детализации в сторону более грубых
+        SR_NODISCARD int32_t GetLodBias() const noexcept { return m_lodBias; }
+        /// Крупные меши рисуются только видимыми камерой прохода кластерами
+        SR_NODISCARD bool IsClusterCullingEnabled() const noexcept { return m_clusterCulling; }
+        /// Меши и кластеры отсекаются по пирамиде глубины DepthPrePass техники
+        SR_NODISCARD bool IsOcclusionCullingEnabled() const noexcept { return m_depthPrePass != nullptr; }
+        /// Сфера закрыта от камеры прохода или, для теней, не может дать видимую тень
+        SR_NODISCARD virtual bool IsOccluded(const SR_MATH_NS::FVector3& center, float_t radius) const;
 
         virtual void UseUniforms(ShaderUseInfo info, MeshPtr pMesh);
         virtual void UseSharedUniforms(ShaderUseInfo info);
@@ -57,6 +67,7 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD ShaderUseInfo ReplaceShader(ShaderPtr pShader) const override;
         SR_NODISCARD bool IsLayerAllowed(SR_UTILS_NS::StringAtom layer) const override;
         SR_NODISCARD bool IsPriorityAllowed(int64_t priority) const override { return true; }
+        SR_NODISCARD virtual bool IsMaterialAllowed(BaseMaterial* pMaterial) const { return true; }
 
         SR_NODISCARD const std::vector<RenderQueuePtr>& GetRenderQueues() const noexcept { return m_renderQueues; }
 
@@ -67,6 +78,8 @@ namespace SR_GRAPH_NS {
         void SetRenderTechnique(IRenderTechnique* pRenderTechnique) override;
 
         SR_NODISCARD RenderStrategy* GetRenderStrategy() const;
+        SR_NODISCARD virtual int32_t GetDefaultLodBias() const noexcept { return 0; }
+        SR_NODISCARD virtual bool IsClusterCullingByDefault() const noexcept { return true; }
         SR_NODISCARD virtual RenderQueuePtr AllocateRenderQueue();
 
     private:
@@ -76,10 +89,15 @@ namespace SR_GRAPH_NS {
         bool m_useMaterials = true;
         bool m_passWasRendered = false;
 
+        int32_t m_lodBias = 0;
+        bool m_clusterCulling = true;
+        bool m_occlusionCulling = false;
+
         std::vector<RenderQueuePtr> m_renderQueues;
 
         ShadowMapPass* m_shadowMapPass = nullptr;
         CascadedShadowMapPass* m_cascadedShadowMapPass = nullptr;
+        DepthPrePass* m_depthPrePass = nullptr;
 
         SR_HTYPES_NS::Time& m_time;
 
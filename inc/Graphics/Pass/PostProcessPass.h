@@ -42,6 +42,10 @@ namespace SR_GRAPH_NS {
         void OnResourceUpdated(SR_UTILS_NS::ResourceContainer* pContainer, int32_t depth) override;
 
     protected:
+        virtual bool LoadShader(const SR_XML_NS::Node& passNode);
+        /// Пуш-константы записываются в буфер команд вместе с отрисовкой
+        virtual void UseConstants(ShaderUseInfo info) { }
+
         void SetShader(SR_GTYPES_NS::Shader* pShader);
         void SetRenderTechnique(IRenderTechnique* pRenderTechnique) override;
 
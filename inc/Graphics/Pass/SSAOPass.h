@@ -13,9 +13,35 @@ namespace SR_GTYPES_NS {
 }
 
 namespace SR_GRAPH_NS {
+    SR_ENUM_NS_CLASS_T(SSAOQuality, uint8_t,
+        Ultra,      /// полное разрешение, все 64 направления каждый кадр
+        High,
+        Medium,
+        Low
+    );
+
+    /**
+     * При ResolutionScale < 1 SSAO считается по уменьшенным глубине и нормалям из DepthNormalDownsamplePass
+     * и возвращается в полное разрешение через BilateralUpsamplePass. Оба прохода читают Quality и
+     * ResolutionScale так же, как SSAOPass, поэтому в технике у всех трех указываются одни и те же атрибуты.
+     */
     class SSAOPass : public PostProcessPass, public IFramebufferPass {
         SR_REGISTER_LOGICAL_NODE(SSAOPass, SSAO Pass, { "Passes" })
         using SSAOKernel = std::vector<SR_MATH_NS::FVector4>;
+        /// Размер массива SSAO_SAMPLES в шейдере
+        static constexpr uint32_t KERNEL_SIZE = 64;
+
+        struct Preset {
+            uint32_t samples = KERNEL_SIZE;
+            float_t resolutionScale = 1.f;
+            /// Доля истории в накоплении, 0 - без накопления
+            float_t temporalWeight = 0.f;
+        };
+
+    public:
+        /// Масштаб разрешения по Quality и ResolutionScale прохода: 1, 1/2 или 1/4
+        SR_NODISCARD static float_t LoadResolutionScale(const SR_XML_NS::Node& passNode);
+
     public:
         bool Init() override;
         void DeInit() override;
@@ -32,6 +58,7 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD std::vector<SR_GTYPES_NS::Framebuffer*> GetFrameBuffers() const override;
 
     protected:
+        SR_NODISCARD static Preset GetPreset(SSAOQuality quality);
         SR_NODISCARD SSAOKernel CreateKernel() const;
         SR_NODISCARD SR_GTYPES_NS::Texture* CreateNoise() const;
         SR_NODISCARD IRenderTechnique* GetFrameBufferRenderTechnique() const override;
@@ -40,6 +67,13 @@ namespace SR_GRAPH_NS {
         SSAOKernel m_kernel;
         SR_GTYPES_NS::Texture* m_noise = nullptr;
 
+        Preset m_preset;
+
+        uint64_t m_frame = 0;
+        SR_MATH_NS::Matrix4x4 m_prevViewProjection;
+        /// После смены камеры история не совпадает с кадром
+        CameraPtr m_prevCamera = nullptr;
+
     };
 }
 
@@ -0,0 +1,51 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_SEPARABLE_BLUR_PASS_H
+#define SR_ENGINE_GRAPHICS_SEPARABLE_BLUR_PASS_H
+
+#include <Graphics/Pass/PostProcessPass.h>
+#include <Graphics/Pass/IFramebufferPass.h>
+
+namespace SR_GRAPH_NS {
+    SR_ENUM_NS_CLASS_T(BlurDirection, uint8_t,
+        Horizontal,
+        Vertical
+    );
+
+    /**
+     * Один шаг раздельного размытия: ряд выборок вдоль одной оси из семплера в свой кадровый буфер.
+     * Два прохода подряд (Horizontal в промежуточный буфер, затем Vertical) дают размытие квадратом
+     * за 2 * (2 * Radius + 1) выборок вместо (2 * Radius + 1)^2. Слоистый буфер размывается послойно,
+     * номер слоя шейдер получает в BLUR_LAYER, так размываются каскады теней.
+     * Проход читает и пишет разные буферы, размывать буфер в самого себя нельзя.
+     */
+    class SeparableBlurPass : public PostProcessPass, public IFramebufferPass {
+        SR_REGISTER_LOGICAL_NODE(SeparableBlurPass, Separable Blur Pass, { "Passes" })
+        using Super = PostProcessPass;
+    public:
+        static constexpr uint32_t MAX_RADIUS = 16;
+
+    public:
+        bool Load(const SR_XML_NS::Node& passNode) override;
+
+        bool Render() override;
+        void Update() override;
+
+        SR_NODISCARD std::vector<SR_GTYPES_NS::Framebuffer*> GetFrameBuffers() const override;
+
+    protected:
+        void UseConstants(ShaderUseInfo info) override;
+        void RenderFrameBufferInner() override;
+
+        SR_NODISCARD IRenderTechnique* GetFrameBufferRenderTechnique() const override { return GetTechnique(); }
+
+    private:
+        BlurDirection m_direction = BlurDirection::Horizontal;
+        uint32_t m_radius = 2;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_SEPARABLE_BLUR_PASS_H
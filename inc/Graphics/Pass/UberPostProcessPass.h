@@ -0,0 +1,36 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_UBER_POST_PROCESS_PASS_H
+#define SR_ENGINE_GRAPHICS_UBER_POST_PROCESS_PASS_H
+
+#include <Graphics/Pass/PostProcessPass.h>
+#include <Graphics/Utils/PostProcessComposer.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Полноэкранный проход, рисующий сегмент цепочки пост-эффектов одним шейдером.
+     * Цепочка задается узлами Effect в самом проходе или в файле из атрибута Chain,
+     * чтобы проходы разных сегментов одной цепочки не повторяли ее описание.
+     */
+    class UberPostProcessPass : public PostProcessPass {
+        SR_REGISTER_LOGICAL_NODE(UberPostProcessPass, Uber Post Process Pass, { "Passes" })
+        using Super = PostProcessPass;
+        using Params = std::vector<std::pair<SR_UTILS_NS::StringAtom, float_t>>;
+    public:
+        void Update() override;
+
+    protected:
+        bool LoadShader(const SR_XML_NS::Node& passNode) override;
+
+    private:
+        SR_NODISCARD static PostProcessEffects LoadEffects(const SR_XML_NS::Node& chainNode);
+
+    private:
+        Params m_params;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_UBER_POST_PROCESS_PASS_H
@@ -8,9 +8,33 @@
 #include <Graphics/Pass/CascadedShadowMapPass.h>
 
 namespace SR_GRAPH_NS {
+    /**
+     * Каскадные тени, хранящие вместо глубины моменты экспоненциально искаженной глубины (EVSM).
+     * Моменты можно фильтровать и размывать, поэтому карта рисуется в пониженном разрешении,
+     * а мягкость теней получается линейной выборкой вместо множества PCF-выборок.
+     * Размывают моменты два SeparableBlurPass после прохода, получатели читают уже размытый буфер.
+     * Предел показателей зависит от формата буфера: 42 для 32-битного float, около 5.5 для 16-битного.
+     */
     class VarianceShadowMapPass : public CascadedShadowMapPass {
+        SR_REGISTER_LOGICAL_NODE(VarianceShadowMapPass, Variance Shadow Map Pass, { "Passes" })
         using Super = CascadedShadowMapPass;
     public:
+        bool Load(const SR_XML_NS::Node& passNode) override;
+
+        void UseReceiverUniforms(SR_GTYPES_NS::Shader* pShader) const override;
+
+    protected:
+        SR_NODISCARD static float_t GetMaxExponent(ImageFormat format);
+
+        void UseSharedUniforms(ShaderUseInfo info) override;
+
+    private:
+        /// Показатели искажения глубины, положительный и отрицательный
+        SR_MATH_NS::FVector2 m_exponents = SR_MATH_NS::FVector2(40.f, 5.f);
+        /// Доля отсекаемого хвоста неравенства Чебышёва, убирает просвечивание
+        float_t m_lightBleedingReduction = 0.2f;
+        float_t m_minVariance = 0.0001f;
+        float_t m_resolutionScale = 0.5f;
 
     };
 }
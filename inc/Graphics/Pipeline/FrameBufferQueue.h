@@ -21,6 +21,8 @@ namespace SR_GRAPH_NS {
         void AddQueue(FrameBuffer pFrameBuffer, uint32_t queueIndex);
 
         void Clear();
+        /// Уровни связаны семафорами по порядку, пустой уровень разорвал бы цепочку
+        void RemoveEmptyLevels();
 
         SR_NODISCARD bool IsAllowMultiFrameBuffers() const;
 
@@ -49,6 +49,8 @@ namespace SR_GRAPH_NS {
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SLICED_TEXTURE_BORDER = "SLICED_TEXTURE_BORDER";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SLICED_WINDOW_BORDER = "SLICED_WINDOW_BORDER";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_MODEL_NO_SCALE_MATRIX = "MODEL_NO_SCALE_MATRIX";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_VERTEX_BOUNDS_MIN = "VERTEX_BOUNDS_MIN";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_VERTEX_BOUNDS_SIZE = "VERTEX_BOUNDS_SIZE";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SKELETON_MATRICES_128 = "SKELETON_MATRICES_128";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SKELETON_MATRIX_OFFSETS_128 = "SKELETON_MATRIX_OFFSETS_128";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SKELETON_MATRICES_256 = "SKELETON_MATRICES_256";
@@ -57,6 +59,16 @@ namespace SR_GRAPH_NS {
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SKELETON_MATRIX_OFFSETS_384 = "SKELETON_MATRIX_OFFSETS_384";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_VIEW_MATRIX = "VIEW_MATRIX";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SSAO_SAMPLES = "SSAO_SAMPLES";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SSAO_SAMPLES_COUNT = "SSAO_SAMPLES_COUNT";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SSAO_SAMPLES_OFFSET = "SSAO_SAMPLES_OFFSET";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SSAO_TEMPORAL_WEIGHT = "SSAO_TEMPORAL_WEIGHT";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SSAO_PREV_VIEW_PROJECTION = "SSAO_PREV_VIEW_PROJECTION";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_BLUR_DIRECTION = "BLUR_DIRECTION";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_BLUR_RADIUS = "BLUR_RADIUS";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_BLUR_LAYER = "BLUR_LAYER";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_DOWNSAMPLE_FACTOR = "DOWNSAMPLE_FACTOR";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_UPSAMPLE_FACTOR = "UPSAMPLE_FACTOR";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_UPSAMPLE_DEPTH_SIGMA = "UPSAMPLE_DEPTH_SIGMA";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_LIGHT_SPACE_MATRIX = "LIGHT_SPACE_MATRIX";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_VIEW_NO_TRANSLATE_MATRIX = "VIEW_NO_TRANSLATE_MATRIX";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_PROJECTION_MATRIX = "PROJECTION_MATRIX";
@@ -67,6 +79,7 @@ namespace SR_GRAPH_NS {
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_TIME = "TIME";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_ASPECT = "ASPECT";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_RESOLUTION = "RESOLUTION";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_RESOLUTION_SCALE = "RESOLUTION_SCALE";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SKYBOX_DIFFUSE = "SKYBOX_DIFFUSE";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_DEPTH_ATTACHMENT = "DEPTH_ATTACHMENT";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_TEXT_RECT_X = "TEXT_RECT_X";
@@ -77,10 +90,17 @@ namespace SR_GRAPH_NS {
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SHADOW_CASCADE_INDEX = "SHADOW_CASCADE_INDEX";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_CASCADE_LIGHT_SPACE_MATRICES = "CASCADE_LIGHT_SPACE_MATRICES";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_CASCADE_SPLITS = "CASCADE_SPLITS";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_VSM_EXPONENTS = "VSM_EXPONENTS";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_VSM_LIGHT_BLEEDING_REDUCTION = "VSM_LIGHT_BLEEDING_REDUCTION";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_VSM_MIN_VARIANCE = "VSM_MIN_VARIANCE";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_COLOR_BUFFER_MODE = "COLOR_BUFFER_MODE";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_COLOR_BUFFER_VALUE = "COLOR_BUFFER_VALUE";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_SSAO_NOISE = "SSAO_NOISE";
     SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_TEXT_ATLAS_TEXTURE = "TEXT_ATLAS_TEXTURE";
+    SR_INLINE_STATIC SR_UTILS_NS::StringAtom SHADER_BINDLESS_TEXTURES = "BINDLESS_TEXTURES";
+
+    /// Размер массива BINDLESS_TEXTURES, одинаковый для всех шейдеров
+    SR_INLINE_STATIC constexpr uint32_t SHADER_BINDLESS_TEXTURES_CAPACITY = 1024;
 
     typedef std::vector<std::pair<Vertices::Attribute, size_t>> VertexAttributes;
     typedef std::vector<SR_VERTEX_DESCRIPTION> VertexDescriptions;
@@ -103,7 +123,7 @@ namespace SR_GRAPH_NS {
         MissSecondary
     );
 
-    SR_ENUM_NS_CLASS(LayoutBinding, Unknown = 0, Uniform, Sampler2D, Attachhment, SSBO)
+    SR_ENUM_NS_CLASS(LayoutBinding, Unknown = 0, Uniform, Sampler2D, Attachhment, SSBO, DynamicUniform)
     SR_ENUM_NS_CLASS(PolygonMode, Unknown, Fill, Line, Point)
     SR_ENUM_NS_CLASS(CullMode, Unknown, None, Front, Back, FrontAndBack)
     SR_ENUM_NS_CLASS(PrimitiveTopology,
@@ -136,6 +156,8 @@ namespace SR_GRAPH_NS {
         ShaderStage stage = ShaderStage::Unknown;
         uint64_t binding = 0;
         uint64_t size = 0;
+        /// Количество элементов, больше одного для массивов текстур
+        uint32_t count = 1;
     };
 
     typedef std::vector<Uniform> UBOInfo;
@@ -12,6 +12,7 @@
 #include <Graphics/Pipeline/PipelineState.h>
 #include <Graphics/Pipeline/FrameBufferQueue.h>
 #include <Graphics/Pipeline/IShaderProgram.h>
+#include <Graphics/Memory/MemoryBudget.h>
 #include <Graphics/Overlay/OverlayType.h>
 
 namespace SR_GTYPES_NS {
@@ -35,6 +36,14 @@ namespace SR_GRAPH_NS {
         using RenderContextPtr = SR_HTYPES_NS::SafePtr<SR_GRAPH_NS::RenderContext>;
         using WindowPtr = SR_HTYPES_NS::SharedPtr<Window>;
         using ShaderProgram = int32_t;
+
+        /// Время выполнения командного буфера кадрового буфера, SR_ID_INVALID - SwapChain
+        struct GPUTiming {
+            int32_t frameBufferId = SR_ID_INVALID;
+            float_t milliseconds = 0.f;
+        };
+        using GPUTimings = std::vector<GPUTiming>;
+
     public:
         explicit Pipeline(const RenderContextPtr& pContext);
         virtual ~Pipeline();
@@ -127,6 +136,11 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD virtual uint8_t GetSupportedSamples() const noexcept { return m_supportedSampleCount; }
         SR_NODISCARD virtual bool IsShaderConstantSupport() const { ++m_state.operations; return false; }
         SR_NODISCARD virtual SR_MATH_NS::FColor GetPixelColor(uint32_t textureId, uint32_t x, uint32_t y) { return SR_MATH_NS::FColor(0.f); }
+        /// Ставит копирование текстуры в память процессора в ближайшую отправку кадра, видеокарту не ждет.
+        /// Вернет номер копии или 0, если копия не поставлена
+        virtual uint64_t RequestTextureReadback(int32_t textureId, const SR_MATH_NS::UVector2& size, uint32_t pixelSize) { return 0; }
+        /// Последняя завершенная копия текстуры, пиксели идут плотно по строкам. Вернет ее номер или 0
+        SR_NODISCARD virtual uint64_t GetTextureReadback(int32_t textureId, std::vector<uint8_t>& data, SR_MATH_NS::UVector2& size) { return 0; }
 
         virtual void SetCurrentShader(ShaderPtr pShader) { ++m_state.operations; m_state.pShader = pShader; }
         virtual void SetCurrentShaderId(int32_t id) { ++m_state.operations; m_state.shaderId = id; }
@@ -157,6 +171,11 @@ namespace SR_GRAPH_NS {
 
         virtual uint64_t GetUsedMemory() const { return 0; }
 
+        /// Обновляет данные о кучах видеопамяти и проверяет бюджет, вызывается раз в кадр
+        virtual void UpdateMemoryBudget() { m_memoryBudget.Update(); }
+        /// Обходит все выделения ради наибольшего свободного участка куч, поэтому не вызывается каждый кадр
+        virtual void UpdateMemoryFragmentation() { }
+
         /// ---------------------------------------- Мультисемплинг и VSync --------------------------------------------
 
         virtual void OnMultiSampleChanged();
@@ -171,10 +190,21 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD uint8_t GetSamplesCount() const;
         SR_NODISCARD bool IsMultiSamplingSupported() const noexcept;
         SR_NODISCARD virtual bool IsVSyncEnabled() const { return false; }
+
+        /// ------------------------------------------- Метки времени GPU ----------------------------------------------
+
+        /// Метки пишутся при записи командных буферов, после переключения их нужно перезаписать
+        virtual void SetTimestampsEnabled(bool enabled) { m_timestampsEnabled = enabled; }
+        SR_NODISCARD bool IsTimestampsEnabled() const noexcept { return m_timestampsEnabled; }
+        /// Времена последнего полностью выполненного кадра, конвейер без поддержки меток вернет пустой список
+        SR_NODISCARD virtual GPUTimings GetGPUTimings() const { return GPUTimings(); }
+
         /// Изменился ли текущий шейдер после UseShader. Даже если был вызван UnUseShader. Низкоуровневая проверка.
         SR_NODISCARD bool IsShaderChanged() const noexcept { return m_isShaderChanged; }
         SR_NODISCARD bool IsRenderState() const noexcept { return m_isRenderState; }
         SR_NODISCARD bool IsFBOQueueValid() const noexcept;
+        SR_NODISCARD Memory::MemoryBudget& GetMemoryBudget() noexcept { return m_memoryBudget; }
+        SR_NODISCARD const Memory::MemoryBudget& GetMemoryBudget() const noexcept { return m_memoryBudget; }
 
         /// ------------------------------------------ Работа с памятью ------------------------------------------------
 
@@ -183,6 +213,10 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD virtual int32_t AllocateUBO(uint32_t uboSize) { return SR_ID_INVALID; }
         SR_NODISCARD virtual int32_t AllocateSSBO(uint32_t ssboSize, SSBOUsage usage) { return SR_ID_INVALID; }
         SR_NODISCARD virtual int32_t AllocDescriptorSet(const std::vector<DescriptorType>& types) { return SR_ID_INVALID; }
+        /// Набор живет до конца кадра, его не нужно освобождать. SR_ID_INVALID - временных наборов нет или пул исчерпан
+        SR_NODISCARD virtual int32_t AllocTransientDescriptorSet(const std::vector<DescriptorType>& types) { return SR_ID_INVALID; }
+        /// Вызывается один раз за кадр, возвращает память временных наборов, которые больше не в полете
+        virtual void ResetTransientDescriptorSets() { }
         SR_NODISCARD virtual int32_t AllocateShaderProgram(const SRShaderCreateInfo& createInfo, int32_t fbo) { return SR_ID_INVALID; };
         SR_NODISCARD virtual int32_t AllocateTexture(const SRTextureCreateInfo& createInfo) { return SR_ID_INVALID; };
         SR_NODISCARD virtual int32_t AllocateFrameBuffer(const SRFrameBufferCreateInfo& createInfo) { return SR_ID_INVALID; };
@@ -202,8 +236,12 @@ namespace SR_GRAPH_NS {
 
         /// ------------------------------------------ Вызовы отрисовки ------------------------------------------------
 
-        /// Отрисовка вершин по индексам
-        virtual void DrawIndices(uint32_t count);
+        /// Отрисовка вершин по индексам. firstIndex и vertexOffset задают участок общего буфера
+        virtual void DrawIndices(uint32_t count, uint32_t firstIndex = 0, int32_t vertexOffset = 0);
+
+        /// Отрисовка по индексам с параметрами из буфера косвенных команд. offset в байтах,
+        /// count команд подряд с шагом IndirectDrawBuffer::STRIDE отправляются одним вызовом
+        virtual void DrawIndicesIndirect(uint32_t SSBO, uint32_t offset, uint32_t count = 1);
 
         /// Обычная отрисовка вершин
         virtual void Draw(uint32_t count);
@@ -223,6 +261,8 @@ namespace SR_GRAPH_NS {
 
         /// Uniform Buffer Object - обеспечивает привязку для передачм данных в шейдеры
         virtual void BindUBO(uint32_t UBO);
+        /// Общий буфер, в котором лежит UBO. Наборы объектов ссылаются на него, а не на сам UBO
+        SR_NODISCARD virtual int32_t GetUBOPage(int32_t UBO) const { return UBO; }
 
         /// Shader Storage Buffer Object - обеспечивает привязку для передачм данных в шейдеры
         virtual void BindSSBO(uint32_t SSBO);
@@ -233,6 +273,12 @@ namespace SR_GRAPH_NS {
         /// Обеспечивает обновление данных в шейдере
         virtual void UpdateSSBO(uint32_t SSBO, void* pData, uint64_t size);
 
+        /// Перезаписывает участок буфера вершин, используется общими буферами геометрии. offset в байтах
+        virtual void UpdateVBO(uint32_t VBO, void* pData, uint64_t size, uint64_t offset = 0);
+
+        /// Перезаписывает участок буфера индексов, используется общими буферами геометрии. offset в байтах
+        virtual void UpdateIBO(uint32_t IBO, void* pData, uint64_t size, uint64_t offset = 0);
+
         /// Привязываем к дескриптору юниформы. Работает не во всех API
         virtual void UpdateDescriptorSets(uint32_t descriptorSet, const SRDescriptorUpdateInfos& updateInfo);
 
@@ -242,9 +288,15 @@ namespace SR_GRAPH_NS {
 
         virtual void BindTexture(uint8_t activeTexture, uint32_t textureId);
         virtual void BindAttachment(uint8_t activeTexture, uint32_t textureId);
+        /// Запись массива текстур (bindless) в текущий набор дескрипторов. Поддерживается не всеми API
+        virtual void BindTextureArray(uint8_t binding, const std::vector<int32_t>& textures);
+        /// Дописывает слоты массива текстур во все записанные наборы, не трогая командные буферы.
+        /// Вернет false, если API так не умеет и наборы нужно записать заново
+        virtual bool UpdateTextureArrays(const std::vector<int32_t>& textures, const std::vector<int32_t>& slots) { return false; }
 
         /// Привязка UBO к набору дескрипторов. Поддерживается не всеми API
-        virtual bool BindDescriptorSet(uint32_t descriptorSet);
+        /// shared - набор из кэша, уже записан и может привязываться несколько раз за рендер
+        virtual bool BindDescriptorSet(uint32_t descriptorSet, bool shared = false);
 
         virtual void ResetLastShader();
 
@@ -255,9 +307,13 @@ namespace SR_GRAPH_NS {
 
         FrameBufferQueue m_fboQueue;
 
+        /// Без API, сообщающего о кучах, учет выделений сам служит занятостью памяти
+        Memory::MemoryBudget m_memoryBudget;
+
         bool m_isRenderState = false;
         bool m_isCmdState = false;
         bool m_enableValidationLayers = false;
+        bool m_timestampsEnabled = false;
 
         mutable uint64_t m_errorsCount = 0;
 
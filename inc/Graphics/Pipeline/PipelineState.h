@@ -39,6 +39,8 @@ namespace SR_GRAPH_NS {
         uint8_t mipLevels = 0;
         bool alpha = false;
         bool cpuUsage = false;
+        /// Уровни готовой мип-цепочки в pData, если пусто - pData хранит только нулевой уровень
+        std::vector<MipLevel> mipChain;
     };
 
     struct SRCubeMapCreateInfo {
@@ -103,6 +105,8 @@ namespace SR_GRAPH_NS {
         mutable uint32_t drawCalls = 0;
         /// Количество вершин, которые были отрисованы
         mutable uint32_t vertices = 0;
+        /// Количество треугольников, отправленных на отрисовку
+        mutable uint32_t triangles = 0;
         /// Количество всех обращений к API в процессе отрисовки
         mutable uint32_t operations = 0;
 
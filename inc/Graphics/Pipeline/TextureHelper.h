@@ -11,7 +11,9 @@
 namespace SR_GRAPH_NS {
     SR_ENUM_NS_CLASS_T(SSBOUsage, uint8_t,
         Unknown,
-        Read, Write, ReadWrite
+        Read, Write, ReadWrite,
+        /// Параметры косвенных отрисовок, пишутся процессором каждый кадр
+        Indirect
     );
 
     SR_ENUM_NS_CLASS_T(ImageLoadFormat, uint8_t,
@@ -51,6 +53,7 @@ namespace SR_GRAPH_NS {
         BGRA8_UNORM,
         RGBA16_UNORM,
         RGBA16_SFLOAT,
+        RGBA32_SFLOAT,
 
         RGB8_UNORM,
         RGB8_SRGB,
@@ -136,6 +139,25 @@ namespace SR_GRAPH_NS {
         None = 0, BC1 = 1, BC2 = 2, BC3 = 3, BC4 = 4, BC5 = 5, BC6 = 6, BC7 = 7
     );
 
+    SR_ENUM_NS_CLASS_T(MipFilter, uint8_t,
+        Box, Kaiser
+    );
+
+    /// Уровень мип-цепочки, все уровни лежат одним блоком памяти друг за другом
+    struct MipLevel {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint64_t offset = 0;
+    };
+
+    struct MipChainInfo {
+        MipFilter filter = MipFilter::Box;
+        /// фильтрация в линейном пространстве
+        bool sRGB = false;
+        /// xyz в [-1, 1], после фильтрации нормаль нормализуется
+        bool normalMap = false;
+    };
+
     SR_INLINE static uint32_t Find4(uint32_t i) {
         if (i % 4 == 0)
             return i;
@@ -160,7 +182,21 @@ namespace SR_GRAPH_NS {
 
     uint32_t GetPixelSize(ImageFormat format);
 
-    uint8_t* Compress(uint32_t w, uint32_t h, uint8_t* pixels, SR_GRAPH_NS::TextureCompression method);
+    SR_NODISCARD uint8_t CalculateMipCount(uint32_t width, uint32_t height);
+
+    /// Строит полную мип-цепочку RGBA8 изображения, нулевой уровень копируется без изменений
+    bool GenerateMipChain(const uint8_t* pPixels, uint32_t width, uint32_t height, const MipChainInfo& info,
+        std::vector<uint8_t>& chain, std::vector<MipLevel>& levels);
+
+    uint8_t* Compress(uint32_t w, uint32_t h, const uint8_t* pixels, SR_GRAPH_NS::TextureCompression method);
+
+    /// Размер сжатого блока 4x4 в байтах, 0 - без сжатия
+    SR_NODISCARD uint32_t GetCompressedBlockBytes(SR_GRAPH_NS::TextureCompression method);
+
+    /// Сжимает уровни RGBA8 цепочки полосами в нескольких потоках, уровни со сторонами не кратными 4 отбрасываются.
+    /// Вернет память от malloc со сжатыми уровнями одним блоком или nullptr, если нулевой уровень нельзя сжать
+    uint8_t* CompressMipChain(const uint8_t* pChain, const std::vector<MipLevel>& levels, SR_GRAPH_NS::TextureCompression method,
+        std::vector<MipLevel>& compressedLevels, uint64_t& bytes);
 }
 
 #endif //SR_ENGINE_TEXTUREHELPER_H
@@ -30,6 +30,11 @@ namespace SR_GRAPH_NS::VulkanTools {
             case Vertices::Attribute::FLOAT_R32G32:       return VK_FORMAT_R32G32_SFLOAT;
             case Vertices::Attribute::INT_R32:            return VK_FORMAT_R32_SINT;
             case Vertices::Attribute::UINT_R32:           return VK_FORMAT_R32_UINT;
+            case Vertices::Attribute::HALF_R16G16:        return VK_FORMAT_R16G16_SFLOAT;
+            case Vertices::Attribute::UNORM_R16G16B16A16: return VK_FORMAT_R16G16B16A16_UNORM;
+            case Vertices::Attribute::SNORM_R16G16:       return VK_FORMAT_R16G16_SNORM;
+            case Vertices::Attribute::UNORM_R8G8B8A8:     return VK_FORMAT_R8G8B8A8_UNORM;
+            case Vertices::Attribute::UINT_R8G8B8A8:      return VK_FORMAT_R8G8B8A8_UINT;
             default:                                      return VK_FORMAT_UNDEFINED;
         }
     }
@@ -88,6 +93,7 @@ namespace SR_GRAPH_NS::VulkanTools {
             switch (uniform.type) {
                 case LayoutBinding::Sampler2D: type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER; break;
                 case LayoutBinding::Uniform: type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER; break;
+                case LayoutBinding::DynamicUniform: type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC; break;
                 case LayoutBinding::Attachhment: type = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT; break;
                 case LayoutBinding::SSBO: type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER; break;
                 default:
@@ -114,7 +120,7 @@ namespace SR_GRAPH_NS::VulkanTools {
 
             descriptorLayoutBindings.emplace_back(EvoVulkan::Tools::Initializers::DescriptorSetLayoutBinding(
                     type, stage, uniform.binding
-            ));
+            )).descriptorCount = uniform.count;
 
         skip:
             SR_NOOP;
@@ -236,6 +242,8 @@ namespace SR_GRAPH_NS::VulkanTools {
         switch (descriptorType) {
             case DescriptorType::Uniform:
                 return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            case DescriptorType::DynamicUniform:
+                return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
             case DescriptorType::CombinedImage:
                 return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
             default: {
@@ -256,6 +264,9 @@ namespace SR_GRAPH_NS::VulkanTools {
                 case DescriptorType::Uniform:
                     vkDescriptorTypes.emplace_back(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
                     break;
+                case DescriptorType::DynamicUniform:
+                    vkDescriptorTypes.emplace_back(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC);
+                    break;
                 case DescriptorType::CombinedImage:
                     vkDescriptorTypes.emplace_back(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
                     break;
@@ -277,6 +288,9 @@ namespace SR_GRAPH_NS::VulkanTools {
             if (type == static_cast<uint64_t>(DescriptorType::Uniform)) {
                 type = static_cast<uint64_t>(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
             }
+            else if (type == static_cast<uint64_t>(DescriptorType::DynamicUniform)) {
+                type = static_cast<uint64_t>(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC);
+            }
             else if (type == static_cast<uint64_t>(DescriptorType::CombinedImage)) {
                 type = static_cast<uint64_t>(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
             }
@@ -305,6 +319,7 @@ namespace SR_GRAPH_NS::VulkanTools {
             case ImageFormat::BGRA8_UNORM: return VK_FORMAT_B8G8R8A8_UNORM;
             case ImageFormat::RGBA16_UNORM: return VK_FORMAT_R16G16B16A16_UNORM;
             case ImageFormat::RGBA16_SFLOAT: return VK_FORMAT_R16G16B16A16_SFLOAT;
+            case ImageFormat::RGBA32_SFLOAT: return VK_FORMAT_R32G32B32A32_SFLOAT;
 
             case ImageFormat::RGB8_UNORM: return VK_FORMAT_R8G8B8_UNORM;
             case ImageFormat::RGB16_UNORM: return VK_FORMAT_R16G16B16_UNORM;
@@ -7,6 +7,7 @@
 
 #include <Utils/Common/NonCopyable.h>
 #include <Utils/Types/Function.h>
+#include <Utils/Types/Map.h>
 
 #include <EvoVulkan/Types/VulkanBuffer.h>
 #include <EvoVulkan/Complexes/Framebuffer.h>
@@ -17,7 +18,10 @@
 #include <EvoVulkan/Types/DescriptorSet.h>
 
 #include <Graphics/Pipeline/TextureHelper.h>
+#include <Graphics/Memory/MemoryBudget.h>
 #include <Graphics/Pipeline/Vulkan/DynamicTextureDescriptorSet.h>
+#include <Graphics/Pipeline/Vulkan/VulkanUploadManager.h>
+#include <Graphics/Pipeline/Vulkan/VulkanUniformPages.h>
 
 namespace SR_GRAPH_NS::VulkanTools {
     struct VulkanFrameBufferAllocInfo {
@@ -34,18 +38,31 @@ namespace SR_GRAPH_NS::VulkanTools {
     };
 
     class MemoryManager : SR_UTILS_NS::NonCopyable {
+        /// Наборов в одном пуле временных наборов
+        static constexpr uint32_t TRANSIENT_POOL_SETS = 1024;
+
+        struct TransientPool {
+            VkDescriptorPool pool = VK_NULL_HANDLE;
+            std::vector<int32_t> descriptorSets;
+            /// Наборы, которые еще используются
+            uint32_t alive = 0;
+            /// Кадр, в котором был отпущен последний набор
+            uint64_t releaseFrame = 0;
+            bool isFull = false;
+        };
+
     private:
         MemoryManager() = default;
         ~MemoryManager() override = default;
 
     private:
-        bool Initialize(EvoVulkan::Core::VulkanKernel* kernel);
+        bool Initialize(EvoVulkan::Core::VulkanKernel* kernel, Memory::MemoryBudget* pBudget);
 
     public:
-        static MemoryManager* Create(EvoVulkan::Core::VulkanKernel* kernel) {
+        static MemoryManager* Create(EvoVulkan::Core::VulkanKernel* kernel, Memory::MemoryBudget* pBudget) {
             auto memory = new MemoryManager();
 
-            if (!memory->Initialize(kernel)) {
+            if (!memory->Initialize(kernel, pBudget)) {
                 SR_ERROR("MemoryManager::Create() : failed to initialize memory!");
                 return nullptr;
             }
@@ -54,6 +71,24 @@ namespace SR_GRAPH_NS::VulkanTools {
         }
         void Free();
 
+        /// Передает в учет занятость и бюджет куч, полученные от VMA
+        void UpdateBudget();
+        void UpdateFragmentation();
+
+        /// Копирует данные в буфер вершин или индексов через кольцо загрузки
+        bool UploadVBO(uint32_t id, const void* pData, uint64_t size, uint64_t offset);
+        bool UploadIBO(uint32_t id, const void* pData, uint64_t size, uint64_t offset);
+
+        SR_NODISCARD UploadManager& GetUploadManager() noexcept { return m_uploadManager; }
+
+        /// Записывает данные в участок страницы юниформ
+        void UpdateUBO(uint32_t id, const void* pData, uint64_t size);
+
+        /// Временные наборы не освобождаются по одному: пул сбрасывается целиком, когда все его
+        /// наборы отпущены и последний из них уже не используется кадрами в полете
+        SR_NODISCARD int32_t AllocateTransientDescriptorSet(uint32_t shaderProgram);
+        void ResetTransientDescriptorSets(uint32_t framesInFlight);
+
     public:
         SR_NODISCARD bool FreeDescriptorSet(uint32_t id);
 
@@ -81,6 +116,7 @@ namespace SR_GRAPH_NS::VulkanTools {
 
         SR_NODISCARD int32_t AllocateFBO(const VulkanFrameBufferAllocInfo& info);
 
+        /// Без доступа процессора копируется через менеджер загрузок, недостающие уровни строятся блитом
         SR_NODISCARD int32_t AllocateTexture(
                 const uint8_t* pixels,
                 uint32_t w,
@@ -91,6 +127,15 @@ namespace SR_GRAPH_NS::VulkanTools {
                 uint8_t mipLevels,
                 bool cpuUsage);
 
+        /// Уровни готовой мип-цепочки копируются через менеджер загрузок, без построения мипов на видеокарте
+        SR_NODISCARD int32_t AllocateTexture(
+                const uint8_t* pChain,
+                uint64_t size,
+                const std::vector<MipLevel>& levels,
+                VkFormat format,
+                VkFilter filter,
+                TextureCompression compression);
+
         SR_NODISCARD int32_t AllocateTexture(
                 std::array<const uint8_t*, 6> pixels,
                 uint32_t w,
@@ -102,7 +147,7 @@ namespace SR_GRAPH_NS::VulkanTools {
 
         SR_NODISCARD const EvoVulkan::Types::Texture* GetTexture(uint32_t id) const { return m_texturePool.At(static_cast<int32_t>(id)); }
         SR_NODISCARD const EvoVulkan::Types::VmaBuffer* GetVBO(uint32_t id) const { return m_vboPool.At(static_cast<int32_t>(id)); }
-        SR_NODISCARD const EvoVulkan::Types::VmaBuffer* GetUBO(uint32_t id) const { return m_uboPool.At(static_cast<int32_t>(id)); }
+        SR_NODISCARD const UniformPages::Slot& GetUBO(uint32_t id) const { return m_uboPool.At(static_cast<int32_t>(id)); }
         SR_NODISCARD const EvoVulkan::Types::VmaBuffer* GetIBO(uint32_t id) const { return m_iboPool.At(static_cast<int32_t>(id)); }
         SR_NODISCARD const EvoVulkan::Types::VmaBuffer* GetSSBO(uint32_t id) const { return m_ssboPool.At(static_cast<int32_t>(id)); }
         SR_NODISCARD const EvoVulkan::Complexes::FrameBuffer* GetFBO(uint32_t id) const { return m_fboPool.At(static_cast<int32_t>(id)); }
@@ -111,7 +156,7 @@ namespace SR_GRAPH_NS::VulkanTools {
 
         SR_NODISCARD EvoVulkan::Types::Texture* GetTexture(uint32_t id) { return m_texturePool.At(static_cast<int32_t>(id)); }
         SR_NODISCARD EvoVulkan::Types::VmaBuffer* GetVBO(uint32_t id) { return m_vboPool.At(static_cast<int32_t>(id)); }
-        SR_NODISCARD EvoVulkan::Types::VmaBuffer* GetUBO(uint32_t id) { return m_uboPool.At(static_cast<int32_t>(id)); }
+        SR_NODISCARD VkBuffer GetUBOBuffer(uint32_t id) const { return m_uniformPages.GetBuffer(GetUBO(id).page); }
         SR_NODISCARD EvoVulkan::Types::VmaBuffer* GetIBO(uint32_t id) { return m_iboPool.At(static_cast<int32_t>(id)); }
         SR_NODISCARD EvoVulkan::Types::VmaBuffer* GetSSBO(uint32_t id) { return m_ssboPool.At(static_cast<int32_t>(id)); }
         SR_NODISCARD EvoVulkan::Complexes::FrameBuffer* GetFBO(uint32_t id) { return m_fboPool.At(static_cast<int32_t>(id)); }
@@ -138,6 +183,23 @@ namespace SR_GRAPH_NS::VulkanTools {
         SR_NODISCARD uint32_t GetTexturesCount() const { return m_texturePool.GetAliveCount(); }
 
     private:
+        void Track(Memory::MemoryCategory category, Memory::MemoryHeap heap, int32_t id, uint64_t bytes);
+        void Untrack(Memory::MemoryCategory category, int32_t id);
+
+        SR_NODISCARD static Memory::MemoryHeap GetMemoryHeap(VmaMemoryUsage memoryUsage);
+        SR_NODISCARD static uint64_t GetImageSize(VkFormat format, uint32_t width, uint32_t height, uint8_t mipLevels, uint32_t layers);
+        SR_NODISCARD uint64_t GetFrameBufferSize(const VulkanFrameBufferAllocInfo& info) const;
+
+    private:
+        Memory::MemoryBudget* m_budget = nullptr;
+        UploadManager m_uploadManager;
+        UniformPages m_uniformPages;
+
+        std::vector<TransientPool> m_transientPools;
+        /// Временный набор и индекс его пула
+        ska::flat_hash_map<int32_t, uint32_t> m_transientSets;
+        uint64_t m_transientFrame = 0;
+
         EvoVulkan::Core::DescriptorManager* m_descriptorManager = nullptr;
         EvoVulkan::Types::Device* m_device = nullptr;
         EvoVulkan::Memory::Allocator* m_allocator = nullptr;
@@ -146,7 +208,7 @@ namespace SR_GRAPH_NS::VulkanTools {
         SR_HTYPES_NS::ObjectPool<EvoVulkan::Types::DescriptorSet, int32_t> m_descriptorSetPool;
         SR_HTYPES_NS::ObjectPool<EvoVulkan::Complexes::Shader*, int32_t> m_shaderProgramPool;
         SR_HTYPES_NS::ObjectPool<EvoVulkan::Types::VmaBuffer*, int32_t> m_vboPool;
-        SR_HTYPES_NS::ObjectPool<EvoVulkan::Types::VmaBuffer*, int32_t> m_uboPool;
+        SR_HTYPES_NS::ObjectPool<UniformPages::Slot, int32_t> m_uboPool;
         SR_HTYPES_NS::ObjectPool<EvoVulkan::Types::VmaBuffer*, int32_t> m_iboPool;
         SR_HTYPES_NS::ObjectPool<EvoVulkan::Types::VmaBuffer*, int32_t> m_ssboPool;
         SR_HTYPES_NS::ObjectPool<EvoVulkan::Complexes::FrameBuffer*, int32_t> m_fboPool;
@@ -23,6 +23,8 @@ namespace EvoVulkan::Complexes {
 namespace SR_GRAPH_NS {
     class VulkanPipeline : public Pipeline {
         using Super = Pipeline;
+        /// Пары меток начала и конца командного буфера
+        static constexpr uint32_t MAX_TIMESTAMP_SLOTS = 256;
     public:
         explicit VulkanPipeline(const RenderContextPtr& pContext)
             : Super(pContext)
@@ -52,17 +54,23 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD uint8_t GetFrameBufferSampleCount() const override;
         SR_NODISCARD uint8_t GetBuildIterationsCount() const noexcept override;
         SR_NODISCARD SR_MATH_NS::FColor GetPixelColor(uint32_t textureId, uint32_t x, uint32_t y) override;
+        uint64_t RequestTextureReadback(int32_t textureId, const SR_MATH_NS::UVector2& size, uint32_t pixelSize) override;
+        SR_NODISCARD uint64_t GetTextureReadback(int32_t textureId, std::vector<uint8_t>& data, SR_MATH_NS::UVector2& size) override;
         SR_NODISCARD void* GetCurrentShaderHandle() const override;
 
         SR_NODISCARD EvoVulkan::Core::VulkanKernel* GetKernel() const noexcept { return m_kernel; }
         SR_NODISCARD VulkanTools::MemoryManager* GetMemoryManager() const noexcept { return m_memory; }
         SR_NODISCARD uint64_t GetUsedMemory() const override;
+        void UpdateMemoryBudget() override;
+        void UpdateMemoryFragmentation() override;
         SR_NODISCARD bool IsShaderConstantSupport() const noexcept override { ++m_state.operations; return true; }
 
         SR_NODISCARD int32_t AllocateUBO(uint32_t uboSize) override;
         SR_NODISCARD int32_t AllocateVBO(void* pVertices, Vertices::VertexType type, size_t count) override;
         SR_NODISCARD int32_t AllocateIBO(void* pIndices, uint32_t indexSize, size_t count, int32_t VBO) override;
         SR_NODISCARD int32_t AllocDescriptorSet(const std::vector<DescriptorType>& types) override;
+        SR_NODISCARD int32_t AllocTransientDescriptorSet(const std::vector<DescriptorType>& types) override;
+        void ResetTransientDescriptorSets() override;
         SR_NODISCARD int32_t AllocateShaderProgram(const SRShaderCreateInfo& createInfo, int32_t fbo) override;
         SR_NODISCARD int32_t AllocateTexture(const SRTextureCreateInfo& createInfo) override;
         SR_NODISCARD int32_t AllocateFrameBuffer(const SRFrameBufferCreateInfo& createInfo) override;
@@ -115,6 +123,8 @@ namespace SR_GRAPH_NS {
         void UpdateDescriptorSets(uint32_t descriptorSet, const SRDescriptorUpdateInfos& updateInfo) override;
         void UpdateUBO(uint32_t UBO, void* pData, uint64_t size) override;
         void UpdateSSBO(uint32_t SSBO, void* pData, uint64_t size) override;
+        void UpdateVBO(uint32_t VBO, void* pData, uint64_t size, uint64_t offset) override;
+        void UpdateIBO(uint32_t IBO, void* pData, uint64_t size, uint64_t offset) override;
 
         void PushConstants(void* pData, uint64_t size) override;
 
@@ -122,22 +132,41 @@ namespace SR_GRAPH_NS {
         void UnUseShader() override;
 
         void Draw(uint32_t count) override;
-        void DrawIndices(uint32_t count) override;
+        void DrawIndices(uint32_t count, uint32_t firstIndex = 0, int32_t vertexOffset = 0) override;
+        void DrawIndicesIndirect(uint32_t SSBO, uint32_t offset, uint32_t count) override;
 
         void BindAttachment(uint8_t activeTexture, uint32_t textureId) override;
         void BindVBO(uint32_t VBO) override;
         void BindUBO(uint32_t UBO) override;
+        SR_NODISCARD int32_t GetUBOPage(int32_t UBO) const override;
         void BindIBO(uint32_t IBO) override;
         void BindTexture(uint8_t activeTexture, uint32_t textureId) override;
-        bool BindDescriptorSet(uint32_t descriptorSet) override;
+        void BindTextureArray(uint8_t binding, const std::vector<int32_t>& textures) override;
+        bool UpdateTextureArrays(const std::vector<int32_t>& textures, const std::vector<int32_t>& slots) override;
+        bool BindDescriptorSet(uint32_t descriptorSet, bool shared = false) override;
         void BindFrameBuffer(FramebufferPtr pFBO) override;
         void BindSSBO(uint32_t SSBO) override;
 
         void ResetLastShader() override;
 
+        void SetTimestampsEnabled(bool enabled) override;
+        SR_NODISCARD GPUTimings GetGPUTimings() const override;
+
     private:
         bool InitEvoVulkanHooks();
 
+        SR_NODISCARD int32_t AllocateTextureMipChain(const SRTextureCreateInfo& createInfo, VkFormat vkFormat);
+
+        /// Образ под идентификатором текстуры удален
+        void OnTextureFreed(int32_t textureId);
+        /// Идентификатор текстуры остался, но образ под ним новый
+        void OnTextureReCreated(int32_t textureId);
+
+        void WriteTimestamp(bool begin);
+        /// Помечает слоты отправляемых кадровых буферов номером кадра
+        void TagTimestampSlots();
+        void DestroyTimestampPool();
+
     private:
         VkDeviceSize m_offsets[1] = { 0 };
         VkViewport m_viewport = { };
@@ -146,11 +175,24 @@ namespace SR_GRAPH_NS {
         VkCommandBufferBeginInfo m_cmdBufInfo = { };
 
         VkDescriptorSet m_currentDescriptorSet = VK_NULL_HANDLE;
+        /// Смещение участка привязанного буфера юниформ и число динамических биндингов у шейдера
+        uint32_t m_dynamicOffset = 0;
+        uint32_t m_dynamicOffsetsCount = 0;
+        ska::flat_hash_map<int32_t, uint32_t> m_dynamicOffsetsCounts;
 
         VkCommandBuffer m_currentCmd  = VK_NULL_HANDLE;
         VkPipelineLayout m_currentLayout = VK_NULL_HANDLE;
 
         std::vector<VkClearValue> m_clearValues;
+        std::vector<VkDescriptorImageInfo> m_imageInfosCache;
+
+        /// Массивы текстур объявлены с UPDATE_AFTER_BIND и дописываются без перезаписи команд
+        bool m_isTextureArrayUpdateAfterBind = false;
+        /// Без multiDrawIndirect каждая косвенная команда отправляется своим вызовом
+        bool m_isMultiDrawIndirect = false;
+        /// Наборы с записанным массивом текстур и его привязка
+        ska::flat_hash_map<int32_t, uint8_t> m_textureArraySets;
+        std::vector<VkWriteDescriptorSet> m_descriptorWritesCache;
 
         EvoVulkan::Complexes::FrameBuffer* m_currentVkFrameBuffer = nullptr;
         EvoVulkan::Complexes::Shader* m_currentVkShader = nullptr;
@@ -159,6 +201,19 @@ namespace SR_GRAPH_NS {
 
         VulkanTools::MemoryManager* m_memory = nullptr;
 
+        VkQueryPool m_timestampPool = VK_NULL_HANDLE;
+        /// Слот на пару (кадровый буфер, итерация сборки), у SwapChain свой буфер на каждую итерацию
+        std::map<std::pair<int32_t, uint8_t>, uint32_t> m_timestampSlots;
+        /// Кадр, в котором слот последний раз был отправлен. Пропущенные буферы хранят результаты старых кадров
+        std::vector<uint64_t> m_timestampFrames;
+        /// Слот, записанный в командный буфер кадрового буфера последним, он и выполняется при отправке
+        std::map<int32_t, uint32_t> m_recordedTimestampSlots;
+        /// Кадровые буферы текущей очереди отправки
+        std::vector<int32_t> m_submittedFrameBuffers;
+        uint64_t m_timestampFrame = 0;
+        uint32_t m_currentTimestampSlot = MAX_TIMESTAMP_SLOTS;
+        float_t m_timestampPeriod = 1.f;
+
     };
 }
 
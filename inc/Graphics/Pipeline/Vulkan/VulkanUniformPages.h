@@ -0,0 +1,67 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_VULKAN_UNIFORM_PAGES_H
+#define SR_ENGINE_GRAPHICS_VULKAN_UNIFORM_PAGES_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Types/ObjectPool.h>
+
+#include <EvoVulkan/VulkanKernel.h>
+
+namespace SR_GRAPH_NS::VulkanTools {
+    /**
+     * Буферы юниформ, выделенные участками из общих страниц видимой процессору памяти.
+     * Набор дескрипторов ссылается на страницу целиком, а участок объекта выбирается динамическим
+     * смещением при привязке, поэтому объекты одного материала делят один набор.
+     * В странице лежат участки одного размера. Пустые страницы не освобождаются до DeInit:
+     * на них могут ссылаться наборы в кадрах в полете и в кэше наборов.
+     */
+    class UniformPages : public SR_UTILS_NS::NonCopyable {
+    public:
+        static constexpr uint32_t PAGE_SIZE = 64 * 1024;
+
+        struct Slot {
+            int32_t page = SR_ID_INVALID;
+            uint32_t offset = 0;
+            uint32_t size = 0;
+        };
+
+    private:
+        struct Page {
+            VkBuffer buffer = VK_NULL_HANDLE;
+            VmaAllocation allocation = VK_NULL_HANDLE;
+            uint8_t* pData = nullptr;
+            uint32_t slotSize = 0;
+            std::vector<uint32_t> freeOffsets;
+        };
+
+    public:
+        ~UniformPages() override;
+
+    public:
+        bool Init(EvoVulkan::Core::VulkanKernel* pKernel);
+        void DeInit();
+
+        SR_NODISCARD Slot Allocate(uint32_t size);
+        void Free(const Slot& slot);
+
+        void Write(const Slot& slot, const void* pData, uint64_t size);
+
+        SR_NODISCARD VkBuffer GetBuffer(int32_t page) const { return m_pages.At(page).buffer; }
+        SR_NODISCARD uint32_t GetPagesCount() const { return m_pages.GetAliveCount(); }
+
+    private:
+        SR_NODISCARD int32_t CreatePage(uint32_t slotSize);
+
+    private:
+        SR_HTYPES_NS::ObjectPool<Page, int32_t> m_pages;
+
+        VmaAllocator m_allocator = VK_NULL_HANDLE;
+        VkDeviceSize m_alignment = 256;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_VULKAN_UNIFORM_PAGES_H
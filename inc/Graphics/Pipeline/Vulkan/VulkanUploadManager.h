@@ -0,0 +1,156 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_VULKAN_UPLOAD_MANAGER_H
+#define SR_ENGINE_GRAPHICS_VULKAN_UPLOAD_MANAGER_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Types/Map.h>
+
+#include <Graphics/Pipeline/TextureHelper.h>
+
+#include <EvoVulkan/VulkanKernel.h>
+
+namespace SR_GRAPH_NS::VulkanTools {
+    /**
+     * Загрузка данных в буферы видеопамяти через общее кольцо промежуточной памяти.
+     * Все копирования кадра записываются в один командный буфер и отправляются одним submit'ом,
+     * дополнительные отправки бывают только при превышении бюджета кадра или нехватке места в кольце.
+     * Каждая отправка получает номер, место в кольце возвращается, когда завершится отправка с этим номером.
+     * В очередь отправляет только поток рендера (тот, что вызвал Init), вместе с отправками кадра,
+     * остальные потоки только записывают копирования и при нехватке места ждут его отправки.
+     * Тем же путем изображения копируются обратно в постоянно отображенные буферы: копия читается,
+     * когда завершится ее отправка, кадр видеокарту не ждет.
+     */
+    class UploadManager : public SR_UTILS_NS::NonCopyable {
+        static constexpr uint64_t RING_SIZE = 64ULL * 1024 * 1024;
+        static constexpr uint64_t RING_ALIGNMENT = 16;
+        static constexpr uint64_t DEFAULT_FRAME_BUDGET = 32ULL * 1024 * 1024;
+
+        struct Batch {
+            VkCommandBuffer cmd = VK_NULL_HANDLE;
+            VkFence fence = VK_NULL_HANDLE;
+            /// Место в кольце вместе с выравниванием при переходе через конец
+            uint64_t ringBytes = 0;
+            uint64_t value = 0;
+            std::vector<VkBuffer> destinations;
+            std::vector<VkImage> images;
+            /// Ключ чтения и индекс его буфера
+            std::vector<std::pair<uint64_t, uint32_t>> readbacks;
+        };
+
+        struct ReadbackSlot {
+            VkBuffer buffer = VK_NULL_HANDLE;
+            VmaAllocation allocation = VK_NULL_HANDLE;
+            const uint8_t* pData = nullptr;
+            /// Номер отправки с копированием, 0 - копии нет
+            uint64_t value = 0;
+            uint64_t ticket = 0;
+            /// Копирование записано, но еще не отправлено
+            bool isPending = false;
+        };
+
+        struct Readback {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t pixelSize = 0;
+            uint32_t next = 0;
+            std::vector<ReadbackSlot> slots;
+        };
+
+    public:
+        ~UploadManager() override;
+
+    public:
+        bool Init(EvoVulkan::Core::VulkanKernel* pKernel);
+        void DeInit();
+
+        /// Копирует данные в буфер в начале следующей отправки
+        bool Upload(VkBuffer destination, VkDeviceSize offset, const void* pData, uint64_t size);
+
+        /// Копирует уровни изображения и переводит его в VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+        /// Уровни лежат одним блоком, blockSize - сторона блока сжатия в текселях, blockBytes - его размер
+        bool UploadImage(VkImage image, const uint8_t* pData, const std::vector<MipLevel>& levels, uint32_t blockSize, uint32_t blockBytes);
+        /// Копирует нулевой уровень несжатого изображения, остальные mipLevels - 1 уровней строит блитом в той же отправке
+        bool UploadImage(VkImage image, const uint8_t* pData, uint32_t width, uint32_t height, uint32_t pixelSize, uint32_t mipLevels);
+        /// Формат можно уменьшать блитом с линейной фильтрацией
+        SR_NODISCARD bool IsBlitSupported(VkFormat format) const;
+
+        /// Отправляет накопленные копирования, вызывается раз в кадр перед отправкой кадра. Вернет номер отправки
+        uint64_t Flush();
+
+        /// Копирует первый слой изображения в память процессора в начале следующей отправки.
+        /// Буферы чтения ходят по кругу, пока все заняты, вернет 0, иначе номер копии
+        uint64_t Readback(uint64_t key, VkImage image, VkImageLayout layout, uint32_t width, uint32_t height, uint32_t pixelSize, uint32_t slotsCount);
+        /// Последняя завершенная копия, пиксели идут плотно по строкам. Вернет ее номер или 0
+        uint64_t GetReadback(uint64_t key, std::vector<uint8_t>& data, uint32_t& width, uint32_t& height);
+        /// Ждет копирований по ключу и освобождает буферы, нужно перед удалением изображения
+        void FreeReadback(uint64_t key);
+
+        /// Ждет, пока закончатся копирования в буфер, нужно перед его удалением
+        void WaitBuffer(VkBuffer buffer);
+        /// Ждет, пока закончатся копирования в изображение, нужно перед его удалением
+        void WaitImage(VkImage image);
+        void Wait(uint64_t value);
+
+        void SetFrameBudget(uint64_t bytes) noexcept { m_frameBudget = SR_MAX(bytes, RING_ALIGNMENT); }
+
+        SR_NODISCARD uint64_t GetSubmittedValue() const noexcept { return m_submittedValue; }
+        SR_NODISCARD uint64_t GetCompletedValue() const noexcept { return m_completedValue; }
+        SR_NODISCARD uint64_t GetSubmitsCount() const noexcept { return m_submitsCount; }
+        SR_NODISCARD uint64_t GetUploadedBytes() const noexcept { return m_uploadedBytes; }
+
+    private:
+        SR_NODISCARD bool Reserve(uint64_t size, uint64_t& offset, std::unique_lock<std::recursive_mutex>& lock);
+        SR_NODISCARD bool BeginBatch();
+        SR_NODISCARD bool CopyLevel(VkImage image, uint32_t level, const uint8_t* pData, const MipLevel& mipLevel, uint32_t blockSize, uint32_t blockBytes, std::unique_lock<std::recursive_mutex>& lock);
+        uint64_t SubmitBatch();
+        /// Возвращает место завершенных отправок
+        void Retire(bool wait);
+        void DestroyReadback(Readback& readback, std::unique_lock<std::recursive_mutex>& lock);
+        /// Передает буферам чтения номер отправки, 0 - отправка не удалась
+        void ResolveReadbacks(const Batch& batch, uint64_t value);
+
+        SR_NODISCARD bool IsSubmitThread() const noexcept { return std::this_thread::get_id() == m_submitThread; }
+
+    private:
+        std::recursive_mutex m_mutex;
+        /// Будит потоки, ждущие отправки или места в кольце
+        std::condition_variable_any m_condition;
+        std::thread::id m_submitThread;
+
+        VkDevice m_device = VK_NULL_HANDLE;
+        VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+        VkQueue m_queue = VK_NULL_HANDLE;
+        VmaAllocator m_allocator = VK_NULL_HANDLE;
+
+        VkCommandPool m_commandPool = VK_NULL_HANDLE;
+
+        VkBuffer m_ringBuffer = VK_NULL_HANDLE;
+        VmaAllocation m_ringAllocation = VK_NULL_HANDLE;
+        uint8_t* m_pRingData = nullptr;
+
+        uint64_t m_head = 0;
+        uint64_t m_used = 0;
+
+        std::optional<Batch> m_current;
+        std::deque<Batch> m_inFlight;
+        std::vector<Batch> m_freeBatches;
+
+        uint64_t m_frameBudget = DEFAULT_FRAME_BUDGET;
+        uint64_t m_frameBytes = 0;
+
+        uint64_t m_submittedValue = 0;
+        uint64_t m_completedValue = 0;
+
+        ska::flat_hash_map<uint64_t, Readback> m_readbacks;
+        uint64_t m_readbackTicket = 0;
+
+        uint64_t m_submitsCount = 0;
+        uint64_t m_uploadedBytes = 0;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_VULKAN_UPLOAD_MANAGER_H
@@ -0,0 +1,69 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_DYNAMIC_RESOLUTION_H
+#define SR_ENGINE_GRAPHICS_DYNAMIC_RESOLUTION_H
+
+#include <Utils/Common/NonCopyable.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Подбор масштаба разрешения сцены по времени кадра.
+     * Время кадра берется как большее из времени CPU и GPU, сглаживается и сравнивается с целевым.
+     * Время CPU - это только работа кадра без ожидания вертикальной синхронизации, иначе кадр,
+     * упершийся в частоту экрана, всегда выглядел бы ровно целевым и масштаб не рос бы обратно.
+     * Масштаб меняется ступенями и не чаще раза в несколько кадров, потому что каждая смена
+     * перезаписывает командные буферы с новой областью вывода.
+     */
+    class DynamicResolution : public SR_UTILS_NS::NonCopyable {
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr float_t SCALE_STEP = 0.05f;
+        static constexpr float_t SMOOTHING = 0.1f;
+        /// Запас, чтобы масштаб не колебался около целевого времени
+        static constexpr float_t DOWNSCALE_THRESHOLD = 1.05f;
+        static constexpr float_t UPSCALE_THRESHOLD = 0.85f;
+        static constexpr uint32_t COOLDOWN_FRAMES = 30;
+
+    public:
+        /// Вернет true, если масштаб изменился
+        bool Update();
+
+        /// Границы работы CPU над кадром, ожидание кадра и показ вызываются вне их
+        void BeginCPUWork() noexcept;
+        void EndCPUWork() noexcept;
+
+        void SetEnabled(bool enabled);
+        void SetTargetFrameTime(float_t milliseconds) noexcept { m_targetFrameTime = SR_MAX(milliseconds, 1.f); }
+        void SetBounds(float_t minScale, float_t maxScale) noexcept;
+        /// Время GPU приходит от профилировщика, пока его нет - учитывается только время CPU
+        void SetGPUFrameTime(float_t milliseconds) noexcept { m_gpuFrameTime = milliseconds; }
+
+        SR_NODISCARD bool IsEnabled() const noexcept { return m_enabled; }
+        SR_NODISCARD float_t GetScale() const noexcept { return m_enabled ? m_scale : 1.f; }
+        SR_NODISCARD float_t GetFrameTime() const noexcept { return m_frameTime; }
+        SR_NODISCARD float_t GetTargetFrameTime() const noexcept { return m_targetFrameTime; }
+
+    private:
+        bool m_enabled = false;
+
+        float_t m_targetFrameTime = 1000.f / 60.f;
+        float_t m_minScale = 0.5f;
+        float_t m_maxScale = 1.f;
+        float_t m_scale = 1.f;
+
+        float_t m_cpuFrameTime = 0.f;
+        float_t m_gpuFrameTime = 0.f;
+        float_t m_frameTime = 0.f;
+
+        uint32_t m_cooldown = COOLDOWN_FRAMES;
+
+        /// Работа текущего кадра, сцены рисуются по очереди и их время складывается
+        std::optional<Clock::time_point> m_workStart;
+        float_t m_cpuWorkTime = 0.f;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_DYNAMIC_RESOLUTION_H
@@ -26,15 +26,28 @@ namespace SR_GRAPH_NS {
     public:
         SR_NODISCARD SR_GTYPES_NS::Framebuffer* GetFramebuffer() const noexcept { return m_framebuffer; }
         SR_NODISCARD uint8_t GetLayersCount() const noexcept { return m_layersCount; }
+        SR_NODISCARD bool HasColorLayers() const noexcept { return !m_colorFormats.empty(); }
+        SR_NODISCARD ImageFormat GetColorFormat(uint32_t index) const noexcept;
+        /// Одинаковые вложения, размер и способ использования - буферы могут делить одну память
+        SR_NODISCARD bool IsAliasCompatible(const FrameBufferController& other) const noexcept;
 
         bool LoadFramebufferSettings(const SR_XML_NS::Node& settingsNode);
         bool InitializeFramebuffer(RenderContext* pContext);
 
         void OnResize(const SR_MATH_NS::UVector2& size);
+        void SetResolutionScale(float_t scale);
+        /// Действует до создания буфера, проходы так выбирают свое разрешение
+        void SetPreScale(const SR_MATH_NS::FVector2& preScale);
+        SR_NODISCARD const SR_MATH_NS::FVector2& GetPreScale() const noexcept { return m_preScale; }
+
+        SR_NODISCARD bool IsDynamicResolution() const noexcept { return m_dynamicResolution; }
 
     private:
         bool m_dynamicResizing = false;
         bool m_depthEnabled = true;
+        /// Буфер сцены, масштаб которого меняется по времени кадра
+        bool m_dynamicResolution = false;
+        float_t m_resolutionScale = 1.f;
 
         SR_MATH_NS::FVector2 m_preScale = SR_MATH_NS::FVector2(1.f);
         SR_MATH_NS::IVector2 m_size;
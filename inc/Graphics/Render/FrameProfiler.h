@@ -0,0 +1,104 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_FRAME_PROFILER_H
+#define SR_ENGINE_GRAPHICS_FRAME_PROFILER_H
+
+#include <Graphics/Pipeline/Pipeline.h>
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/FileSystem/Path.h>
+#include <Utils/Types/StringAtom.h>
+
+namespace SR_GRAPH_NS {
+    /// Вложенный участок кадра, времена в микросекундах от начала кадра
+    struct ProfilerScope {
+        SR_UTILS_NS::StringAtom name;
+        uint32_t depth = 0;
+        uint64_t cpuStart = 0;
+        uint64_t cpuDuration = 0;
+        /// Сумма времен командных буферов участка в мс, отрицательное - метки недоступны
+        float_t gpuTime = -1.f;
+        std::vector<int32_t> frameBuffers;
+    };
+
+    struct FrameCapture {
+        uint64_t frame = 0;
+        /// Микросекунды от включения профилировщика
+        uint64_t start = 0;
+        uint64_t cpuDuration = 0;
+        float_t gpuTime = -1.f;
+        float_t swapChainGPUTime = -1.f;
+        std::vector<ProfilerScope> scopes;
+    };
+
+    /**
+     * Профилировщик кадра по проходам.
+     * Время CPU снимается вокруг обновления каждого прохода, время GPU приходит от конвейера по кадровым буферам
+     * и приписывается проходам, которые в них рисуют. Метки GPU читаются без ожидания, поэтому отстают от CPU на
+     * кадр или больше. Последние CAPTURES_COUNT кадров хранятся для оверлеев, тестов и выгрузки в Chrome Trace.
+     */
+    class FrameProfiler : public SR_UTILS_NS::NonCopyable {
+        using Clock = std::chrono::steady_clock;
+        static constexpr uint32_t CAPTURES_COUNT = 120;
+
+    public:
+        struct Statistics {
+            uint32_t samples = 0;
+            float_t averageCPU = 0.f;
+            float_t maxCPU = 0.f;
+            /// Отрицательные, если метки GPU недоступны
+            float_t averageGPU = -1.f;
+            float_t maxGPU = -1.f;
+        };
+
+        class Scope : public SR_UTILS_NS::NonCopyable {
+        public:
+            Scope(FrameProfiler& profiler, SR_UTILS_NS::StringAtom name, std::vector<int32_t> frameBuffers = { });
+            ~Scope() override;
+
+        private:
+            FrameProfiler& m_profiler;
+            int32_t m_index = SR_ID_INVALID;
+
+        };
+
+    public:
+        void SetEnabled(bool enabled);
+
+        void BeginFrame();
+        void EndFrame(const Pipeline::GPUTimings& timings);
+
+        /// Вернет индекс участка для EndScope, SR_ID_INVALID если профилировщик выключен
+        int32_t BeginScope(SR_UTILS_NS::StringAtom name, std::vector<int32_t> frameBuffers = { });
+        void EndScope(int32_t index);
+
+        SR_NODISCARD bool IsEnabled() const noexcept { return m_enabled; }
+        SR_NODISCARD const std::deque<FrameCapture>& GetCaptures() const noexcept { return m_captures; }
+        SR_NODISCARD const FrameCapture* GetLastCapture() const noexcept;
+        /// Статистика участка по всем сохраненным кадрам, время в мс
+        SR_NODISCARD Statistics GetScopeStatistics(SR_UTILS_NS::StringAtom name) const;
+
+        SR_NODISCARD std::string ToChromeTrace() const;
+        bool ExportChromeTrace(const SR_UTILS_NS::Path& path) const;
+
+    private:
+        SR_NODISCARD uint64_t GetTime() const;
+
+    private:
+        std::deque<FrameCapture> m_captures;
+
+        FrameCapture m_current;
+        Clock::time_point m_epoch;
+        Clock::time_point m_frameStart;
+        uint32_t m_depth = 0;
+        uint64_t m_frame = 0;
+
+        bool m_enabled = false;
+        bool m_isFrameActive = false;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_FRAME_PROFILER_H
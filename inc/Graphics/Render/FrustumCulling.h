@@ -25,16 +25,27 @@ namespace SR_GRAPH_NS {
         FrustumPlane nearFace;
     };
 
+    /**
+     * Плоскости строятся по углам двух срезов пирамиды видимости, восстановленным из обратной матрицы.
+     * Глубина срезов одинаково лежит внутри пирамиды при любом диапазоне глубины API,
+     * поэтому ближняя плоскость не проверяется, а нормали смотрят внутрь пирамиды.
+     */
     class FrustumCulling : public SR_UTILS_NS::NonCopyable {
     public:
         FrustumCulling() = default;
 
-        //void UpdateFrustum(const SR_GTYPES_NS::Camera& camera) noexcept;
-        //SR_NODISCARD bool IsSphereInFrustum(const SR_GTYPES_NS::Vector3& center, float_t radius) const noexcept;
+        void UpdateFrustum(const SR_MATH_NS::Matrix4x4& viewProjection) noexcept;
+        SR_NODISCARD bool IsSphereInFrustum(const SR_MATH_NS::FVector3& center, float_t radius) const noexcept;
         //SR_NODISCARD bool IsBoxInFrustum(const SR_GTYPES_NS::Vector3& min, const SR_GTYPES_NS::Vector3& max) const noexcept;
 
+        SR_NODISCARD const Frustum& GetFrustum() const noexcept { return m_frustum; }
+
+    private:
+        SR_NODISCARD static FrustumPlane BuildPlane(const SR_MATH_NS::FVector3& a, const SR_MATH_NS::FVector3& b, const SR_MATH_NS::FVector3& c, const SR_MATH_NS::FVector3& inside) noexcept;
+
     private:
-        SR_MATH_NS::FVector4 m_planes[6];
+        Frustum m_frustum;
+        bool m_isValid = false;
 
     };
 
@@ -0,0 +1,46 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_HIZ_PYRAMID_H
+#define SR_ENGINE_GRAPHICS_HIZ_PYRAMID_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Math/Matrix4x4.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Иерархический Z-буфер на процессоре: каждый уровень хранит самую дальнюю глубину из 2x2 текселей предыдущего.
+     * Глубина в диапазоне [0, 1], как в gl_FragCoord.z, строки идут сверху вниз, как в кадровом буфере.
+     * Пирамида строится по глубине прошлого кадра, поэтому проверка идет с его матрицей вида-проекции.
+     */
+    class HiZPyramid : public SR_UTILS_NS::NonCopyable {
+    public:
+        /// Запас по глубине, чтобы объект не пропадал за собственной поверхностью в буфере
+        static constexpr float_t DEPTH_BIAS = 0.0001f;
+
+    public:
+        void Build(std::vector<float_t>&& depth, uint32_t width, uint32_t height, const SR_MATH_NS::Matrix4x4& viewProjection);
+        void Clear();
+
+        /// Сфера целиком за уже нарисованной геометрией. При любой неясности вернет false
+        SR_NODISCARD bool IsSphereOccluded(const SR_MATH_NS::FVector3& center, float_t radius) const;
+
+        SR_NODISCARD bool IsValid() const noexcept { return !m_levels.empty(); }
+        SR_NODISCARD uint32_t GetLevelsCount() const noexcept { return static_cast<uint32_t>(m_levels.size()); }
+
+    private:
+        struct Level {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            std::vector<float_t> depth;
+        };
+
+    private:
+        std::vector<Level> m_levels;
+        SR_MATH_NS::Matrix4x4 m_viewProjection;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_HIZ_PYRAMID_H
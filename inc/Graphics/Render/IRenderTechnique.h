@@ -14,6 +14,8 @@
 
 #include <Graphics/Pass/GroupPass.h>
 #include <Graphics/Pass/PassQueue.h>
+#include <Graphics/Render/RenderGraph.h>
+#include <Graphics/Render/OffScreenCameraScheduler.h>
 
 namespace SR_GTYPES_NS {
     class Camera;
@@ -29,6 +31,7 @@ namespace SR_GRAPH_NS {
     class IRenderTechnique : public Memory::IGraphicsResource, public GroupPass {
     public:
         using FrameBufferControllerPtr = SR_HTYPES_NS::SharedPtr<FrameBufferController>;
+        using FrameBufferControllers = std::map<SR_UTILS_NS::StringAtom, FrameBufferControllerPtr>;
         using CameraPtr = Types::Camera*;
         using Super = Memory::IGraphicsResource;
         using RenderScenePtr = SR_HTYPES_NS::SafePtr<RenderScene>;
@@ -57,14 +60,22 @@ namespace SR_GRAPH_NS {
 
         void OnResize(const SR_MATH_NS::UVector2& size) override;
         void OnMultisampleChanged() override;
+        void SetResolutionScale(float_t scale);
+        void SetUpdatePolicy(const CameraUpdatePolicy& policy) { m_updatePolicy = policy; }
 
         SR_NODISCARD FrameBufferControllerPtr GetFrameBufferController(SR_UTILS_NS::StringAtom name) const;
+        SR_NODISCARD const FrameBufferControllers& GetFrameBufferControllers() const noexcept { return m_frameBufferControllers; }
 
         SR_GTYPES_NS::Mesh* PickMeshAt(const SR_MATH_NS::FPoint& pos) const;
         SR_GTYPES_NS::Mesh* PickMeshAt(float_t x, float_t y) const;
         SR_GTYPES_NS::Mesh* PickMeshAt(float_t x, float_t y, SR_UTILS_NS::StringAtom passName) const;
         SR_GTYPES_NS::Mesh* PickMeshAt(float_t x, float_t y, const std::vector<SR_UTILS_NS::StringAtom>& passFilter) const;
         SR_NODISCARD const PassQueues& GetQueues() const { return m_queues; }
+        SR_NODISCARD const RenderGraph& GetRenderGraph() const noexcept { return m_renderGraph; }
+        /// Как часто обновляется техника закадровой камеры
+        SR_NODISCARD const CameraUpdatePolicy& GetUpdatePolicy() const noexcept { return m_updatePolicy; }
+        /// С прошлого обновления изменились меши, которые камера техники может видеть
+        SR_NODISCARD bool HasVisibleChanges() const;
 
     protected:
         virtual bool Build() { return true; }
@@ -80,9 +91,11 @@ namespace SR_GRAPH_NS {
         std::atomic<bool> m_dirty = false;
         std::atomic<bool> m_hasErrors = false;
 
-        std::map<SR_UTILS_NS::StringAtom, FrameBufferControllerPtr> m_frameBufferControllers;
+        FrameBufferControllers m_frameBufferControllers;
 
         PassQueues m_queues;
+        RenderGraph m_renderGraph;
+        CameraUpdatePolicy m_updatePolicy;
 
     };
 }
@@ -0,0 +1,91 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_OFF_SCREEN_CAMERA_SCHEDULER_H
+#define SR_ENGINE_GRAPHICS_OFF_SCREEN_CAMERA_SCHEDULER_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/Math/Matrix4x4.h>
+#include <Utils/Math/Vector2.h>
+#include <Utils/Math/Vector3.h>
+#include <Utils/Types/SharedPtr.h>
+
+namespace SR_GTYPES_NS {
+    class Camera;
+}
+
+namespace SR_GRAPH_NS {
+    SR_ENUM_NS_CLASS_T(CameraUpdateMode, uint8_t,
+        EveryFrame,
+        Interval,   /// раз в UpdateInterval кадров
+        OnChange,   /// когда в поле зрения сдвинулся меш или сама камера
+        Budget      /// по кругу, пока сумма стоимостей камер укладывается в бюджет кадра
+    );
+
+    struct CameraUpdatePolicy {
+        CameraUpdateMode mode = CameraUpdateMode::EveryFrame;
+        uint32_t interval = 1;
+    };
+
+    /**
+     * Выбор закадровых камер, которые обновляются в текущем кадре.
+     * Командные буферы пропущенной камеры не отправляются, и ее текстура хранит прошлый кадр.
+     * Решение принимается до обновления техник, поэтому меняет только очередь отправки, а не команды.
+     */
+    class OffScreenCameraScheduler : public SR_UTILS_NS::NonCopyable {
+        using CameraPtr = SR_HTYPES_NS::SharedPtr<SR_GTYPES_NS::Camera>;
+        /// Доля новой стоимости обновления в сглаженной
+        static constexpr float_t SMOOTHING = 0.1f;
+
+    public:
+        struct Statistics {
+            uint64_t rendered = 0;
+            uint64_t skipped = 0;
+            /// Сглаженное время обновления техники камеры, мс
+            float_t updateTime = 0.f;
+        };
+
+    private:
+        struct CameraState {
+            Statistics statistics;
+            uint64_t lastFrame = 0;
+            uint64_t aliveFrame = 0;
+            bool scheduled = true;
+            /// Еще один кадр после изменения, чтобы ушедший из вида меш не остался на текстуре
+            bool trailing = false;
+
+            SR_MATH_NS::FVector3 position;
+            SR_MATH_NS::Quaternion rotation;
+            SR_MATH_NS::UVector2 size;
+        };
+
+    public:
+        /// Вернет true, если набор обновляемых камер изменился и очередь отправки нужно перестроить
+        bool Schedule(const std::vector<CameraPtr>& cameras, bool all);
+
+        void OnUpdated(const SR_GTYPES_NS::Camera* pCamera, float_t milliseconds);
+
+        void SetBudget(float_t milliseconds) noexcept { m_budget = SR_MAX(0.f, milliseconds); }
+
+        SR_NODISCARD bool IsScheduled(const SR_GTYPES_NS::Camera* pCamera) const;
+        SR_NODISCARD float_t GetBudget() const noexcept { return m_budget; }
+        SR_NODISCARD std::map<const SR_GTYPES_NS::Camera*, Statistics> GetStatistics() const;
+
+    private:
+        SR_NODISCARD bool IsCameraChanged(const SR_GTYPES_NS::Camera* pCamera, CameraState& state) const;
+
+        void Apply(CameraState& state, bool scheduled, bool& changed) const;
+
+    private:
+        std::map<const SR_GTYPES_NS::Camera*, CameraState> m_cameras;
+
+        uint64_t m_frame = 0;
+        uint64_t m_budgetCursor = 0;
+        float_t m_budget = 2.f;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_OFF_SCREEN_CAMERA_SCHEDULER_H
@@ -10,7 +10,12 @@
 #include <Utils/Types/SafePointer.h>
 
 #include <Graphics/Render/MeshCluster.h>
+#include <Graphics/Render/DynamicResolution.h>
+#include <Graphics/Render/FrameProfiler.h>
 #include <Graphics/Memory/IGraphicsResource.h>
+#include <Graphics/Memory/ContextResource.h>
+#include <Graphics/Memory/ResourceReleaseQueue.h>
+#include <Graphics/Memory/FramebufferPool.h>
 #include <Graphics/Pipeline/PipelineType.h>
 
 namespace SR_GTYPES_NS {
@@ -28,23 +33,14 @@ namespace SR_GRAPH_NS {
     class IRenderTechnique;
     class Pipeline;
 
-    SR_ENUM_NS_CLASS_T(RCUpdateQueueState, uint8_t,
-       Begin = 0,
-       Framebuffers,
-       Shaders,
-       Textures,
-       Techniques,
-       Materials,
-       Skyboxes,
-       End
-    );
-
     /**
      * Здесь хранятся все контекстные ресурсы.
      * Исключение - меши, потому что они могут быть в нескольких экземплярах.
      * Управлением памяти мешей занимается MeshCluster, который у каждой RenderScene свой.
      */
     class RenderContext : public SR_HTYPES_NS::SafePtr<RenderContext> {
+        /// Минимальный интервал между проходами дефрагментации, в кадрах
+        static constexpr uint64_t DEFRAGMENTATION_INTERVAL = 600;
         using RenderScenePtr = SR_HTYPES_NS::SafePtr<RenderScene>;
         using PipelinePtr = SR_HTYPES_NS::SharedPtr<SR_GRAPH_NS::Pipeline>;
         using Super = SR_HTYPES_NS::SafePtr<RenderContext>;
@@ -88,6 +84,17 @@ namespace SR_GRAPH_NS {
         void Register(MaterialPtr pMaterial);
         void Register(SkyboxPtr pSkybox);
 
+        /// Ресурс будет освобожден после кадров в полете, если у него осталась только точка использования контекста
+        void ScheduleRelease(FramebufferPtr pFrameBuffer);
+        void ScheduleRelease(SR_GTYPES_NS::Shader* pShader);
+        void ScheduleRelease(SR_GTYPES_NS::Texture* pTexture);
+        void ScheduleRelease(IRenderTechnique* pTechnique);
+        void ScheduleRelease(MaterialPtr pMaterial);
+        void ScheduleRelease(SkyboxPtr pSkybox);
+
+        /// Отложенный кадровый буфер с тем же описанием и классом размера, снова зарегистрированный в контексте
+        SR_NODISCARD FramebufferPtr AcquireFramebuffer(uint64_t description, const SR_MATH_NS::IVector2& size);
+
         SR_NODISCARD bool IsOptimizedRenderUpdateEnabled() const noexcept { return m_isOptimizedUpdateEnabled; }
         SR_NODISCARD bool IsEmpty() const;
         SR_NODISCARD bool IsDirty() const;
@@ -110,10 +117,21 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD const std::vector<MaterialPtr>& GetMaterials() const noexcept;
         SR_NODISCARD const std::vector<SR_GTYPES_NS::Skybox*>& GetSkyboxes() const noexcept;
         SR_NODISCARD const RenderScenes& GetScenes() const noexcept { return m_scenes; }
+        SR_NODISCARD const Memory::ResourceReleaseQueue& GetReleaseQueue() const noexcept { return m_releaseQueue; }
+        SR_NODISCARD const Memory::FramebufferPool& GetFramebufferPool() const noexcept { return m_framebufferPool; }
+        SR_NODISCARD DynamicResolution& GetDynamicResolution() noexcept { return m_dynamicResolution; }
+        SR_NODISCARD const DynamicResolution& GetDynamicResolution() const noexcept { return m_dynamicResolution; }
+        SR_NODISCARD FrameProfiler& GetFrameProfiler() noexcept { return m_frameProfiler; }
+        SR_NODISCARD const FrameProfiler& GetFrameProfiler() const noexcept { return m_frameProfiler; }
 
         void SetOptimizedRenderUpdateEnabled(bool enabled) noexcept { m_isOptimizedUpdateEnabled = enabled; }
         bool SetCurrentShader(ShaderPtr pShader);
         void GarbageCollect() { m_isNeedGarbageCollection = true; }
+        /// Сжимает общий пул геометрии: участки мешей переносятся в новые страницы, старые освобождаются после кадров в полете.
+        /// Изображения и буферы EvoVulkan не переносятся, их выделениями движок не владеет
+        void Defragment();
+        /// Включает профилировщик вместе с метками GPU, командные буферы перезаписываются
+        void SetProfilerEnabled(bool enabled);
 
     private:
         bool LoadDefaultResources();
@@ -137,10 +155,22 @@ namespace SR_GRAPH_NS {
             return true;
         }
 
-        template<typename T> bool Update(T& resourceList) noexcept;
+        void ScheduleAllResources();
+        void UpdateDefragmentation();
+        void UpdateDynamicResolution();
+
+        template<typename T> bool Retire(std::vector<T*>& resourceList, T* pRenderResource, RCResourceType type);
+        bool ReleaseResource(const Memory::ResourceReleaseQueue::Entry& entry);
+        void ReviveResource(const Memory::ResourceReleaseQueue::Entry& entry);
 
     private:
-        RCUpdateQueueState m_updateState = RCUpdateQueueState::Begin;
+        Memory::ResourceReleaseQueue m_releaseQueue;
+        Memory::FramebufferPool m_framebufferPool;
+        DynamicResolution m_dynamicResolution;
+        FrameProfiler m_frameProfiler;
+
+        std::optional<uint64_t> m_lastDefragmentationFrame;
+        float_t m_defragmentationThreshold = 0.3f;
 
         std::vector<SR_GTYPES_NS::Framebuffer*> m_framebuffers;
         std::vector<SR_GTYPES_NS::Shader*> m_shaders;
@@ -170,53 +200,67 @@ namespace SR_GRAPH_NS {
 
     /// ------------------------------------------------------------------------------
 
-    template<typename T> bool RenderContext::Update(T& resourceList) noexcept {
-        SR_TRACY_ZONE;
-        
-        bool dirty = false;
+    template<typename T> bool RenderContext::Retire(std::vector<T*>& resourceList, T* pRenderResource, RCResourceType type) {
+        /// ресурс уже ждет освобождения, либо был освобожден, пока находился в очереди
+        auto&& pIt = std::find(resourceList.begin(), resourceList.end(), pRenderResource);
+        if (pIt == resourceList.end()) {
+            return false;
+        }
 
-        static auto&& freeVideoMemory = [](SR_UTILS_NS::IResource* pResource) {
-            /// Ресурс необязательно имеет видеопамять, а лишь содержит другие ресурсы, например материал.
-            if (auto&& pGraphicsResource = dynamic_cast<Memory::IGraphicsResource*>(pResource)) {
-                pGraphicsResource->FreeVideoMemory();
-                pGraphicsResource->DeInitGraphicsResource();
+        auto&& pResource = dynamic_cast<SR_UTILS_NS::IResource*>(pRenderResource);
+        if (!pResource) {
+            return false;
+        }
+
+        const bool retired = pResource->Execute([&]() -> bool {
+            if (pResource->GetCountUses() != 1) {
+                return false;
             }
-        };
 
-        for (auto pIt = std::begin(resourceList); pIt != std::end(resourceList); ) {
-            auto&& pRenderResource = *pIt;
+            SRAssert(pResource->GetContainerParents().empty());
+            resourceList.erase(pIt);
+            return true;
+        });
+
+        if (retired) {
+            m_releaseQueue.Push(pRenderResource, dynamic_cast<Memory::IGraphicsResource*>(pRenderResource), pResource, type);
+        }
 
-            auto&& pResource = dynamic_cast<SR_UTILS_NS::IResource*>(pRenderResource);
+        return retired;
+    }
 
-            if (pResource) {
-                const bool removed = pResource->Execute([&]() -> bool {
-                    if (pResource->GetCountUses() == 1) {
-                        SRAssert(pResource->GetContainerParents().empty());
+    template<typename T> SR_UTILS_NS::IResource::RemoveUPResult Memory::ContextResource<T>::RemoveUsePoint() {
+        auto&& pResource = static_cast<T*>(this);
 
-                        freeVideoMemory(pResource);
+        RenderContext* pContext = nullptr;
+        RemoveUPResult result = { };
 
-                        pResource->RemoveUsePoint();
-                        pIt = resourceList.erase(pIt);
-                        /// После освобождения ресурса необходимо перестроить все контекстные сцены рендера.
-                        dirty |= true;
-                        return true;
-                    }
+        /// снятие точки и проверка выполняются под той же блокировкой, под которой контекст проверяет
+        /// точки в Retire, поэтому одновременное снятие двух последних точек не теряет освобождение
+        Execute([&]() -> bool {
+            result = SR_UTILS_NS::IResource::RemoveUsePoint();
 
-                    return false;
-                });
+            if constexpr (std::is_base_of_v<IGraphicsResource, T>) {
+                SRAssert2(!(pResource->IsCalculated() && GetCountUses() == 0), "Possible multi threading error!");
+            }
 
-                /// TODO: это безопасно?
-                if (!removed) {
-                    ++pIt;
+            if (GetCountUses() == 1) {
+                if constexpr (std::is_base_of_v<IGraphicsResource, T>) {
+                    pContext = pResource->GetRenderContext();
+                }
+                else {
+                    pContext = pResource->GetContext().Get();
                 }
             }
-            else {
-                freeVideoMemory(pResource);
-                ++pIt;
-            }
+
+            return true;
+        });
+
+        if (pContext) {
+            pContext->ScheduleRelease(pResource);
         }
 
-        return dirty;
+        return result;
     }
 }
 
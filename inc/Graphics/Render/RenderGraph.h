@@ -0,0 +1,76 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_RENDER_GRAPH_H
+#define SR_ENGINE_GRAPHICS_RENDER_GRAPH_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Types/StringAtom.h>
+
+#include <Graphics/Pass/PassQueue.h>
+
+namespace SR_GTYPES_NS {
+    class Framebuffer;
+}
+
+namespace SR_GRAPH_NS {
+    class IRenderTechnique;
+    class FrameBufferController;
+
+    /**
+     * Граф зависимостей проходов техники по кадровым буферам.
+     * Запись берется из кадровых буферов прохода, чтение - из сэмплеров с атрибутом FBO.
+     * По зависимостям вычисляется уровень отправки каждого прохода: читающий проход всегда
+     * попадает на уровень после пишущего, между уровнями стоят семафоры.
+     * Для промежуточных буферов считается время жизни и план совмещения памяти.
+     * TODO: план пока не применяется. У кадрового буфера один командный буфер и один семафор на кадр,
+     *  поэтому проходы разных уровней не могут делить один объект буфера, а вложения одного слота
+     *  нужно размещать в общей памяти на стороне Vulkan.
+     */
+    class RenderGraph : public SR_UTILS_NS::NonCopyable {
+    public:
+        using FramebufferPtr = SR_GTYPES_NS::Framebuffer*;
+
+        struct Resource {
+            SR_UTILS_NS::StringAtom name;
+            FramebufferPtr pFrameBuffer = nullptr;
+            FrameBufferController* pController = nullptr;
+            uint32_t writes = 0;
+            uint32_t reads = 0;
+            /// Уровни первого и последнего использования
+            uint32_t firstLevel = SR_UINT32_MAX;
+            uint32_t lastLevel = 0;
+            /// Уровень последней записи, читатели ставятся после него
+            uint32_t writeLevel = SR_UINT32_MAX;
+            uint32_t aliasSlot = SR_UINT32_MAX;
+        };
+
+    public:
+        void Build(const IRenderTechnique* pTechnique);
+        void Clear();
+
+        /// Уровень отправки кадровых буферов прохода, не меньше глубины его очереди
+        SR_NODISCARD uint32_t GetLevel(const BasePass* pPass, uint32_t queueDepth) const;
+
+        SR_NODISCARD const std::vector<Resource>& GetResources() const noexcept { return m_resources; }
+        SR_NODISCARD uint32_t GetTransientCount() const noexcept { return m_transientCount; }
+        SR_NODISCARD uint32_t GetAliasSlotsCount() const noexcept { return m_aliasSlotsCount; }
+        SR_NODISCARD uint32_t GetHazardsCount() const noexcept { return m_hazardsCount; }
+
+    private:
+        SR_NODISCARD uint32_t FindOrAddResource(FramebufferPtr pFrameBuffer);
+        void BuildAliasing();
+
+    private:
+        std::vector<Resource> m_resources;
+        ska::flat_hash_map<const BasePass*, uint32_t> m_levels;
+
+        uint32_t m_transientCount = 0;
+        uint32_t m_aliasSlotsCount = 0;
+        uint32_t m_hazardsCount = 0;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_RENDER_GRAPH_H
@@ -8,6 +8,9 @@
 #include <Utils/Types/SharedPtr.h>
 #include <Utils/Types/SortedVector.h>
 #include <Graphics/Memory/UBOManager.h>
+#include <Graphics/Memory/IndirectDrawBuffer.h>
+#include <Graphics/Render/FrustumCulling.h>
+#include <Graphics/Utils/MeshletBuilder.h>
 
 namespace SR_GTYPES_NS {
     class Shader;
@@ -15,6 +18,7 @@ namespace SR_GTYPES_NS {
 }
 
 namespace SR_GRAPH_NS {
+    class BaseMaterial;
     class MeshDrawerPass;
     class RenderStrategy;
     class RenderContext;
@@ -34,15 +38,33 @@ namespace SR_GRAPH_NS {
             QUEUE_STATE_ERROR         = 1 << 1,
             QUEUE_STATE_VBO_ERROR     = QUEUE_STATE_ERROR | 1 << 2,
             QUEUE_STATE_SHADER_ERROR  = QUEUE_STATE_ERROR | 1 << 3,
+            /// Шейдер прохода ждет другой формат вершин, чем собран у меша
+            QUEUE_STATE_FORMAT_ERROR  = QUEUE_STATE_ERROR | 1 << 4,
         };
         typedef uint8_t QueueStateFlags;
 
+        /// Допустимая ошибка уровня детализации на экране, в пикселях
+        static constexpr float_t LOD_PIXEL_ERROR = 1.f;
+        /// Переход на более грубый уровень только с запасом, чтобы уровни не мигали на границе
+        static constexpr float_t LOD_HYSTERESIS = 0.25f;
+        /// При неравномерном масштабе конус нормалей в мировых координатах неверен и не проверяется
+        static constexpr float_t CLUSTER_SCALE_TOLERANCE = 0.01f;
+        /// Сколько обновлений подряд меш должен быть закрыт, чтобы его перестали рисовать
+        static constexpr uint8_t OCCLUSION_CONFIRM_UPDATES = 4;
+
         struct MeshInfo {
             ShaderUseInfo shaderUseInfo = {};
             VBO vbo = 0;
             MeshPtr pMesh = nullptr;
             int64_t priority = 0;
             QueueStateFlags state = QUEUE_STATE_ERROR;
+            /// Уровень детализации для камеры прохода, без учета сдвига прохода
+            uint8_t lod = 0;
+            uint8_t occludedUpdates = 0;
+            /// Первый слот косвенной отрисовки, записанный в команды, SR_UINT32_MAX - меш рисуется напрямую
+            uint32_t drawSlot = SR_UINT32_MAX;
+            uint32_t drawSlotsCount = 0;
+            bool occluded = false;
             bool hasVBO = false;
 
             bool operator==(const MeshInfo& other) const noexcept {
@@ -89,6 +111,12 @@ namespace SR_GRAPH_NS {
             }
         };
 
+        struct DirtyMeshHash {
+            SR_NODISCARD size_t operator()(const std::pair<MeshPtr, ShaderPtr>& key) const noexcept {
+                return SR_UTILS_NS::HashCombine(key.second, std::hash<MeshPtr>()(key.first));
+            }
+        };
+
         using Queue = SR_HTYPES_NS::SortedVector<MeshInfo, RenderQueueLessPredicate>;
 
     public:
@@ -105,16 +133,52 @@ namespace SR_GRAPH_NS {
 
         void OnMeshDirty(MeshPtr pMesh, ShaderUseInfo info);
 
+        /// Среди ожидающих обновления мешей есть попадающие в пирамиду камеры прохода
+        SR_NODISCARD bool HasVisibleChanges() const;
+
         SR_NODISCARD const std::vector<std::pair<Layer, Queue>>& GetQueues() const noexcept { return m_queues; }
+        /// Кластеры крупных мешей, проверенные при последнем обновлении, и сколько из них видно
+        SR_NODISCARD uint32_t GetClustersCount() const noexcept { return m_clustersCount; }
+        SR_NODISCARD uint32_t GetVisibleClustersCount() const noexcept { return m_visibleClustersCount; }
+        SR_NODISCARD uint32_t GetOccludedMeshesCount() const noexcept { return m_occludedMeshesCount; }
+        /// Треугольники, отправленные за кадр с учетом уровней, кластеров и перекрытия
+        SR_NODISCARD uint64_t GetSubmittedTrianglesCount() const noexcept { return m_submittedTrianglesCount; }
 
     protected:
         virtual void CustomDrawMesh(const MeshInfo& info) { }
+        /// Кластер, прошедший пирамиду и конус нормалей, можно отбросить по перекрытию
+        SR_NODISCARD virtual bool IsClusterOccluded(const SR_MATH_NS::FVector3& center, float_t radius) const;
 
         SR_NODISCARD MeshDrawerPass* GetMeshDrawerPass() const noexcept { return m_meshDrawerPass; }
 
     private:
         void UpdateShaders();
         void UpdateMeshes();
+        void UpdateLods();
+        void UpdateClusters();
+        /// Переписывает слоты косвенной отрисовки под текущие уровни детализации и видимые кластеры
+        void UpdateIndirectDraws();
+        void UpdateOcclusion();
+        /// Сообщает стримеру размер текстур видимых мешей на экране
+        void UpdateTextureStreaming();
+
+        void CullClusters(MeshPtr pMesh, const Meshlets& meshlets, const SR_MATH_NS::FVector3& cameraPosition, IndexRanges& ranges);
+
+        /// Уровень, которым меш рисуется в проходе, с учетом сдвига прохода
+        SR_NODISCARD uint8_t GetDrawLod(const MeshInfo& info) const;
+        /// Сжатые вершины меша совпадают с форматом шейдера, которым его рисует проход
+        SR_NODISCARD static bool IsVertexFormatCompatible(MeshPtr pMesh, ShaderPtr pShader);
+        /// Ограничивающая сфера меша в мире, радиус в w
+        SR_NODISCARD static SR_MATH_NS::FVector4 GetBoundingSphere(MeshPtr pMesh);
+        /// Слот на каждый кластер, если они отсекаются, иначе один слот под уровень детализации или перекрытие
+        SR_NODISCARD uint32_t GetDrawSlotsCount(MeshPtr pMesh) const;
+        SR_NODISCARD Memory::DrawIndexedCommand GetDrawCommand(MeshPtr pMesh, const IndexRange& range) const;
+        /// Видимые участки или уровень меша, оставшиеся слоты и слоты перекрытого меша ничего не рисуют
+        /// Возвращает число треугольников в записанных командах
+        uint32_t WriteDrawSlots(const MeshInfo& info);
+        SR_NODISCARD uint8_t SelectLod(const MeshInfo& info, const SR_MATH_NS::FVector3& cameraPosition, float_t pixelsPerUnit) const;
+        /// Диаметр ограничивающей сферы на экране в пикселях, UINT32_MAX если камера внутри нее
+        SR_NODISCARD uint32_t CalculateScreenSize(const MeshInfo& info, const SR_MATH_NS::FVector3& cameraPosition, float_t pixelsPerUnit) const;
 
         SR_NODISCARD bool IsSuitable(const MeshRegistrationInfo& info) const;
 
@@ -144,6 +208,26 @@ namespace SR_GRAPH_NS {
 
         SR_HTYPES_NS::SortedVector<ShaderUseInfo, ShaderQueueLessPredicate> m_shaders;
         std::vector<std::pair<MeshPtr, ShaderUseInfo>> m_meshes;
+        /// Пока очередь не обновлялась, меш могут пометить много раз, в m_meshes он попадает однажды
+        ska::flat_hash_set<std::pair<MeshPtr, ShaderPtr>, DirtyMeshHash> m_dirtyMeshes;
+        /// Где меш был, когда его последний раз вывели: уход из пирамиды тоже меняет кадр
+        ska::flat_hash_map<MeshPtr, SR_MATH_NS::FVector4> m_submittedBounds;
+
+        FrustumCulling m_frustumCulling;
+        /// Уровни детализации и видимые кластеры меняются через слоты, а не перезаписью команд
+        Memory::IndirectDrawBuffer m_indirectDraws;
+        uint32_t m_nextDrawSlot = 0;
+        /// Отсекались ли кластеры и перекрытые меши при записи команд, от этого зависит число слотов
+        bool m_isClusterCulling = false;
+        bool m_isOcclusionCulling = false;
+        /// Видимые участки мешей, которые рисуются по кластерам
+        ska::flat_hash_map<MeshPtr, IndexRanges> m_clusterRanges;
+        /// Наибольший размер на экране среди мешей материала, пересобирается каждое обновление
+        ska::flat_hash_map<BaseMaterial*, uint32_t> m_materialScreenSizes;
+        uint32_t m_clustersCount = 0;
+        uint32_t m_visibleClustersCount = 0;
+        uint32_t m_occludedMeshesCount = 0;
+        uint64_t m_submittedTrianglesCount = 0;
 
         MeshDrawerPass* m_meshDrawerPass = nullptr;
         RenderContext* m_renderContext = nullptr;
@@ -13,6 +13,7 @@
 #include <Graphics/Render/RenderStrategy.h>
 #include <Graphics/Render/FlatCluster.h>
 #include <Graphics/Render/SortedMeshQueue.h>
+#include <Graphics/Render/OffScreenCameraScheduler.h>
 #include <Graphics/GUI/WidgetManager.h>
 #include <Graphics/Pass/PassQueue.h>
 
@@ -105,6 +106,7 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD RenderStrategy* GetRenderStrategy() { return m_renderStrategy.Get(); }
         SR_NODISCARD CameraPtr GetFirstOffScreenCamera() const;
         SR_NODISCARD SR_MATH_NS::UVector2 GetSurfaceSize() const;
+        SR_NODISCARD OffScreenCameraScheduler& GetCameraScheduler() noexcept { return m_cameraScheduler; }
 
     private:
         void SetMeshMaterial(MeshPtr pMesh);
@@ -117,6 +119,8 @@ namespace SR_GRAPH_NS {
         void PrepareRender();
         void Build();
         void BuildQueue();
+        /// Команды не меняются, меняется только набор отправляемых кадровых буферов
+        void RebuildSubmitQueue();
         void Update();
         void PostUpdate();
 
@@ -142,6 +146,8 @@ namespace SR_GRAPH_NS {
 
         PassQueues m_queues;
 
+        OffScreenCameraScheduler m_cameraScheduler;
+
         SR_MATH_NS::UVector2 m_surfaceSize;
 
         SR_HTYPES_NS::SafeVar<uint32_t> m_dirty = 0;
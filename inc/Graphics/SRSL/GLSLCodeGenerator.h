@@ -54,6 +54,8 @@ namespace SR_SRSL_NS {
         SR_NODISCARD std::string GenerateTab(int32_t deep) const;
 
         SR_NODISCARD std::string VertexAttributeToString(Vertices::Attribute attribute) const;
+        SR_NODISCARD std::string GenerateVertexDecodeFunctions() const;
+        SR_NODISCARD std::string GenerateVertexDecode(Vertices::VertexType vertexType) const;
 
     private:
         const SRSLShader* m_shader = nullptr;
@@ -21,6 +21,8 @@ namespace SR_SRSL_NS {
         bool isPublic = false;
         uint64_t binding = 0;
         int32_t attachment = -1;
+        /// Больше одного для массива текстур (BINDLESS_TEXTURES)
+        uint32_t count = 1;
         std::set<ShaderStage> stages;
         SR_UTILS_NS::StringAtom defaultValue;
     };
@@ -70,6 +72,7 @@ namespace SR_SRSL_NS {
         SR_NODISCARD const SRSLUniformBlock::Field* FindField(const SR_UTILS_NS::StringAtom& name) const;
         SR_NODISCARD Vertices::VertexType GetVertexType() const;
         SR_NODISCARD SR_SRSL_NS::ShaderType GetType() const;
+        SR_NODISCARD VertexFormat GetVertexFormat() const noexcept { return m_vertexFormat; }
         SR_NODISCARD const SRSLAnalyzedTree::Ptr GetAnalyzedTree() const;
         SR_NODISCARD const SRSLUseStack::Ptr GetUseStack() const;
         SR_NODISCARD const UniformBlocks& GetUniformBlocks() const { return m_uniformBlocks; }
@@ -106,6 +109,7 @@ namespace SR_SRSL_NS {
         std::vector<std::pair<SR_UTILS_NS::StringAtom, SRSLVariable*>> m_shared;
         std::map<SR_UTILS_NS::StringAtom, SRSLVariable*> m_constants;
         ShaderType m_type = ShaderType::Unknown;
+        VertexFormat m_vertexFormat = VertexFormat::Full;
         SRShaderCreateInfo m_createInfo;
         SRSLAnalyzedTree::Ptr m_analyzedTree;
         SRSLUseStack::Ptr m_useStack;
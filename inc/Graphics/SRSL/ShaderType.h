@@ -31,6 +31,11 @@ namespace SR_SRSL_NS {
         RayTrace           /// шейдер трассировки лучей
     );
 
+    SR_ENUM_NS_CLASS_T(VertexFormat, uint8_t,
+        Full,               /// вершины хранятся в fp32
+        Quantized           /// сжатые вершины, распаковываются в начале вершинного шейдера
+    );
+
     enum VertexAttribute {
         SRSL_VERTEX_ATTRIBUTE_AUTO = 0,
         SRSL_VERTEX_ATTRIBUTE_POSITION = 1 << 0,
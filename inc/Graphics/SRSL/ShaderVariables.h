@@ -12,6 +12,7 @@ namespace SR_SRSL_NS {
             { "SHADOW_CASCADE_INDEX",           "int"           },
             { "COLOR_BUFFER_MODE",              "int"           },
             { "COLOR_BUFFER_VALUE",             "vec3"          },
+            { "BLUR_LAYER",                     "int"           },
     };
 
     SR_INLINE_STATIC const std::map<std::string, std::string> SR_SRSL_DEFAULT_SHARED_UNIFORMS = { /** NOLINT */
@@ -25,11 +26,16 @@ namespace SR_SRSL_NS {
             { "TIME",                           "float"         },
 
             { "RESOLUTION",                     "vec2"          },
+            { "RESOLUTION_SCALE",               "vec2"          },
             { "ASPECT",                         "vec2"          },
 
             { "CASCADE_LIGHT_SPACE_MATRICES",   "mat4[4]"       },
             { "CASCADE_SPLITS",                 "vec4"          },
 
+            { "VSM_EXPONENTS",                  "vec2"          },
+            { "VSM_LIGHT_BLEEDING_REDUCTION",   "float"         },
+            { "VSM_MIN_VARIANCE",               "float"         },
+
             { "DIRECTIONAL_LIGHT_POSITION",     "vec3"          },
             { "VIEW_POSITION",                  "vec3"          },
             { "VIEW_DIRECTION",                 "vec3"          },
@@ -56,6 +62,17 @@ namespace SR_SRSL_NS {
             { "LINE_END_POINT",                 "vec3"          },
 
             { "SSAO_SAMPLES",                   "vec4[64]"      },
+            { "SSAO_SAMPLES_COUNT",             "int"           },
+            { "SSAO_SAMPLES_OFFSET",            "int"           },
+            { "SSAO_TEMPORAL_WEIGHT",           "float"         },
+            { "SSAO_PREV_VIEW_PROJECTION",      "mat4"          },
+
+            { "BLUR_DIRECTION",                 "vec2"          },
+            { "BLUR_RADIUS",                    "int"           },
+
+            { "DOWNSAMPLE_FACTOR",              "int"           },
+            { "UPSAMPLE_FACTOR",                "int"           },
+            { "UPSAMPLE_DEPTH_SIGMA",           "float"         },
 
             { "LINE_COLOR",                     "vec4"          },
 
@@ -65,10 +82,17 @@ namespace SR_SRSL_NS {
             { "TEXT_RECT_HEIGHT",               "float"         },
     };
 
+    /// Границы AABB меша для распаковки сжатых позиций, добавляются в BLOCK при VertexFormat Quantized
+    SR_INLINE_STATIC const std::map<std::string, std::string> SR_SRSL_QUANTIZED_VERTEX_UNIFORMS = { /** NOLINT */
+            { "VERTEX_BOUNDS_MIN",              "vec3"          },
+            { "VERTEX_BOUNDS_SIZE",             "vec3"          },
+    };
+
     SR_INLINE_STATIC const std::map<std::string, std::string> SR_SRSL_DEFAULT_SAMPLERS = { /** NOLINT */
             { "SKYBOX_DIFFUSE",                 "samplerCube"   },
             { "TEXT_ATLAS_TEXTURE",             "sampler2D"     },
             { "SSAO_NOISE",                     "sampler2D"     },
+            { "BINDLESS_TEXTURES",              "sampler2D"     },
     };
 
     SR_INLINE_STATIC const std::string SR_SRSL_MAIN_OUT_LAYER = "COLOR_INDEX_0"; /** NOLINT */
@@ -104,6 +104,9 @@ namespace SR_GTYPES_NS {
         void OnEnable() override;
         void OnDisable() override;
 
+    private:
+        void ReleaseRenderTechnique(SR_UTILS_NS::IResource* pResource);
+
     private:
         /** >= 0 - одна главная камера, < 0 - закадровые камеры, которые рендерятся в RenderTexture.
          * Выбирается та камера, что ближе к нулю */
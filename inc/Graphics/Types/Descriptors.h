@@ -9,8 +9,28 @@
 
 namespace SR_GRAPH_NS {
     enum class DescriptorType {
-        Unknown, Uniform, CombinedImage, Storage
+        Unknown, Uniform, CombinedImage, Storage,
+        /// Буфер юниформ объекта, участок страницы выбирается смещением при привязке набора
+        DynamicUniform
     };
+
+    /// Ресурс, записанный в конкретный биндинг набора дескрипторов
+    struct DescriptorBinding {
+        uint32_t binding = 0;
+        DescriptorType type = DescriptorType::Unknown;
+        int32_t resource = SR_ID_INVALID;
+        uint32_t range = 0;
+        /// Поколение таблицы для bindless массива
+        uint64_t generation = 0;
+        bool isAttachment = false;
+
+        SR_NODISCARD bool operator==(const DescriptorBinding& other) const noexcept {
+            return binding == other.binding && type == other.type && resource == other.resource
+                && range == other.range && generation == other.generation && isAttachment == other.isAttachment;
+        }
+    };
+
+    using DescriptorBindings = std::vector<DescriptorBinding>;
 }
 
 #endif //SR_ENGINE_DESCRIPTORS_H
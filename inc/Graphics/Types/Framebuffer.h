@@ -10,6 +10,7 @@
 #include <Utils/Resources/IResource.h>
 
 #include <Graphics/Memory/IGraphicsResource.h>
+#include <Graphics/Memory/ContextResource.h>
 #include <Graphics/Pipeline/TextureHelper.h>
 #include <Graphics/Pipeline/FrameBufferFeatures.h>
 
@@ -27,10 +28,10 @@ namespace SR_GTYPES_NS {
     /**
      * \Usage Bing -> BeginRenderBuffer -> BeginRender -> EndRender -> EndRenderBuffer
      * */
-    class Framebuffer : public SR_UTILS_NS::IResource, public Memory::IGraphicsResource {
+    class Framebuffer : public Memory::ContextResource<Framebuffer>, public Memory::IGraphicsResource {
     public:
         using Ptr = Framebuffer*;
-        using Super = SR_UTILS_NS::IResource;
+        using Super = Memory::ContextResource<Framebuffer>;
         using ClearColors = std::vector<SR_MATH_NS::FColor>;
         using PipelinePtr = SR_HTYPES_NS::SharedPtr<Pipeline>;
     private:
@@ -45,6 +46,10 @@ namespace SR_GTYPES_NS {
         static Ptr Create(const std::list<ImageFormat>& colors, ImageFormat depth, const SR_MATH_NS::IVector2& size, uint8_t samples, uint32_t layersCount);
         static Ptr Create(const std::list<ImageFormat>& colors, ImageFormat depth, const SR_MATH_NS::IVector2& size, uint8_t samples, uint32_t layersCount, ImageAspect depthAspect);
 
+        /// Буферы с одинаковым описанием отличаются только размером и могут заменять друг друга
+        SR_NODISCARD static uint64_t HashDescription(const std::list<ImageFormat>& colors, ImageFormat depth, ImageAspect depthAspect,
+            uint8_t samples, uint32_t layersCount, const FrameBufferFeatures& features, bool depthEnabled);
+
     public:
         bool Update();
         bool Bind();
@@ -66,6 +71,11 @@ namespace SR_GTYPES_NS {
         void SetLayersCount(uint32_t layersCount);
         void SetDepthAspect(ImageAspect depthAspect);
         void SetFeatures(const FrameBufferFeatures& features);
+        /// Рисовать только в часть буфера, память при этом не пересоздается
+        void SetViewportScale(float_t scale);
+        /// Размер содержимого, память выделяется по классу размера FramebufferPool и пересоздается,
+        /// только когда содержимое не помещается или память больше класса на целый шаг
+        void SetContentSize(const SR_MATH_NS::IVector2& size);
 
         SR_NODISCARD bool IsFileResource() const noexcept override { return false; }
         SR_NODISCARD uint8_t GetSamplesCount() const;
@@ -83,7 +93,15 @@ namespace SR_GTYPES_NS {
 
         SR_NODISCARD uint32_t GetWidth() const;
         SR_NODISCARD uint32_t GetHeight() const;
+        /// Размер выделенной памяти
         SR_NODISCARD SR_MATH_NS::IVector2 GetSize() const { return m_size; }
+        SR_NODISCARD SR_MATH_NS::IVector2 GetContentSize() const { return m_contentSize.HasZero() ? m_size : m_contentSize; }
+        /// Часть памяти, в которую рисуется кадр, с учетом масштаба
+        SR_NODISCARD SR_MATH_NS::IVector2 GetViewportSize() const;
+        /// Доля памяти, занятая кадром, по ней читающие проходы масштабируют UV
+        SR_NODISCARD SR_MATH_NS::FVector2 GetViewportUVScale() const;
+        SR_NODISCARD float_t GetViewportScale() const noexcept { return m_viewportScale; }
+        SR_NODISCARD uint64_t GetDescriptionHash() const;
 
         void FreeVideoMemory() override;
         uint64_t GetFileHash() const override;
@@ -99,6 +117,9 @@ namespace SR_GTYPES_NS {
         int32_t m_frameBuffer = SR_ID_INVALID;
 
         SR_MATH_NS::IVector2 m_size = { };
+        /// Нулевой - содержимое занимает всю память
+        SR_MATH_NS::IVector2 m_contentSize = { };
+        float_t m_viewportScale = 1.f;
 
         uint8_t m_layersCount = 1;
 
@@ -6,8 +6,11 @@
 #define SR_ENGINE_GRAPHICS_INDEXEDMESH_H
 
 #include <Graphics/Memory/MeshManager.h>
+#include <Graphics/Memory/GeometryPool.h>
 #include <Graphics/Types/Mesh.h>
 #include <Graphics/Pipeline/Pipeline.h>
+#include <Graphics/Utils/MeshOptimizer.h>
+#include <Graphics/Utils/MeshCache.h>
 
 namespace SR_GTYPES_NS {
     class IndexedMesh : public Mesh {
@@ -21,13 +24,29 @@ namespace SR_GTYPES_NS {
     public:
         SR_NODISCARD int32_t GetIBO() override;
         SR_NODISCARD int32_t GetVBO() override;
+        SR_NODISCARD uint32_t GetFirstIndex() override;
+        SR_NODISCARD int32_t GetVertexOffset() override;
 
         SR_NODISCARD uint32_t GetVerticesCount() const { return m_countVertices; }
-        SR_NODISCARD uint32_t GetIndicesCount() const override { return m_countIndices; }
+        SR_NODISCARD uint32_t GetIndicesCount() const override;
+        SR_NODISCARD uint8_t GetLodCount() const override { return SR_MAX(static_cast<uint8_t>(m_lods.size()), static_cast<uint8_t>(1)); }
+        SR_NODISCARD float_t GetLodError(uint8_t lod) const override;
+        SR_NODISCARD IndexRange GetLodRange(uint8_t lod) const override;
+        SR_NODISCARD float_t GetBoundingRadius() const override { return m_boundingRadius; }
+        SR_NODISCARD const Meshlets* GetMeshlets() const override { return m_meshlets.empty() ? nullptr : &m_meshlets; }
 
         SR_NODISCARD virtual std::vector<uint32_t> GetIndices() const { return { }; }
 
         SR_NODISCARD bool IsSupportVBO() const override { return true; }
+        SR_NODISCARD Vertices::VertexType GetVertexType() const override { return m_vertexType; }
+        /// m_VBO и m_IBO хранят участки GeometryPool, а не буферы конвейера
+        SR_NODISCARD bool IsPooled() const noexcept { return m_isPooled; }
+        /// Меш умеет загружать сжатые вершины, если их требует шейдер (VertexFormat Quantized)
+        SR_NODISCARD virtual bool IsQuantizationSupported() const { return false; }
+        SR_NODISCARD bool IsQuantizationRequired() const;
+        /// Формат вершин в видеопамяти не совпадает с тем, что ожидает текущий шейдер
+        SR_NODISCARD bool IsVertexFormatOutdated() const;
+        SR_NODISCARD const Vertices::QuantizationBounds& GetQuantizationBounds() const noexcept { return m_quantizationBounds; }
 
         bool Calculate() override;
 
@@ -37,15 +56,58 @@ namespace SR_GTYPES_NS {
 
         template<Vertices::VertexType type, typename Vertex> bool CalculateVBO(const std::vector<Vertex>& vertices);
         template<Vertices::VertexType type, typename Vertex> bool CalculateVBO(const SR_HTYPES_NS::Function<std::vector<Vertex>()>& getter);
+        /// Берет поток вершин из MeshCache, если его там нет - строит через getter и дописывает в кэш
+        template<Vertices::VertexType type, typename Vertex> bool CalculateBakedVBO(const SR_HTYPES_NS::Function<std::vector<Vertex>()>& getter);
+        template<Vertices::VertexType type, typename Vertex> bool CalculateQuantizedVBO();
 
         bool FreeVBO();
         bool FreeIBO();
 
+    private:
+        template<Vertices::VertexType type, typename Vertex> bool AllocateVBO(const std::vector<Vertex>& vertices, Memory::MeshManager::Hash alias);
+        /// Буфер с тем же хэшем содержимого, если его байты совпадают с pData. При совпадении одного хэша обнулит key
+        template<Memory::MeshMemoryType memType> SR_NODISCARD int32_t CopyIfEqual(Memory::MeshManager::Hash& key, const void* pData, uint64_t size);
+
+    protected:
+        void UseQuantizationBounds();
+
+        /// Геометрия после MeshOptimizer, общая для всех мешей с тем же идентификатором. Без оптимизации совпадает с исходной
+        SR_NODISCARD std::vector<SR_UTILS_NS::Vertex> GetOptimizedVertices() const;
+        SR_NODISCARD std::vector<uint32_t> GetOptimizedIndices() const;
+        SR_NODISCARD MeshOptimizer::OptimizedMeshPtr GetOptimizedMesh() const;
+        SR_NODISCARD MeshCache::BakedMeshPtr GetBakedMesh() const;
+        /// Запеченный меш без запекания, исходная геометрия не нужна
+        SR_NODISCARD MeshCache::BakedMeshPtr FindBakedMesh() const;
+
+        /// Геометрия не меняется после загрузки, поэтому границы кластеров остаются верными
+        SR_NODISCARD virtual bool IsClusterCullingSupported() const { return false; }
+
+        /// Меш отдает исходную геометрию через GetSourceVertices/GetSourceIndices
+        SR_NODISCARD virtual bool IsOptimizable() const { return false; }
+        SR_NODISCARD virtual std::vector<SR_UTILS_NS::Vertex> GetSourceVertices() const { return { }; }
+        SR_NODISCARD virtual std::vector<uint32_t> GetSourceIndices() const { return { }; }
+
+        /// Файл, из которого загружен меш, и номер меша в нем. Пустой путь - меш не запекается
+        SR_NODISCARD virtual SR_UTILS_NS::Path GetBakedMeshSource() const { return SR_UTILS_NS::Path(); }
+        SR_NODISCARD virtual uint32_t GetBakedMeshIndex() const { return 0; }
+        virtual void OnMeshBaked(MeshCache::BakedMesh& bakedMesh) const { }
+
+    private:
+        void UpdateLods();
+
+        SR_NODISCARD MeshOptimizer::OptimizedMeshPtr OptimizeSourceMesh() const;
+
     protected:
         int32_t m_IBO = SR_ID_INVALID;
         int32_t m_VBO = SR_ID_INVALID;
         uint32_t m_countIndices = 0;
         uint32_t m_countVertices = 0;
+        bool m_isPooled = false;
+        Vertices::VertexType m_vertexType = Vertices::VertexType::Unknown;
+        Vertices::QuantizationBounds m_quantizationBounds;
+        std::vector<MeshOptimizer::Lod> m_lods;
+        Meshlets m_meshlets;
+        float_t m_boundingRadius = 0.f;
 
     };
 
@@ -59,24 +121,66 @@ namespace SR_GTYPES_NS {
 
         using namespace Memory;
 
+        m_isPooled = GeometryPool::Instance().IsEnabled();
+        m_vertexType = type;
+
+        const MeshManager::Hash alias = IsUniqueMesh() ? 0 : MeshManager::HashIdentifier(GetMeshIdentifier(), type);
+
         if (!IsUniqueMesh()) {
-            m_VBO = MeshManager::Instance().CopyIfExists<type, MeshMemoryType::VBO>(GetMeshIdentifier());
+            m_VBO = MeshManager::Instance().CopyByAlias<MeshMemoryType::VBO>(alias);
         }
 
         if (m_VBO == SR_ID_INVALID) {
-            auto&& vertices = getter();
-            return CalculateVBO<type>(vertices);
+            return AllocateVBO<type>(getter(), alias);
         }
 
-        if (!IsUniqueMesh()) {
-            m_countVertices = MeshManager::Instance().Size<type, MeshMemoryType::VBO>(
-                GetMeshIdentifier()
-            );
-        }
+        m_countVertices = MeshManager::Instance().Size<MeshMemoryType::VBO>(m_VBO);
 
         return true;
     }
 
+    template<Vertices::VertexType type, typename Vertex> bool IndexedMesh::CalculateBakedVBO(const SR_HTYPES_NS::Function<std::vector<Vertex>()>& getter) {
+        SR_TRACY_ZONE;
+
+        auto&& pBaked = GetBakedMesh();
+
+        if (auto&& pStream = pBaked ? pBaked->FindStream(type) : nullptr) {
+            return CalculateVBO<type, Vertex>([pStream]() {
+                return MeshCache::GetVertices<Vertex>(*pStream);
+            });
+        }
+
+        return CalculateVBO<type, Vertex>([this, &getter, &pBaked]() {
+            auto&& vertices = getter();
+            if (pBaked) {
+                MeshCache::Instance().AddStream(GetMeshIdentifier(), pBaked, type, vertices.data(), sizeof(Vertex), static_cast<uint32_t>(vertices.size()));
+            }
+            return vertices;
+        });
+    }
+
+    template<Vertices::VertexType type, typename Vertex> bool IndexedMesh::CalculateQuantizedVBO() {
+        SR_TRACY_ZONE;
+
+        std::vector<SR_UTILS_NS::Vertex> vertices;
+
+        /// границы запеченного меша совпадают с посчитанными по его вершинам
+        if (auto&& pBaked = GetBakedMesh()) {
+            m_quantizationBounds = pBaked->bounds;
+        }
+        else {
+            vertices = GetOptimizedVertices();
+            m_quantizationBounds = Vertices::CalculateQuantizationBounds(vertices);
+        }
+
+        return CalculateBakedVBO<type, Vertex>([this, &vertices]() {
+            if (vertices.empty()) {
+                vertices = GetOptimizedVertices();
+            }
+            return Vertices::QuantizeVertices<Vertex>(vertices, m_quantizationBounds);
+        });
+    }
+
     template<Vertices::VertexType type, typename Vertex> bool IndexedMesh::CalculateVBO(const std::vector<Vertex>& vertices) {
         SR_TRACY_ZONE;
 
@@ -85,39 +189,79 @@ namespace SR_GTYPES_NS {
 
         using namespace Memory;
 
+        m_isPooled = GeometryPool::Instance().IsEnabled();
+        m_vertexType = type;
+
+        const MeshManager::Hash alias = IsUniqueMesh() ? 0 : MeshManager::HashIdentifier(GetMeshIdentifier(), type);
+
         if (!IsUniqueMesh()) {
-            m_VBO = MeshManager::Instance().CopyIfExists<type, MeshMemoryType::VBO>(GetMeshIdentifier());
+            m_VBO = MeshManager::Instance().CopyByAlias<MeshMemoryType::VBO>(alias);
         }
 
         if (m_VBO == SR_ID_INVALID) {
-            if ((m_countVertices = vertices.size()) == 0) {
-                SR_ERROR("IndexedMesh::CalculateVBO() : invalid vertices! \n\tIdentifier: " + GetMeshIdentifier());
-                return false;
-            }
+            return AllocateVBO<type>(vertices, alias);
+        }
 
-            if (m_VBO = m_pipeline->AllocateVBO((void*)vertices.data(), type, m_countVertices); m_VBO == SR_ID_INVALID) {
-                SR_ERROR("IndexedMesh::CalculateVBO() : failed calculate VBO \"" + GetGeometryName() + "\" mesh!");
-                m_hasErrors = true;
-                return false;
-            }
-            else if (IsUniqueMesh()) {
+        m_countVertices = MeshManager::Instance().Size<MeshMemoryType::VBO>(m_VBO);
+
+        return true;
+    }
+
+    template<Vertices::VertexType type, typename Vertex> bool IndexedMesh::AllocateVBO(const std::vector<Vertex>& vertices, Memory::MeshManager::Hash alias) {
+        using namespace Memory;
+
+        if ((m_countVertices = vertices.size()) == 0) {
+            SR_ERROR("IndexedMesh::AllocateVBO() : invalid vertices! \n\tIdentifier: " + GetMeshIdentifier());
+            return false;
+        }
+
+        MeshManager::Hash key = 0;
+
+        /// та же геометрия могла быть загружена под другим именем, байты для сравнения есть только в общем буфере геометрии
+        if (!IsUniqueMesh() && m_isPooled) {
+            key = MeshManager::HashContent(vertices.data(), vertices.size() * sizeof(Vertex), type);
+
+            if ((m_VBO = CopyIfEqual<MeshMemoryType::VBO>(key, vertices.data(), vertices.size() * sizeof(Vertex))) != SR_ID_INVALID) {
+                MeshManager::Instance().AddAlias<MeshMemoryType::VBO>(key, alias);
                 return true;
             }
+        }
 
-            return MeshManager::Instance().Register<type, MeshMemoryType::VBO>(
-                GetMeshIdentifier(),
-                m_countVertices,
-                m_VBO
-            );
+        if (m_isPooled) {
+            m_VBO = GeometryPool::Instance().AllocateVertices(type, vertices.data(), m_countVertices);
+        }
+        else {
+            m_VBO = m_pipeline->AllocateVBO((void*)vertices.data(), type, m_countVertices);
         }
 
-        if (!IsUniqueMesh()) {
-            m_countVertices = MeshManager::Instance().Size<type, MeshMemoryType::VBO>(
-                GetMeshIdentifier()
-            );
+        if (m_VBO == SR_ID_INVALID) {
+            SR_ERROR("IndexedMesh::AllocateVBO() : failed calculate VBO \"" + GetGeometryName() + "\" mesh!");
+            m_hasErrors = true;
+            return false;
+        }
+        else if (IsUniqueMesh()) {
+            return true;
         }
 
-        return true;
+        return MeshManager::Instance().Register<MeshMemoryType::VBO>(key, alias, m_countVertices, m_VBO);
+    }
+
+    template<Memory::MeshMemoryType memType> int32_t IndexedMesh::CopyIfEqual(Memory::MeshManager::Hash& key, const void* pData, uint64_t size) {
+        using namespace Memory;
+
+        const int32_t id = MeshManager::Instance().CopyIfExists<memType>(key);
+        if (id == SR_ID_INVALID || GeometryPool::Instance().IsEqual(id, pData, size)) SR_LIKELY_ATTRIBUTE {
+            return id;
+        }
+
+        /// совпал только хэш, такая геометрия ищется лишь по псевдониму
+        if (MeshManager::Instance().Free<memType>(id) == MeshManager::FreeResult::Freed) SR_UNLIKELY_ATTRIBUTE {
+            GeometryPool::Instance().Free(id);
+        }
+
+        key = 0;
+
+        return SR_ID_INVALID;
     }
 }
 
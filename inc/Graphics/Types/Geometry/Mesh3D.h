@@ -28,15 +28,30 @@ namespace SR_GTYPES_NS {
         bool OnResourceReloaded(SR_UTILS_NS::IResource* pResource) override;
 
         SR_NODISCARD bool IsCalculatable() const override;
+        SR_NODISCARD bool IsQuantizationSupported() const override { return true; }
         SR_NODISCARD std::vector<uint32_t> GetIndices() const override;
         SR_NODISCARD std::string GetMeshIdentifier() const override;
         SR_NODISCARD FrustumCullingType GetFrustumCullingType() const override { return m_frustumCullingType; }
 
+        /// Исходник импортируется только при расчете и только если в кэше нет готовой геометрии
+        void SetMeshPath(const SR_UTILS_NS::Path& path);
+
     private:
         bool Calculate() override;
 
+        SR_NODISCARD bool IsBakedMeshComplete() const;
+
+        SR_NODISCARD bool IsOptimizable() const override { return true; }
+        SR_NODISCARD bool IsClusterCullingSupported() const override { return true; }
+        SR_NODISCARD std::vector<SR_UTILS_NS::Vertex> GetSourceVertices() const override;
+        SR_NODISCARD std::vector<uint32_t> GetSourceIndices() const override;
+        SR_NODISCARD SR_UTILS_NS::Path GetBakedMeshSource() const override;
+        SR_NODISCARD uint32_t GetBakedMeshIndex() const override { return static_cast<uint32_t>(GetMeshId()); }
+
     private:
         FrustumCullingType m_frustumCullingType = FrustumCullingType::Sphere;
+        /// Путь исходника, известен и тогда, когда сам исходник не загружен
+        SR_UTILS_NS::Path m_meshPath;
 
     };
 }
@@ -34,6 +34,7 @@ namespace SR_GTYPES_NS {
 
         SR_NODISCARD bool IsSkeletonUsable() const;
         SR_NODISCARD bool IsCalculatable() const override;
+        SR_NODISCARD bool IsQuantizationSupported() const override { return true; }
         SR_NODISCARD bool ExecuteInEditMode() const override { return true; }
         SR_NODISCARD bool IsUpdatable() const noexcept override { return true; }
         SR_NODISCARD std::string GetMeshIdentifier() const override;
@@ -43,8 +44,12 @@ namespace SR_GTYPES_NS {
 
         void UseSSBO() override;
 
+        /// Исходник импортируется только при расчете и только если в кэше нет готовой геометрии
+        void SetMeshPath(const SR_UTILS_NS::Path& path);
+
     private:
         bool PopulateSkeletonMatrices();
+        void OnMeshSourceChanged();
 
         bool OnResourceReloaded(SR_UTILS_NS::IResource* pResource) override;
         void OnRawMeshChanged() override;
@@ -52,13 +57,28 @@ namespace SR_GTYPES_NS {
 
         void FreeSSBO();
 
+        SR_NODISCARD bool IsBakedMeshComplete() const;
+
         SR_NODISCARD std::vector<uint32_t> GetIndices() const override;
+        SR_NODISCARD bool IsOptimizable() const override { return true; }
+        SR_NODISCARD std::vector<SR_UTILS_NS::Vertex> GetSourceVertices() const override;
+        SR_NODISCARD std::vector<uint32_t> GetSourceIndices() const override;
+        SR_NODISCARD SR_UTILS_NS::Path GetBakedMeshSource() const override;
+        SR_NODISCARD uint32_t GetBakedMeshIndex() const override { return static_cast<uint32_t>(GetMeshId()); }
+        void OnMeshBaked(MeshCache::BakedMesh& bakedMesh) const override;
 
     private:
         bool m_skeletonIsBroken = false;
         int32_t m_ssboBones = SR_ID_INVALID;
         int32_t m_ssboOffsets = SR_ID_INVALID;
 
+        /// Путь исходника, известен и тогда, когда сам исходник не загружен
+        SR_UTILS_NS::Path m_meshPath;
+
+        /// Таблицы скелета из запеченного меша, исходник для них не нужен
+        ska::flat_hash_map<SR_UTILS_NS::StringAtom, uint16_t> m_bones;
+        std::vector<SR_MATH_NS::Matrix4x4> m_boneOffsets;
+
     };
 }
 
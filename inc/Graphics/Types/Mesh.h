@@ -11,6 +11,7 @@
 #include <Utils/Types/Function.h>
 
 #include <Graphics/Utils/MeshUtils.h>
+#include <Graphics/Utils/MeshletBuilder.h>
 #include <Graphics/Pipeline/IShaderProgram.h>
 #include <Graphics/Memory/IGraphicsResource.h>
 #include <Graphics/Memory/UBOManager.h>
@@ -85,6 +86,9 @@ namespace SR_GTYPES_NS {
     public:
         SR_NODISCARD virtual int32_t GetIBO() { return SR_ID_INVALID; }
         SR_NODISCARD virtual int32_t GetVBO() { return SR_ID_INVALID; }
+        /// Смещения участка меша в общем буфере геометрии
+        SR_NODISCARD virtual uint32_t GetFirstIndex() { return 0; }
+        SR_NODISCARD virtual int32_t GetVertexOffset() { return 0; }
 
         SR_NODISCARD virtual bool IsCalculatable() const;
         SR_NODISCARD virtual bool IsUniqueMesh() const { return false; }
@@ -97,8 +101,20 @@ namespace SR_GTYPES_NS {
         SR_NODISCARD virtual bool HasSortingPriority() const { return false; }
         SR_NODISCARD virtual SR_UTILS_NS::StringAtom GetMeshLayer() const { return SR_UTILS_NS::StringAtom(); }
         SR_NODISCARD virtual bool IsSupportVBO() const = 0;
+        /// Формат вершин в видеопамяти, Unknown - буфер еще не собран
+        SR_NODISCARD virtual Vertices::VertexType GetVertexType() const { return Vertices::VertexType::Unknown; }
         SR_NODISCARD virtual uint32_t GetIndicesCount() const = 0;
         SR_NODISCARD virtual FrustumCullingType GetFrustumCullingType() const { return FrustumCullingType::None; }
+        /// Уровни детализации, 0 - исходная геометрия
+        SR_NODISCARD virtual uint8_t GetLodCount() const { return 1; }
+        /// Отклонение уровня от исходной поверхности в единицах меша
+        SR_NODISCARD virtual float_t GetLodError(uint8_t lod) const { return 0.f; }
+        /// Радиус сферы с центром в начале координат меша, в которую помещается вся геометрия
+        SR_NODISCARD virtual float_t GetBoundingRadius() const { return 0.f; }
+        /// Кластеры исходного уровня для отсечения по частям, nullptr - меш рисуется целиком
+        SR_NODISCARD virtual const Meshlets* GetMeshlets() const { return nullptr; }
+        /// Участок индексов уровня относительно GetFirstIndex
+        SR_NODISCARD virtual IndexRange GetLodRange(uint8_t lod) const { return IndexRange { 0, GetIndicesCount() }; }
 
         SR_NODISCARD ShaderPtr GetShader() const;
         SR_NODISCARD MeshMaterialProperty& GetMaterialProperty() noexcept { return m_materialProperty; }
@@ -141,6 +157,8 @@ namespace SR_GTYPES_NS {
         void SetMaterial(BaseMaterial* pMaterial);
         void SetMaterial(const SR_UTILS_NS::Path& path);
 
+        /// Пока заданы, Draw берет параметры отрисовки из count слотов буфера, а не из меша
+        void SetIndirectDraws(int32_t buffer, uint32_t offset, uint32_t count) noexcept;
         void SetErrorsClean() { m_hasErrors = false; }
         void SetUniformsClean() { m_isUniformsDirty = false; }
 
@@ -164,6 +182,10 @@ namespace SR_GTYPES_NS {
         bool m_dirtyMaterial = false;
         bool m_isUniformsDirty = false;
 
+        int32_t m_indirectBuffer = SR_ID_INVALID;
+        uint32_t m_indirectOffset = 0;
+        uint32_t m_indirectDrawsCount = 0;
+
         int32_t m_virtualUBO = SR_ID_INVALID;
         int32_t m_virtualDescriptor = SR_ID_INVALID;
 
@@ -16,7 +16,9 @@
 #include <Graphics/Loaders/SRSL.h>
 #include <Graphics/Memory/ShaderProgramManager.h>
 #include <Graphics/Memory/IGraphicsResource.h>
+#include <Graphics/Memory/ContextResource.h>
 #include <Graphics/Memory/UBOManager.h>
+#include <Graphics/Types/Descriptors.h>
 
 namespace SR_GTYPES_NS {
     class Texture;
@@ -30,7 +32,7 @@ namespace SR_GRAPH_NS {
 namespace SR_GTYPES_NS {
     class Shader;
 
-    class Shader : public SR_UTILS_NS::IResource, public Memory::IGraphicsResource {
+    class Shader : public Memory::ContextResource<Shader>, public Memory::IGraphicsResource {
         using ShaderProgram = int32_t;
     public:
         using Ptr = Shader*;
@@ -54,6 +56,9 @@ namespace SR_GTYPES_NS {
         void StartWatch() override;
 
         void AttachDescriptorSets();
+        /// Ресурсы, которые AttachDescriptorSets записал бы в текущий набор дескрипторов
+        void CollectDescriptorBindings(DescriptorBindings& bindings) const;
+        void DiscardSSBOBindings() noexcept;
 
         bool BeginSharedUBO();
         void EndSharedUBO();
@@ -72,7 +77,10 @@ namespace SR_GTYPES_NS {
         SR_NODISCARD bool IsAvailable() const;
         SR_NODISCARD bool IsSamplersValid() const;
         SR_NODISCARD bool HasSharedUBO() const noexcept { return m_uniformSharedBlock.Valid(); }
+        SR_NODISCARD bool HasBindlessTextures() const noexcept { return m_hasBindlessTextures; }
+        SR_NODISCARD const Memory::ShaderUBOBlock& GetUniformBlock() const noexcept { return m_uniformBlock; }
         SR_NODISCARD SR_SRSL_NS::ShaderType GetType() const noexcept;
+        SR_NODISCARD SR_SRSL_NS::VertexFormat GetVertexFormat() const noexcept { return m_vertexFormat; }
 
     public:
         template<bool constant, typename T> void SetValue(uint64_t hashId, const T* v) noexcept {
@@ -108,6 +116,8 @@ namespace SR_GTYPES_NS {
         void SR_FASTCALL SetConstVec2(uint64_t hashId, const SR_MATH_NS::FVector2& v) noexcept;
         void SR_FASTCALL SetConstIVec2(uint64_t hashId, const SR_MATH_NS::IVector2& v) noexcept;
 
+        void SR_FASTCALL SetUniformRange(uint32_t offset, const void* pData, uint32_t size) noexcept;
+
         void SR_FASTCALL SetSampler2D(SR_UTILS_NS::StringAtom name, Texture* sampler) noexcept;
         void SR_FASTCALL SetSampler2D(SR_UTILS_NS::StringAtom name, int32_t sampler) noexcept;
         void SR_FASTCALL SetSamplerCube(SR_UTILS_NS::StringAtom name, int32_t sampler) noexcept;
@@ -140,6 +150,7 @@ namespace SR_GTYPES_NS {
         bool m_hasErrors = false;
         bool m_isRegistered = false;
         bool m_sharedUBOMode = false;
+        bool m_hasBindlessTextures = false;
 
         SRShaderCreateInfo m_shaderCreateInfo = { };
 
@@ -155,6 +166,7 @@ namespace SR_GTYPES_NS {
         std::map<SR_UTILS_NS::StringAtom, Texture*> m_defaultSamplers;
 
         SR_SRSL_NS::ShaderType m_type = SR_SRSL_NS::ShaderType::Unknown;
+        SR_SRSL_NS::VertexFormat m_vertexFormat = SR_SRSL_NS::VertexFormat::Full;
 
     };
 }
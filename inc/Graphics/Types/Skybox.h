@@ -8,12 +8,13 @@
 #include <Utils/Resources/IResource.h>
 
 #include <Graphics/Memory/IGraphicsResource.h>
+#include <Graphics/Memory/ContextResource.h>
 #include <Graphics/Loaders/TextureLoader.h>
 
 namespace SR_GTYPES_NS {
     class Shader;
 
-    class Skybox : public SR_UTILS_NS::IResource, public Memory::IGraphicsResource {
+    class Skybox : public Memory::ContextResource<Skybox>, public Memory::IGraphicsResource {
     private:
         Skybox();
         ~Skybox() override;
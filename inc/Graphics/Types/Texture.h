@@ -11,10 +11,12 @@
 #include <Graphics/Pipeline/TextureHelper.h>
 #include <Graphics/Memory/TextureConfigs.h>
 #include <Graphics/Memory/IGraphicsResource.h>
+#include <Graphics/Memory/ContextResource.h>
 #include <Graphics/Loaders/TextureLoader.h>
 
 namespace SR_GRAPH_NS {
     class TextureLoader;
+    class TextureStreamer;
     class RenderContext;
     class Render;
 }
@@ -22,8 +24,9 @@ namespace SR_GRAPH_NS {
 namespace SR_GTYPES_NS {
     class Font;
 
-    class Texture : public SR_UTILS_NS::IResource, public Memory::IGraphicsResource {
+    class Texture : public Memory::ContextResource<Texture>, public Memory::IGraphicsResource {
         friend class ::SR_GRAPH_NS::TextureLoader;
+        friend class ::SR_GRAPH_NS::TextureStreamer;
         using RenderContextPtr = SR_HTYPES_NS::SafePtr<RenderContext>;
     public:
         using Ptr = Texture*;
@@ -42,6 +45,8 @@ namespace SR_GTYPES_NS {
         SR_NODISCARD uint32_t GetHeight() const noexcept;
         SR_NODISCARD uint32_t GetChannels() const noexcept;
         SR_NODISCARD int32_t GetId() noexcept;
+        /// Индекс в массиве BINDLESS_TEXTURES, 0 - запасная текстура
+        SR_NODISCARD int32_t GetBindlessSlot() noexcept;
         SR_NODISCARD void* GetDescriptor();
         SR_NODISCARD SR_UTILS_NS::Path GetAssociatedPath() const override;
 
@@ -49,8 +54,6 @@ namespace SR_GTYPES_NS {
 
         void FreeVideoMemory() override;
 
-        RemoveUPResult RemoveUsePoint() override;
-
     protected:
         bool Unload() override;
         bool Load() override;
@@ -60,6 +63,10 @@ namespace SR_GTYPES_NS {
         void SetConfig(const Memory::TextureConfig& config);
         void FreeTextureData();
 
+        /// Вызывается стримером из потока рендера, когда загружен новый мип-уровень.
+        /// Вернет прежний идентификатор, его еще могут читать кадры в полете
+        SR_NODISCARD int32_t OnStreamed(int32_t id, uint32_t width, uint32_t height);
+
     private:
         TextureData::Ptr m_textureData;
         RenderContextPtr m_context = { };
@@ -67,6 +74,10 @@ namespace SR_GTYPES_NS {
         int32_t m_id = SR_ID_INVALID;
 
         std::atomic<bool> m_hasErrors = false;
+        std::atomic<bool> m_isStreamed = false;
+
+        /// Полный размер текстуры, данные которой живут в стримере
+        SR_MATH_NS::UVector2 m_streamedSize;
 
         Memory::TextureConfig m_config = Memory::TextureConfig();
 
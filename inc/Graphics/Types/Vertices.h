@@ -14,6 +14,8 @@
 #include <Utils/Common/Enumerations.h>
 #include <Utils/Profile/TracyContext.h>
 
+#include <glm/gtc/packing.hpp>
+
 namespace SR_GRAPH_NS::Vertices {
     enum class Attribute {
         Unknown            = 0,
@@ -27,8 +29,17 @@ namespace SR_GRAPH_NS::Vertices {
         INT_R32G32         = 1 << 5,
         UINT_R32           = 1 << 6,
         INT_R32            = 1 << 7,
+
+        HALF_R16G16        = 1 << 8,
+        UNORM_R16G16B16A16 = 1 << 9,
+        SNORM_R16G16       = 1 << 10,
+        UNORM_R8G8B8A8     = 1 << 11,
+        UINT_R8G8B8A8      = 1 << 12,
     };
 
+    /// Сколько костей хранит сжатая вершина, остальные отбрасываются при импорте
+    static constexpr uint32_t SR_QUANTIZED_BONES_ON_VERTEX = 4;
+
     static std::string ToString(const glm::vec3& vec3) {
         return SR_FORMAT("[ {}, {}, {} ]", vec3.x, vec3.y, vec3.z);
     }
@@ -209,6 +220,88 @@ namespace SR_GRAPH_NS::Vertices {
     };
     typedef std::vector<UIVertex> UIVertices;
 
+    /**
+     * Сжатая статическая вершина (20 байт вместо 56).
+     * pos - unorm16 относительно AABB меша, в w знак битангенса (0 или 1),
+     * uv - fp16, нормаль и тангенс - snorm16 в октаэдрической развертке, битангенс восстанавливается в шейдере.
+     */
+    struct QuantizedStaticMeshVertex {
+        uint16_t pos[4];
+        uint16_t uv[2];
+        int16_t norm[2];
+        int16_t tang[2];
+
+        static constexpr SR_FORCE_INLINE SR_VERTEX_DESCRIPTION GetDescription() {
+            return sizeof(QuantizedStaticMeshVertex);
+        }
+
+        static SR_FORCE_INLINE std::vector<std::string> GetNames() {
+            return { "VERTEX", "UV", "NORMAL", "TANGENT" };
+        }
+
+        static SR_FORCE_INLINE std::vector<std::pair<Attribute, size_t>> GetAttributes(bool asTypes) {
+            auto descriptions = std::vector<std::pair<Attribute, size_t>>();
+
+            if (asTypes) {
+                descriptions.emplace_back(std::pair(Attribute::UNORM_R16G16B16A16, 1));
+                descriptions.emplace_back(std::pair(Attribute::HALF_R16G16,        1));
+                descriptions.emplace_back(std::pair(Attribute::SNORM_R16G16,       1));
+                descriptions.emplace_back(std::pair(Attribute::SNORM_R16G16,       1));
+            }
+            else {
+                descriptions.emplace_back(std::pair(Attribute::UNORM_R16G16B16A16, SR_OFFSETOF(QuantizedStaticMeshVertex, pos)));
+                descriptions.emplace_back(std::pair(Attribute::HALF_R16G16,        SR_OFFSETOF(QuantizedStaticMeshVertex, uv)));
+                descriptions.emplace_back(std::pair(Attribute::SNORM_R16G16,       SR_OFFSETOF(QuantizedStaticMeshVertex, norm)));
+                descriptions.emplace_back(std::pair(Attribute::SNORM_R16G16,       SR_OFFSETOF(QuantizedStaticMeshVertex, tang)));
+            }
+
+            return descriptions;
+        }
+    };
+    typedef std::vector<QuantizedStaticMeshVertex> QuantizedStaticMeshVertices;
+
+    /// Сжатая вершина со скелетом (28 байт): к статической добавляются 4 индекса костей uint8 и веса unorm8
+    struct QuantizedSkinnedMeshVertex {
+        uint16_t pos[4];
+        uint16_t uv[2];
+        int16_t norm[2];
+        int16_t tang[2];
+        uint8_t bones[SR_QUANTIZED_BONES_ON_VERTEX];
+        uint8_t weights[SR_QUANTIZED_BONES_ON_VERTEX];
+
+        static constexpr SR_FORCE_INLINE SR_VERTEX_DESCRIPTION GetDescription() {
+            return sizeof(QuantizedSkinnedMeshVertex);
+        }
+
+        static SR_FORCE_INLINE std::vector<std::string> GetNames() {
+            return { "VERTEX", "UV", "NORMAL", "TANGENT", "BONES", "BONE_WEIGHTS" };
+        }
+
+        static SR_FORCE_INLINE std::vector<std::pair<Attribute, size_t>> GetAttributes(bool asTypes) {
+            auto descriptions = std::vector<std::pair<Attribute, size_t>>();
+
+            if (asTypes) {
+                descriptions.emplace_back(std::pair(Attribute::UNORM_R16G16B16A16, 1));
+                descriptions.emplace_back(std::pair(Attribute::HALF_R16G16,        1));
+                descriptions.emplace_back(std::pair(Attribute::SNORM_R16G16,       1));
+                descriptions.emplace_back(std::pair(Attribute::SNORM_R16G16,       1));
+                descriptions.emplace_back(std::pair(Attribute::UINT_R8G8B8A8,      1));
+                descriptions.emplace_back(std::pair(Attribute::UNORM_R8G8B8A8,     1));
+            }
+            else {
+                descriptions.emplace_back(std::pair(Attribute::UNORM_R16G16B16A16, SR_OFFSETOF(QuantizedSkinnedMeshVertex, pos)));
+                descriptions.emplace_back(std::pair(Attribute::HALF_R16G16,        SR_OFFSETOF(QuantizedSkinnedMeshVertex, uv)));
+                descriptions.emplace_back(std::pair(Attribute::SNORM_R16G16,       SR_OFFSETOF(QuantizedSkinnedMeshVertex, norm)));
+                descriptions.emplace_back(std::pair(Attribute::SNORM_R16G16,       SR_OFFSETOF(QuantizedSkinnedMeshVertex, tang)));
+                descriptions.emplace_back(std::pair(Attribute::UINT_R8G8B8A8,      SR_OFFSETOF(QuantizedSkinnedMeshVertex, bones)));
+                descriptions.emplace_back(std::pair(Attribute::UNORM_R8G8B8A8,     SR_OFFSETOF(QuantizedSkinnedMeshVertex, weights)));
+            }
+
+            return descriptions;
+        }
+    };
+    typedef std::vector<QuantizedSkinnedMeshVertex> QuantizedSkinnedMeshVertices;
+
     SR_MAYBE_UNUSED static std::string ToString(const std::vector<uint32_t>& indices) {
         std::string str = std::to_string(indices.size()) + " indices: \n";
         for (uint32_t i = 0; i < indices.size() - 1; i++)
@@ -263,7 +356,9 @@ namespace SR_GRAPH_NS::Vertices {
         StaticMeshVertex,
         SkinnedMeshVertex,
         SimpleVertex,
-        UIVertex
+        UIVertex,
+        QuantizedStaticMeshVertex,
+        QuantizedSkinnedMeshVertex
     )
 
     SR_MAYBE_UNUSED static uint32_t GetVertexSize(VertexType type) {
@@ -276,12 +371,32 @@ namespace SR_GRAPH_NS::Vertices {
                 return sizeof(SimpleVertex);
             case VertexType::UIVertex:
                 return sizeof(UIVertex);
+            case VertexType::QuantizedStaticMeshVertex:
+                return sizeof(QuantizedStaticMeshVertex);
+            case VertexType::QuantizedSkinnedMeshVertex:
+                return sizeof(QuantizedSkinnedMeshVertex);
             default:
                 SRHalt0();
                 return 0;
         }
     }
 
+    SR_MAYBE_UNUSED static bool IsQuantizedVertexType(VertexType type) {
+        return type == VertexType::QuantizedStaticMeshVertex || type == VertexType::QuantizedSkinnedMeshVertex;
+    }
+
+    /// Формат, в котором вершина видна шейдеру после распаковки
+    SR_MAYBE_UNUSED static VertexType GetDecodedVertexType(VertexType type) {
+        switch (type) {
+            case VertexType::QuantizedStaticMeshVertex:
+                return VertexType::StaticMeshVertex;
+            case VertexType::QuantizedSkinnedMeshVertex:
+                return VertexType::SkinnedMeshVertex;
+            default:
+                return type;
+        }
+    }
+
     template<typename V> SR_MATH_NS::FVector3 Barycenter(const std::vector<V>& vertices) {
         auto x = [vertices]() { float sum = 0.f; for (const auto& v : vertices) sum += v.pos.x; return sum; }();
         auto y = [vertices]() { float sum = 0.f; for (const auto& v : vertices) sum += v.pos.y; return sum; }();
@@ -324,6 +439,18 @@ namespace SR_GRAPH_NS::Vertices {
                 info.m_descriptions = { UIVertex::GetDescription() };
                 info.m_names = UIVertex::GetNames();
                 break;
+            case VertexType::QuantizedStaticMeshVertex:
+                info.m_attributes = QuantizedStaticMeshVertex::GetAttributes(false);
+                info.m_types = QuantizedStaticMeshVertex::GetAttributes(true);
+                info.m_descriptions = { QuantizedStaticMeshVertex::GetDescription() };
+                info.m_names = QuantizedStaticMeshVertex::GetNames();
+                break;
+            case VertexType::QuantizedSkinnedMeshVertex:
+                info.m_attributes = QuantizedSkinnedMeshVertex::GetAttributes(false);
+                info.m_types = QuantizedSkinnedMeshVertex::GetAttributes(true);
+                info.m_descriptions = { QuantizedSkinnedMeshVertex::GetDescription() };
+                info.m_names = QuantizedSkinnedMeshVertex::GetNames();
+                break;
             case VertexType::None:
                 break;
             default: {
@@ -392,6 +519,138 @@ namespace SR_GRAPH_NS::Vertices {
             SRHalt("Vertices::CastVertices() : sizes is different!");
         }
 
+        return vertices;
+    }
+    /// Границы, относительно которых хранятся сжатые позиции
+    struct QuantizationBounds {
+        glm::vec3 min = glm::vec3(0.f);
+        glm::vec3 size = glm::vec3(1.f);
+    };
+
+    SR_MAYBE_UNUSED static QuantizationBounds CalculateQuantizationBounds(const std::vector<SR_UTILS_NS::Vertex>& raw) {
+        if (raw.empty()) {
+            return QuantizationBounds();
+        }
+
+        glm::vec3 min = *reinterpret_cast<const glm::vec3*>((const void*)&raw.front().position);
+        glm::vec3 max = min;
+
+        for (const auto& vertex : raw) {
+            const glm::vec3& position = *reinterpret_cast<const glm::vec3*>((const void*)&vertex.position);
+            min = glm::min(min, position);
+            max = glm::max(max, position);
+        }
+
+        QuantizationBounds bounds;
+        bounds.min = min;
+        /// плоский меш не должен давать деление на ноль
+        bounds.size = glm::max(max - min, glm::vec3(1e-6f));
+
+        return bounds;
+    }
+
+    SR_MAYBE_UNUSED static glm::vec2 EncodeOctahedral(glm::vec3 normal) {
+        const float_t sum = glm::abs(normal.x) + glm::abs(normal.y) + glm::abs(normal.z);
+        if (sum <= 0.f) {
+            return glm::vec2(0.f);
+        }
+
+        normal /= sum;
+
+        if (normal.z >= 0.f) {
+            return glm::vec2(normal.x, normal.y);
+        }
+
+        return glm::vec2(
+            (1.f - glm::abs(normal.y)) * (normal.x >= 0.f ? 1.f : -1.f),
+            (1.f - glm::abs(normal.x)) * (normal.y >= 0.f ? 1.f : -1.f)
+        );
+    }
+
+    template<typename T> static void QuantizeVertex(T& vertex, const SR_UTILS_NS::Vertex& raw, const QuantizationBounds& bounds) {
+        const glm::vec3& position = *reinterpret_cast<const glm::vec3*>((const void*)&raw.position);
+        const glm::vec2& uv = *reinterpret_cast<const glm::vec2*>((const void*)&raw.uv);
+        const glm::vec3& normal = *reinterpret_cast<const glm::vec3*>((const void*)&raw.normal);
+        const glm::vec3& tangent = *reinterpret_cast<const glm::vec3*>((const void*)&raw.tangent);
+        const glm::vec3& bitangent = *reinterpret_cast<const glm::vec3*>((const void*)&raw.bitangent);
+
+        const glm::vec3 relative = (position - bounds.min) / bounds.size;
+        const bool isMirrored = glm::dot(glm::cross(normal, tangent), bitangent) < 0.f;
+
+        vertex.pos[0] = glm::packUnorm1x16(relative.x);
+        vertex.pos[1] = glm::packUnorm1x16(relative.y);
+        vertex.pos[2] = glm::packUnorm1x16(relative.z);
+        vertex.pos[3] = isMirrored ? 0 : SR_UINT16_MAX;
+
+        vertex.uv[0] = glm::packHalf1x16(uv.x);
+        vertex.uv[1] = glm::packHalf1x16(uv.y);
+
+        const glm::vec2 octNormal = EncodeOctahedral(normal);
+        const glm::vec2 octTangent = EncodeOctahedral(tangent);
+
+        vertex.norm[0] = static_cast<int16_t>(glm::packSnorm1x16(octNormal.x));
+        vertex.norm[1] = static_cast<int16_t>(glm::packSnorm1x16(octNormal.y));
+        vertex.tang[0] = static_cast<int16_t>(glm::packSnorm1x16(octTangent.x));
+        vertex.tang[1] = static_cast<int16_t>(glm::packSnorm1x16(octTangent.y));
+    }
+
+    /// Сжатие вершин при импорте. Позиции кодируются относительно bounds, их же нужно передать в шейдер
+    template<typename T> static std::vector<T> QuantizeVertices(const std::vector<SR_UTILS_NS::Vertex>& raw, const QuantizationBounds& bounds) {
+        SR_TRACY_ZONE;
+
+        auto vertices = std::vector<T>();
+
+        vertices.resize(raw.size());
+
+        for (uint32_t i = 0; i < raw.size(); ++i) {
+            QuantizeVertex(vertices[i], raw[i], bounds);
+        }
+
+        if constexpr (std::is_same<Vertices::QuantizedSkinnedMeshVertex, T>::value) {
+            bool isBoneOverflow = false;
+
+            for (uint32_t i = 0; i < raw.size(); ++i) {
+                auto&& rawVertex = raw[i];
+                auto&& vertex = vertices[i];
+
+                /// оставляем самые тяжелые кости
+                std::array<uint32_t, SR_MAX_BONES_ON_VERTEX> order = { };
+                std::iota(order.begin(), order.end(), 0);
+
+                const uint32_t count = SR_MIN(static_cast<uint32_t>(rawVertex.weightsNum), static_cast<uint32_t>(SR_MAX_BONES_ON_VERTEX));
+
+                std::sort(order.begin(), order.begin() + count, [&rawVertex](uint32_t left, uint32_t right) {
+                    return rawVertex.weights[left].weight > rawVertex.weights[right].weight;
+                });
+
+                const uint32_t kept = SR_MIN(count, SR_QUANTIZED_BONES_ON_VERTEX);
+
+                float_t sum = 0.f;
+                for (uint32_t j = 0; j < kept; ++j) {
+                    sum += rawVertex.weights[order[j]].weight;
+                }
+
+                for (uint32_t j = 0; j < SR_QUANTIZED_BONES_ON_VERTEX; ++j) {
+                    if (j >= kept || sum <= 0.f) {
+                        vertex.bones[j] = 0;
+                        vertex.weights[j] = 0;
+                        continue;
+                    }
+
+                    auto&& weight = rawVertex.weights[order[j]];
+
+                    isBoneOverflow |= weight.boneId > UINT8_MAX;
+
+                    vertex.bones[j] = static_cast<uint8_t>(SR_MIN(static_cast<uint32_t>(weight.boneId), static_cast<uint32_t>(UINT8_MAX)));
+                    vertex.weights[j] = glm::packUnorm1x8(weight.weight / sum);
+                }
+            }
+
+            if (isBoneOverflow) {
+                SR_WARN("Vertices::QuantizeVertices() : bone index doesn't fit into 8 bits, skinning will be broken!");
+            }
+        }
+
         return vertices;
     }
 }
@@ -0,0 +1,100 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_MESH_CACHE_H
+#define SR_ENGINE_GRAPHICS_MESH_CACHE_H
+
+#include <Utils/FileSystem/Path.h>
+#include <Utils/Math/Matrix4x4.h>
+
+#include <Graphics/Utils/MeshOptimizer.h>
+#include <Graphics/Types/Vertices.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Кэш запеченной геометрии.
+     * Для каждого меша исходного файла хранит результат импорта: индексы всех уровней детализации,
+     * таблицу уровней, кластеры, перестановку вершин, границы и потоки вершин уже в форматах из Vertices.h.
+     * Файл читается одним чтением и проверяется по хэшу исходника, поэтому при повторной загрузке
+     * не нужны ни разбор вершин исходного меша, ни оптимизация, ни преобразование вершин.
+     */
+    class MeshCache : public SR_UTILS_NS::Singleton<MeshCache> {
+        SR_REGISTER_SINGLETON(MeshCache)
+    public:
+        /// "SRBM"
+        static constexpr uint32_t MESH_CACHE_MAGIC = 0x4D425253;
+        static constexpr uint32_t MESH_CACHE_VERSION = 3;
+
+        struct Stream {
+            Vertices::VertexType type = Vertices::VertexType::Unknown;
+            uint32_t stride = 0;
+            uint32_t count = 0;
+            std::vector<uint8_t> data;
+        };
+
+        struct BakedMesh {
+            SR_UTILS_NS::Path cachePath;
+            uint64_t sourceHash = 0;
+            MeshOptimizer::OptimizedMeshPtr pOptimized;
+            /// Границы оптимизированных вершин, по ним сжимаются квантованные потоки
+            Vertices::QuantizationBounds bounds;
+            std::vector<Stream> streams;
+            /// Таблицы скелета, пустые у статичных мешей
+            std::vector<std::pair<std::string, uint16_t>> bones;
+            std::vector<SR_MATH_NS::Matrix4x4> boneOffsets;
+
+            SR_NODISCARD const Stream* FindStream(Vertices::VertexType type) const;
+        };
+        using BakedMeshPtr = std::shared_ptr<const BakedMesh>;
+        using BakeFn = SR_HTYPES_NS::Function<std::shared_ptr<BakedMesh>()>;
+
+    public:
+        /// Вернет запеченный меш из памяти или с диска, при отсутствии или устаревании запечет его через bake
+        SR_NODISCARD BakedMeshPtr Load(const std::string& identifier, const SR_UTILS_NS::Path& source, uint32_t index, const BakeFn& bake);
+        /// То же без запекания: nullptr, если действительного кэша нет
+        SR_NODISCARD BakedMeshPtr Find(const std::string& identifier, const SR_UTILS_NS::Path& source, uint32_t index);
+        /// Дописывает в запеченный меш поток вершин нового формата
+        void AddStream(const std::string& identifier, const BakedMeshPtr& pBaked, Vertices::VertexType type, const void* pData, uint32_t stride, uint32_t count);
+
+        template<typename T> SR_NODISCARD static std::vector<T> GetVertices(const Stream& stream);
+
+        void Clear();
+
+        SR_NODISCARD bool IsEnabled() const;
+
+    private:
+        struct SourceHash {
+            int64_t writeTime = 0;
+            uint64_t fileSize = 0;
+            uint64_t hash = 0;
+        };
+
+    private:
+        SR_NODISCARD static SR_UTILS_NS::Path GetCachePath(const SR_UTILS_NS::Path& source, uint32_t index);
+        /// Хэш исходника считается один раз на файл, а не на каждый его меш, и пересчитывается после изменения файла
+        SR_NODISCARD uint64_t GetSourceHash(const SR_UTILS_NS::Path& source);
+
+        SR_NODISCARD static BakedMeshPtr LoadFromFile(const SR_UTILS_NS::Path& path, uint64_t sourceHash);
+        static bool Save(const BakedMesh& mesh);
+
+    private:
+        mutable std::mutex m_mutex;
+
+        std::unordered_map<std::string, BakedMeshPtr> m_cache;
+        std::unordered_map<std::string, SourceHash> m_sourceHashes;
+
+    };
+
+    template<typename T> std::vector<T> MeshCache::GetVertices(const Stream& stream) {
+        if (stream.stride != sizeof(T) || stream.data.size() != static_cast<size_t>(stream.stride) * stream.count) SR_UNLIKELY_ATTRIBUTE {
+            return { };
+        }
+
+        std::vector<T> vertices(stream.count);
+        std::memcpy(vertices.data(), stream.data.data(), stream.data.size());
+        return vertices;
+    }
+}
+
+#endif //SR_ENGINE_GRAPHICS_MESH_CACHE_H
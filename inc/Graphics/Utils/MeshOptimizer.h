@@ -0,0 +1,121 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_MESH_OPTIMIZER_H
+#define SR_ENGINE_GRAPHICS_MESH_OPTIMIZER_H
+
+#include <Utils/Common/Singleton.h>
+#include <Utils/Types/Function.h>
+#include <Utils/Common/Vertices.h>
+
+#include <Graphics/Utils/MeshletBuilder.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Оптимизация геометрии при импорте.
+     * Склеивает одинаковые вершины, переупорядочивает треугольники под кэш вершин (Tipsify),
+     * сортирует кластеры треугольников для уменьшения перерисовки и переставляет вершины
+     * в порядке первого использования. Для плотных мешей строит цепочку уровней детализации,
+     * которые лежат в том же буфере индексов после исходной геометрии, а исходный уровень крупных мешей
+     * делит на кластеры для отсечения по частям. Результат хранится по идентификатору меша,
+     * поэтому VBO и IBO одного меша (и всех мешей с тем же идентификатором) всегда согласованы.
+     */
+    class MeshOptimizer : public SR_UTILS_NS::Singleton<MeshOptimizer> {
+        SR_REGISTER_SINGLETON(MeshOptimizer)
+    public:
+        using VerticesGetter = SR_HTYPES_NS::Function<std::vector<SR_UTILS_NS::Vertex>()>;
+        using IndicesGetter = SR_HTYPES_NS::Function<std::vector<uint32_t>()>;
+
+        /// Размер моделируемого FIFO кэша вершин
+        static constexpr uint32_t VERTEX_CACHE_SIZE = 16;
+        /// Допустимое ухудшение ACMR внутри кластера при разбиении под сортировку перерисовки
+        static constexpr float_t OVERDRAW_THRESHOLD = 1.05f;
+
+        /// Уровней детализации вместе с исходным
+        static constexpr uint8_t MAX_LODS = 5;
+        /// Меньшие меши не упрощаются
+        static constexpr uint32_t LOD_MIN_TRIANGLES = 512;
+        /// Доля треугольников следующего уровня от предыдущего
+        static constexpr float_t LOD_REDUCTION = 0.5f;
+
+        struct CacheStatistics {
+            /// Среднее число промахов кэша на треугольник
+            float_t acmr = 0.f;
+            /// Среднее число промахов кэша на вершину
+            float_t atvr = 0.f;
+            uint32_t vertices = 0;
+            uint32_t triangles = 0;
+        };
+
+        struct Lod {
+            uint32_t firstIndex = 0;
+            uint32_t indicesCount = 0;
+            /// Наибольшее отклонение от исходной поверхности в единицах меша
+            float_t error = 0.f;
+        };
+
+        struct OptimizedMesh {
+            /// Индексы всех уровней детализации подряд
+            std::vector<uint32_t> indices;
+            /// Новая вершина -> вершина исходного меша
+            std::vector<uint32_t> vertexRemap;
+            std::vector<Lod> lods;
+            /// Кластеры исходного уровня, пусто у небольших мешей
+            Meshlets meshlets;
+            /// Радиус сферы с центром в начале координат меша
+            float_t boundingRadius = 0.f;
+            CacheStatistics before;
+            CacheStatistics after;
+        };
+        using OptimizedMeshPtr = std::shared_ptr<const OptimizedMesh>;
+
+        struct Statistics {
+            uint32_t meshes = 0;
+            uint32_t weldedVertices = 0;
+            CacheStatistics before;
+            CacheStatistics after;
+        };
+
+    public:
+        /// Вернет nullptr, если оптимизация выключена или геометрия некорректна
+        SR_NODISCARD OptimizedMeshPtr Optimize(const std::string& identifier, const VerticesGetter& getVertices, const IndicesGetter& getIndices);
+        SR_NODISCARD static std::vector<SR_UTILS_NS::Vertex> RemapVertices(const OptimizedMesh& mesh, const std::vector<SR_UTILS_NS::Vertex>& vertices);
+
+        void Clear();
+        /// Учитывает в статистике меш, оптимизированный в прошлых запусках и загруженный из кэша
+        void AddStatistics(const OptimizedMesh& mesh);
+        /// Пишет в лог ACMR и ATVR до и после оптимизации по всем учтенным мешам
+        void LogStatistics() const;
+
+        SR_NODISCARD bool IsEnabled() const;
+        SR_NODISCARD Statistics GetStatistics() const;
+
+        SR_NODISCARD static CacheStatistics AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize = VERTEX_CACHE_SIZE);
+
+    private:
+        void AccumulateStatistics(const OptimizedMesh& mesh);
+
+        SR_NODISCARD static OptimizedMesh Build(const std::vector<SR_UTILS_NS::Vertex>& vertices, const std::vector<uint32_t>& indices);
+
+        SR_NODISCARD static uint64_t HashVertex(const SR_UTILS_NS::Vertex& vertex);
+
+        /// Возвращает число уникальных вершин, remap: исходная вершина -> уникальная
+        SR_NODISCARD static uint32_t WeldVertices(const std::vector<SR_UTILS_NS::Vertex>& vertices, std::vector<uint32_t>& remap);
+        SR_NODISCARD static std::vector<uint32_t> OptimizeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount, std::vector<uint32_t>& clusters);
+        SR_NODISCARD static std::vector<uint32_t> OptimizeOverdraw(const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& clusters);
+        SR_NODISCARD static std::vector<std::pair<std::vector<uint32_t>, float_t>> GenerateLods(const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions);
+        SR_NODISCARD static std::vector<uint32_t> SplitClusters(const std::vector<uint32_t>& indices, uint32_t vertexCount, const std::vector<uint32_t>& clusters);
+        /// Возвращает число использованных вершин, remap: старая вершина -> новая (SR_UINT32_MAX, если не используется)
+        SR_NODISCARD static uint32_t OptimizeVertexFetch(const std::vector<uint32_t>& indices, uint32_t vertexCount, std::vector<uint32_t>& remap);
+
+    private:
+        mutable std::mutex m_mutex;
+
+        std::unordered_map<std::string, OptimizedMeshPtr> m_cache;
+        Statistics m_statistics;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_MESH_OPTIMIZER_H
@@ -0,0 +1,50 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_MESH_SIMPLIFIER_H
+#define SR_ENGINE_GRAPHICS_MESH_SIMPLIFIER_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Vertices.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Упрощение сетки стягиванием ребер по квадрикам ошибки (Garland-Heckbert).
+     * Вершина стягивается в соседнюю существующую вершину, поэтому результат - новый список индексов
+     * поверх того же буфера вершин. Вершины на швах атрибутов и на границах сетки не двигаются.
+     */
+    class MeshSimplifier : public SR_UTILS_NS::NonCopyable {
+        /// Симметричная матрица 4x4 квадрики
+        struct Quadric {
+            double_t a2 = 0, ab = 0, ac = 0, ad = 0;
+            double_t b2 = 0, bc = 0, bd = 0;
+            double_t c2 = 0, cd = 0;
+            double_t d2 = 0;
+
+            void AddPlane(const glm::vec3& normal, float_t distance);
+            void Add(const Quadric& other);
+            SR_NODISCARD float_t Evaluate(const glm::vec3& point) const;
+        };
+
+        struct Collapse {
+            uint32_t from = 0;
+            uint32_t to = 0;
+            float_t cost = 0.f;
+        };
+
+    public:
+        /// Вернет упрощенные индексы, error - наибольшее отклонение от исходной поверхности в единицах меша
+        SR_NODISCARD static std::vector<uint32_t> Simplify(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, uint32_t targetIndexCount, float_t& error);
+
+    private:
+        /// Вершины с одинаковой позицией -> первая из них
+        SR_NODISCARD static std::vector<uint32_t> BuildPositionRemap(const std::vector<glm::vec3>& positions);
+        /// Вершины на швах и границах, которые нельзя стягивать
+        SR_NODISCARD static std::vector<bool> BuildLocks(const std::vector<uint32_t>& positionRemap, const std::vector<uint32_t>& indices);
+        SR_NODISCARD static bool IsFlipped(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& positionRemap, const std::vector<uint32_t>& indices, uint32_t triangle, uint32_t from, const glm::vec3& target);
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_MESH_SIMPLIFIER_H
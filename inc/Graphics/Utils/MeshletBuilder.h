@@ -0,0 +1,59 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_MESHLET_BUILDER_H
+#define SR_ENGINE_GRAPHICS_MESHLET_BUILDER_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Vertices.h>
+
+namespace SR_GRAPH_NS {
+    /// Непрерывный участок буфера индексов с границами для отсечения. Хранится в кэше мешей как есть
+    struct Meshlet {
+        uint32_t firstIndex = 0;
+        uint32_t indicesCount = 0;
+        glm::vec3 center = glm::vec3(0.f);
+        float_t radius = 0.f;
+        /// Конус нормалей: все треугольники смотрят от камеры, если она внутри конуса за кластером
+        glm::vec3 coneAxis = glm::vec3(0.f);
+        /// 1 - конус вырожден и кластер не отсекается по нормалям
+        float_t coneCutoff = 1.f;
+    };
+
+    using Meshlets = std::vector<Meshlet>;
+
+    /// Участок буфера индексов относительно первого индекса меша, так рисуются видимые кластеры
+    struct IndexRange {
+        uint32_t firstIndex = 0;
+        uint32_t indicesCount = 0;
+
+        bool operator==(const IndexRange& other) const noexcept {
+            return firstIndex == other.firstIndex && indicesCount == other.indicesCount;
+        }
+    };
+
+    using IndexRanges = std::vector<IndexRange>;
+
+    /**
+     * Разбиение геометрии на небольшие кластеры треугольников.
+     * Треугольники идут в порядке буфера индексов, поэтому каждый кластер - участок этого буфера
+     * и при отрисовке соседние видимые кластеры сливаются в один вызов.
+     */
+    class MeshletBuilder : public SR_UTILS_NS::NonCopyable {
+    public:
+        static constexpr uint32_t MAX_VERTICES = 64;
+        static constexpr uint32_t MAX_TRIANGLES = 124;
+        /// Меньшие меши целиком помещаются в несколько кластеров, отсекать их по частям нет смысла
+        static constexpr uint32_t MIN_TRIANGLES = 4 * MAX_TRIANGLES;
+
+    public:
+        SR_NODISCARD static Meshlets Build(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, uint32_t firstIndex, uint32_t indicesCount);
+
+    private:
+        static void CalculateBounds(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, Meshlet& meshlet);
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_MESHLET_BUILDER_H
@@ -0,0 +1,55 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_POST_PROCESS_COMPOSER_H
+#define SR_ENGINE_GRAPHICS_POST_PROCESS_COMPOSER_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/FileSystem/Path.h>
+#include <Utils/Types/StringAtom.h>
+
+namespace SR_GRAPH_NS {
+    /// Один эффект цепочки: SRSL-файл с функцией vec4 Function(vec4 color, vec2 uv)
+    struct PostProcessEffect {
+        SR_UTILS_NS::StringAtom name;
+        SR_UTILS_NS::Path path;
+        std::string function;
+        /// Эффект читает соседние пиксели через SampleSource, поэтому должен получить готовое изображение
+        bool neighborhood = false;
+        /// Значения public-параметров эффекта, имена без префикса эффекта
+        std::vector<std::pair<SR_UTILS_NS::StringAtom, float_t>> params;
+    };
+
+    using PostProcessEffects = std::vector<PostProcessEffect>;
+
+    /**
+     * Сборка цепочки пост-эффектов в минимальное число полноэкранных шейдеров.
+     * Базовый файл задает тип шейдера, вершинную стадию, сэмплер исходного изображения и функции
+     * vec2 GetSourceUV() и vec4 SampleSource(vec2 uv). Эффекты вызываются друг за другом над цветом в регистрах,
+     * новый шейдер начинается только перед эффектом, которому нужны соседние пиксели.
+     * Код эффекта вставляется в шейдер, а его глобальные имена получают префикс с номером эффекта в сегменте,
+     * поэтому одинаковые параметры разных эффектов и повторы одного эффекта не пересекаются.
+     */
+    class PostProcessComposer : public SR_UTILS_NS::NonCopyable {
+    public:
+        static constexpr const char* GENERATED_PATH = "Engine/Shaders/Generated/PostProcess";
+
+    public:
+        SR_NODISCARD static std::vector<PostProcessEffects> Split(const PostProcessEffects& effects);
+        /// Пустая строка, если не удалось прочитать эффект
+        SR_NODISCARD static std::string Generate(const SR_UTILS_NS::Path& base, const PostProcessEffects& effects);
+        /// Имя функции или параметра эффекта в шейдере сегмента
+        SR_NODISCARD static std::string GetScopedName(uint32_t effectIndex, const std::string& name);
+
+        /// Пишет шейдер сегмента в ресурсы и вернет путь относительно ресурсов, пустой при ошибке
+        SR_NODISCARD static SR_UTILS_NS::Path Compose(const SR_UTILS_NS::Path& base, const PostProcessEffects& effects);
+
+    private:
+        /// Код эффекта с префиксом у объявленных в нем глобальных имен
+        SR_NODISCARD static std::string ScopeEffect(const PostProcessEffect& effect, uint32_t effectIndex);
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_POST_PROCESS_COMPOSER_H
@@ -17,6 +17,7 @@ const std::unordered_map<std::string, SR_GRAPH_NS::ShaderVarType> SR_GRAPH_NS::S
         { "SKELETON_MATRIX_OFFSETS_128", ShaderVarType::Skeleton128 },
         { "SKYBOX_DIFFUSE", ShaderVarType::SamplerCube },
         { "TEXT_ATLAS_TEXTURE", ShaderVarType::Sampler2D },
+        { "BINDLESS_TEXTURES", ShaderVarType::Sampler2D },
         { "TIME", ShaderVarType::Float },
         { "TEXT_RECT_X", ShaderVarType::Float },
         { "TEXT_RECT_Y", ShaderVarType::Float },
@@ -74,6 +74,51 @@ namespace SR_GRAPH_NS {
         return pTextureData;
     }
 
+    TextureData::Ptr TextureData::CreateMipChain(const TextureData::Ptr& pSource, const MipChainInfo& info) {
+        SR_TRACY_ZONE;
+
+        std::vector<uint8_t> chain;
+        std::vector<MipLevel> levels;
+
+        if (!GenerateMipChain(pSource->GetData(), pSource->GetWidth(), pSource->GetHeight(), info, chain, levels)) {
+            SR_ERROR("TextureData::CreateMipChain() : failed to generate mip chain!");
+            return nullptr;
+        }
+
+        auto&& pData = (uint8_t*)malloc(chain.size());
+        std::memcpy(pData, chain.data(), chain.size());
+
+        auto&& pTextureData = TextureData::Create(pSource->GetWidth(), pSource->GetHeight(), pData, [](uint8_t* pData) {
+            free(pData);
+        }, pSource->GetFormat());
+
+        pTextureData->m_path = pSource->m_path;
+        pTextureData->m_mipLevels = std::move(levels);
+
+        return pTextureData;
+    }
+
+    MipLevel TextureData::GetMipLevel(uint8_t level) const {
+        if (!HasMipChain()) {
+            return MipLevel { .width = m_width, .height = m_height, .offset = 0 };
+        }
+
+        return m_mipLevels.at(SR_MIN(level, static_cast<uint8_t>(m_mipLevels.size() - 1)));
+    }
+
+    const uint8_t* TextureData::GetMipData(uint8_t level) const {
+        return m_data ? m_data + GetMipLevel(level).offset : nullptr;
+    }
+
+    uint64_t TextureData::GetMipChainBytes() const {
+        if (!m_data) {
+            return 0;
+        }
+
+        auto&& last = GetMipLevel(GetMipCount() - 1);
+        return last.offset + static_cast<uint64_t>(last.width) * last.height * 4;
+    }
+
     bool TextureData::Save(const SR_UTILS_NS::Path& path) const {
         if (!path.Create()) {
             SR_ERROR("TextureData::Save() : failed to create path! \nPath: \"" + path.GetFolder().ToString() + "\".");
@@ -89,15 +134,29 @@ namespace SR_GRAPH_NS {
     }
 
 
-    TextureData::Ptr TextureLoader::Load(const SR_UTILS_NS::Path& path) {
+    TextureData::Ptr TextureLoader::Load(const SR_UTILS_NS::Path& path, const std::optional<Memory::TextureConfig>& config) {
         SR_TRACY_ZONE;
 
         const bool cacheEnabled = SR_UTILS_NS::Features::Instance().Enabled("TextureCaching", true);
         auto&& cache = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Textures");
 
-        const uint64_t hashName = cacheEnabled ? SR_HASH(path.ConvertToFileName()) : 0;
+        const bool mipChainRequired = config && config->IsMipChainRequired();
+        const MipChainInfo mipChainInfo = mipChainRequired ? config->GetMipChainInfo() : MipChainInfo();
+
+        uint64_t hashName = cacheEnabled ? SR_HASH(path.ConvertToFileName()) : 0;
         uint64_t fileHash = cacheEnabled ? path.GetFileHash() : 0;
 
+        if (cacheEnabled) {
+            /// цепочка с разными параметрами хранится в отдельном файле кэша
+            if (mipChainRequired) {
+                hashName = SR_UTILS_NS::HashCombine(static_cast<uint64_t>(mipChainInfo.filter), hashName);
+                hashName = SR_UTILS_NS::HashCombine(mipChainInfo.sRGB, hashName);
+                hashName = SR_UTILS_NS::HashCombine(mipChainInfo.normalMap, hashName);
+            }
+
+            fileHash = SR_UTILS_NS::HashCombine(TEXTURE_CACHE_VERSION, fileHash);
+        }
+
         if (cacheEnabled) {
             auto&& stringHash = SR_UTILS_NS::ToString(hashName);
             auto&& cachePath = cache.Concat(path.GetBaseNameAndExt() + "." + stringHash);
@@ -106,7 +165,7 @@ namespace SR_GRAPH_NS {
             if (cacheHashPath.Exists(SR_UTILS_NS::Path::Type::File)) {
                 if (SR_UTILS_NS::FileSystem::ReadHashFromFile(cacheHashPath) == fileHash) {
                     auto&& pTextureData = LoadFromCache(cachePath.ConcatExt(".cache"));
-                    if (pTextureData) {
+                    if (pTextureData && (!mipChainRequired || pTextureData->HasMipChain())) {
                         return pTextureData;
                     }
                 }
@@ -124,6 +183,20 @@ namespace SR_GRAPH_NS {
 
         const ImageLoadFormat format = numComponents == 4 ? ImageLoadFormat::RGBA : ImageLoadFormat::RGB;
 
+        auto&& pTextureData = TextureData::Create(width, height, pImgData, [](uint8_t* pData) {
+            TextureLoader::Free(pData);
+        }, format);
+
+        SRAssert2(pTextureData, "TextureLoader::Load() : failed to create TextureData!");
+
+        if (mipChainRequired) {
+            if (auto&& pMipChain = TextureData::CreateMipChain(pTextureData, mipChainInfo)) {
+                pTextureData = pMipChain;
+            }
+        }
+
+        pTextureData->SetPath(path);
+
         if (cacheEnabled) {
             SR_LOG("TextureLoader::Load() : save texture to cache...");
 
@@ -132,10 +205,8 @@ namespace SR_GRAPH_NS {
             auto&& cacheHashPath = cachePath.ConcatExt(".cache.hash");
             auto&& cacheFilePath = cachePath.ConcatExt(".cache");
 
-            if (!cacheHashPath.Exists(SR_UTILS_NS::Path::Type::File)) {
-                if (!SR_UTILS_NS::FileSystem::WriteHashToFile(cacheHashPath, fileHash)) {
-                    SR_ERROR("TextureLoader::Load() : failed to write hash to file \"" + cacheHashPath.ToStringRef() + "\"!");
-                }
+            if (!SR_UTILS_NS::FileSystem::WriteHashToFile(cacheHashPath, fileHash)) {
+                SR_ERROR("TextureLoader::Load() : failed to write hash to file \"" + cacheHashPath.ToStringRef() + "\"!");
             }
 
             auto&& marshal = SR_HTYPES_NS::Marshal();
@@ -143,21 +214,23 @@ namespace SR_GRAPH_NS {
             marshal.Write<uint32_t>(width);
             marshal.Write<uint32_t>(height);
             marshal.Write(static_cast<uint8_t>(format));
-            marshal.WriteBlock(pImgData, width * height * 4 * sizeof(uint8_t));
+
+            /// все уровни пишутся одним блоком, чтобы читать их одним чтением
+            marshal.Write<uint8_t>(pTextureData->HasMipChain() ? pTextureData->GetMipCount() : 0);
+            for (uint8_t level = 0; pTextureData->HasMipChain() && level < pTextureData->GetMipCount(); ++level) {
+                auto&& mipLevel = pTextureData->GetMipLevel(level);
+                marshal.Write<uint32_t>(mipLevel.width);
+                marshal.Write<uint32_t>(mipLevel.height);
+                marshal.Write<uint64_t>(mipLevel.offset);
+            }
+
+            marshal.WriteBlock(pTextureData->GetData(), pTextureData->GetMipChainBytes());
 
             if (!marshal.Save(cacheFilePath)) {
                 SR_ERROR("TextureLoader::Load() : failed to save marshal to file \"" + cacheFilePath.ToStringRef() + "\"!");
             }
         }
 
-        auto&& pTextureData = TextureData::Create(width, height, pImgData, [](uint8_t* pData) {
-            TextureLoader::Free(pData);
-        }, format);
-
-        pTextureData->SetPath(path);
-
-        SRAssert2(pTextureData, "TextureLoader::Load() : failed to create TextureData!");
-
         return pTextureData;
     }
 
@@ -222,6 +295,13 @@ namespace SR_GRAPH_NS {
         auto&& height = marshal.Read<uint32_t>();
         auto&& format = static_cast<ImageLoadFormat>(marshal.Read<uint8_t>());
 
+        std::vector<MipLevel> mipLevels(marshal.Read<uint8_t>());
+        for (auto&& mipLevel : mipLevels) {
+            mipLevel.width = marshal.Read<uint32_t>();
+            mipLevel.height = marshal.Read<uint32_t>();
+            mipLevel.offset = marshal.Read<uint64_t>();
+        }
+
         auto&& size = marshal.Read<uint64_t>();
 
         uint8_t* pData = nullptr;
@@ -236,6 +316,7 @@ namespace SR_GRAPH_NS {
         }, format);
 
         pTextureData->SetPath(sourcePath);
+        pTextureData->SetMipLevels(std::move(mipLevels));
 
         return pTextureData;
     }
@@ -14,37 +14,33 @@ namespace SR_GRAPH_NS {
     }
 
     void BaseMaterial::SetVec4(SR_UTILS_NS::StringAtom id, const SR_MATH_NS::FVector4& v) noexcept {
-        for (auto&& pProperty : m_properties.GetMaterialUniformsProperties()) {
-            if (pProperty->GetName() == id && pProperty->GetShaderVarType() == ShaderVarType::Vec4) {
-                pProperty->SetData(v);
-                return;
-            }
+        if (auto&& pProperty = GetProperty(id.GetHash()); pProperty && pProperty->GetShaderVarType() == ShaderVarType::Vec4) {
+            pProperty->SetData(v);
         }
     }
 
-
     void BaseMaterial::SetBool(SR_UTILS_NS::StringAtom id, bool v) noexcept {
-        for (auto&& pProperty : m_properties.GetMaterialUniformsProperties()) {
-            if (pProperty->GetName() == id && pProperty->GetShaderVarType() == ShaderVarType::Bool) {
-                pProperty->SetData(v);
-                return;
-            }
+        if (auto&& pProperty = GetProperty(id.GetHash()); pProperty && pProperty->GetShaderVarType() == ShaderVarType::Bool) {
+            pProperty->SetData(v);
         }
     }
 
     void BaseMaterial::SetTexture(SR_UTILS_NS::StringAtom id, SR_GTYPES_NS::Texture* pTexture) noexcept {
-        for (auto&& pProperty : m_properties.GetMaterialSamplerProperties()) {
-            if (pProperty->GetName() == id && pProperty->GetShaderVarType() == ShaderVarType::Sampler2D) {
-                pProperty->SetData(pTexture);
-                return;
-            }
+        if (auto&& pProperty = GetProperty(id.GetHash()); pProperty && pProperty->GetShaderVarType() == ShaderVarType::Sampler2D) {
+            pProperty->SetData(pTexture);
         }
     }
 
     void BaseMaterial::Use() {
         SR_TRACY_ZONE;
         InitContext();
-        m_properties.UseMaterialUniforms(GetContext()->GetPipeline()->GetCurrentShader());
+
+        auto&& pShader = GetContext()->GetPipeline()->GetCurrentShader();
+
+        /// блок собран под шейдер материала, при подмене шейдера в проходе идем по свойствам
+        if (!m_parameterBlock.Upload(pShader, m_properties)) SR_UNLIKELY_ATTRIBUTE {
+            m_properties.UseMaterialUniforms(pShader);
+        }
     }
 
     bool BaseMaterial::IsTransparent() const {
@@ -74,6 +70,19 @@ namespace SR_GRAPH_NS {
         });
     }
 
+    void BaseMaterial::ForEachTexture(const SR_HTYPES_NS::Function<void(TexturePtr)>& callback) const {
+        m_properties.ForEachPropertyRet<MaterialProperty>([&callback](auto&& pProperty) -> bool {
+            std::visit([&callback](ShaderPropertyVariant&& arg) {
+                if (std::holds_alternative<SR_GTYPES_NS::Texture*>(arg)) {
+                    if (auto&& pTexture = std::get<SR_GTYPES_NS::Texture*>(arg)) {
+                        callback(pTexture);
+                    }
+                }
+            }, pProperty->GetData());
+            return true;
+        });
+    }
+
     uint32_t BaseMaterial::RegisterMesh(MeshPtr pMesh) {
         SRAssert(pMesh);
         return m_meshes.Add(pMesh);
@@ -87,6 +96,8 @@ namespace SR_GRAPH_NS {
     void BaseMaterial::OnPropertyChanged(bool onlyUniforms) {
         SR_TRACY_ZONE;
 
+        m_parameterBlock.MarkDataDirty();
+
         if (onlyUniforms) {
             m_meshes.ForEach([](uint32_t, auto&& pMesh) {
                 pMesh->MarkUniformsDirty();
@@ -120,12 +131,14 @@ namespace SR_GRAPH_NS {
         });
 
         if (!((m_shader = pShader))) {
+            m_parameterBlock.Clear();
             return;
         }
 
         m_shaderReloadDoneSubscription = m_shader->Subscribe(SR_UTILS_NS::IResource::RELOAD_DONE_EVENT,
             [this](const SR_UTILS_NS::SubscriptionMessage& msg) {
                 m_dirtyShader = true;
+                m_parameterBlock.MarkLayoutDirty();
                 OnPropertyChanged(false);
             }
         );
@@ -154,6 +167,9 @@ namespace SR_GRAPH_NS {
     }
 
     MaterialProperty* BaseMaterial::GetProperty(uint64_t hashId) {
+        if (auto&& pProperty = m_parameterBlock.Find(hashId)) SR_LIKELY_ATTRIBUTE {
+            return pProperty;
+        }
         return m_properties.Find<MaterialProperty>(hashId);
     }
 
@@ -176,6 +192,7 @@ namespace SR_GRAPH_NS {
 
         SetShader(nullptr);
 
+        m_parameterBlock.Clear();
         m_properties.ClearContainer();
     }
 
@@ -185,6 +202,7 @@ namespace SR_GRAPH_NS {
             return;
         }
 
+        m_parameterBlock.Clear();
         m_properties.ClearContainer();
 
         /// Загружаем базовые значения
@@ -194,5 +212,7 @@ namespace SR_GRAPH_NS {
                 .SetMaterial(this)
                 .SetDisplayName(property.id); // TODO: make a pretty name
         }
+
+        m_parameterBlock.Compile(m_shader, m_properties);
     }
 }
@@ -4,11 +4,12 @@
 
 #include <Graphics/Material/FileMaterial.h>
 #include <Graphics/Types/Shader.h>
+#include <Graphics/Render/RenderContext.h>
 
 namespace SR_GRAPH_NS {
     FileMaterial::FileMaterial()
         : BaseMaterial()
-        , IResource(SR_COMPILE_TIME_CRC32_TYPE_NAME(FileMaterial))
+        , Memory::ContextResource<FileMaterial>(SR_COMPILE_TIME_CRC32_TYPE_NAME(FileMaterial))
     { }
 
     FileMaterial::~FileMaterial() = default;
@@ -122,6 +123,7 @@ namespace SR_GRAPH_NS {
         SR_TRACY_ZONE;
         SetShader(nullptr);
 
+        m_parameterBlock.Clear();
         m_properties.ClearContainer();
 
         return IResource::Unload();
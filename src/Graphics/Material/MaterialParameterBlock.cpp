@@ -0,0 +1,148 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Material/MaterialParameterBlock.h>
+#include <Graphics/Types/Shader.h>
+
+namespace SR_GRAPH_NS {
+    void MaterialParameterBlock::Compile(SR_GTYPES_NS::Shader* pShader, MaterialProperties& properties) {
+        SR_TRACY_ZONE;
+
+        Clear();
+
+        /// без шейдера нечего паковать, а указатели на свойства могут пережить сами свойства
+        if (!pShader) {
+            return;
+        }
+
+        m_shader = pShader;
+
+        properties.ForEachProperty<MaterialProperty>([this](auto&& pProperty) {
+            m_lookup[pProperty->GetName().GetHash()] = pProperty;
+        });
+
+        struct Location {
+            MaterialProperty* pProperty;
+            Memory::ShaderUBOBlock::FieldLocation field;
+        };
+        std::vector<Location> locations;
+
+        auto&& uniformBlock = pShader->GetUniformBlock();
+
+        for (auto&& pProperty : properties.GetMaterialUniformsProperties()) {
+            Memory::ShaderUBOBlock::FieldLocation field;
+            if (!uniformBlock.FindField(pProperty->GetName().GetHash(), field)) {
+                continue; /// свойство из SHARED блока или push-константа
+            }
+            locations.emplace_back(Location { pProperty, field });
+        }
+
+        std::sort(locations.begin(), locations.end(), [](const Location& left, const Location& right) {
+            return left.field.offset < right.field.offset;
+        });
+
+        uint32_t packedSize = 0;
+
+        for (auto&& location : locations) {
+            auto&& handle = m_handles.emplace_back();
+            handle.pProperty = location.pProperty;
+            handle.packedOffset = packedSize;
+            handle.size = location.field.size;
+
+            /// соседние поля склеиваем в один диапазон
+            if (!m_ranges.empty() && m_ranges.back().blockOffset + m_ranges.back().size == location.field.offset) {
+                m_ranges.back().size += location.field.size;
+            }
+            else {
+                m_ranges.emplace_back(Range {
+                    .packedOffset = packedSize,
+                    .blockOffset = location.field.offset,
+                    .size = location.field.size,
+                });
+            }
+
+            packedSize += location.field.size;
+        }
+
+        m_memory.resize(packedSize);
+
+        Pack();
+    }
+
+    void MaterialParameterBlock::Clear() {
+        m_shader = nullptr;
+        m_handles.clear();
+        m_ranges.clear();
+        m_memory.clear();
+        m_lookup.clear();
+        m_dataDirty = true;
+        m_layoutDirty = false;
+    }
+
+    bool MaterialParameterBlock::Upload(SR_GTYPES_NS::Shader* pShader, MaterialProperties& properties) {
+        if (!m_shader || m_shader != pShader) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        if (m_layoutDirty) SR_UNLIKELY_ATTRIBUTE {
+            Compile(pShader, properties);
+        }
+        else if (m_dataDirty) {
+            Pack();
+        }
+
+        const uint8_t* pMemory = m_memory.data();
+
+        for (auto&& range : m_ranges) {
+            pShader->SetUniformRange(range.blockOffset, pMemory + range.packedOffset, range.size);
+        }
+
+        return true;
+    }
+
+    MaterialProperty* MaterialParameterBlock::Find(uint64_t hashId) const noexcept {
+        if (auto&& pIt = m_lookup.find(hashId); pIt != m_lookup.end()) {
+            return pIt->second;
+        }
+        return nullptr;
+    }
+
+    void MaterialParameterBlock::Pack() {
+        SR_TRACY_ZONE;
+
+        m_dataDirty = false;
+
+        for (auto&& handle : m_handles) {
+            uint8_t* pDestination = m_memory.data() + handle.packedOffset;
+
+            auto&& write = [pDestination, &handle](const auto& value) {
+                std::memcpy(pDestination, &value, SR_MIN(static_cast<uint32_t>(sizeof(value)), handle.size));
+            };
+
+            auto&& data = handle.pProperty->GetData();
+
+            switch (handle.pProperty->GetShaderVarType()) {
+                case ShaderVarType::Int:
+                case ShaderVarType::Bool:
+                    write(std::get<int32_t>(data));
+                    break;
+                case ShaderVarType::Float:
+                    write(std::get<float_t>(data));
+                    break;
+                case ShaderVarType::Vec2:
+                    write(std::get<SR_MATH_NS::FVector2>(data).template Cast<float_t>());
+                    break;
+                case ShaderVarType::Vec3:
+                    write(std::get<SR_MATH_NS::FVector3>(data).template Cast<float_t>());
+                    break;
+                case ShaderVarType::Vec4:
+                    write(std::get<SR_MATH_NS::FVector4>(data).template Cast<float_t>());
+                    break;
+                default:
+                    SRAssertOnce(false);
+                    break;
+            }
+        }
+    }
+}
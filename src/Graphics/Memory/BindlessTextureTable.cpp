@@ -0,0 +1,122 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/BindlessTextureTable.h>
+
+namespace SR_GRAPH_NS {
+    BindlessTextureTable::Slot BindlessTextureTable::Acquire(TextureId textureId) {
+        if (textureId == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            return 0;
+        }
+
+        if (auto&& pIt = m_slots.find(textureId); pIt != m_slots.end()) SR_LIKELY_ATTRIBUTE {
+            return pIt->second;
+        }
+
+        if (m_textures.empty()) {
+            m_textures.resize(GetCapacity(), m_fallbackTexture);
+        }
+
+        Slot slot;
+
+        if (!m_freeSlots.empty()) {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else if (m_nextSlot < static_cast<Slot>(GetCapacity())) {
+            slot = m_nextSlot++;
+        }
+        else {
+            if (!m_isFullWarned) {
+                SR_WARN("BindlessTextureTable::Acquire() : table is full! Capacity: {}", GetCapacity());
+                m_isFullWarned = true;
+            }
+            return 0;
+        }
+
+        m_slots[textureId] = slot;
+        SetSlot(slot, textureId);
+
+        return slot;
+    }
+
+    void BindlessTextureTable::OnTextureFreed(TextureId textureId) {
+        auto&& pIt = m_slots.find(textureId);
+        if (pIt == m_slots.end()) {
+            return;
+        }
+
+        const Slot slot = pIt->second;
+        m_slots.erase(pIt);
+
+        SetSlot(slot, m_fallbackTexture);
+
+        m_pendingSlots.emplace_back(PendingSlot { slot, m_frame });
+    }
+
+    void BindlessTextureTable::OnTextureReCreated(TextureId textureId) {
+        if (auto&& pIt = m_slots.find(textureId); pIt != m_slots.end()) {
+            MarkDirty(pIt->second);
+        }
+    }
+
+    bool BindlessTextureTable::NextFrame(uint32_t framesInFlight) {
+        for (auto pIt = m_pendingSlots.begin(); pIt != m_pendingSlots.end(); ) {
+            if (pIt->frame + framesInFlight > m_frame) {
+                ++pIt;
+                continue;
+            }
+            m_freeSlots.emplace_back(pIt->slot);
+            pIt = m_pendingSlots.erase(pIt);
+        }
+
+        ++m_frame;
+
+        std::sort(m_dirtySlots.begin(), m_dirtySlots.end());
+        m_dirtySlots.erase(std::unique(m_dirtySlots.begin(), m_dirtySlots.end()), m_dirtySlots.end());
+
+        return !m_dirtySlots.empty();
+    }
+
+    void BindlessTextureTable::Clear() {
+        m_textures.clear();
+        m_slots.clear();
+        m_freeSlots.clear();
+        m_pendingSlots.clear();
+        m_dirtySlots.clear();
+        m_fallbackTexture = SR_ID_INVALID;
+        m_nextSlot = 1;
+        m_isFullWarned = false;
+        ++m_generation;
+    }
+
+    void BindlessTextureTable::SetFallbackTexture(TextureId textureId) {
+        const TextureId oldFallback = m_fallbackTexture;
+        m_fallbackTexture = textureId;
+
+        if (m_textures.empty()) {
+            m_textures.resize(GetCapacity(), m_fallbackTexture);
+            ++m_generation;
+            return;
+        }
+
+        for (Slot slot = 0; slot < static_cast<Slot>(m_textures.size()); ++slot) {
+            if (slot == 0 || m_textures[slot] == oldFallback) {
+                SetSlot(slot, textureId);
+            }
+        }
+    }
+
+    void BindlessTextureTable::SetSlot(Slot slot, TextureId textureId) {
+        if (m_textures[slot] == textureId) {
+            return;
+        }
+        m_textures[slot] = textureId;
+        MarkDirty(slot);
+    }
+
+    void BindlessTextureTable::MarkDirty(Slot slot) {
+        m_dirtySlots.emplace_back(slot);
+    }
+}
@@ -3,9 +3,10 @@
 //
 
 #include <Graphics/Memory/DescriptorManager.h>
+#include <Graphics/Memory/BindlessTextureTable.h>
 
 namespace SR_GRAPH_NS {
-    DescriptorManager::VirtualDescriptorSet DescriptorManager::AllocateDescriptorSet(VirtualDescriptorSet reallocation) {
+    DescriptorManager::VirtualDescriptorSet DescriptorManager::AllocateDescriptorSet(VirtualDescriptorSet reallocation, bool transient) {
         SR_TRACY_ZONE;
 
         if (!m_pipeline) SR_UNLIKELY_ATTRIBUTE {
@@ -13,34 +14,23 @@ namespace SR_GRAPH_NS {
             return SR_ID_INVALID;
         }
 
-        auto&& pShader = m_pipeline->GetCurrentShader();
-        if (!pShader) SR_UNLIKELY_ATTRIBUTE {
+        if (!m_pipeline->GetCurrentShader()) SR_UNLIKELY_ATTRIBUTE {
             SRHalt("DescriptorManager::AllocateDescriptorSet() : shader is nullptr!");
             return SR_ID_INVALID;
         }
 
-        auto&& descriptorSet = AllocateMemory(pShader);
-        if (descriptorSet == SR_ID_INVALID && !m_allocationTypesCache.empty()) SR_UNLIKELY_ATTRIBUTE {
-            SRHalt("DescriptorManager::AllocateDescriptorSet() : failed to allocate descriptor set!");
-            return SR_ID_INVALID;
-        }
-
-        auto&& pShaderHandle = m_pipeline->GetCurrentShaderHandle();
-
+        /// физический набор будет получен из кэша при первом Flush
         if (reallocation != SR_ID_INVALID) {
-            auto&& descriptors = m_descriptorPool.At(reallocation);
-            for (auto&& descriptor : descriptors) {
-                if (descriptor.descriptorSet == SR_ID_INVALID) {
-                    continue;
-                }
-                m_pipeline->FreeDescriptorSet(&descriptor.descriptorSet);
-            }
-            descriptors.clear();
-            descriptors.emplace_back(pShaderHandle, descriptorSet);
+            auto&& info = m_descriptorPool.At(reallocation);
+            Release(info);
+            info.transient = transient;
             return reallocation;
         }
 
-        return m_descriptorPool.Add({ DescriptorSetInfo{ pShaderHandle, descriptorSet } });
+        VirtualDescriptorSetInfo info;
+        info.transient = transient;
+
+        return m_descriptorPool.Add(std::move(info));
     }
 
     DescriptorManager::BindResult DescriptorManager::Bind(DescriptorManager::VirtualDescriptorSet virtualDescriptorSet) {
@@ -49,56 +39,196 @@ namespace SR_GRAPH_NS {
             return BindResult::Failed;
         }
 
-        auto&& info = m_descriptorPool.At(virtualDescriptorSet);
+        m_currentVirtualSet = virtualDescriptorSet;
+
+        auto&& descriptorSets = m_descriptorPool.At(virtualDescriptorSet).descriptorSets;
         auto&& pShaderHandle = m_pipeline->GetCurrentShaderHandle();
 
-        DescriptorSet descriptorSet;
-        bool hasDescriptorSet = false;
+        for (auto pIt = descriptorSets.begin(); pIt != descriptorSets.end(); ++pIt) {
+            if (pIt->pShaderHandle != pShaderHandle) SR_UNLIKELY_ATTRIBUTE {
+                continue;
+            }
 
-        const DescriptorSetInfo* pElement = info.data();
-        const DescriptorSetInfo* pEnd = pElement + info.size();
-        for (; pElement != pEnd; ++pElement) {
-            if (pElement->pShaderHandle == pShaderHandle) SR_LIKELY_ATTRIBUTE {
-                descriptorSet = pElement->descriptorSet;
-                hasDescriptorSet = true;
-                break;
+            if (pIt->isEmpty) {
+                return BindResult::Success;
+            }
+
+            if (pIt->transientSet != SR_ID_INVALID) {
+                if (!m_pipeline->BindDescriptorSet(pIt->transientSet, true)) {
+                    SR_ERROR("DescriptorManager::Bind() : failed to bind descriptor set!");
+                    return BindResult::Failed;
+                }
+                return BindResult::Success;
             }
-        }
 
-        BindResult result = BindResult::Success;
+            const bool isBindlessOutdated = pIt->hasBindlessTextures
+                && pIt->bindlessGeneration != BindlessTextureTable::Instance().GetGeneration();
 
-        if (!hasDescriptorSet) SR_UNLIKELY_ATTRIBUTE {
-            descriptorSet = AllocateMemory(m_pipeline->GetCurrentShader());
+            /// один из ресурсов набора был освобожден или изменилась таблица текстур, набор нужно получить заново
+            if (!m_cache.IsValid(pIt->cacheHandle) || isBindlessOutdated) SR_UNLIKELY_ATTRIBUTE {
+                m_cache.Release(pIt->cacheHandle);
+                descriptorSets.erase(pIt);
+                break;
+            }
 
-            if (descriptorSet == SR_ID_INVALID && !m_allocationTypesCache.empty()) SR_UNLIKELY_ATTRIBUTE {
-                SRHalt("DescriptorManager::Bind() : failed to allocate descriptor set!");
+            if (!m_pipeline->BindDescriptorSet(m_cache.GetDescriptorSet(pIt->cacheHandle), true)) {
+                SR_ERROR("DescriptorManager::Bind() : failed to bind descriptor set!");
                 return BindResult::Failed;
             }
 
-            info.emplace_back(pShaderHandle, descriptorSet);
-            result = BindResult::Duplicated;
+            return BindResult::Success;
         }
 
-        if (descriptorSet != SR_ID_INVALID) SR_LIKELY_ATTRIBUTE {
-            if (!m_pipeline->BindDescriptorSet(descriptorSet)) {
-                SR_ERROR("DescriptorManager::Bind() : failed to bind descriptor set!");
-                return BindResult::Failed;
-            }
+        /// записать набор можно только на первой итерации построения
+        if (m_pipeline->GetCurrentBuildIteration() > 0) SR_UNLIKELY_ATTRIBUTE {
+            return BindResult::Failed;
         }
 
-        return result;
+        return BindResult::Duplicated;
     }
 
     void DescriptorManager::Flush() {
+        SR_TRACY_ZONE;
+
         auto&& pShader = m_pipeline->GetCurrentShader();
+
+        if (m_currentVirtualSet == SR_ID_INVALID || !pShader) SR_UNLIKELY_ATTRIBUTE {
+            SRHalt("DescriptorManager::Flush() : descriptor set is not binded!");
+            return;
+        }
+
+        auto&& info = m_descriptorPool.At(m_currentVirtualSet);
+        auto&& pShaderHandle = m_pipeline->GetCurrentShaderHandle();
+
+        DescriptorSetInfo* pElement = nullptr;
+        for (auto&& descriptorSetInfo : info.descriptorSets) {
+            if (descriptorSetInfo.pShaderHandle == pShaderHandle) {
+                pElement = &descriptorSetInfo;
+                break;
+            }
+        }
+
+        if (!IsDescriptorSetRequired(pShader)) SR_UNLIKELY_ATTRIBUTE {
+            if (!pElement) {
+                info.descriptorSets.emplace_back(DescriptorSetInfo { pShaderHandle, SR_ID_INVALID, true });
+            }
+            pShader->DiscardSSBOBindings();
+            return;
+        }
+
+        /// временный набор пишется заново при каждом Flush, искать его в кэше не нужно
+        if (info.transient && !pShader->HasBindlessTextures() && FlushTransient(info, pElement, pShader)) {
+            return;
+        }
+
+        m_bindingsCache.clear();
+        pShader->CollectDescriptorBindings(m_bindingsCache);
+
+        const uint64_t hash = DescriptorSetCache::CalculateHash(pShaderHandle, m_bindingsCache);
+
+        DescriptorSetCache::Handle cacheHandle = m_cache.Acquire(pShaderHandle, hash, m_bindingsCache);
+
+        /// содержимое не изменилось, набор уже привязан в Bind
+        if (pElement && cacheHandle != SR_ID_INVALID && cacheHandle == pElement->cacheHandle) SR_LIKELY_ATTRIBUTE {
+            m_cache.Release(cacheHandle);
+            pShader->DiscardSSBOBindings();
+            return;
+        }
+
+        if (cacheHandle != SR_ID_INVALID) {
+            if (!m_pipeline->BindDescriptorSet(m_cache.GetDescriptorSet(cacheHandle), true)) SR_UNLIKELY_ATTRIBUTE {
+                SR_ERROR("DescriptorManager::Flush() : failed to bind descriptor set!");
+                m_cache.Release(cacheHandle);
+                return;
+            }
+            pShader->DiscardSSBOBindings();
+        }
+        else {
+            DescriptorSet descriptorSet = AllocateMemory(pShader);
+            if (descriptorSet == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+                SRHalt("DescriptorManager::Flush() : failed to allocate descriptor set!");
+                return;
+            }
+
+            if (!m_pipeline->BindDescriptorSet(descriptorSet)) SR_UNLIKELY_ATTRIBUTE {
+                SR_ERROR("DescriptorManager::Flush() : failed to bind descriptor set!");
+                m_pipeline->FreeDescriptorSet(&descriptorSet);
+                return;
+            }
+
+            pShader->AttachDescriptorSets();
+
+            cacheHandle = m_cache.Insert(pShaderHandle, hash, descriptorSet, m_bindingsCache, info.transient);
+        }
+
+        if (!pElement) {
+            pElement = &info.descriptorSets.emplace_back(DescriptorSetInfo { pShaderHandle, SR_ID_INVALID, true });
+        }
+
+        ReleaseElement(*pElement);
+
+        pElement->cacheHandle = cacheHandle;
+        pElement->isEmpty = false;
+        pElement->hasBindlessTextures = pShader->HasBindlessTextures();
+        pElement->bindlessGeneration = BindlessTextureTable::Instance().GetGeneration();
+    }
+
+    bool DescriptorManager::FlushTransient(VirtualDescriptorSetInfo& info, DescriptorSetInfo*& pElement, SR_GTYPES_NS::Shader* pShader) {
+        auto&& types = GetAllocationTypes(pShader);
+        if (types.empty()) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        DescriptorSet descriptorSet = m_pipeline->AllocTransientDescriptorSet(types);
+        if (descriptorSet == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        if (!m_pipeline->BindDescriptorSet(descriptorSet, true)) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("DescriptorManager::FlushTransient() : failed to bind descriptor set!");
+            m_pipeline->FreeDescriptorSet(&descriptorSet);
+            return true;
+        }
+
         pShader->AttachDescriptorSets();
+
+        if (!pElement) {
+            pElement = &info.descriptorSets.emplace_back(DescriptorSetInfo { m_pipeline->GetCurrentShaderHandle(), SR_ID_INVALID, true });
+        }
+
+        ReleaseElement(*pElement);
+
+        pElement->isEmpty = false;
+        pElement->transientSet = descriptorSet;
+
+        return true;
     }
 
-    DescriptorManager::DescriptorSet DescriptorManager::AllocateMemory(SR_GTYPES_NS::Shader* pShader) const {
+    void DescriptorManager::ReleaseElement(DescriptorSetInfo& element) {
+        if (element.isEmpty) {
+            return;
+        }
+
+        if (element.transientSet != SR_ID_INVALID) {
+            m_pipeline->FreeDescriptorSet(&element.transientSet);
+            element.transientSet = SR_ID_INVALID;
+        }
+        else {
+            m_cache.Release(element.cacheHandle);
+        }
+
+        element.cacheHandle = SR_ID_INVALID;
+    }
+
+    bool DescriptorManager::IsDescriptorSetRequired(SR_GTYPES_NS::Shader* pShader) const {
+        return pShader->GetUBOBlockSize() > 0 || pShader->GetSamplersCount() > 0 || pShader->HasSharedUBO();
+    }
+
+    const std::vector<DescriptorType>& DescriptorManager::GetAllocationTypes(SR_GTYPES_NS::Shader* pShader) const {
         m_allocationTypesCache.clear();
 
         if (pShader->GetUBOBlockSize() > 0) SR_LIKELY_ATTRIBUTE {
-            m_allocationTypesCache.emplace_back(DescriptorType::Uniform);
+            m_allocationTypesCache.emplace_back(DescriptorType::DynamicUniform);
         }
         else if (pShader->GetSamplersCount() > 0) {
             m_allocationTypesCache.emplace_back(DescriptorType::CombinedImage);
@@ -113,11 +243,17 @@ namespace SR_GRAPH_NS {
         ///     m_allocationTypesCache.emplace_back(DescriptorType::Storage);
         /// }
 
-        if (m_allocationTypesCache.empty()) SR_UNLIKELY_ATTRIBUTE {
+        return m_allocationTypesCache;
+    }
+
+    DescriptorManager::DescriptorSet DescriptorManager::AllocateMemory(SR_GTYPES_NS::Shader* pShader) const {
+        auto&& types = GetAllocationTypes(pShader);
+
+        if (types.empty()) SR_UNLIKELY_ATTRIBUTE {
             return SR_ID_INVALID;
         }
 
-        const DescriptorSet descriptorSet = m_pipeline->AllocDescriptorSet(m_allocationTypesCache);
+        const DescriptorSet descriptorSet = m_pipeline->AllocDescriptorSet(types);
         if (descriptorSet == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
             SRHalt("DescriptorManager::AllocateMemory() : failed to allocate descriptor set!");
             return SR_ID_INVALID;
@@ -137,36 +273,80 @@ namespace SR_GRAPH_NS {
         }
 
         auto&& info = m_descriptorPool.RemoveByIndex(*pVirtualDescriptorSet);
-        for (auto&& descriptor : info) {
-            if (descriptor.descriptorSet == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
-                continue;
-            }
-            m_pipeline->FreeDescriptorSet(&descriptor.descriptorSet);
+        Release(info);
+
+        if (m_currentVirtualSet == *pVirtualDescriptorSet) {
+            m_currentVirtualSet = SR_ID_INVALID;
         }
 
         *pVirtualDescriptorSet = SR_ID_INVALID;
         return true;
     }
 
-    void DescriptorManager::CollectUnused() {
+    void DescriptorManager::OnResourceFreed(DescriptorType type, int32_t resource) {
+        m_cache.InvalidateResource(type, resource);
+    }
+
+    void DescriptorManager::Release(VirtualDescriptorSetInfo& info) {
+        for (auto&& descriptorSetInfo : info.descriptorSets) {
+            ReleaseElement(descriptorSetInfo);
+        }
+        info.descriptorSets.clear();
+    }
+
+    void DescriptorManager::NextFrame() {
         SR_TRACY_ZONE;
 
-        if (m_descriptorPool.IsEmpty()) {
+        if (!m_pipeline) SR_UNLIKELY_ATTRIBUTE {
             return;
         }
 
+        /// набор мог быть записан в командные буферы всех кадров в полете
+        const uint32_t framesInFlight = static_cast<uint32_t>(m_pipeline->GetBuildIterationsCount()) + 1;
+
+        m_cache.NextFrame(framesInFlight, m_garbage);
+
+        FreeGarbage();
+
+        m_pipeline->ResetTransientDescriptorSets();
+    }
+
+    void DescriptorManager::Clear() {
+        SR_TRACY_ZONE;
+
+        m_descriptorPool.ForEach([this](VirtualDescriptorSet, VirtualDescriptorSetInfo& info) {
+            Release(info);
+        });
+
+        m_currentVirtualSet = SR_ID_INVALID;
+
+        m_cache.Clear(m_garbage);
+
+        FreeGarbage();
+    }
+
+    void DescriptorManager::FreeGarbage() {
+        for (auto&& descriptorSet : m_garbage) {
+            m_pipeline->FreeDescriptorSet(&descriptorSet);
+        }
+        m_garbage.clear();
+    }
+
+    void DescriptorManager::CollectUnused() {
+        SR_TRACY_ZONE;
+
         auto&& handles = m_pipeline->GetShaderHandles();
 
         uint32_t count = 0;
 
-        m_descriptorPool.ForEach([&](VirtualDescriptorSet , std::vector<DescriptorSetInfo>& descriptorSetInfos) {
+        m_descriptorPool.ForEach([&](VirtualDescriptorSet, VirtualDescriptorSetInfo& info) {
+            auto&& descriptorSetInfos = info.descriptorSets;
+
             for (auto pIt = descriptorSetInfos.begin(); pIt != descriptorSetInfos.end(); ) {
                 DescriptorSetInfo& data = *pIt;
 
                 if (handles.count(data.pShaderHandle) == 0) {
-                    if (data.descriptorSet != SR_ID_INVALID) {
-                        m_pipeline->FreeDescriptorSet(&data.descriptorSet);
-                    }
+                    ReleaseElement(data);
                     pIt = descriptorSetInfos.erase(pIt);
                     ++count;
                 }
@@ -176,8 +356,10 @@ namespace SR_GRAPH_NS {
             }
         });
 
+        m_cache.InvalidateLayouts(handles);
+
         if (count > 0) {
             SR_LOG("DescriptorManager::CollectUnused() : collected {} unused descriptors.", count);
         }
     }
-}
\ No newline at end of file
+}
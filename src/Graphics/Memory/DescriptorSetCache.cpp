@@ -0,0 +1,247 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/DescriptorSetCache.h>
+
+namespace SR_GRAPH_NS {
+    DescriptorSetCache::~DescriptorSetCache() {
+        SRAssert2(m_entries.IsEmpty() && m_garbage.empty(), "Descriptor set cache is not empty!");
+    }
+
+    uint64_t DescriptorSetCache::CalculateHash(void* pLayout, const DescriptorBindings& bindings) noexcept {
+        uint64_t hash = SR_UTILS_NS::HashCombine(reinterpret_cast<uintptr_t>(pLayout), 0ULL);
+
+        for (auto&& binding : bindings) {
+            hash = SR_UTILS_NS::HashCombine(binding.binding, hash);
+            hash = SR_UTILS_NS::HashCombine(static_cast<uint32_t>(binding.type), hash);
+            hash = SR_UTILS_NS::HashCombine(binding.resource, hash);
+            hash = SR_UTILS_NS::HashCombine(binding.range, hash);
+            hash = SR_UTILS_NS::HashCombine(binding.generation, hash);
+            hash = SR_UTILS_NS::HashCombine(binding.isAttachment, hash);
+        }
+
+        return hash;
+    }
+
+    DescriptorSetCache::Handle DescriptorSetCache::Acquire(void* pLayout, uint64_t hash, const DescriptorBindings& bindings) {
+        auto&& pIt = m_lookup.find(hash);
+        if (pIt == m_lookup.end()) {
+            ++m_statistics.misses;
+            return SR_ID_INVALID;
+        }
+
+        const Handle handle = pIt->second;
+        auto&& entry = m_entries.At(handle);
+
+        /// коллизия хеша, считаем промахом
+        if (entry.pLayout != pLayout || entry.bindings != bindings) SR_UNLIKELY_ATTRIBUTE {
+            ++m_statistics.misses;
+            return SR_ID_INVALID;
+        }
+
+        if (entry.refCount == 0) {
+            if (auto&& pUnusedIt = m_unusedIterators.find(handle); pUnusedIt != m_unusedIterators.end()) {
+                m_unused.erase(pUnusedIt->second);
+                m_unusedIterators.erase(pUnusedIt);
+            }
+        }
+
+        ++entry.refCount;
+        entry.lastUseFrame = m_frame;
+        ++m_statistics.hits;
+
+        return handle;
+    }
+
+    DescriptorSetCache::Handle DescriptorSetCache::Insert(void* pLayout, uint64_t hash, DescriptorSet descriptorSet, const DescriptorBindings& bindings, bool transient) {
+        Entry entry;
+        entry.pLayout = pLayout;
+        entry.hash = hash;
+        entry.bindings = bindings;
+        entry.descriptorSet = descriptorSet;
+        entry.refCount = 1;
+        entry.lastUseFrame = m_frame;
+        entry.transient = transient;
+
+        const Handle handle = m_entries.Add(std::move(entry));
+
+        /// при коллизии старый набор просто перестает быть доступным для поиска
+        m_lookup[hash] = handle;
+
+        return handle;
+    }
+
+    void DescriptorSetCache::Release(Handle handle) {
+        if (handle == SR_ID_INVALID) {
+            return;
+        }
+
+        auto&& entry = m_entries.At(handle);
+        if (entry.refCount == 0) SR_UNLIKELY_ATTRIBUTE {
+            SRHalt("DescriptorSetCache::Release() : entry is not referenced!");
+            return;
+        }
+
+        if (--entry.refCount > 0) {
+            return;
+        }
+
+        entry.lastUseFrame = m_frame;
+
+        if (entry.invalid) {
+            Destroy(handle);
+            return;
+        }
+
+        m_unusedIterators[handle] = m_unused.insert(m_unused.end(), handle);
+    }
+
+    bool DescriptorSetCache::IsValid(Handle handle) const noexcept {
+        return handle != SR_ID_INVALID && !m_entries.At(handle).invalid;
+    }
+
+    DescriptorSetCache::DescriptorSet DescriptorSetCache::GetDescriptorSet(Handle handle) const noexcept {
+        return m_entries.At(handle).descriptorSet;
+    }
+
+    uint64_t DescriptorSetCache::GetHash(Handle handle) const noexcept {
+        return m_entries.At(handle).hash;
+    }
+
+    void DescriptorSetCache::InvalidateResource(DescriptorType type, int32_t resource) {
+        if (resource == SR_ID_INVALID || m_entries.IsEmpty()) {
+            return;
+        }
+
+        std::vector<Handle> unused;
+
+        m_entries.ForEach([&](Handle handle, Entry& entry) {
+            if (entry.invalid) {
+                return;
+            }
+
+            for (auto&& binding : entry.bindings) {
+                if (binding.resource != resource || binding.type != type) {
+                    continue;
+                }
+
+                Invalidate(handle, entry);
+
+                if (entry.refCount == 0) {
+                    unused.emplace_back(handle);
+                }
+
+                break;
+            }
+        });
+
+        for (auto&& handle : unused) {
+            Destroy(handle);
+        }
+    }
+
+    void DescriptorSetCache::InvalidateLayouts(const std::set<void*>& aliveLayouts) {
+        if (m_entries.IsEmpty()) {
+            return;
+        }
+
+        std::vector<Handle> unused;
+
+        m_entries.ForEach([&](Handle handle, Entry& entry) {
+            if (entry.invalid || aliveLayouts.count(entry.pLayout) != 0) {
+                return;
+            }
+
+            Invalidate(handle, entry);
+
+            if (entry.refCount == 0) {
+                unused.emplace_back(handle);
+            }
+        });
+
+        for (auto&& handle : unused) {
+            Destroy(handle);
+        }
+    }
+
+    void DescriptorSetCache::NextFrame(uint32_t framesInFlight, std::vector<DescriptorSet>& garbage) {
+        SR_TRACY_ZONE;
+
+        /// временные наборы живут до конца кадра, в котором они перестали использоваться
+        for (auto pIt = m_unused.begin(); pIt != m_unused.end(); ) {
+            const Handle handle = *pIt;
+            ++pIt;
+
+            if (m_entries.At(handle).transient) {
+                Destroy(handle);
+            }
+        }
+
+        /// постоянные вытесняем начиная с самых старых
+        while (m_entries.GetAliveCount() > m_capacity && !m_unused.empty()) {
+            Destroy(m_unused.front());
+            ++m_statistics.evicted;
+        }
+
+        for (auto pIt = m_garbage.begin(); pIt != m_garbage.end(); ) {
+            if (pIt->frame + framesInFlight > m_frame) {
+                ++pIt;
+                continue;
+            }
+            garbage.emplace_back(pIt->descriptorSet);
+            pIt = m_garbage.erase(pIt);
+        }
+
+        m_statistics.alive = m_entries.GetAliveCount();
+        m_statistics.unused = static_cast<uint32_t>(m_unused.size());
+
+        ++m_frame;
+    }
+
+    void DescriptorSetCache::Clear(std::vector<DescriptorSet>& garbage) {
+        std::vector<Handle> handles;
+        m_entries.ForEach([&handles](Handle handle, Entry&) {
+            handles.emplace_back(handle);
+        });
+
+        for (auto&& handle : handles) {
+            Destroy(handle);
+        }
+
+        for (auto&& item : m_garbage) {
+            garbage.emplace_back(item.descriptorSet);
+        }
+
+        m_garbage.clear();
+        m_lookup.clear();
+        m_unused.clear();
+        m_unusedIterators.clear();
+    }
+
+    void DescriptorSetCache::Invalidate(Handle handle, Entry& entry) {
+        entry.invalid = true;
+        ++m_statistics.invalidated;
+
+        if (auto&& pIt = m_lookup.find(entry.hash); pIt != m_lookup.end() && pIt->second == handle) {
+            m_lookup.erase(pIt);
+        }
+    }
+
+    void DescriptorSetCache::Destroy(Handle handle) {
+        auto&& entry = m_entries.RemoveByIndex(handle);
+
+        if (auto&& pIt = m_lookup.find(entry.hash); pIt != m_lookup.end() && pIt->second == handle) {
+            m_lookup.erase(pIt);
+        }
+
+        if (auto&& pIt = m_unusedIterators.find(handle); pIt != m_unusedIterators.end()) {
+            m_unused.erase(pIt->second);
+            m_unusedIterators.erase(pIt);
+        }
+
+        if (entry.descriptorSet != SR_ID_INVALID) {
+            m_garbage.emplace_back(Garbage { entry.descriptorSet, m_frame });
+        }
+    }
+}
@@ -0,0 +1,69 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/FramebufferPool.h>
+#include <Graphics/Types/Framebuffer.h>
+
+namespace SR_GRAPH_NS::Memory {
+    bool FramebufferPool::Put(FramebufferPtr pFramebuffer, uint64_t frame) {
+        /// буфер с ошибкой или без памяти нечего переиспользовать
+        if (!pFramebuffer || m_entries.size() >= MAX_COUNT || !pFramebuffer->IsValid()) {
+            return false;
+        }
+
+        Entry entry;
+        entry.pFramebuffer = pFramebuffer;
+        entry.description = pFramebuffer->GetDescriptionHash();
+        entry.size = pFramebuffer->GetSize();
+        entry.frame = frame;
+
+        m_entries.emplace_back(entry);
+
+        return true;
+    }
+
+    FramebufferPool::FramebufferPtr FramebufferPool::Take(uint64_t description, const SR_MATH_NS::IVector2& size) {
+        const SR_MATH_NS::IVector2 sizeClass = GetSizeClass(size);
+
+        /// буферы фиксированного размера выделены точно, динамические - по классу
+        auto&& pIt = std::find_if(m_entries.begin(), m_entries.end(), [description, &size, &sizeClass](const Entry& entry) {
+            return entry.description == description && (entry.size == size || entry.size == sizeClass);
+        });
+
+        if (pIt == m_entries.end()) {
+            ++m_statistics.misses;
+            return nullptr;
+        }
+
+        ++m_statistics.hits;
+
+        auto&& pFramebuffer = pIt->pFramebuffer;
+        m_entries.erase(pIt);
+
+        return pFramebuffer;
+    }
+
+    std::vector<FramebufferPool::FramebufferPtr> FramebufferPool::Trim(uint64_t frame, bool force) {
+        std::vector<FramebufferPtr> expired;
+
+        for (auto pIt = m_entries.begin(); pIt != m_entries.end(); ) {
+            if (force || frame - pIt->frame > LIFETIME_FRAMES) {
+                expired.emplace_back(pIt->pFramebuffer);
+                pIt = m_entries.erase(pIt);
+            }
+            else {
+                ++pIt;
+            }
+        }
+
+        return expired;
+    }
+
+    SR_MATH_NS::IVector2 FramebufferPool::GetSizeClass(const SR_MATH_NS::IVector2& size) noexcept {
+        return SR_MATH_NS::IVector2(
+            (SR_MAX(size.x, 1) + SIZE_CLASS_STEP - 1) / SIZE_CLASS_STEP * SIZE_CLASS_STEP,
+            (SR_MAX(size.y, 1) + SIZE_CLASS_STEP - 1) / SIZE_CLASS_STEP * SIZE_CLASS_STEP
+        );
+    }
+}
@@ -0,0 +1,519 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/GeometryPool.h>
+#include <Graphics/Pipeline/Pipeline.h>
+
+namespace SR_GRAPH_NS {
+    void GeometryPool::SetPipeline(PipelinePtr pipeline) {
+        std::lock_guard lock(m_mutex);
+
+        if (m_pipeline && m_pipeline != pipeline) {
+            SR_WARN("GeometryPool::SetPipeline() : pipeline changed, clearing the pool...");
+            Clear();
+        }
+
+        m_pipeline = std::move(pipeline);
+        m_enabled = m_pipeline && SR_UTILS_NS::Features::Instance().Enabled("GeometryPool", false);
+    }
+
+    GeometryPool::AllocationId GeometryPool::AllocateVertices(Vertices::VertexType type, const void* pData, uint32_t count) {
+        std::lock_guard lock(m_mutex);
+        return Allocate(GetHeap(Memory::MeshMemoryType::VBO, type), pData, count);
+    }
+
+    GeometryPool::AllocationId GeometryPool::AllocateIndices(const uint32_t* pData, uint32_t count) {
+        std::lock_guard lock(m_mutex);
+        return Allocate(GetHeap(Memory::MeshMemoryType::IBO, Vertices::VertexType::Unknown), pData, count);
+    }
+
+    GeometryPool::AllocationId GeometryPool::Allocate(uint32_t heapIndex, const void* pData, uint32_t count) {
+        SR_TRACY_ZONE;
+
+        if (!m_enabled || !m_pipeline || heapIndex == SR_UINT32_MAX || count == 0 || !pData) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("GeometryPool::Allocate() : invalid allocation! Count: {}", count);
+            return SR_ID_INVALID;
+        }
+
+        auto&& heap = m_heaps[heapIndex];
+
+        uint32_t pageIndex = 0;
+        uint32_t offset = 0;
+
+        for (; pageIndex < heap.pages.size(); ++pageIndex) {
+            if (heap.pages[pageIndex].buffer != SR_ID_INVALID && TakeBlock(heap.pages[pageIndex], count, offset)) {
+                break;
+            }
+        }
+
+        if (pageIndex == heap.pages.size()) {
+            if (!CreatePage(heapIndex, count, pageIndex) || !TakeBlock(heap.pages[pageIndex], count, offset)) SR_UNLIKELY_ATTRIBUTE {
+                SR_ERROR("GeometryPool::Allocate() : failed to allocate {} elements!", count);
+                return SR_ID_INVALID;
+            }
+        }
+
+        auto&& page = heap.pages[pageIndex];
+
+        const uint64_t begin = static_cast<uint64_t>(offset) * heap.stride;
+        const uint64_t size = static_cast<uint64_t>(count) * heap.stride;
+
+        std::memcpy(page.shadow.data() + begin, pData, size);
+
+        page.used += count;
+        MarkDirty(page, begin, begin + size);
+
+        return m_allocations.Add(Allocation {
+            .heap = heapIndex,
+            .page = pageIndex,
+            .offset = offset,
+            .count = count,
+        });
+    }
+
+    bool GeometryPool::Free(AllocationId id) {
+        std::lock_guard lock(m_mutex);
+
+        if (id == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("GeometryPool::Free() : invalid allocation id!");
+            return false;
+        }
+
+        /// участок еще могут читать кадры в полете, освобождаем его в NextFrame
+        m_pendingBlocks.emplace_back(PendingBlock {
+            .allocation = m_allocations.RemoveByIndex(id),
+            .frame = m_frame,
+        });
+
+        return true;
+    }
+
+    int32_t GeometryPool::GetBuffer(AllocationId id) const {
+        std::lock_guard lock(m_mutex);
+
+        if (id == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            return SR_ID_INVALID;
+        }
+
+        auto&& allocation = m_allocations.At(id);
+        return m_heaps[allocation.heap].pages[allocation.page].buffer;
+    }
+
+    uint32_t GeometryPool::GetOffset(AllocationId id) const {
+        std::lock_guard lock(m_mutex);
+
+        if (id == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            return 0;
+        }
+
+        return m_allocations.At(id).offset;
+    }
+
+    bool GeometryPool::IsEqual(AllocationId id, const void* pData, uint64_t size) const {
+        SR_TRACY_ZONE;
+
+        std::lock_guard lock(m_mutex);
+
+        if (id == SR_ID_INVALID || !pData) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        auto&& allocation = m_allocations.At(id);
+        auto&& heap = m_heaps[allocation.heap];
+
+        if (static_cast<uint64_t>(allocation.count) * heap.stride != size) {
+            return false;
+        }
+
+        auto&& page = heap.pages[allocation.page];
+        return std::memcmp(page.shadow.data() + static_cast<uint64_t>(allocation.offset) * heap.stride, pData, size) == 0;
+    }
+
+    void GeometryPool::Flush() {
+        SR_TRACY_ZONE;
+
+        std::lock_guard lock(m_mutex);
+
+        if (!m_pipeline) {
+            return;
+        }
+
+        for (auto&& heap : m_heaps) {
+            for (auto&& page : heap.pages) {
+                if (page.dirtyRanges.empty() || page.buffer == SR_ID_INVALID) {
+                    continue;
+                }
+
+                for (auto&& [begin, end] : page.dirtyRanges) {
+                    if (heap.memoryType == Memory::MeshMemoryType::VBO) {
+                        m_pipeline->UpdateVBO(page.buffer, page.shadow.data() + begin, end - begin, begin);
+                    }
+                    else {
+                        m_pipeline->UpdateIBO(page.buffer, page.shadow.data() + begin, end - begin, begin);
+                    }
+
+                    m_uploadedBytes += end - begin;
+                }
+
+                page.dirtyRanges.clear();
+            }
+        }
+    }
+
+    void GeometryPool::NextFrame(uint32_t framesInFlight) {
+        SR_TRACY_ZONE;
+
+        std::lock_guard lock(m_mutex);
+
+        ++m_frame;
+
+        for (auto pIt = m_pendingBlocks.begin(); pIt != m_pendingBlocks.end(); ) {
+            if (pIt->frame + framesInFlight > m_frame) {
+                ++pIt;
+                continue;
+            }
+
+            auto&& allocation = pIt->allocation;
+            auto&& heap = m_heaps[allocation.heap];
+            auto&& page = heap.pages[allocation.page];
+
+            ReleaseBlock(page, allocation.offset, allocation.count);
+            page.used -= allocation.count;
+
+            if (page.used == 0) {
+                FreePage(heap, page);
+            }
+
+            pIt = m_pendingBlocks.erase(pIt);
+        }
+
+        for (auto pIt = m_retiredPages.begin(); pIt != m_retiredPages.end(); ) {
+            if (pIt->frame + framesInFlight > m_frame) {
+                ++pIt;
+                continue;
+            }
+
+            auto&& heap = m_heaps[pIt->heap];
+            FreePage(heap, heap.pages[pIt->page]);
+
+            pIt = m_retiredPages.erase(pIt);
+        }
+    }
+
+    bool GeometryPool::Compact(float_t fragmentationThreshold) {
+        SR_TRACY_ZONE;
+
+        std::lock_guard lock(m_mutex);
+
+        bool moved = false;
+
+        for (uint32_t heapIndex = 0; heapIndex < m_heaps.size(); ++heapIndex) {
+            auto&& heap = m_heaps[heapIndex];
+
+            for (uint32_t pageIndex = 0; pageIndex < heap.pages.size(); ++pageIndex) {
+                auto&& page = heap.pages[pageIndex];
+
+                if (page.buffer == SR_ID_INVALID || page.used == 0 || page.freeBlocks.size() < 2) {
+                    continue;
+                }
+
+                /// освобождаемые участки еще читаются, такую страницу двигать нельзя
+                const bool hasPending = std::any_of(m_pendingBlocks.begin(), m_pendingBlocks.end(), [heapIndex, pageIndex](auto&& pending) {
+                    return pending.allocation.heap == heapIndex && pending.allocation.page == pageIndex;
+                });
+
+                if (hasPending) {
+                    continue;
+                }
+
+                /// дыры внутри занятой части страницы, хвостовой свободный участок не считается
+                uint32_t extent = page.capacity;
+                if (auto&& pLast = page.freeBlocks.rbegin(); pLast->first + pLast->second == page.capacity) {
+                    extent = pLast->first;
+                }
+
+                if (extent == 0 || static_cast<float_t>(extent - page.used) / static_cast<float_t>(extent) < fragmentationThreshold) {
+                    continue;
+                }
+
+                /// старую страницу еще читают кадры в полете, поэтому участки переносятся в новую
+                uint32_t newPageIndex = 0;
+                if (!CreatePage(heapIndex, page.used, newPageIndex)) SR_UNLIKELY_ATTRIBUTE {
+                    continue;
+                }
+
+                /// создание страницы могло переложить вектор
+                auto&& oldPage = heap.pages[pageIndex];
+                auto&& newPage = heap.pages[newPageIndex];
+
+                std::vector<Allocation*> allocations;
+
+                m_allocations.ForEach([&allocations, heapIndex, pageIndex](AllocationId, Allocation& allocation) {
+                    if (allocation.heap == heapIndex && allocation.page == pageIndex) {
+                        allocations.emplace_back(&allocation);
+                    }
+                });
+
+                std::sort(allocations.begin(), allocations.end(), [](auto&& pLeft, auto&& pRight) {
+                    return pLeft->offset < pRight->offset;
+                });
+
+                uint32_t offset = 0;
+
+                for (auto&& pAllocation : allocations) {
+                    std::memcpy(
+                        newPage.shadow.data() + static_cast<uint64_t>(offset) * heap.stride,
+                        oldPage.shadow.data() + static_cast<uint64_t>(pAllocation->offset) * heap.stride,
+                        static_cast<uint64_t>(pAllocation->count) * heap.stride
+                    );
+                    pAllocation->page = newPageIndex;
+                    pAllocation->offset = offset;
+                    offset += pAllocation->count;
+                }
+
+                newPage.freeBlocks.clear();
+                newPage.freeBySize.clear();
+                InsertFreeBlock(newPage, offset, newPage.capacity - offset);
+
+                newPage.used = offset;
+                MarkDirty(newPage, 0, static_cast<uint64_t>(offset) * heap.stride);
+
+                /// из старой страницы больше ничего не выделяется, буфер освободится в NextFrame
+                oldPage.used = 0;
+                oldPage.dirtyRanges.clear();
+                oldPage.freeBlocks.clear();
+                oldPage.freeBySize.clear();
+
+                m_retiredPages.emplace_back(RetiredPage {
+                    .heap = heapIndex,
+                    .page = pageIndex,
+                    .frame = m_frame,
+                });
+
+                moved = true;
+            }
+        }
+
+        return moved;
+    }
+
+    void GeometryPool::Clear() {
+        std::lock_guard lock(m_mutex);
+
+        for (auto&& heap : m_heaps) {
+            for (auto&& page : heap.pages) {
+                FreePage(heap, page);
+            }
+        }
+
+        if (!m_allocations.IsEmpty()) {
+            SR_WARN("GeometryPool::Clear() : {} allocations are still alive!", m_allocations.GetAliveCount());
+        }
+
+        std::vector<AllocationId> alive;
+        m_allocations.ForEach([&alive](AllocationId id, Allocation&) {
+            alive.emplace_back(id);
+        });
+
+        for (auto&& id : alive) {
+            m_allocations.RemoveByIndex(id);
+        }
+
+        m_heaps.clear();
+        m_pendingBlocks.clear();
+        m_retiredPages.clear();
+        m_uploadedBytes = 0;
+    }
+
+    GeometryPool::Statistics GeometryPool::GetStatistics() const {
+        std::lock_guard lock(m_mutex);
+
+        Statistics statistics;
+
+        statistics.uploadedBytes = m_uploadedBytes;
+        statistics.allocations = m_allocations.GetAliveCount();
+
+        for (auto&& heap : m_heaps) {
+            for (auto&& page : heap.pages) {
+                if (page.buffer == SR_ID_INVALID) {
+                    continue;
+                }
+
+                ++statistics.pages;
+                statistics.reservedBytes += static_cast<uint64_t>(page.capacity) * heap.stride;
+                statistics.usedBytes += static_cast<uint64_t>(page.used) * heap.stride;
+                statistics.freeBlocks += static_cast<uint32_t>(page.freeBlocks.size());
+            }
+        }
+
+        return statistics;
+    }
+
+    uint32_t GeometryPool::GetHeap(Memory::MeshMemoryType memoryType, Vertices::VertexType vertexType) {
+        for (uint32_t i = 0; i < m_heaps.size(); ++i) {
+            if (m_heaps[i].memoryType == memoryType && m_heaps[i].vertexType == vertexType) {
+                return i;
+            }
+        }
+
+        const uint32_t stride = memoryType == Memory::MeshMemoryType::IBO ? sizeof(uint32_t) : Vertices::GetVertexSize(vertexType);
+        if (stride == 0) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("GeometryPool::GetHeap() : unsupported vertex type \"{}\"!", SR_UTILS_NS::EnumReflector::ToStringAtom<Vertices::VertexType>(vertexType).ToStringRef());
+            return SR_UINT32_MAX;
+        }
+
+        auto&& heap = m_heaps.emplace_back();
+        heap.memoryType = memoryType;
+        heap.vertexType = vertexType;
+        heap.stride = stride;
+
+        return static_cast<uint32_t>(m_heaps.size() - 1);
+    }
+
+    bool GeometryPool::CreatePage(uint32_t heapIndex, uint32_t minCount, uint32_t& pageIndex) {
+        SR_TRACY_ZONE;
+
+        auto&& heap = m_heaps[heapIndex];
+
+        const uint64_t pageSize = heap.memoryType == Memory::MeshMemoryType::IBO ? INDEX_PAGE_SIZE : VERTEX_PAGE_SIZE;
+        /// слишком большой меш получает собственную страницу
+        const uint32_t capacity = SR_MAX(static_cast<uint32_t>(pageSize / heap.stride), minCount);
+
+        /// освобожденные страницы сохраняют свой индекс, чтобы не трогать выделенные участки
+        pageIndex = 0;
+        while (pageIndex < heap.pages.size() && heap.pages[pageIndex].buffer != SR_ID_INVALID) {
+            ++pageIndex;
+        }
+
+        if (pageIndex == heap.pages.size()) {
+            heap.pages.emplace_back();
+        }
+
+        auto&& page = heap.pages[pageIndex];
+
+        page.capacity = capacity;
+        page.used = 0;
+        page.dirtyRanges.clear();
+        page.shadow.assign(static_cast<uint64_t>(capacity) * heap.stride, 0);
+        page.freeBlocks.clear();
+        page.freeBySize.clear();
+
+        if (heap.memoryType == Memory::MeshMemoryType::VBO) {
+            page.buffer = m_pipeline->AllocateVBO(page.shadow.data(), heap.vertexType, capacity);
+        }
+        else {
+            page.buffer = m_pipeline->AllocateIBO(page.shadow.data(), sizeof(uint32_t), capacity, SR_ID_INVALID);
+        }
+
+        if (page.buffer == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("GeometryPool::CreatePage() : failed to allocate page! Size: {} bytes", page.shadow.size());
+            page.shadow = std::vector<uint8_t>();
+            return false;
+        }
+
+        InsertFreeBlock(page, 0, capacity);
+
+        return true;
+    }
+
+    void GeometryPool::FreePage(const Heap& heap, Page& page) {
+        if (page.buffer == SR_ID_INVALID) {
+            return;
+        }
+
+        if (m_pipeline) {
+            if (heap.memoryType == Memory::MeshMemoryType::VBO) {
+                m_pipeline->FreeVBO(&page.buffer);
+            }
+            else {
+                m_pipeline->FreeIBO(&page.buffer);
+            }
+        }
+
+        page.buffer = SR_ID_INVALID;
+        page.capacity = 0;
+        page.used = 0;
+        page.dirtyRanges.clear();
+        page.shadow = std::vector<uint8_t>();
+        page.freeBlocks.clear();
+        page.freeBySize.clear();
+    }
+
+    bool GeometryPool::TakeBlock(Page& page, uint32_t count, uint32_t& offset) {
+        /// наименьший подходящий участок
+        auto&& pBest = page.freeBySize.lower_bound(std::make_pair(count, 0U));
+        if (pBest == page.freeBySize.end()) {
+            return false;
+        }
+
+        offset = pBest->second;
+        const uint32_t blockCount = pBest->first;
+
+        EraseFreeBlock(page, page.freeBlocks.find(offset));
+
+        if (blockCount > count) {
+            InsertFreeBlock(page, offset + count, blockCount - count);
+        }
+
+        return true;
+    }
+
+    void GeometryPool::ReleaseBlock(Page& page, uint32_t offset, uint32_t count) {
+        /// сливаем с соседями слева и справа
+        if (auto&& pNext = page.freeBlocks.find(offset + count); pNext != page.freeBlocks.end()) {
+            count += pNext->second;
+            EraseFreeBlock(page, pNext);
+        }
+
+        if (auto&& pNext = page.freeBlocks.lower_bound(offset); pNext != page.freeBlocks.begin()) {
+            auto&& pPrev = std::prev(pNext);
+            if (pPrev->first + pPrev->second == offset) {
+                offset = pPrev->first;
+                count += pPrev->second;
+                EraseFreeBlock(page, pPrev);
+            }
+        }
+
+        InsertFreeBlock(page, offset, count);
+    }
+
+    void GeometryPool::InsertFreeBlock(Page& page, uint32_t offset, uint32_t count) {
+        if (count == 0) {
+            return;
+        }
+
+        page.freeBlocks.emplace(offset, count);
+        page.freeBySize.emplace(count, offset);
+    }
+
+    void GeometryPool::EraseFreeBlock(Page& page, std::map<uint32_t, uint32_t>::iterator pIt) {
+        page.freeBySize.erase(std::make_pair(pIt->second, pIt->first));
+        page.freeBlocks.erase(pIt);
+    }
+
+    void GeometryPool::MarkDirty(Page& page, uint64_t begin, uint64_t end) {
+        if (begin >= end) {
+            return;
+        }
+
+        /// поглощаем пересекающиеся и соседние участки справа
+        auto&& pIt = page.dirtyRanges.lower_bound(begin);
+        while (pIt != page.dirtyRanges.end() && pIt->first <= end) {
+            end = SR_MAX(end, pIt->second);
+            pIt = page.dirtyRanges.erase(pIt);
+        }
+
+        /// и слева
+        if (pIt != page.dirtyRanges.begin()) {
+            auto&& pPrev = std::prev(pIt);
+            if (pPrev->second >= begin) {
+                begin = pPrev->first;
+                end = SR_MAX(end, pPrev->second);
+                page.dirtyRanges.erase(pPrev);
+            }
+        }
+
+        page.dirtyRanges.emplace(begin, end);
+    }
+}
@@ -0,0 +1,90 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/IndirectDrawBuffer.h>
+#include <Graphics/Pipeline/Pipeline.h>
+
+namespace SR_GRAPH_NS::Memory {
+    IndirectDrawBuffer::~IndirectDrawBuffer() {
+        SRAssert2(m_buffer == SR_ID_INVALID && m_retired.empty(), "Indirect draw buffer is not freed!");
+    }
+
+    bool IndirectDrawBuffer::Reserve(uint32_t count, uint64_t frame) {
+        if (count <= m_commands.size() && m_buffer != SR_ID_INVALID) SR_LIKELY_ATTRIBUTE {
+            return true;
+        }
+
+        if (!m_pipeline) SR_UNLIKELY_ATTRIBUTE {
+            SRHalt("IndirectDrawBuffer::Reserve() : pipeline is nullptr!");
+            return false;
+        }
+
+        const uint32_t capacity = SR_MAX(MIN_CAPACITY, SR_MAX(count, static_cast<uint32_t>(m_commands.size()) * 2));
+
+        const int32_t buffer = m_pipeline->AllocateSSBO(capacity * STRIDE, SSBOUsage::Indirect);
+        if (buffer == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("IndirectDrawBuffer::Reserve() : failed to allocate buffer! Slots: {}", capacity);
+            return false;
+        }
+
+        if (m_buffer != SR_ID_INVALID) {
+            m_retired.emplace_back(RetiredBuffer { m_buffer, frame });
+        }
+
+        m_buffer = buffer;
+        m_commands.resize(capacity);
+        m_dirty = true;
+
+        return true;
+    }
+
+    void IndirectDrawBuffer::Set(uint32_t slot, const DrawIndexedCommand& command) {
+        auto&& current = m_commands[slot];
+        if (current == command) SR_LIKELY_ATTRIBUTE {
+            return;
+        }
+
+        current = command;
+        m_dirty = true;
+    }
+
+    void IndirectDrawBuffer::Flush(uint64_t frame, uint32_t framesInFlight) {
+        SR_TRACY_ZONE;
+
+        for (auto pIt = m_retired.begin(); pIt != m_retired.end(); ) {
+            if (pIt->frame + framesInFlight > frame) {
+                ++pIt;
+                continue;
+            }
+            m_pipeline->FreeSSBO(&pIt->buffer);
+            pIt = m_retired.erase(pIt);
+        }
+
+        if (!m_dirty || m_buffer == SR_ID_INVALID) {
+            return;
+        }
+
+        m_pipeline->UpdateSSBO(m_buffer, m_commands.data(), m_commands.size() * STRIDE);
+        m_dirty = false;
+    }
+
+    void IndirectDrawBuffer::Free() {
+        if (!m_pipeline) {
+            return;
+        }
+
+        for (auto&& retired : m_retired) {
+            m_pipeline->FreeSSBO(&retired.buffer);
+        }
+        m_retired.clear();
+
+        if (m_buffer != SR_ID_INVALID) {
+            m_pipeline->FreeSSBO(&m_buffer);
+            m_buffer = SR_ID_INVALID;
+        }
+
+        m_commands.clear();
+        m_dirty = false;
+    }
+}
@@ -0,0 +1,216 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/MemoryBudget.h>
+
+namespace SR_GRAPH_NS::Memory {
+    void MemoryBudget::OnAllocated(MemoryCategory category, MemoryHeap heap, int32_t id, uint64_t bytes) {
+        if (category == MemoryCategory::Unknown || heap == MemoryHeap::Unknown || id == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        auto&& categoryBytes = m_bytes[static_cast<uint8_t>(category)];
+        auto&& allocation = m_allocations[static_cast<uint8_t>(category)][id];
+
+        if (allocation.heap != MemoryHeap::Unknown) {
+            categoryBytes[static_cast<uint8_t>(allocation.heap)] -= allocation.bytes;
+        }
+
+        allocation.heap = heap;
+        allocation.bytes = bytes;
+
+        categoryBytes[static_cast<uint8_t>(heap)] += bytes;
+    }
+
+    void MemoryBudget::OnFreed(MemoryCategory category, int32_t id) {
+        if (category == MemoryCategory::Unknown) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        auto&& allocations = m_allocations[static_cast<uint8_t>(category)];
+
+        /// ссылки на вложения кадровых буферов освобождаются как текстуры, но учтены в самом буфере
+        auto&& pIt = allocations.find(id);
+        if (pIt == allocations.end()) {
+            return;
+        }
+
+        m_bytes[static_cast<uint8_t>(category)][static_cast<uint8_t>(pIt->second.heap)] -= pIt->second.bytes;
+        allocations.erase(pIt);
+    }
+
+    void MemoryBudget::Clear() {
+        std::lock_guard lock(m_mutex);
+
+        for (auto&& allocations : m_allocations) {
+            allocations.clear();
+        }
+
+        m_bytes = { };
+        m_reported = { };
+        m_largestFreeRange = { };
+        m_states = { };
+    }
+
+    void MemoryBudget::SetHeapInfo(MemoryHeap heap, const HeapInfo& info) {
+        if (heap == MemoryHeap::Unknown) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+        m_reported[static_cast<uint8_t>(heap)] = info;
+    }
+
+    void MemoryBudget::SetFallbackBudget(MemoryHeap heap, uint64_t bytes) {
+        if (heap == MemoryHeap::Unknown) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+        m_fallbackBudget[static_cast<uint8_t>(heap)] = bytes;
+    }
+
+    void MemoryBudget::SetLargestFreeRange(MemoryHeap heap, uint64_t bytes) {
+        if (heap == MemoryHeap::Unknown) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+        m_largestFreeRange[static_cast<uint8_t>(heap)] = bytes;
+    }
+
+    void MemoryBudget::SetLimits(float_t soft, float_t hard) {
+        m_hardLimit = std::clamp(hard, 0.f, 1.f);
+        m_softLimit = std::clamp(soft, 0.f, m_hardLimit);
+    }
+
+    void MemoryBudget::Update() {
+        SR_TRACY_ZONE;
+
+        for (uint8_t heapIndex = 0; heapIndex < HEAPS_COUNT; ++heapIndex) {
+            const auto heap = static_cast<MemoryHeap>(heapIndex);
+            const HeapInfo info = GetHeapInfo(heap);
+
+            if (info.budget == 0) {
+                m_states[heapIndex] = MemoryBudgetState::Normal;
+                continue;
+            }
+
+            const double_t load = static_cast<double_t>(info.usage) / static_cast<double_t>(info.budget);
+
+            MemoryBudgetState state = MemoryBudgetState::Normal;
+            if (load >= m_hardLimit) {
+                state = MemoryBudgetState::Hard;
+            }
+            else if (load >= m_softLimit) {
+                state = MemoryBudgetState::Soft;
+            }
+
+            const MemoryBudgetState previous = m_states[heapIndex];
+            m_states[heapIndex] = state;
+
+            /// обработчики вызываются только при росте нагрузки, а не каждый кадр
+            if (state <= previous) {
+                continue;
+            }
+
+            if (state == MemoryBudgetState::Hard) {
+                SR_WARN("MemoryBudget::Update() : {} heap is over the hard budget! Usage: {} MB, budget: {} MB",
+                    SR_UTILS_NS::EnumReflector::ToStringAtom(heap).ToStringRef(), info.usage / (1024 * 1024), info.budget / (1024 * 1024));
+
+                if (m_hardCallback) {
+                    m_hardCallback(heap, info);
+                }
+            }
+            else if (m_softCallback) {
+                m_softCallback(heap, info);
+            }
+        }
+    }
+
+    uint64_t MemoryBudget::GetBytes(MemoryCategory category) const {
+        uint64_t bytes = 0;
+
+        for (uint8_t heapIndex = 0; heapIndex < HEAPS_COUNT; ++heapIndex) {
+            bytes += GetBytes(category, static_cast<MemoryHeap>(heapIndex));
+        }
+
+        return bytes;
+    }
+
+    uint64_t MemoryBudget::GetBytes(MemoryCategory category, MemoryHeap heap) const {
+        if (category == MemoryCategory::Unknown || heap == MemoryHeap::Unknown) SR_UNLIKELY_ATTRIBUTE {
+            return 0;
+        }
+
+        std::lock_guard lock(m_mutex);
+        return m_bytes[static_cast<uint8_t>(category)][static_cast<uint8_t>(heap)];
+    }
+
+    uint32_t MemoryBudget::GetCount(MemoryCategory category) const {
+        if (category == MemoryCategory::Unknown) SR_UNLIKELY_ATTRIBUTE {
+            return 0;
+        }
+
+        std::lock_guard lock(m_mutex);
+        return static_cast<uint32_t>(m_allocations[static_cast<uint8_t>(category)].size());
+    }
+
+    MemoryBudget::HeapInfo MemoryBudget::GetHeapInfo(MemoryHeap heap) const {
+        if (heap == MemoryHeap::Unknown) SR_UNLIKELY_ATTRIBUTE {
+            return HeapInfo();
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        if (auto&& reported = m_reported[static_cast<uint8_t>(heap)]) {
+            return reported.value();
+        }
+
+        HeapInfo info;
+
+        for (auto&& categoryBytes : m_bytes) {
+            info.usage += categoryBytes[static_cast<uint8_t>(heap)];
+        }
+
+        info.budget = m_fallbackBudget[static_cast<uint8_t>(heap)];
+        info.blockBytes = info.usage;
+        info.allocationBytes = info.usage;
+
+        return info;
+    }
+
+    float_t MemoryBudget::GetFragmentation(MemoryHeap heap) const {
+        const HeapInfo info = GetHeapInfo(heap);
+
+        if (info.allocationBytes >= info.blockBytes) {
+            return 0.f;
+        }
+
+        std::optional<uint64_t> largestFreeRange;
+
+        {
+            std::lock_guard lock(m_mutex);
+            largestFreeRange = m_largestFreeRange[static_cast<uint8_t>(heap)];
+        }
+
+        /// без данных API о свободных участках судить о фрагментации не по чему
+        if (!largestFreeRange.has_value()) {
+            return 0.f;
+        }
+
+        const uint64_t freeBytes = info.blockBytes - info.allocationBytes;
+        const uint64_t largest = SR_MIN(largestFreeRange.value(), freeBytes);
+
+        return 1.f - static_cast<float_t>(static_cast<double_t>(largest) / static_cast<double_t>(freeBytes));
+    }
+
+    MemoryBudgetState MemoryBudget::GetState(MemoryHeap heap) const {
+        return heap == MemoryHeap::Unknown ? MemoryBudgetState::Normal : m_states[static_cast<uint8_t>(heap)];
+    }
+}
@@ -5,148 +5,435 @@
 #include <Graphics/Memory/MeshManager.h>
 
 namespace SR_GRAPH_NS::Memory {
-    MeshManager::MeshManager() {
-        const uint16_t reserve = 512;
-
-        m_VBOs.reserve(reserve);
-        m_IBOs.reserve(reserve);
-        m_VBOTable.resize(reserve);
-        m_IBOTable.resize(reserve);
+    MeshManager::HashTable::HashTable() {
+        m_tables.emplace_back(std::make_unique<Table>(INITIAL_CAPACITY));
+        m_table.store(m_tables.back().get(), std::memory_order_release);
     }
 
-    MeshManager::VideoResourcesIter MeshManager::FindImpl(Hash hash, MeshMemoryType memType) {
-        switch (memType) {
-            case MeshMemoryType::VBO: {
-                if (auto mem = m_VBOs.find(hash); mem != m_VBOs.end()) {
-                    return mem;
-                }
+    bool MeshManager::HashTable::Find(Hash key, uint64_t& value) const {
+        /// пока счетчик не нулевой, писатель не освободит таблицу, которую мы читаем
+        m_readers.fetch_add(1, std::memory_order_seq_cst);
+
+        const Table* pTable = m_table.load(std::memory_order_seq_cst);
+        const uint32_t mask = pTable->capacity - 1;
+
+        bool isFound = false;
+
+        for (uint32_t probe = 0, index = static_cast<uint32_t>(key) & mask; probe < pTable->capacity; ++probe, index = (index + 1) & mask) {
+            auto&& entry = pTable->entries[index];
+            const Hash current = entry.key.load(std::memory_order_acquire);
+
+            if (current == EMPTY) {
                 break;
             }
-            case MeshMemoryType::IBO: {
-                if (auto mem = m_IBOs.find(hash); mem != m_IBOs.end()) {
-                    return mem;
-                }
-                break;
+
+            if (current != key) {
+                continue;
             }
-            default:
-                SRHalt("MeshManager::FindImpl() : unknown memory type!");
-                return std::nullopt;
+
+            value = entry.value.load(std::memory_order_acquire);
+
+            /// запись могли удалить и занять другим ключом, пока читали значение
+            isFound = entry.key.load(std::memory_order_acquire) == key;
+
+            break;
         }
 
-        return std::nullopt;
+        m_readers.fetch_sub(1, std::memory_order_release);
+
+        return isFound;
     }
 
-    bool MeshManager::RegisterImpl(const std::string& resourceId, MeshMemoryType memType, uint32_t size, uint32_t id) {
-    #ifndef SR_RELEASE
-        if (SR_UTILS_NS::Debug::Instance().GetLevel() >= SR_UTILS_NS::Debug::Level::High) {
-            SR_LOG("MeshManager::RegisterImpl() : register resource \"" + resourceId + "\"");
-        }
-    #endif
+    bool MeshManager::HashTable::Insert(Hash key, uint64_t value) {
+        FreeRetiredTables();
 
-        SRAssert2(id <= 32768, "Buffer overflow!");
+        const uint32_t capacity = m_table.load(std::memory_order_relaxed)->capacity;
 
-        Hash hash = SR_HASH_STR(resourceId);
+        /// заполненность не выше половины, иначе цепочки проб растут
+        if ((m_count + 1) * 2 > capacity) {
+            Rehash(capacity * 2);
+        }
+        else if ((m_count + m_tombstones + 1) * 4 > capacity * 3) {
+            Rehash(capacity);
+        }
 
-        switch (memType) {
-            case MeshMemoryType::VBO: {
-                m_VBOs[hash] = MeshVidMemInfo(size, id, memType);
+        Table* pTable = m_table.load(std::memory_order_relaxed);
+        const uint32_t mask = pTable->capacity - 1;
 
-                if (id >= m_VBOTable.size()) {
-                    m_VBOTable.resize(SR_MAX(m_VBOTable.size() * 2, id + 1));
-                }
-                m_VBOTable[id] = hash;
+        Entry* pFree = nullptr;
 
+        for (uint32_t probe = 0, index = static_cast<uint32_t>(key) & mask; probe < pTable->capacity; ++probe, index = (index + 1) & mask) {
+            auto&& entry = pTable->entries[index];
+            const Hash current = entry.key.load(std::memory_order_relaxed);
+
+            if (current == key) {
+                entry.value.store(value, std::memory_order_release);
                 return true;
             }
-            case MeshMemoryType::IBO: {
-                m_IBOs[hash] = MeshVidMemInfo(size, id, memType);
 
-                if (id >= m_IBOTable.size()) {
-                    m_IBOTable.resize(SR_MAX(m_IBOTable.size() * 2, id + 1));
-                }
-                m_IBOTable[id] = hash;
+            if (current == TOMBSTONE && !pFree) {
+                pFree = &entry;
+            }
 
-                return true;
+            if (current == EMPTY) {
+                pFree = pFree ? pFree : &entry;
+                break;
             }
+        }
 
-            default:
-                SR_ERROR("MeshManager::RegisterImpl() : unknown type!");
-                return false;
+        if (!pFree) SR_UNLIKELY_ATTRIBUTE {
+            return false;
         }
+
+        if (pFree->key.load(std::memory_order_relaxed) == TOMBSTONE) {
+            --m_tombstones;
+        }
+
+        ++m_count;
+
+        /// значение должно быть видно раньше ключа
+        pFree->value.store(value, std::memory_order_relaxed);
+        pFree->key.store(key, std::memory_order_release);
+
+        return true;
     }
 
-    MeshManager::FreeResult MeshManager::FreeImpl(VideoResourcesIter iter, MeshMemoryType memType) {
-        if (auto& memory = iter.value()->second; memory.m_usages == 1) {
-            switch (memType) {
-                case MeshMemoryType::VBO: m_VBOs.erase(iter.value());
-                    goto skip;
-                case MeshMemoryType::IBO: m_IBOs.erase(iter.value());
-                skip:
-                    return FreeResult::Freed;
-                case MeshMemoryType::Unknown:
-                default:
-                    SRHalt("MeshManager::FreeImpl() : unknown memory type!");
-                    return FreeResult::UnknownMem;
+    void MeshManager::HashTable::Erase(Hash key, uint64_t value) {
+        FreeRetiredTables();
+
+        Table* pTable = m_table.load(std::memory_order_relaxed);
+        const uint32_t mask = pTable->capacity - 1;
+
+        for (uint32_t probe = 0, index = static_cast<uint32_t>(key) & mask; probe < pTable->capacity; ++probe, index = (index + 1) & mask) {
+            auto&& entry = pTable->entries[index];
+            const Hash current = entry.key.load(std::memory_order_relaxed);
+
+            if (current == EMPTY) {
+                return;
+            }
+
+            if (current != key) {
+                continue;
+            }
+
+            if (entry.value.load(std::memory_order_relaxed) != value) {
+                return;
+            }
+
+            entry.key.store(TOMBSTONE, std::memory_order_release);
+
+            --m_count;
+            ++m_tombstones;
+
+            /// удаленные записи не обрывают цепочки проб, поэтому промахи замедляются, пока таблицу не пересобрать
+            if (m_tombstones * 4 > pTable->capacity) {
+                Rehash(pTable->capacity);
             }
+
+            return;
         }
-        else {
-            --memory.m_usages;
-            return FreeResult::EndUse;
+    }
+
+    void MeshManager::HashTable::Clear() {
+        m_tables.emplace_back(std::make_unique<Table>(INITIAL_CAPACITY));
+        m_table.store(m_tables.back().get(), std::memory_order_seq_cst);
+
+        m_count = 0;
+        m_tombstones = 0;
+
+        FreeRetiredTables();
+    }
+
+    void MeshManager::HashTable::Rehash(uint32_t capacity) {
+        SR_TRACY_ZONE;
+
+        const Table* pOld = m_table.load(std::memory_order_relaxed);
+
+        auto&& pTable = std::make_unique<Table>(capacity);
+        const uint32_t mask = capacity - 1;
+
+        for (uint32_t i = 0; i < pOld->capacity; ++i) {
+            const Hash key = pOld->entries[i].key.load(std::memory_order_relaxed);
+            if (key == EMPTY || key == TOMBSTONE) {
+                continue;
+            }
+
+            uint32_t index = static_cast<uint32_t>(key) & mask;
+            while (pTable->entries[index].key.load(std::memory_order_relaxed) != EMPTY) {
+                index = (index + 1) & mask;
+            }
+
+            pTable->entries[index].value.store(pOld->entries[i].value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            pTable->entries[index].key.store(key, std::memory_order_relaxed);
         }
+
+        m_table.store(pTable.get(), std::memory_order_seq_cst);
+        m_tables.emplace_back(std::move(pTable));
+
+        m_tombstones = 0;
+
+        FreeRetiredTables();
     }
 
-    void MeshManager::OnSingletonDestroy() {
-        if (!m_VBOs.empty()) {
-            SR_WARN("MeshManager::OnSingletonDestroy() : VBOs isn't empty! \n\tCount = {} \n\tMemory leak possible.", m_VBOs.size());
+    void MeshManager::HashTable::FreeRetiredTables() {
+        if (m_tables.size() <= 1 || m_readers.load(std::memory_order_seq_cst) != 0) {
+            return;
+        }
+
+        /// новые читатели уже видят текущую таблицу, она всегда последняя
+        m_tables.erase(m_tables.begin(), m_tables.end() - 1);
+    }
+
+    MeshManager::Storage::Storage()
+        : chunks(std::make_unique<std::atomic<Slot*>[]>(MAX_SLOT_CHUNKS))
+    { }
+
+    MeshManager::MeshManager() = default;
+
+    MeshManager::Hash MeshManager::HashContent(const void* pData, uint64_t size, Vertices::VertexType vertexType) {
+        SR_TRACY_ZONE;
+
+        /// fmix64 из MurmurHash3, по 8 байт за шаг
+        auto&& mix = [](uint64_t value) -> uint64_t {
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDULL;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53ULL;
+            value ^= value >> 33;
+            return value;
+        };
+
+        auto&& pBytes = static_cast<const uint8_t*>(pData);
+
+        uint64_t hash = mix(size * 0x9E3779B97F4A7C15ULL + static_cast<uint64_t>(vertexType));
+        uint64_t offset = 0;
+
+        for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+            uint64_t word = 0;
+            std::memcpy(&word, pBytes + offset, sizeof(uint64_t));
+            hash = mix(hash ^ word);
+        }
+
+        if (offset < size) {
+            uint64_t tail = 0;
+            std::memcpy(&tail, pBytes + offset, size - offset);
+            hash = mix(hash ^ tail);
+        }
+
+        return HashTable::Normalize(hash);
+    }
+
+    MeshManager::Hash MeshManager::HashIdentifier(const std::string& identifier, Vertices::VertexType vertexType) {
+        return HashTable::Normalize(SR_UTILS_NS::HashCombine(static_cast<uint64_t>(vertexType), SR_HASH_STR(identifier)));
+    }
+
+    MeshManager::Slot* MeshManager::GetSlot(const Storage& storage, uint32_t id) {
+        if (id > MAX_BUFFER_ID) SR_UNLIKELY_ATTRIBUTE {
+            return nullptr;
+        }
+
+        Slot* pChunk = storage.chunks[id / SLOT_CHUNK_SIZE].load(std::memory_order_acquire);
+        return pChunk ? &pChunk[id % SLOT_CHUNK_SIZE] : nullptr;
+    }
+
+    MeshManager::Slot* MeshManager::GetOrCreateSlot(Storage& storage, uint32_t id) {
+        if (id > MAX_BUFFER_ID) SR_UNLIKELY_ATTRIBUTE {
+            return nullptr;
+        }
+
+        auto&& chunk = storage.chunks[id / SLOT_CHUNK_SIZE];
+
+        if (!chunk.load(std::memory_order_relaxed)) {
+            storage.ownedChunks.emplace_back(std::make_unique<Slot[]>(SLOT_CHUNK_SIZE));
+            chunk.store(storage.ownedChunks.back().get(), std::memory_order_release);
         }
 
-        if (!m_IBOs.empty()) {
-            SR_WARN("MeshManager::OnSingletonDestroy() : IBOs isn't empty! \n\tCount = {} \n\tMemory leak possible.", m_IBOs.size());
+        return &chunk.load(std::memory_order_relaxed)[id % SLOT_CHUNK_SIZE];
+    }
+
+    bool MeshManager::AcquireHandle(Storage& storage, Handle handle) {
+        const auto id = static_cast<uint32_t>(handle);
+        const auto generation = static_cast<uint32_t>(handle >> 32);
+
+        Slot* pSlot = GetSlot(storage, id);
+        if (!pSlot) SR_UNLIKELY_ATTRIBUTE {
+            return false;
         }
 
-        m_VBOs.clear();
-        m_IBOs.clear();
+        auto&& state = pSlot->state;
+        uint64_t current = state.load(std::memory_order_acquire);
 
-        m_VBOTable.clear();
-        m_IBOTable.clear();
+        /// буфер мог быть освобожден, а слот занят другим поколением
+        do {
+            if (static_cast<uint32_t>(current >> 32) != generation || static_cast<uint32_t>(current) == 0) {
+                return false;
+            }
+        }
+        while (!state.compare_exchange_weak(current, current + 1, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        return true;
     }
 
-    MeshManager::VideoResourcesIter MeshManager::FindById(int32_t id, MeshMemoryType memType) {
-        HashTable* pHashTable = nullptr;
+    int32_t MeshManager::CopyImpl(Storage& storage, Hash key, bool isAlias) {
+        Handle handle = 0;
 
-        switch (memType) {
-            case MeshMemoryType::VBO: pHashTable = &m_VBOTable; break;
-            case MeshMemoryType::IBO: pHashTable = &m_IBOTable; break;
-            case MeshMemoryType::Unknown:
-            default:
-                SRHalt("MeshManager::FindById() : unknown memory type!");
-                return std::nullopt;
+        if (!(isAlias ? storage.aliases : storage.buffers).Find(key, handle) || !AcquireHandle(storage, handle)) {
+            return SR_ID_INVALID;
         }
 
-        if (id >= pHashTable->size()) {
-            SRHalt("MeshManager::FindById() : invalid id!");
-            return std::nullopt;
+        return static_cast<int32_t>(static_cast<uint32_t>(handle));
+    }
+
+    uint32_t MeshManager::SizeImpl(const Storage& storage, int32_t id) const {
+        if (id < 0) SR_UNLIKELY_ATTRIBUTE {
+            return 0;
         }
 
-        return FindImpl((*pHashTable)[id], memType);
+        const Slot* pSlot = GetSlot(storage, static_cast<uint32_t>(id));
+        return pSlot ? pSlot->size.load(std::memory_order_acquire) : 0;
     }
 
-    uint32_t MeshVidMemInfo::Copy() {
-    #ifndef SR_RELEASE
-        if (m_type == MeshMemoryType::Unknown) {
-            SR_WARN("MeshVidMemInfo::Copy() : unknown memory type!");
+    bool MeshManager::RegisterImpl(Storage& storage, Hash key, Hash alias, uint32_t size, int32_t id) {
+        SR_TRACY_ZONE;
+
+        if (id < 0 || id > static_cast<int32_t>(MAX_BUFFER_ID)) SR_UNLIKELY_ATTRIBUTE {
+            SRHalt("MeshManager::RegisterImpl() : invalid id!");
+            return false;
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        Handle existing = 0;
+        if (key != 0 && storage.buffers.Find(key, existing)) {
+            SRHalt("MeshManager::RegisterImpl() : memory already registered!");
+            return false;
+        }
+
+        auto&& slot = *GetOrCreateSlot(storage, static_cast<uint32_t>(id));
+        const uint64_t state = slot.state.load(std::memory_order_relaxed);
+
+        if (static_cast<uint32_t>(state) != 0) {
+            SRHalt("MeshManager::RegisterImpl() : buffer is already in use!");
+            return false;
+        }
+
+        slot.key = key;
+        slot.aliases.clear();
+        slot.size.store(size, std::memory_order_relaxed);
+        slot.state.store(state | 1, std::memory_order_release);
+
+        const Handle handle = (state & 0xFFFFFFFF00000000ULL) | static_cast<uint32_t>(id);
+
+        if (key != 0 && !storage.buffers.Insert(key, handle)) {
+            SR_ERROR("MeshManager::RegisterImpl() : failed to insert buffer!");
+            slot.key = 0;
+            slot.size.store(0, std::memory_order_relaxed);
+            slot.state.store(state, std::memory_order_release);
+            return false;
+        }
+
+        ++storage.count;
+
+        if (alias != 0) {
+            InsertAlias(storage, handle, alias);
         }
 
-        if (SR_UTILS_NS::Debug::Instance().GetLevel() >= SR_UTILS_NS::Debug::Level::High) {
-            switch (m_type) {
-                case MeshMemoryType::VBO: SR_LOG("MeshVidMemInfo::Copy() : copy VBO..."); break;
-                case MeshMemoryType::IBO: SR_LOG("MeshVidMemInfo::Copy() : copy IBO..."); break;
-                default: break;
+        return true;
+    }
+
+    void MeshManager::AddAliasImpl(Storage& storage, Hash key, Hash alias) {
+        std::lock_guard lock(m_mutex);
+
+        Handle handle = 0;
+        if (storage.buffers.Find(key, handle)) {
+            InsertAlias(storage, handle, alias);
+        }
+    }
+
+    void MeshManager::InsertAlias(Storage& storage, Handle handle, Hash alias) {
+        if (storage.aliases.Insert(alias, handle)) {
+            GetSlot(storage, static_cast<uint32_t>(handle))->aliases.emplace_back(alias);
+        }
+    }
+
+    MeshManager::FreeResult MeshManager::FreeImpl(Storage& storage, int32_t id) {
+        SR_TRACY_ZONE;
+
+        Slot* pSlot = id < 0 ? nullptr : GetSlot(storage, static_cast<uint32_t>(id));
+        if (!pSlot) SR_UNLIKELY_ATTRIBUTE {
+            SRHalt("MeshManager::FreeImpl() : invalid id!");
+            return FreeResult::NotFound;
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        auto&& slot = *pSlot;
+        uint64_t state = slot.state.load(std::memory_order_acquire);
+        uint64_t desired = 0;
+
+        /// последнее использование сразу переводит слот в новое поколение,
+        /// поэтому дескрипторы, которые читатели успели прочитать, больше не захватываются
+        do {
+            if (static_cast<uint32_t>(state) == 0) SR_UNLIKELY_ATTRIBUTE {
+                SRHalt("MeshManager::FreeImpl() : memory isn't registered!");
+                return FreeResult::NotFound;
             }
+
+            desired = static_cast<uint32_t>(state) == 1 ? (state & 0xFFFFFFFF00000000ULL) + (1ULL << 32) : state - 1;
+        }
+        while (!slot.state.compare_exchange_weak(state, desired, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        if (static_cast<uint32_t>(state) > 1) {
+            return FreeResult::EndUse;
+        }
+
+        const Handle handle = (state & 0xFFFFFFFF00000000ULL) | static_cast<uint32_t>(id);
+
+        if (slot.key != 0) {
+            storage.buffers.Erase(slot.key, handle);
+        }
+
+        for (auto&& alias : slot.aliases) {
+            storage.aliases.Erase(alias, handle);
+        }
+
+        slot.aliases.clear();
+        slot.key = 0;
+        slot.size.store(0, std::memory_order_relaxed);
+
+        --storage.count;
+
+        return FreeResult::Freed;
+    }
+
+    void MeshManager::ClearStorage(Storage& storage) {
+        storage.buffers.Clear();
+        storage.aliases.Clear();
+
+        for (auto&& pChunk : storage.ownedChunks) {
+            for (uint32_t i = 0; i < SLOT_CHUNK_SIZE; ++i) {
+                pChunk[i].state.store(0, std::memory_order_relaxed);
+                pChunk[i].size.store(0, std::memory_order_relaxed);
+                pChunk[i].key = 0;
+                pChunk[i].aliases.clear();
+            }
+        }
+
+        storage.count = 0;
+    }
+
+    void MeshManager::OnSingletonDestroy() {
+        std::lock_guard lock(m_mutex);
+
+        if (m_VBOs.count > 0) {
+            SR_WARN("MeshManager::OnSingletonDestroy() : VBOs isn't empty! \n\tCount = {} \n\tMemory leak possible.", m_VBOs.count);
+        }
+
+        if (m_IBOs.count > 0) {
+            SR_WARN("MeshManager::OnSingletonDestroy() : IBOs isn't empty! \n\tCount = {} \n\tMemory leak possible.", m_IBOs.count);
         }
-    #endif
 
-        m_usages++;
-        return m_vidId;
+        ClearStorage(m_VBOs);
+        ClearStorage(m_IBOs);
     }
 }
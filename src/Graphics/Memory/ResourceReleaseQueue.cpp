@@ -0,0 +1,74 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/ResourceReleaseQueue.h>
+
+namespace SR_GRAPH_NS::Memory {
+    void ResourceReleaseQueue::Schedule(void* pResource, RCResourceType type) {
+        if (!pResource || type == RCResourceType::Unknown) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        /// ресурс может несколько раз потерять и снова получить точки использования за кадр
+        for (auto&& candidate : m_scheduled) {
+            if (candidate.pResource == pResource) {
+                return;
+            }
+        }
+
+        m_scheduled.emplace_back(Candidate { pResource, type });
+    }
+
+    std::vector<ResourceReleaseQueue::Candidate> ResourceReleaseQueue::TakeScheduled() {
+        std::lock_guard lock(m_mutex);
+        return std::exchange(m_scheduled, { });
+    }
+
+    void ResourceReleaseQueue::Push(void* pRenderResource, IGraphicsResource* pGraphicsResource, SR_UTILS_NS::IResource* pResource, RCResourceType type) {
+        auto&& entry = m_pending.emplace_back();
+
+        entry.pRenderResource = pRenderResource;
+        entry.pGraphicsResource = pGraphicsResource;
+        entry.pResource = pResource;
+        entry.type = type;
+        entry.frame = m_frame;
+
+        ++m_pendingCount[static_cast<uint8_t>(type)];
+    }
+
+    uint32_t ResourceReleaseQueue::Release(uint32_t framesInFlight, const ReleaseFn& release) {
+        SR_TRACY_ZONE;
+
+        uint32_t count = 0;
+
+        /// зависимости освобожденного ресурса попадут в m_scheduled и будут проверены при следующем обновлении
+        for (; count < m_pending.size(); ++count) {
+            const Entry entry = m_pending[count];
+
+            if (framesInFlight > 0 && entry.frame + framesInFlight > m_frame) {
+                break;
+            }
+
+            --m_pendingCount[static_cast<uint8_t>(entry.type)];
+
+            if (release(entry)) {
+                ++m_freedCount[static_cast<uint8_t>(entry.type)];
+            }
+        }
+
+        m_pending.erase(m_pending.begin(), m_pending.begin() + count);
+
+        return count;
+    }
+
+    uint32_t ResourceReleaseQueue::GetPendingCount(RCResourceType type) const noexcept {
+        return type == RCResourceType::Unknown ? 0 : m_pendingCount[static_cast<uint8_t>(type)];
+    }
+
+    uint64_t ResourceReleaseQueue::GetFreedCount(RCResourceType type) const noexcept {
+        return type == RCResourceType::Unknown ? 0 : m_freedCount[static_cast<uint8_t>(type)];
+    }
+}
@@ -143,6 +143,30 @@ namespace SR_GRAPH_NS::Memory {
         }, property);
     }
 
+    void ShaderUBOBlock::SetRange(uint32_t offset, const void* pData, uint32_t size) noexcept {
+        if (!m_memory || !pData) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        if (offset + size > m_size) SR_UNLIKELY_ATTRIBUTE {
+            SRHaltOnce("Out of range!");
+            return;
+        }
+
+        memcpy(m_memory + offset, pData, size);
+    }
+
+    bool ShaderUBOBlock::FindField(uint64_t hashId, FieldLocation& location) const noexcept {
+        for (uint8_t i = 0; i < m_dataCount; ++i) {
+            if (m_data[i].hashId == hashId) {
+                location.offset = static_cast<uint32_t>(m_data[i].offset);
+                location.size = static_cast<uint32_t>(m_data[i].size);
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool ShaderUBOBlock::HasField(uint64_t hashId) const noexcept {
         for (uint8_t i = 0; i < m_dataCount; ++i) {
             if (m_data[i].hashId == hashId) {
@@ -24,6 +24,8 @@ namespace SR_GRAPH_NS::Memory {
                 const auto mipLevels   = static_cast<uint32_t>(texture.TryGetAttribute("MipLevels").ToInt(1));
                 const auto alpha       = SR_UTILS_NS::EnumReflector::FromString<SR_UTILS_NS::BoolExt>(texture.TryGetAttribute("Alpha").ToString("None"));
                 const auto cpuUsage    = texture.TryGetAttribute("CPUUsage").ToBool(false);
+                const auto mipFilter   = SR_UTILS_NS::EnumReflector::FromString<MipFilter>(texture.TryGetAttribute("MipFilter").ToString("Box"));
+                const auto normalMap   = texture.TryGetAttribute("NormalMap").ToBool(false);
 
                 m_configs.insert(std::make_pair(
                         texture.GetAttribute("Path").ToString(),
@@ -33,7 +35,9 @@ namespace SR_GRAPH_NS::Memory {
                             compression,
                             mipLevels,
                             alpha,
-                            cpuUsage)
+                            cpuUsage,
+                            mipFilter,
+                            normalMap)
                 ));
             }
 
@@ -0,0 +1,515 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/TextureStreamer.h>
+#include <Graphics/Pipeline/Pipeline.h>
+#include <Graphics/Types/Texture.h>
+
+namespace SR_GRAPH_NS {
+    void TextureStreamer::Start(PipelinePtr pipeline) {
+        if (m_isRunning) {
+            SR_WARN("TextureStreamer::Start() : streamer is already running!");
+            return;
+        }
+
+        m_enabled = SR_UTILS_NS::Features::Instance().Enabled("TextureStreaming", false);
+        if (!m_enabled) {
+            return;
+        }
+
+        m_pipeline = std::move(pipeline);
+        m_isRunning = true;
+
+        const uint32_t workersCount = SR_MAX(SR_MIN(std::thread::hardware_concurrency() / 2, 4U), 1U);
+
+        SR_INFO("TextureStreamer::Start() : starting {} worker threads...", workersCount);
+
+        for (uint32_t i = 0; i < workersCount; ++i) {
+            m_workers.emplace_back(&TextureStreamer::WorkerThread, this);
+        }
+    }
+
+    void TextureStreamer::Stop() {
+        if (!m_isRunning) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_isRunning = false;
+            m_jobs.clear();
+        }
+
+        m_condition.notify_all();
+
+        for (auto&& worker : m_workers) {
+            worker.join();
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        FreeRetired(true);
+
+        m_workers.clear();
+        m_results.clear();
+        m_enabled = false;
+        m_placeholderTexture = SR_ID_INVALID;
+        m_pipeline.Reset();
+
+        /// записи остаются до выгрузки текстур, но больше не догружаются
+        for (auto&& [pTexture, record] : m_records) {
+            record.pDecoded.Reset();
+            record.pPendingData.Reset();
+            record.inFlight = false;
+        }
+    }
+
+    bool TextureStreamer::Register(TexturePtr pTexture, const SR_UTILS_NS::Path& path) {
+        if (!m_enabled) {
+            return false;
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        auto&& record = m_records[pTexture];
+        record = Record();
+        record.path = path;
+
+        /// сначала только заглушка, крупные уровни запросит Touch по размеру на экране
+        Enqueue(pTexture, record, PLACEHOLDER_LEVEL);
+
+        return true;
+    }
+
+    void TextureStreamer::Unregister(TexturePtr pTexture) {
+        std::lock_guard lock(m_mutex);
+
+        auto&& pIt = m_records.find(pTexture);
+        if (pIt == m_records.end()) {
+            return;
+        }
+
+        m_statistics.residentBytes -= pIt->second.residentBytes;
+        m_records.erase(pIt);
+    }
+
+    void TextureStreamer::OnFreeVideoMemory(TexturePtr pTexture) {
+        std::lock_guard lock(m_mutex);
+
+        auto&& pIt = m_records.find(pTexture);
+        if (pIt == m_records.end()) {
+            return;
+        }
+
+        auto&& record = pIt->second;
+
+        m_statistics.residentBytes -= record.residentBytes;
+
+        record.residentBytes = 0;
+        record.residentLevel = UINT8_MAX;
+        /// не загружаем обратно, пока текстуру снова не запросят
+        record.lastUseFrame = 0;
+    }
+
+    void TextureStreamer::Touch(TexturePtr pTexture, uint32_t pixels) {
+        std::lock_guard lock(m_mutex);
+
+        auto&& pIt = m_records.find(pTexture);
+        if (pIt == m_records.end()) {
+            return;
+        }
+
+        auto&& record = pIt->second;
+
+        const uint64_t frame = m_frame + 1;
+
+        record.lastUseFrame = frame;
+
+        if (pixels == 0) {
+            /// очереди отрисовки ни разу не оценили текстуру, считаем, что нужен полный размер,
+            /// иначе остается последний оцененный уровень
+            if (record.coverageFrame == 0) {
+                record.desiredLevel = 0;
+            }
+            return;
+        }
+
+        uint8_t level = 0;
+
+        if (record.width != 0) {
+            const uint32_t size = SR_MAX(record.width, record.height);
+            while (level < record.placeholderLevel && (size >> (level + 1)) >= pixels) {
+                ++level;
+            }
+        }
+
+        /// текстура может быть на нескольких мешах, берем самый крупный из них за кадр
+        record.desiredLevel = record.coverageFrame == frame ? SR_MIN(record.desiredLevel, level) : level;
+        record.coverageFrame = frame;
+    }
+
+    void TextureStreamer::Update() {
+        SR_TRACY_ZONE;
+
+        if (!m_enabled) {
+            return;
+        }
+
+        std::vector<Result> results;
+
+        {
+            std::lock_guard lock(m_queueMutex);
+            results.swap(m_results);
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        ++m_frame;
+
+        FreeRetired(false);
+
+        for (auto&& result : results) {
+            auto&& pIt = m_records.find(result.pTexture);
+            if (pIt == m_records.end() || pIt->second.ticket != result.ticket) {
+                continue; /// текстура выгружена или перезагружена, пока декодировалась
+            }
+
+            auto&& record = pIt->second;
+            record.inFlight = false;
+
+            if (!result.pData) {
+                SR_ERROR("TextureStreamer::Update() : failed to load texture!\n\tPath: {}", record.path.ToStringRef());
+                continue;
+            }
+
+            record.width = result.width;
+            record.height = result.height;
+
+            if (result.pDecoded) {
+                record.pDecoded = std::move(result.pDecoded);
+            }
+
+            if (result.isPlaceholder) {
+                record.pPlaceholder = std::move(result.pData);
+                record.placeholderLevel = result.level;
+                continue;
+            }
+
+            record.pPendingData = std::move(result.pData);
+            record.pendingLevel = result.level;
+        }
+
+        uint64_t uploaded = 0;
+
+        for (auto&& [pTexture, record] : m_records) {
+            /// текстуру еще ни разу не запросили, держим ее только в памяти процессора
+            if (record.lastUseFrame == 0 || uploaded >= m_uploadBudget) {
+                continue;
+            }
+
+            if (record.pPendingData && record.pendingLevel < record.residentLevel) {
+                const uint64_t bytes = CalculateBytes(record.pPendingData->GetWidth(), record.pPendingData->GetHeight(), pTexture->m_config.m_mipLevels);
+                const uint64_t required = m_statistics.residentBytes - record.residentBytes + bytes;
+
+                if ((required <= m_budget || EnforceBudget(m_budget - SR_MIN(bytes, m_budget))) && Upload(pTexture, record, record.pPendingData, record.pendingLevel)) {
+                    uploaded += bytes;
+                    ++m_statistics.promotions;
+                    record.pPendingData.Reset();
+                    continue;
+                }
+
+                /// не влезло в бюджет, полный размер догрузим позже
+                record.pPendingData.Reset();
+            }
+
+            if (record.residentLevel == UINT8_MAX && record.pPlaceholder) {
+                if (Upload(pTexture, record, record.pPlaceholder, record.placeholderLevel)) {
+                    uploaded += record.residentBytes;
+                }
+            }
+        }
+
+        m_statistics.uploadedBytes = uploaded;
+
+        if (m_statistics.residentBytes > m_budget) {
+            EnforceBudget(m_budget);
+        }
+
+        /// запрашиваем уровень, нужный по размеру на экране, если он поместится в бюджет
+        for (auto&& [pTexture, record] : m_records) {
+            if (record.inFlight || record.pPendingData || record.residentLevel == UINT8_MAX) {
+                continue;
+            }
+
+            if (record.residentLevel <= record.desiredLevel || record.lastUseFrame + STALE_FRAMES < m_frame) {
+                continue;
+            }
+
+            const uint64_t bytes = CalculateBytes(record.width >> record.desiredLevel, record.height >> record.desiredLevel, pTexture->m_config.m_mipLevels);
+            if (m_statistics.residentBytes - record.residentBytes + bytes > m_budget) {
+                continue;
+            }
+
+            Enqueue(pTexture, record, record.desiredLevel);
+        }
+    }
+
+    TextureStreamer::Statistics TextureStreamer::GetStatistics() const {
+        std::lock_guard lock(m_mutex);
+
+        Statistics statistics = m_statistics;
+        statistics.textures = static_cast<uint32_t>(m_records.size());
+        statistics.pending = 0;
+
+        for (auto&& [pTexture, record] : m_records) {
+            statistics.pending += record.inFlight ? 1 : 0;
+            statistics.decodedBytes += record.pDecoded ? CalculateBytes(record.pDecoded->GetWidth(), record.pDecoded->GetHeight(), record.pDecoded->GetMipCount()) : 0;
+        }
+
+        return statistics;
+    }
+
+    void TextureStreamer::WorkerThread() {
+        while (true) {
+            Job job;
+
+            {
+                std::unique_lock lock(m_queueMutex);
+                m_condition.wait(lock, [this]() {
+                    return !m_isRunning || !m_jobs.empty();
+                });
+
+                if (!m_isRunning) {
+                    return;
+                }
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            Result result;
+            result.pTexture = job.pTexture;
+            result.ticket = job.ticket;
+
+            TextureData::Ptr pData = job.pSource;
+
+            if (!pData) {
+                pData = TextureLoader::Load(job.path, job.config);
+                result.pDecoded = pData;
+            }
+
+            if (pData) {
+                result.width = pData->GetWidth();
+                result.height = pData->GetHeight();
+                result.isPlaceholder = job.level == PLACEHOLDER_LEVEL;
+                result.level = SR_MIN(job.level, CalculatePlaceholderLevel(result.width, result.height));
+                result.pData = Downsample(pData, result.level);
+            }
+
+            std::lock_guard lock(m_queueMutex);
+            m_results.emplace_back(std::move(result));
+        }
+    }
+
+    void TextureStreamer::Enqueue(TexturePtr pTexture, Record& record, uint8_t level) {
+        record.ticket = ++m_nextTicket;
+        record.inFlight = true;
+
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_jobs.emplace_back(Job {
+                .pTexture = pTexture,
+                .ticket = record.ticket,
+                .path = record.path,
+                .config = pTexture->m_config,
+                .pSource = record.pDecoded,
+                .level = level,
+            });
+        }
+
+        m_condition.notify_one();
+    }
+
+    bool TextureStreamer::Upload(TexturePtr pTexture, Record& record, const TextureData::Ptr& pData, uint8_t level) {
+        SR_TRACY_ZONE;
+
+        auto&& config = pTexture->m_config;
+
+        SRTextureCreateInfo createInfo;
+        createInfo.pData = pData->GetData();
+        createInfo.width = pData->GetWidth();
+        createInfo.height = pData->GetHeight();
+        createInfo.compression = config.m_compression;
+        createInfo.cpuUsage = config.m_cpuUsage;
+        createInfo.alpha = config.m_alpha == SR_UTILS_NS::BoolExt::None;
+        createInfo.format = config.m_format;
+        createInfo.mipLevels = CalculateMipLevels(createInfo.width, createInfo.height, config.m_mipLevels);
+        createInfo.filter = config.m_filter;
+
+        const int32_t id = m_pipeline->AllocateTexture(createInfo);
+        if (id == SR_ID_INVALID) {
+            SR_ERROR("TextureStreamer::Upload() : failed to allocate texture!\n\tPath: {}", record.path.ToStringRef());
+            return false;
+        }
+
+        if (const int32_t previousId = pTexture->OnStreamed(id, record.width, record.height); previousId != SR_ID_INVALID) {
+            m_retired.emplace_back(RetiredTexture { previousId, m_frame });
+        }
+
+        m_statistics.residentBytes -= record.residentBytes;
+
+        record.residentBytes = CalculateBytes(createInfo.width, createInfo.height, config.m_mipLevels);
+        record.residentLevel = level;
+
+        m_statistics.residentBytes += record.residentBytes;
+
+        return true;
+    }
+
+    bool TextureStreamer::EnforceBudget(uint64_t budget) {
+        SR_TRACY_ZONE;
+
+        std::vector<std::pair<TexturePtr, Record*>> candidates;
+
+        for (auto&& [pTexture, record] : m_records) {
+            if (record.residentLevel >= record.placeholderLevel || !record.pPlaceholder) {
+                continue;
+            }
+
+            /// текстура недавно использовалась и нужна в текущем размере
+            if (record.lastUseFrame + STALE_FRAMES >= m_frame && record.residentLevel >= record.desiredLevel) {
+                continue;
+            }
+
+            candidates.emplace_back(pTexture, &record);
+        }
+
+        std::sort(candidates.begin(), candidates.end(), [](auto&& left, auto&& right) {
+            return left.second->lastUseFrame < right.second->lastUseFrame;
+        });
+
+        for (auto&& [pTexture, pRecord] : candidates) {
+            if (m_statistics.residentBytes <= budget) {
+                break;
+            }
+
+            if (Upload(pTexture, *pRecord, pRecord->pPlaceholder, pRecord->placeholderLevel)) {
+                ++m_statistics.demotions;
+            }
+        }
+
+        return m_statistics.residentBytes <= budget;
+    }
+
+    void TextureStreamer::FreeRetired(bool force) {
+        if (m_retired.empty() || !m_pipeline) {
+            return;
+        }
+
+        const uint64_t framesInFlight = m_pipeline->GetBuildIterationsCount() + 1;
+
+        for (auto pIt = m_retired.begin(); pIt != m_retired.end(); ) {
+            if (!force && pIt->frame + framesInFlight > m_frame) {
+                ++pIt;
+                continue;
+            }
+            SRVerifyFalse(!m_pipeline->FreeTexture(&pIt->id));
+            pIt = m_retired.erase(pIt);
+        }
+    }
+
+    TextureData::Ptr TextureStreamer::Downsample(const TextureData::Ptr& pData, uint8_t levels) {
+        SR_TRACY_ZONE;
+
+        if (levels == 0) {
+            return pData;
+        }
+
+        /// уровень уже есть в мип-цепочке, построенной загрузчиком
+        if (levels < pData->GetMipCount()) {
+            auto&& mipLevel = pData->GetMipLevel(levels);
+            const uint64_t bytes = static_cast<uint64_t>(mipLevel.width) * mipLevel.height * 4;
+
+            auto&& pPixels = new uint8_t[bytes];
+            std::memcpy(pPixels, pData->GetMipData(levels), bytes);
+
+            return TextureData::Create(mipLevel.width, mipLevel.height, pPixels, [](const uint8_t* pPixels) {
+                delete[] pPixels;
+            }, pData->GetFormat());
+        }
+
+        /// TextureLoader всегда декодирует в RGBA8
+        constexpr uint32_t channels = 4;
+
+        uint32_t width = pData->GetWidth();
+        uint32_t height = pData->GetHeight();
+
+        std::vector<uint8_t> source(pData->GetData(), pData->GetData() + width * height * channels);
+        std::vector<uint8_t> destination;
+
+        for (uint8_t level = 0; level < levels; ++level) {
+            const uint32_t dstWidth = SR_MAX(width / 2, 1U);
+            const uint32_t dstHeight = SR_MAX(height / 2, 1U);
+
+            destination.resize(dstWidth * dstHeight * channels);
+
+            for (uint32_t y = 0; y < dstHeight; ++y) {
+                const uint32_t y0 = SR_MIN(y * 2, height - 1);
+                const uint32_t y1 = SR_MIN(y * 2 + 1, height - 1);
+
+                for (uint32_t x = 0; x < dstWidth; ++x) {
+                    const uint32_t x0 = SR_MIN(x * 2, width - 1);
+                    const uint32_t x1 = SR_MIN(x * 2 + 1, width - 1);
+
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        const uint32_t sum = source[(y0 * width + x0) * channels + c] + source[(y0 * width + x1) * channels + c]
+                            + source[(y1 * width + x0) * channels + c] + source[(y1 * width + x1) * channels + c];
+                        destination[(y * dstWidth + x) * channels + c] = static_cast<uint8_t>((sum + 2) / 4);
+                    }
+                }
+            }
+
+            source.swap(destination);
+            width = dstWidth;
+            height = dstHeight;
+        }
+
+        auto&& pPixels = new uint8_t[source.size()];
+        std::memcpy(pPixels, source.data(), source.size());
+
+        return TextureData::Create(width, height, pPixels, [](const uint8_t* pPixels) {
+            delete[] pPixels;
+        }, pData->GetFormat());
+    }
+
+    uint8_t TextureStreamer::CalculatePlaceholderLevel(uint32_t width, uint32_t height) {
+        const uint32_t size = SR_MAX(width, height);
+
+        uint8_t level = 0;
+        while ((size >> level) > PLACEHOLDER_SIZE) {
+            ++level;
+        }
+
+        return level;
+    }
+
+    uint64_t TextureStreamer::CalculateBytes(uint32_t width, uint32_t height, uint32_t mipLevels) {
+        const uint64_t bytes = static_cast<uint64_t>(SR_MAX(width, 1U)) * SR_MAX(height, 1U) * 4;
+        /// полная цепочка мип-уровней занимает еще треть
+        return mipLevels == 1 ? bytes : bytes + bytes / 3;
+    }
+
+    uint8_t TextureStreamer::CalculateMipLevels(uint32_t width, uint32_t height, uint32_t mipLevels) {
+        if (mipLevels <= 1) {
+            return static_cast<uint8_t>(mipLevels);
+        }
+
+        uint8_t maxLevels = 1;
+        while ((SR_MAX(width, height) >> maxLevels) > 0) {
+            ++maxLevels;
+        }
+
+        return static_cast<uint8_t>(SR_MIN(mipLevels, static_cast<uint32_t>(maxLevels)));
+    }
+}
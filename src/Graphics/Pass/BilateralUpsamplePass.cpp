@@ -0,0 +1,57 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pass/BilateralUpsamplePass.h>
+#include <Graphics/Pass/SSAOPass.h>
+#include <Graphics/Types/Shader.h>
+#include <Graphics/Types/Framebuffer.h>
+
+namespace SR_GRAPH_NS {
+    SR_REGISTER_RENDER_PASS(BilateralUpsamplePass)
+
+    bool BilateralUpsamplePass::Load(const SR_XML_NS::Node& passNode) {
+        LoadFramebufferSettings(passNode);
+
+        m_factor = static_cast<uint32_t>(std::round(1.f / SSAOPass::LoadResolutionScale(passNode)));
+        m_depthSigma = SR_MAX(passNode.TryGetAttribute("DepthSigma").ToFloat(m_depthSigma), 0.0001f);
+
+        if (!GetFrameBufferController()) {
+            SR_ERROR("BilateralUpsamplePass::Load() : upsample pass requires a frame buffer!");
+            return false;
+        }
+
+        return Super::Load(passNode);
+    }
+
+    bool BilateralUpsamplePass::Render() {
+        SR_TRACY_ZONE;
+
+        RenderFrameBuffer(GetPassPipeline());
+
+        /// буфер читается следующими проходами, сам проход ничего не выводит
+        return false;
+    }
+
+    void BilateralUpsamplePass::RenderFrameBufferInner() {
+        Super::Render();
+    }
+
+    void BilateralUpsamplePass::Update() {
+        SR_TRACY_ZONE;
+
+        if (m_shader) {
+            m_shader->SetInt(SHADER_UPSAMPLE_FACTOR, static_cast<int32_t>(m_factor));
+            m_shader->SetFloat(SHADER_UPSAMPLE_DEPTH_SIGMA, m_depthSigma);
+        }
+
+        Super::Update();
+    }
+
+    std::vector<SR_GTYPES_NS::Framebuffer*> BilateralUpsamplePass::GetFrameBuffers() const {
+        if (!GetFramebuffer()) {
+            return std::vector<SR_GTYPES_NS::Framebuffer*>();
+        }
+        return { GetFramebuffer() };
+    }
+}
@@ -12,6 +12,7 @@ namespace SR_GRAPH_NS {
         m_usePerspective = passNode.TryGetAttribute("UsePerspective").ToBool(false);
         m_near = passNode.TryGetAttribute("Near").ToFloat(0.1f);
         m_far = passNode.TryGetAttribute("Far").ToFloat(100.f);
+        m_occlusionShadowDistance = passNode.TryGetAttribute("OcclusionShadowDistance").ToFloat(10.f);
         return Super::Load(passNode);
     }
 
@@ -26,6 +27,24 @@ namespace SR_GRAPH_NS {
         info.pShader->SetVec3(SHADER_DIRECTIONAL_LIGHT_POSITION, lightPos);
     }
 
+    void CascadedShadowMapPass::UseReceiverUniforms(SR_GTYPES_NS::Shader* pShader) const {
+        pShader->SetValue<false>(SHADER_CASCADE_LIGHT_SPACE_MATRICES, m_cascadeMatrices.data());
+        pShader->SetValue<false>(SHADER_CASCADE_SPLITS, m_cascadeSplitDepths.data());
+    }
+
+    bool CascadedShadowMapPass::IsOccluded(const SR_MATH_NS::FVector3& center, float_t radius) const {
+        if (!IsOcclusionCullingEnabled()) {
+            return false;
+        }
+
+        const auto lightPos = GetRenderScene()->GetLightSystem()->GetDirectionalLightPosition();
+        const SR_MATH_NS::FVector3 lightDir = (-lightPos).Normalize();
+        const float_t halfDistance = m_occlusionShadowDistance * 0.5f;
+
+        /// сфера, описанная вокруг заслонителя и его тени
+        return Super::IsOccluded(center + lightDir * halfDistance, radius + halfDistance);
+    }
+
     void CascadedShadowMapPass::UpdateCascades() {
         const auto lightPos = GetRenderScene()->GetLightSystem()->GetDirectionalLightPosition();
 
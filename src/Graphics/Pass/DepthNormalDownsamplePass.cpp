@@ -0,0 +1,62 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pass/DepthNormalDownsamplePass.h>
+#include <Graphics/Pass/SSAOPass.h>
+#include <Graphics/Types/Shader.h>
+#include <Graphics/Types/Framebuffer.h>
+#include <Graphics/Render/FrameBufferController.h>
+
+namespace SR_GRAPH_NS {
+    SR_REGISTER_RENDER_PASS(DepthNormalDownsamplePass)
+
+    bool DepthNormalDownsamplePass::Load(const SR_XML_NS::Node& passNode) {
+        LoadFramebufferSettings(passNode);
+
+        auto&& pController = GetFrameBufferController();
+        if (!pController) {
+            SR_ERROR("DepthNormalDownsamplePass::Load() : downsample pass requires a frame buffer!");
+            return false;
+        }
+
+        const float_t resolutionScale = SSAOPass::LoadResolutionScale(passNode);
+        m_factor = static_cast<uint32_t>(std::round(1.f / resolutionScale));
+
+        if (resolutionScale < 1.f) {
+            pController->SetPreScale(pController->GetPreScale() * resolutionScale);
+        }
+
+        return Super::Load(passNode);
+    }
+
+    bool DepthNormalDownsamplePass::Render() {
+        SR_TRACY_ZONE;
+
+        RenderFrameBuffer(GetPassPipeline());
+
+        /// буфер читается проходом SSAO, сам проход ничего не выводит
+        return false;
+    }
+
+    void DepthNormalDownsamplePass::RenderFrameBufferInner() {
+        Super::Render();
+    }
+
+    void DepthNormalDownsamplePass::Update() {
+        SR_TRACY_ZONE;
+
+        if (m_shader) {
+            m_shader->SetInt(SHADER_DOWNSAMPLE_FACTOR, static_cast<int32_t>(m_factor));
+        }
+
+        Super::Update();
+    }
+
+    std::vector<SR_GTYPES_NS::Framebuffer*> DepthNormalDownsamplePass::GetFrameBuffers() const {
+        if (!GetFramebuffer()) {
+            return std::vector<SR_GTYPES_NS::Framebuffer*>();
+        }
+        return { GetFramebuffer() };
+    }
+}
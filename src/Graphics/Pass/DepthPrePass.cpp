@@ -0,0 +1,149 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pass/DepthPrePass.h>
+#include <Graphics/Material/BaseMaterial.h>
+#include <Graphics/Pipeline/Pipeline.h>
+#include <Graphics/Types/Framebuffer.h>
+#include <Graphics/Types/Camera.h>
+
+namespace SR_GRAPH_NS {
+    SR_REGISTER_RENDER_PASS(DepthPrePass)
+
+    bool DepthPrePass::Load(const SR_XML_NS::Node& passNode) {
+        m_readbackInterval = SR_MAX(1u, passNode.TryGetAttribute("ReadbackInterval").ToUInt(1));
+        return Super::Load(passNode);
+    }
+
+    void DepthPrePass::DeInit() {
+        m_pyramid.Clear();
+        m_renderedViewProjection = std::nullopt;
+        m_pendingReadbacks.clear();
+        m_readbackData.clear();
+        m_builtReadback = 0;
+        m_framesSinceReadback = 0;
+        Super::DeInit();
+    }
+
+    bool DepthPrePass::IsMaterialAllowed(BaseMaterial* pMaterial) const {
+        /// прозрачная геометрия не закрывает то, что за ней
+        return !pMaterial || !pMaterial->IsTransparent();
+    }
+
+    void DepthPrePass::UseUniforms(ShaderUseInfo info, MeshPtr pMesh) {
+        pMesh->UseModelMatrix();
+    }
+
+    void DepthPrePass::Update() {
+        SR_TRACY_ZONE;
+
+        Super::Update();
+
+        if (!m_camera) SR_UNLIKELY_ATTRIBUTE {
+            m_pyramid.Clear();
+            m_renderedViewProjection = std::nullopt;
+            m_pendingReadbacks.clear();
+            return;
+        }
+
+        BuildPyramid();
+
+        /// в буфере лежит прошлый кадр, нарисованный с прошлой матрицей
+        if (m_renderedViewProjection.has_value() && ++m_framesSinceReadback >= m_readbackInterval) {
+            m_framesSinceReadback = 0;
+            RequestReadback(m_renderedViewProjection.value());
+        }
+
+        m_renderedViewProjection = m_camera->GetProjection() * m_camera->GetViewTranslate();
+    }
+
+    void DepthPrePass::RequestReadback(const SR_MATH_NS::Matrix4x4& viewProjection) {
+        SR_TRACY_ZONE;
+
+        auto&& pFramebuffer = GetFramebuffer();
+        if (!pFramebuffer || !pFramebuffer->IsValid()) SR_UNLIKELY_ATTRIBUTE {
+            m_pyramid.Clear();
+            return;
+        }
+
+        const int32_t textureId = pFramebuffer->GetColorTexture(0);
+        if (textureId == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            m_pyramid.Clear();
+            return;
+        }
+
+        /// кадр занимает только часть памяти буфера
+        const SR_MATH_NS::IVector2 size = pFramebuffer->GetViewportSize();
+        const auto width = static_cast<uint32_t>(SR_MAX(0, size.x));
+        const auto height = static_cast<uint32_t>(SR_MAX(0, size.y));
+
+        if (width * height > MAX_READBACK_TEXELS) SR_UNLIKELY_ATTRIBUTE {
+            if (!m_isReadbackTooLarge) {
+                SR_WARN("DepthPrePass::RequestReadback() : framebuffer is too large for readback, occlusion culling is disabled!"
+                    "\n\tSize: " + std::to_string(width) + "x" + std::to_string(height) + "\n\tMax texels: " + std::to_string(MAX_READBACK_TEXELS));
+                m_isReadbackTooLarge = true;
+            }
+            m_pyramid.Clear();
+            m_pendingReadbacks.clear();
+            return;
+        }
+
+        m_isReadbackTooLarge = false;
+
+        /// RGBA8, глубина в первых трех байтах
+        const uint64_t ticket = GetPassPipeline()->RequestTextureReadback(textureId, SR_MATH_NS::UVector2(width, height), 4);
+        if (ticket == 0) {
+            return;
+        }
+
+        m_pendingReadbacks.emplace_back(ticket, viewProjection);
+
+        while (m_pendingReadbacks.size() > MAX_PENDING_READBACKS) {
+            m_pendingReadbacks.pop_front();
+        }
+    }
+
+    void DepthPrePass::BuildPyramid() {
+        SR_TRACY_ZONE;
+
+        auto&& pFramebuffer = GetFramebuffer();
+        if (!pFramebuffer || m_pendingReadbacks.empty()) {
+            return;
+        }
+
+        SR_MATH_NS::UVector2 size;
+
+        const uint64_t ticket = GetPassPipeline()->GetTextureReadback(pFramebuffer->GetColorTexture(0), m_readbackData, size);
+        if (ticket == 0 || ticket == m_builtReadback) {
+            return;
+        }
+
+        /// копии завершаются по порядку, более старые уже не понадобятся
+        while (!m_pendingReadbacks.empty() && m_pendingReadbacks.front().first < ticket) {
+            m_pendingReadbacks.pop_front();
+        }
+
+        if (m_pendingReadbacks.empty() || m_pendingReadbacks.front().first != ticket) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        const SR_MATH_NS::Matrix4x4 viewProjection = m_pendingReadbacks.front().second;
+        m_pendingReadbacks.pop_front();
+        m_builtReadback = ticket;
+
+        if (m_readbackData.size() != static_cast<size_t>(size.x) * size.y * 4) SR_UNLIKELY_ATTRIBUTE {
+            m_pyramid.Clear();
+            return;
+        }
+
+        std::vector<float_t> depth(static_cast<size_t>(size.x) * size.y);
+
+        for (size_t i = 0; i < depth.size(); ++i) {
+            const uint8_t* pTexel = m_readbackData.data() + i * 4;
+            depth[i] = static_cast<float_t>(pTexel[0] * 65536u + pTexel[1] * 256u + pTexel[2]) / 16777215.f;
+        }
+
+        m_pyramid.Build(std::move(depth), size.x, size.y, viewProjection);
+    }
+}
@@ -3,6 +3,8 @@
 //
 
 #include <Graphics/Pass/GroupPass.h>
+#include <Graphics/Render/RenderContext.h>
+#include <Graphics/Types/Framebuffer.h>
 
 namespace SR_GRAPH_NS {
     GroupPass::~GroupPass() {
@@ -104,9 +106,22 @@ namespace SR_GRAPH_NS {
     }
 
     void GroupPass::Update() {
+        auto&& profiler = m_context->GetFrameProfiler();
+
         for (auto&& pPass : m_passes) {
             if (pPass->HasUpdate()) {
                 SR_TRACY_ZONE_S(pPass->GetName().data());
+
+                std::vector<int32_t> frameBuffers;
+
+                if (profiler.IsEnabled()) {
+                    for (auto&& pFrameBuffer : pPass->GetFrameBuffers()) {
+                        frameBuffers.emplace_back(pFrameBuffer->GetId());
+                    }
+                }
+
+                FrameProfiler::Scope scope(profiler, pPass->GetName(), std::move(frameBuffers));
+
                 pPass->Bind();
                 pPass->Update();
             }
@@ -60,6 +60,7 @@ namespace SR_GRAPH_NS {
 
             if (auto&& fboNameNode = samplerNode.TryGetAttribute("FBO")) {
                 sampler.fboName = fboNameNode.ToString();
+                sampler.scaleId = sampler.id.ToStringRef() + "_SCALE";
 
                 if (auto&& depthAttribute = samplerNode.TryGetAttribute("Depth")) {
                     sampler.depth = depthAttribute.ToBool();
@@ -85,6 +86,30 @@ namespace SR_GRAPH_NS {
         /// определяется классом-наследником
         auto&& time = SR_HTYPES_NS::Time::Instance().Clock();
         pShader->SetFloat(SHADER_TIME, time);
+
+        /// G-буферы могут быть выведены в часть памяти, как и у проходов постобработки
+        std::optional<SR_MATH_NS::FVector2> resolutionScale;
+
+        for (auto&& sampler : m_samplers) {
+            if (sampler.fboName.Empty()) {
+                continue;
+            }
+
+            auto&& pController = GetTechnique()->GetFrameBufferController(sampler.fboName);
+            if (!pController || !pController->GetFramebuffer()) SR_UNLIKELY_ATTRIBUTE {
+                continue;
+            }
+
+            const SR_MATH_NS::FVector2 scale = pController->GetFramebuffer()->GetViewportUVScale();
+
+            pShader->SetVec2(sampler.scaleId, scale);
+
+            if (!resolutionScale.has_value()) {
+                resolutionScale = scale;
+            }
+        }
+
+        pShader->SetVec2(SHADER_RESOLUTION_SCALE, resolutionScale.value_or(SR_MATH_NS::FVector2(1.f)));
     }
 
     void IMeshClusterPass::OnMultisampleChanged() {
@@ -93,6 +118,18 @@ namespace SR_GRAPH_NS {
         Super::OnMultisampleChanged();
     }
 
+    std::vector<SR_UTILS_NS::StringAtom> IMeshClusterPass::GetSamplersFrameBuffers() const {
+        std::vector<SR_UTILS_NS::StringAtom> frameBuffers;
+
+        for (auto&& sampler : m_samplers) {
+            if (!sampler.fboName.Empty()) {
+                frameBuffers.emplace_back(sampler.fboName);
+            }
+        }
+
+        return frameBuffers;
+    }
+
     void IMeshClusterPass::PrepareSamplers() {
         if (!m_dirtySamplers) {
             return;
@@ -23,6 +23,7 @@ namespace SR_GRAPH_NS {
         , fboId(SR_UTILS_NS::Exchange(other.fboId, { }))
         , id(SR_UTILS_NS::Exchange(other.id, { }))
         , fboName(SR_UTILS_NS::Exchange(other.fboName, { }))
+        , scaleId(SR_UTILS_NS::Exchange(other.scaleId, { }))
         , pTexture(SR_UTILS_NS::Exchange(other.pTexture, { }))
         , index(SR_UTILS_NS::Exchange(other.index, { }))
         , depth(SR_UTILS_NS::Exchange(other.depth, { }))
@@ -37,6 +38,7 @@ namespace SR_GRAPH_NS {
         fboId = SR_UTILS_NS::Exchange(other.fboId, { });
         id = SR_UTILS_NS::Exchange(other.id, { });
         fboName = SR_UTILS_NS::Exchange(other.fboName, { });
+        scaleId = SR_UTILS_NS::Exchange(other.scaleId, { });
         pTexture = SR_UTILS_NS::Exchange(other.pTexture, { });
         index = SR_UTILS_NS::Exchange(other.index, { });
         depth = SR_UTILS_NS::Exchange(other.depth, { });
@@ -48,6 +50,18 @@ namespace SR_GRAPH_NS {
         m_samplers.clear();
     }
 
+    std::vector<SR_UTILS_NS::StringAtom> ISamplersPass::GetSamplersFrameBuffers() const {
+        std::vector<SR_UTILS_NS::StringAtom> frameBuffers;
+
+        for (auto&& sampler : m_samplers) {
+            if (!sampler.fboName.Empty()) {
+                frameBuffers.emplace_back(sampler.fboName);
+            }
+        }
+
+        return frameBuffers;
+    }
+
     void ISamplersPass::UseSamplers(ShaderUseInfo info) {
         for (auto&& sampler : m_samplers) {
             if (sampler.pTexture) {
@@ -67,6 +81,31 @@ namespace SR_GRAPH_NS {
         }
     }
 
+    void ISamplersPass::UseSamplersScale(SR_GTYPES_NS::Shader* pShader) const {
+        std::optional<SR_MATH_NS::FVector2> resolutionScale;
+
+        for (auto&& sampler : m_samplers) {
+            if (sampler.fboName.Empty()) {
+                continue;
+            }
+
+            auto&& pController = m_pTechnique->GetFrameBufferController(sampler.fboName);
+            if (!pController || !pController->GetFramebuffer()) SR_UNLIKELY_ATTRIBUTE {
+                continue;
+            }
+
+            const SR_MATH_NS::FVector2 scale = pController->GetFramebuffer()->GetViewportUVScale();
+
+            pShader->SetVec2(sampler.scaleId, scale);
+
+            if (!resolutionScale.has_value()) {
+                resolutionScale = scale;
+            }
+        }
+
+        pShader->SetVec2(SHADER_RESOLUTION_SCALE, resolutionScale.value_or(SR_MATH_NS::FVector2(1.f)));
+    }
+
     void ISamplersPass::PrepareSamplers() {
         SR_TRACY_ZONE;
 
@@ -152,6 +191,7 @@ namespace SR_GRAPH_NS {
             }
             else if (auto&& fboNameNode = samplerNode.TryGetAttribute("FBO")) {
                 sampler.fboName = fboNameNode.ToString();
+                sampler.scaleId = sampler.id.ToStringRef() + "_SCALE";
 
                 auto&& pFrameBufferController = m_pTechnique->GetFrameBufferController(sampler.fboName);
                 if (!pFrameBufferController) {
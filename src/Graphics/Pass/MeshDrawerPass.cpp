@@ -5,6 +5,7 @@
 #include <Graphics/Pass/MeshDrawerPass.h>
 #include <Graphics/Pass/CascadedShadowMapPass.h>
 #include <Graphics/Pass/ShadowMapPass.h>
+#include <Graphics/Pass/DepthPrePass.h>
 #include <Graphics/Pass/IFramebufferPass.h>
 #include <Graphics/Render/RenderStrategy.h>
 #include <Graphics/Render/RenderScene.h>
@@ -124,6 +125,9 @@ namespace SR_GRAPH_NS {
         }
 
         m_useMaterials = passNode.TryGetAttribute("UseMaterials").ToBool(true);
+        m_lodBias = passNode.TryGetAttribute("LODBias").ToInt(GetDefaultLodBias());
+        m_clusterCulling = passNode.TryGetAttribute("ClusterCulling").ToBool(IsClusterCullingByDefault());
+        m_occlusionCulling = passNode.TryGetAttribute("OcclusionCulling").ToBool(false);
 
         ISamplersPass::LoadSamplersPass(passNode);
 
@@ -196,9 +200,10 @@ namespace SR_GRAPH_NS {
 
         pShader->SetVec3(SHADER_DIRECTIONAL_LIGHT_POSITION, GetRenderScene()->GetLightSystem()->GetDirectionalLightPosition());
 
+        UseSamplersScale(pShader);
+
         if (m_cascadedShadowMapPass) {
-            pShader->SetValue<false>(SHADER_CASCADE_LIGHT_SPACE_MATRICES, m_cascadedShadowMapPass->GetCascadeMatrices().data());
-            pShader->SetValue<false>(SHADER_CASCADE_SPLITS, m_cascadedShadowMapPass->GetSplitDepths().data());
+            m_cascadedShadowMapPass->UseReceiverUniforms(pShader);
         }
         else if (m_shadowMapPass) {
             pShader->SetMat4(SHADER_LIGHT_SPACE_MATRIX, m_shadowMapPass->GetLightSpaceMatrix());
@@ -264,6 +269,7 @@ namespace SR_GRAPH_NS {
     }
 
     void MeshDrawerPass::DeInit() {
+        m_depthPrePass = nullptr;
         ClearOverrideShaders();
         for (auto&& pRenderQueue : m_renderQueues) {
             pRenderQueue.AutoFree();
@@ -276,6 +282,14 @@ namespace SR_GRAPH_NS {
         m_shadowMapPass = GetTechnique()->FindPass<ShadowMapPass>();
         m_cascadedShadowMapPass = GetTechnique()->FindPass<CascadedShadowMapPass>();
 
+        if (m_occlusionCulling) {
+            m_depthPrePass = GetTechnique()->FindPass<DepthPrePass>();
+            if (!m_depthPrePass || m_depthPrePass == this) {
+                SR_WARN("MeshDrawerPass::Init() : occlusion culling requires a depth pre pass in the technique!\n\tPass: " + GetName().ToStringRef());
+                m_depthPrePass = nullptr;
+            }
+        }
+
         const uint8_t layers = GetMeshDrawerFBOLayers();
         if (layers == 0) SR_UNLIKELY_ATTRIBUTE {
             SRHalt("MeshDrawerPass::Init() : layers count is 0!");
@@ -301,6 +315,10 @@ namespace SR_GRAPH_NS {
         Super::SetRenderTechnique(pRenderTechnique);
     }
 
+    bool MeshDrawerPass::IsOccluded(const SR_MATH_NS::FVector3& center, float_t radius) const {
+        return m_depthPrePass && m_depthPrePass->GetPyramid().IsSphereOccluded(center, radius);
+    }
+
     MeshDrawerPass::RenderQueuePtr MeshDrawerPass::AllocateRenderQueue() {
         return GetRenderStrategy()->BuildQueue(this);
     }
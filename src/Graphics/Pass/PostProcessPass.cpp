@@ -4,6 +4,7 @@
 
 #include <Graphics/Pass/PostProcessPass.h>
 #include <Graphics/Pass/FramebufferPass.h>
+#include <Graphics/Render/RenderContext.h>
 #include <Graphics/Types/Texture.h>
 
 namespace SR_GRAPH_NS {
@@ -43,6 +44,7 @@ namespace SR_GRAPH_NS {
                 UseSamplers(ShaderUseInfo(m_shader));
                 m_descriptorManager.Flush();
             }
+            UseConstants(ShaderUseInfo(m_shader));
             GetPassPipeline()->GetCurrentShader()->FlushConstants();
         }
 
@@ -74,6 +76,8 @@ namespace SR_GRAPH_NS {
             }
 
             m_shader->SetVec2(SHADER_RESOLUTION, resolution);
+            /// доля читаемых буферов, в которую был вывод, у каждого буфера своя
+            UseSamplersScale(m_shader);
 
             m_shader->SetFloat(SHADER_TIME, static_cast<float_t>(SR_HTYPES_NS::Time::Instance().Clock()));
 
@@ -101,15 +105,9 @@ namespace SR_GRAPH_NS {
     }
 
     bool PostProcessPass::Load(const SR_XML_NS::Node& passNode) {
-        auto&& path = passNode.GetAttribute("Shader").ToString();
-
         m_vertices = passNode.TryGetAttribute("Vertices").ToUInt(3);
 
-        if (auto&& pShader = SR_GTYPES_NS::Shader::Load(path)) {
-            SetShader(pShader);
-        }
-        else {
-            SR_ERROR("PostProcessPass::Load() : failed to load shader!\n\tPath: " + path);
+        if (!LoadShader(passNode)) {
             return false;
         }
 
@@ -118,6 +116,19 @@ namespace SR_GRAPH_NS {
         return Super::Load(passNode);
     }
 
+    bool PostProcessPass::LoadShader(const SR_XML_NS::Node& passNode) {
+        auto&& path = passNode.GetAttribute("Shader").ToString();
+
+        if (auto&& pShader = SR_GTYPES_NS::Shader::Load(path)) {
+            SetShader(pShader);
+            return true;
+        }
+
+        SR_ERROR("PostProcessPass::LoadShader() : failed to load shader!\n\tPath: " + path);
+
+        return false;
+    }
+
     void PostProcessPass::SetShader(SR_GTYPES_NS::Shader* pShader) {
         if (m_shader == pShader) {
             return;
@@ -5,6 +5,7 @@
 #include <Graphics/Pass/SSAOPass.h>
 #include <Graphics/Types/Texture.h>
 #include <Graphics/Types/Shader.h>
+#include <Graphics/Render/FrameBufferController.h>
 
 namespace SR_GRAPH_NS {
     SR_REGISTER_RENDER_PASS(SSAOPass);
@@ -35,9 +36,36 @@ namespace SR_GRAPH_NS {
         PostProcessPass::DeInit();
     }
 
+    SSAOPass::Preset SSAOPass::GetPreset(SSAOQuality quality) {
+        switch (quality) {
+            case SSAOQuality::High: return Preset { 32, 1.f, 0.5f };
+            case SSAOQuality::Medium: return Preset { 16, 0.5f, 0.75f };
+            case SSAOQuality::Low: return Preset { 8, 0.25f, 0.875f };
+            case SSAOQuality::Ultra:
+            default:
+                return Preset();
+        }
+    }
+
+    float_t SSAOPass::LoadResolutionScale(const SR_XML_NS::Node& passNode) {
+        const auto quality = SR_UTILS_NS::EnumReflector::FromString<SSAOQuality>(passNode.TryGetAttribute("Quality").ToString("Ultra"));
+        const float_t scale = passNode.TryGetAttribute("ResolutionScale").ToFloat(GetPreset(quality).resolutionScale);
+
+        /// уменьшение и восстановление работают блоками 2x2 и 4x4, промежуточные масштабы округляются
+        if (scale < 0.375f) {
+            return 0.25f;
+        }
+
+        return scale < 0.75f ? 0.5f : 1.f;
+    }
+
     SSAOPass::SSAOKernel SSAOPass::CreateKernel() const {
         std::vector<SR_MATH_NS::Vector4<float_t>> kernel;
-        kernel.resize(64);
+        kernel.resize(KERNEL_SIZE);
+
+        /// каждые samples подряд идущих направлений покрывают все расстояния,
+        /// при накоплении кадры берут соседние группы и вместе проходят все ядро
+        const uint32_t samples = SR_MAX(m_preset.samples, 1U);
 
         for (uint8_t i = 0; i < kernel.size(); ++i)
         {
@@ -50,7 +78,7 @@ namespace SR_GRAPH_NS {
 
             sample = sample.Normalize() * SR_UTILS_NS::Random::Instance().Float(0.0, 1.0);
 
-            float_t scale = float_t(i) / static_cast<float_t>(kernel.size());
+            float_t scale = float_t(i % samples) / static_cast<float_t>(samples);
             scale = SR_MATH_NS::Lerp(0.1, 1.0, scale * scale);
 
             kernel[i] = sample * scale;
@@ -82,9 +110,28 @@ namespace SR_GRAPH_NS {
         SR_TRACY_ZONE_N("SSAO update");
 
         if (m_shader) {
+            const bool temporal = m_preset.temporalWeight > 0.f && m_preset.samples < KERNEL_SIZE;
+            const uint32_t offset = temporal ? static_cast<uint32_t>((m_frame * m_preset.samples) % KERNEL_SIZE) : 0;
+
+            float_t temporalWeight = 0.f;
+            if (temporal && m_camera && m_camera == m_prevCamera && m_frame > 0) {
+                temporalWeight = m_preset.temporalWeight;
+            }
+
             m_shader->SetValue<false>(SHADER_SSAO_SAMPLES, m_kernel.data());
+            m_shader->SetInt(SHADER_SSAO_SAMPLES_COUNT, static_cast<int32_t>(SR_MIN(m_preset.samples, KERNEL_SIZE - offset)));
+            m_shader->SetInt(SHADER_SSAO_SAMPLES_OFFSET, static_cast<int32_t>(offset));
+            m_shader->SetFloat(SHADER_SSAO_TEMPORAL_WEIGHT, temporalWeight);
+            m_shader->SetMat4(SHADER_SSAO_PREV_VIEW_PROJECTION, m_prevViewProjection);
+        }
+
+        if (m_camera) {
+            m_prevViewProjection = m_camera->GetProjection() * m_camera->GetViewTranslate();
         }
 
+        m_prevCamera = m_camera;
+        ++m_frame;
+
         PostProcessPass::Update();
     }
 
@@ -129,6 +176,31 @@ namespace SR_GRAPH_NS {
 
     bool SSAOPass::Load(const SR_XML_NS::Node& passNode) {
         LoadFramebufferSettings(passNode.TryGetNode("FramebufferSettings"));
+
+        const auto quality = SR_UTILS_NS::EnumReflector::FromString<SSAOQuality>(passNode.TryGetAttribute("Quality").ToString("Ultra"));
+
+        m_preset = GetPreset(quality);
+        const uint32_t samples = std::clamp<uint32_t>(passNode.TryGetAttribute("Samples").ToUInt(m_preset.samples), 1, KERNEL_SIZE);
+
+        /// кадры накопления берут ядро группами по samples, группы должны делить его без остатка
+        m_preset.samples = 1;
+        while (m_preset.samples * 2 <= samples && KERNEL_SIZE % (m_preset.samples * 2) == 0) {
+            m_preset.samples *= 2;
+        }
+
+        if (m_preset.samples != samples) {
+            SR_WARN("SSAOPass::Load() : samples count {} isn't a divisor of {}, {} is used!", samples, KERNEL_SIZE, m_preset.samples);
+        }
+
+        m_preset.resolutionScale = LoadResolutionScale(passNode);
+        m_preset.temporalWeight = std::clamp(passNode.TryGetAttribute("TemporalWeight").ToFloat(m_preset.temporalWeight), 0.f, 0.95f);
+
+        /// буфер еще не создан, уменьшенное разрешение задается до инициализации контроллеров
+        /// и умножается на PreScale из настроек буфера, а не заменяет его
+        if (auto&& pController = GetFrameBufferController(); pController && m_preset.resolutionScale < 1.f) {
+            pController->SetPreScale(pController->GetPreScale() * m_preset.resolutionScale);
+        }
+
         return PostProcessPass::Load(passNode);
     }
 
@@ -0,0 +1,64 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pass/SeparableBlurPass.h>
+#include <Graphics/Types/Shader.h>
+#include <Graphics/Types/Framebuffer.h>
+
+namespace SR_GRAPH_NS {
+    SR_REGISTER_RENDER_PASS(SeparableBlurPass)
+
+    bool SeparableBlurPass::Load(const SR_XML_NS::Node& passNode) {
+        LoadFramebufferSettings(passNode);
+
+        m_direction = SR_UTILS_NS::EnumReflector::FromString<BlurDirection>(passNode.TryGetAttribute("Direction").ToString("Horizontal"));
+        m_radius = std::clamp<uint32_t>(passNode.TryGetAttribute("Radius").ToUInt(2), 1, MAX_RADIUS);
+
+        if (!GetFrameBufferController()) {
+            SR_ERROR("SeparableBlurPass::Load() : blur pass requires a frame buffer!");
+            return false;
+        }
+
+        return Super::Load(passNode);
+    }
+
+    bool SeparableBlurPass::Render() {
+        SR_TRACY_ZONE;
+
+        RenderFrameBuffer(GetPassPipeline());
+
+        /// буфер читается следующими проходами, сам проход ничего не выводит
+        return false;
+    }
+
+    void SeparableBlurPass::RenderFrameBufferInner() {
+        Super::Render();
+    }
+
+    void SeparableBlurPass::UseConstants(ShaderUseInfo info) {
+        info.pShader->SetConstInt(SHADER_BLUR_LAYER, static_cast<int32_t>(GetPassPipeline()->GetCurrentFrameBufferLayer()));
+    }
+
+    void SeparableBlurPass::Update() {
+        SR_TRACY_ZONE;
+
+        if (m_shader) {
+            const SR_MATH_NS::FVector2 direction = m_direction == BlurDirection::Horizontal
+                ? SR_MATH_NS::FVector2(1.f, 0.f)
+                : SR_MATH_NS::FVector2(0.f, 1.f);
+
+            m_shader->SetVec2(SHADER_BLUR_DIRECTION, direction);
+            m_shader->SetInt(SHADER_BLUR_RADIUS, static_cast<int32_t>(m_radius));
+        }
+
+        Super::Update();
+    }
+
+    std::vector<SR_GTYPES_NS::Framebuffer*> SeparableBlurPass::GetFrameBuffers() const {
+        if (!GetFramebuffer()) {
+            return std::vector<SR_GTYPES_NS::Framebuffer*>();
+        }
+        return { GetFramebuffer() };
+    }
+}
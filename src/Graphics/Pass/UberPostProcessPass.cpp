@@ -0,0 +1,98 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pass/UberPostProcessPass.h>
+#include <Graphics/Types/Shader.h>
+
+namespace SR_GRAPH_NS {
+    SR_REGISTER_RENDER_PASS(UberPostProcessPass)
+
+    void UberPostProcessPass::Update() {
+        if (m_shader && m_virtualUBO != SR_ID_INVALID) {
+            for (auto&& [name, value] : m_params) {
+                m_shader->SetFloat(name, value);
+            }
+        }
+
+        Super::Update();
+    }
+
+    bool UberPostProcessPass::LoadShader(const SR_XML_NS::Node& passNode) {
+        SR_TRACY_ZONE;
+
+        const SR_UTILS_NS::Path base = passNode.GetAttribute("Base").ToString();
+        const uint32_t segmentIndex = passNode.TryGetAttribute("Segment").ToUInt(0);
+
+        PostProcessEffects effects;
+
+        if (auto&& chainAttribute = passNode.TryGetAttribute("Chain")) {
+            auto&& path = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat(chainAttribute.ToString());
+            auto&& chainXml = SR_XML_NS::Document::Load(path);
+            if (!chainXml) {
+                SR_ERROR("UberPostProcessPass::LoadShader() : failed to load chain!\n\tPath: " + path.ToString());
+                return false;
+            }
+
+            effects = LoadEffects(chainXml.Root().GetNode("PostProcessChain"));
+        }
+        else {
+            effects = LoadEffects(passNode);
+        }
+
+        auto&& segments = PostProcessComposer::Split(effects);
+        if (segmentIndex >= segments.size()) {
+            SR_ERROR("UberPostProcessPass::LoadShader() : segment {} not found, the chain has {} segments!", segmentIndex, segments.size());
+            return false;
+        }
+
+        auto&& segment = segments[segmentIndex];
+
+        SR_LOG("UberPostProcessPass::LoadShader() : segment {} of {} fuses {} effects", segmentIndex + 1, segments.size(), segment.size());
+
+        auto&& shaderPath = PostProcessComposer::Compose(base, segment);
+        if (shaderPath.IsEmpty()) {
+            SR_ERROR("UberPostProcessPass::LoadShader() : failed to compose shader!");
+            return false;
+        }
+
+        auto&& pShader = SR_GTYPES_NS::Shader::Load(shaderPath);
+        if (!pShader) {
+            SR_ERROR("UberPostProcessPass::LoadShader() : failed to load composed shader!\n\tPath: " + shaderPath.ToString());
+            return false;
+        }
+
+        SetShader(pShader);
+
+        m_params.clear();
+
+        for (uint32_t i = 0; i < segment.size(); ++i) {
+            for (auto&& [name, value] : segment[i].params) {
+                m_params.emplace_back(PostProcessComposer::GetScopedName(i, name.ToStringRef()), value);
+            }
+        }
+
+        return true;
+    }
+
+    PostProcessEffects UberPostProcessPass::LoadEffects(const SR_XML_NS::Node& chainNode) {
+        PostProcessEffects effects;
+
+        for (auto&& effectNode : chainNode.TryGetNodes("Effect")) {
+            PostProcessEffect effect;
+
+            effect.name = effectNode.GetAttribute("Name").ToString();
+            effect.path = effectNode.GetAttribute("Path").ToString();
+            effect.function = effectNode.TryGetAttribute("Function").ToString(effect.name.ToStringRef());
+            effect.neighborhood = effectNode.TryGetAttribute("Neighborhood").ToBool(false);
+
+            for (auto&& paramNode : effectNode.TryGetNodes("Param")) {
+                effect.params.emplace_back(paramNode.GetAttribute("Name").ToString(), paramNode.GetAttribute("Value").ToFloat(0.f));
+            }
+
+            effects.emplace_back(std::move(effect));
+        }
+
+        return effects;
+    }
+}
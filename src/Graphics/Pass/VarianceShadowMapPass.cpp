@@ -3,7 +3,79 @@
 //
 
 #include <Graphics/Pass/VarianceShadowMapPass.h>
+#include <Graphics/Render/FrameBufferController.h>
 
 namespace SR_GRAPH_NS {
-    /// SR_REGISTER_RENDER_PASS(VarianceShadowMapPass);
-}
\ No newline at end of file
+    SR_REGISTER_RENDER_PASS(VarianceShadowMapPass);
+
+    float_t VarianceShadowMapPass::GetMaxExponent(ImageFormat format) {
+        /// в моментах лежит exp(2 * c * depth), он должен поместиться в формат буфера
+        switch (format) {
+            case ImageFormat::RGBA32_SFLOAT:
+                return 42.f;
+            case ImageFormat::RGBA16_SFLOAT:
+                return 5.54f; /// ln(65504) / 2
+            default:
+                return 0.f;
+        }
+    }
+
+    bool VarianceShadowMapPass::Load(const SR_XML_NS::Node& passNode) {
+        m_lightBleedingReduction = std::clamp(passNode.TryGetAttribute("LightBleedingReduction").ToFloat(0.2f), 0.f, 0.99f);
+        m_minVariance = SR_MAX(0.f, passNode.TryGetAttribute("MinVariance").ToFloat(0.0001f));
+        m_resolutionScale = std::clamp(passNode.TryGetAttribute("ResolutionScale").ToFloat(0.5f), 0.125f, 1.f);
+
+        if (!Super::Load(passNode)) {
+            return false;
+        }
+
+        auto&& pController = GetFrameBufferController();
+        if (!pController || !pController->HasColorLayers()) {
+            SR_ERROR("VarianceShadowMapPass::Load() : framebuffer has no color layer for moments!");
+            return false;
+        }
+
+        const ImageFormat format = pController->GetColorFormat(0);
+        const float_t maxExponent = GetMaxExponent(format);
+
+        if (maxExponent <= 0.f) {
+            SR_ERROR("VarianceShadowMapPass::Load() : moments require a floating point color format!\n\tFormat: "
+                + SR_UTILS_NS::EnumReflector::ToStringAtom(format).ToStringRef());
+            return false;
+        }
+
+        const SR_MATH_NS::FVector2 exponents(
+            passNode.TryGetAttribute("PositiveExponent").ToFloat(SR_MIN(40.f, maxExponent)),
+            passNode.TryGetAttribute("NegativeExponent").ToFloat(SR_MIN(5.f, maxExponent))
+        );
+
+        m_exponents.x = std::clamp(exponents.x, 0.f, maxExponent);
+        m_exponents.y = std::clamp(exponents.y, 0.f, maxExponent);
+
+        if (m_exponents != exponents) {
+            SR_WARN("VarianceShadowMapPass::Load() : exponents are clamped to {} by the color format {}!",
+                maxExponent, SR_UTILS_NS::EnumReflector::ToStringAtom(format).ToStringRef());
+        }
+
+        /// умножается на PreScale из настроек буфера, как у SSAO
+        if (m_resolutionScale < 1.f) {
+            pController->SetPreScale(pController->GetPreScale() * m_resolutionScale);
+        }
+
+        return true;
+    }
+
+    void VarianceShadowMapPass::UseReceiverUniforms(SR_GTYPES_NS::Shader* pShader) const {
+        Super::UseReceiverUniforms(pShader);
+
+        pShader->SetVec2(SHADER_VSM_EXPONENTS, m_exponents);
+        pShader->SetFloat(SHADER_VSM_LIGHT_BLEEDING_REDUCTION, m_lightBleedingReduction);
+        pShader->SetFloat(SHADER_VSM_MIN_VARIANCE, m_minVariance);
+    }
+
+    void VarianceShadowMapPass::UseSharedUniforms(ShaderUseInfo info) {
+        Super::UseSharedUniforms(info);
+        /// теми же показателями моменты записываются и читаются
+        info.pShader->SetVec2(SHADER_VSM_EXPONENTS, m_exponents);
+    }
+}
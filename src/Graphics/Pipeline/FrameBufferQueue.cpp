@@ -44,6 +44,12 @@ namespace SR_GRAPH_NS {
         m_levels.clear();
     }
 
+    void FrameBufferQueue::RemoveEmptyLevels() {
+        m_levels.erase(std::remove_if(m_levels.begin(), m_levels.end(), [](auto&& level) {
+            return level.empty();
+        }), m_levels.end());
+    }
+
     void FrameBufferQueue::AddQueue(FrameBufferQueue::FrameBuffer pFrameBuffer, uint32_t queueIndex) {
         if (m_levels.size() <= queueIndex) {
             m_levels.resize(queueIndex + 1);
@@ -82,11 +82,18 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
     }
 
-    void Pipeline::DrawIndices(uint32_t count) {
+    void Pipeline::DrawIndices(uint32_t count, uint32_t firstIndex, int32_t vertexOffset) {
         SR_PIPELINE_RENDER_GUARD(void())
         ++m_state.operations;
         ++m_state.drawCalls;
         m_state.vertices += count;
+        m_state.triangles += count / 3;
+    }
+
+    void Pipeline::DrawIndicesIndirect(uint32_t SSBO, uint32_t offset, uint32_t count) {
+        SR_PIPELINE_RENDER_GUARD(void())
+        ++m_state.operations;
+        ++m_state.drawCalls;
     }
 
     void Pipeline::Draw(uint32_t count) {
@@ -94,6 +101,7 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         ++m_state.drawCalls;
         m_state.vertices += count;
+        m_state.triangles += count / 3;
     }
 
     bool Pipeline::BeginCmdBuffer() {
@@ -175,6 +183,20 @@ namespace SR_GRAPH_NS {
         ++m_state.transferredCount;
     }
 
+    void Pipeline::UpdateVBO(uint32_t VBO, void* pData, uint64_t size, uint64_t offset) {
+        SRAssert(pData != nullptr && size > 0);
+        ++m_state.operations;
+        m_state.transferredMemory += size;
+        ++m_state.transferredCount;
+    }
+
+    void Pipeline::UpdateIBO(uint32_t IBO, void* pData, uint64_t size, uint64_t offset) {
+        SRAssert(pData != nullptr && size > 0);
+        ++m_state.operations;
+        m_state.transferredMemory += size;
+        ++m_state.transferredCount;
+    }
+
     void Pipeline::PushConstants(void* pData, uint64_t size) {
         ++m_state.operations;
         m_state.transferredMemory += size;
@@ -191,10 +213,15 @@ namespace SR_GRAPH_NS {
         ++m_state.usedTextures;
     }
 
-    bool Pipeline::BindDescriptorSet(uint32_t descriptorSet) {
+    void Pipeline::BindTextureArray(uint8_t binding, const std::vector<int32_t>& textures) {
+        ++m_state.operations;
+        ++m_state.usedTextures;
+    }
+
+    bool Pipeline::BindDescriptorSet(uint32_t descriptorSet, bool shared) {
         ++m_state.operations;
 
-        if (m_bindedDescriptors.Get(descriptorSet, false)) {
+        if (!shared && m_bindedDescriptors.Get(descriptorSet, false)) {
             PipelineError("Pipeline::BindDescriptorSet() : descriptor set already binded!");
             return false;
         }
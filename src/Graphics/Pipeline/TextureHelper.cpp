@@ -7,6 +7,11 @@
 
 #include <cmp_core.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SR_MIP_CHAIN_SSE2
+    #include <emmintrin.h>
+#endif
+
 namespace SR_GRAPH_NS {
     uint8_t* Compress(uint32_t w, uint32_t h, const uint8_t *pixels, TextureCompression method) {
         uint32_t blockCount = (w / 4) * (h / 4);
@@ -58,6 +63,8 @@ namespace SR_GRAPH_NS {
             case ImageFormat::RGBA16_UNORM:
             case ImageFormat::RGBA16_SFLOAT:
                 return 4 * 2;
+            case ImageFormat::RGBA32_SFLOAT:
+                return 4 * 4;
             case ImageFormat::RGB8_UNORM:
             case ImageFormat::RGB8_SRGB:
                 return 3 * 1;
@@ -73,4 +80,352 @@ namespace SR_GRAPH_NS {
 
         return 0;
     }
+
+    uint8_t CalculateMipCount(uint32_t width, uint32_t height) {
+        uint32_t size = SR_MAX(width, height);
+
+        uint8_t count = 1;
+        while (size > 1) {
+            size /= 2;
+            ++count;
+        }
+
+        return count;
+    }
+
+    SR_INLINE static float_t MipSRGBToLinear(float_t value) {
+        return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    SR_INLINE static float_t MipLinearToSRGB(float_t value) {
+        return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+    }
+
+    /// pDestination += pSource * weight для одного RGBA пикселя
+    SR_INLINE static void MipAccumulate(float_t* pDestination, const float_t* pSource, float_t weight) {
+    #ifdef SR_MIP_CHAIN_SSE2
+        _mm_storeu_ps(pDestination, _mm_add_ps(_mm_loadu_ps(pDestination), _mm_mul_ps(_mm_loadu_ps(pSource), _mm_set1_ps(weight))));
+    #else
+        for (uint32_t i = 0; i < 4; ++i) {
+            pDestination[i] += pSource[i] * weight;
+        }
+    #endif
+    }
+
+    /// Модифицированная функция Бесселя первого рода нулевого порядка
+    static float_t MipBesselI0(float_t x) {
+        float_t sum = 1.f;
+        float_t term = 1.f;
+
+        for (uint32_t k = 1; k < 16; ++k) {
+            term *= (x / (2.f * static_cast<float_t>(k))) * (x / (2.f * static_cast<float_t>(k)));
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    /// Веса 8-ми отводного фильтра sinc с окном Кайзера для уменьшения в два раза
+    static const std::array<float_t, 8>& GetMipKaiserWeights() {
+        static const std::array<float_t, 8> weights = []() {
+            constexpr float_t pi = 3.14159265358979f;
+            constexpr float_t alpha = 4.f;
+            constexpr float_t width = 4.f;
+
+            std::array<float_t, 8> result = { };
+            float_t sum = 0.f;
+
+            for (uint32_t i = 0; i < result.size(); ++i) {
+                /// расстояние от центра выходного пикселя, который лежит между 2x и 2x + 1
+                const float_t distance = (static_cast<float_t>(i) - 3.f) - 0.5f;
+                const float_t x = distance / 2.f;
+                const float_t sinc = std::sin(pi * x) / (pi * x);
+                const float_t t = distance / width;
+                const float_t window = MipBesselI0(alpha * std::sqrt(SR_MAX(0.f, 1.f - t * t))) / MipBesselI0(alpha);
+
+                result[i] = sinc * window;
+                sum += result[i];
+            }
+
+            for (auto&& weight : result) {
+                weight /= sum;
+            }
+
+            return result;
+        }();
+
+        return weights;
+    }
+
+    static void MipDownsampleBox(const std::vector<float_t>& source, uint32_t width, uint32_t height, std::vector<float_t>& destination) {
+        const uint32_t dstWidth = SR_MAX(width / 2, 1U);
+        const uint32_t dstHeight = SR_MAX(height / 2, 1U);
+
+        destination.assign(dstWidth * dstHeight * 4, 0.f);
+
+        for (uint32_t y = 0; y < dstHeight; ++y) {
+            const uint32_t y0 = SR_MIN(y * 2, height - 1);
+            const uint32_t y1 = SR_MIN(y * 2 + 1, height - 1);
+
+            for (uint32_t x = 0; x < dstWidth; ++x) {
+                const uint32_t x0 = SR_MIN(x * 2, width - 1);
+                const uint32_t x1 = SR_MIN(x * 2 + 1, width - 1);
+
+                float_t* pPixel = destination.data() + (y * dstWidth + x) * 4;
+
+                MipAccumulate(pPixel, source.data() + (y0 * width + x0) * 4, 0.25f);
+                MipAccumulate(pPixel, source.data() + (y0 * width + x1) * 4, 0.25f);
+                MipAccumulate(pPixel, source.data() + (y1 * width + x0) * 4, 0.25f);
+                MipAccumulate(pPixel, source.data() + (y1 * width + x1) * 4, 0.25f);
+            }
+        }
+    }
+
+    static void MipDownsampleKaiser(const std::vector<float_t>& source, uint32_t width, uint32_t height, std::vector<float_t>& destination) {
+        auto&& weights = GetMipKaiserWeights();
+
+        const uint32_t dstWidth = SR_MAX(width / 2, 1U);
+        const uint32_t dstHeight = SR_MAX(height / 2, 1U);
+
+        /// фильтр разделимый: сначала по горизонтали, затем по вертикали
+        std::vector<float_t> horizontal(dstWidth * height * 4, 0.f);
+
+        for (uint32_t y = 0; y < height; ++y) {
+            for (uint32_t x = 0; x < dstWidth; ++x) {
+                float_t* pPixel = horizontal.data() + (y * dstWidth + x) * 4;
+
+                for (uint32_t i = 0; i < weights.size(); ++i) {
+                    const int32_t sourceX = SR_MAX(SR_MIN(static_cast<int32_t>(x * 2 + i) - 3, static_cast<int32_t>(width) - 1), 0);
+                    MipAccumulate(pPixel, source.data() + (y * width + sourceX) * 4, weights[i]);
+                }
+            }
+        }
+
+        destination.assign(dstWidth * dstHeight * 4, 0.f);
+
+        for (uint32_t y = 0; y < dstHeight; ++y) {
+            for (uint32_t x = 0; x < dstWidth; ++x) {
+                float_t* pPixel = destination.data() + (y * dstWidth + x) * 4;
+
+                for (uint32_t i = 0; i < weights.size(); ++i) {
+                    const int32_t sourceY = SR_MAX(SR_MIN(static_cast<int32_t>(y * 2 + i) - 3, static_cast<int32_t>(height) - 1), 0);
+                    MipAccumulate(pPixel, horizontal.data() + (sourceY * dstWidth + x) * 4, weights[i]);
+                }
+            }
+        }
+    }
+
+    bool GenerateMipChain(const uint8_t* pPixels, uint32_t width, uint32_t height, const MipChainInfo& info,
+        std::vector<uint8_t>& chain, std::vector<MipLevel>& levels)
+    {
+        SR_TRACY_ZONE;
+
+        if (!pPixels || width == 0 || height == 0) {
+            SR_ERROR("GenerateMipChain() : invalid image!");
+            return false;
+        }
+
+        const uint8_t count = CalculateMipCount(width, height);
+
+        levels.clear();
+        levels.reserve(count);
+
+        uint64_t bytes = 0;
+
+        for (uint8_t level = 0; level < count; ++level) {
+            const uint32_t levelWidth = SR_MAX(width >> level, 1U);
+            const uint32_t levelHeight = SR_MAX(height >> level, 1U);
+
+            levels.emplace_back(MipLevel {
+                .width = levelWidth,
+                .height = levelHeight,
+                .offset = bytes,
+            });
+
+            bytes += static_cast<uint64_t>(levelWidth) * levelHeight * 4;
+        }
+
+        chain.resize(bytes);
+        std::memcpy(chain.data(), pPixels, static_cast<uint64_t>(width) * height * 4);
+
+        /// фильтруем в float, чтобы ошибка квантования не накапливалась от уровня к уровню
+        std::vector<float_t> source(static_cast<uint64_t>(width) * height * 4);
+        std::vector<float_t> destination;
+
+        for (uint64_t i = 0; i < source.size(); ++i) {
+            const float_t value = static_cast<float_t>(pPixels[i]) / 255.f;
+            const bool isColor = (i % 4) != 3;
+
+            if (info.normalMap && isColor) {
+                source[i] = value * 2.f - 1.f;
+            }
+            else if (info.sRGB && isColor) {
+                source[i] = MipSRGBToLinear(value);
+            }
+            else {
+                source[i] = value;
+            }
+        }
+
+        for (uint8_t level = 1; level < count; ++level) {
+            auto&& previous = levels[level - 1];
+            auto&& current = levels[level];
+
+            if (info.filter == MipFilter::Kaiser) {
+                MipDownsampleKaiser(source, previous.width, previous.height, destination);
+            }
+            else {
+                MipDownsampleBox(source, previous.width, previous.height, destination);
+            }
+
+            uint8_t* pLevel = chain.data() + current.offset;
+
+            for (uint64_t pixel = 0; pixel < static_cast<uint64_t>(current.width) * current.height; ++pixel) {
+                float_t* pPixel = destination.data() + pixel * 4;
+
+                if (info.normalMap) {
+                    const float_t length = std::sqrt(pPixel[0] * pPixel[0] + pPixel[1] * pPixel[1] + pPixel[2] * pPixel[2]);
+                    if (length > 0.f) {
+                        pPixel[0] /= length;
+                        pPixel[1] /= length;
+                        pPixel[2] /= length;
+                    }
+                }
+
+                for (uint32_t c = 0; c < 4; ++c) {
+                    float_t value = pPixel[c];
+
+                    if (info.normalMap && c != 3) {
+                        value = value * 0.5f + 0.5f;
+                    }
+                    else if (info.sRGB && c != 3) {
+                        value = MipLinearToSRGB(SR_MAX(value, 0.f));
+                    }
+
+                    pLevel[pixel * 4 + c] = static_cast<uint8_t>(SR_MAX(SR_MIN(value, 1.f), 0.f) * 255.f + 0.5f);
+                }
+            }
+
+            source.swap(destination);
+        }
+
+        return true;
+    }
+
+    uint32_t GetCompressedBlockBytes(TextureCompression method) {
+        switch (method) {
+            case TextureCompression::BC1:
+            case TextureCompression::BC4:
+                return 8;
+            case TextureCompression::BC2:
+            case TextureCompression::BC3:
+            case TextureCompression::BC5:
+            case TextureCompression::BC6:
+            case TextureCompression::BC7:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    uint8_t* CompressMipChain(const uint8_t* pChain, const std::vector<MipLevel>& levels, TextureCompression method,
+        std::vector<MipLevel>& compressedLevels, uint64_t& bytes)
+    {
+        SR_TRACY_ZONE;
+
+        /// полоса из блоков, которую сжимает один поток за раз
+        constexpr uint32_t bandRows = 64;
+
+        struct Band {
+            const uint8_t* pSource = nullptr;
+            uint32_t width = 0;
+            uint32_t rows = 0;
+            uint64_t offset = 0;
+        };
+
+        const uint32_t blockBytes = GetCompressedBlockBytes(method);
+
+        compressedLevels.clear();
+        bytes = 0;
+
+        if (!pChain || blockBytes == 0) {
+            return nullptr;
+        }
+
+        std::vector<Band> bands;
+
+        for (auto&& level : levels) {
+            if (level.width % 4 != 0 || level.height % 4 != 0) {
+                break;
+            }
+
+            compressedLevels.emplace_back(MipLevel {
+                .width = level.width,
+                .height = level.height,
+                .offset = bytes,
+            });
+
+            const uint64_t bandBytes = static_cast<uint64_t>(level.width / 4) * (bandRows / 4) * blockBytes;
+
+            for (uint32_t row = 0; row < level.height; row += bandRows) {
+                bands.emplace_back(Band {
+                    .pSource = pChain + level.offset + static_cast<uint64_t>(row) * level.width * 4,
+                    .width = level.width,
+                    .rows = SR_MIN(bandRows, level.height - row),
+                    .offset = bytes + (row / bandRows) * bandBytes,
+                });
+            }
+
+            bytes += static_cast<uint64_t>(level.width / 4) * (level.height / 4) * blockBytes;
+        }
+
+        if (compressedLevels.empty()) {
+            return nullptr;
+        }
+
+        auto&& pCompressed = (uint8_t*)malloc(bytes);
+
+        std::atomic<uint32_t> next = 0;
+        std::atomic<bool> hasErrors = false;
+
+        auto&& worker = [&]() {
+            for (uint32_t i = next++; i < bands.size(); i = next++) {
+                auto&& band = bands[i];
+
+                auto&& pBand = Compress(band.width, band.rows, band.pSource, method);
+                if (!pBand) {
+                    hasErrors = true;
+                    continue;
+                }
+
+                std::memcpy(pCompressed + band.offset, pBand, static_cast<uint64_t>(band.width / 4) * (band.rows / 4) * blockBytes);
+                free(pBand);
+            }
+        };
+
+        const uint32_t threadsCount = SR_MIN(static_cast<uint32_t>(bands.size()), SR_MAX(std::thread::hardware_concurrency(), 1U));
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadsCount);
+
+        for (uint32_t i = 1; i < threadsCount; ++i) {
+            threads.emplace_back(worker);
+        }
+
+        worker();
+
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+
+        if (hasErrors) {
+            SR_ERROR("CompressMipChain() : failed to compress mip chain!");
+            free(pCompressed);
+            compressedLevels.clear();
+            bytes = 0;
+            return nullptr;
+        }
+
+        return pCompressed;
+    }
 }
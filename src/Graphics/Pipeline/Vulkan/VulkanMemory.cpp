@@ -57,7 +57,11 @@ namespace SR_GRAPH_NS::VulkanTools {
             info.pDepth->subLayers.emplace_back(m_texturePool.Add(pTexture));
         }
 
-        return m_fboPool.Add(pFBO);
+        const int32_t id = m_fboPool.Add(pFBO);
+
+        Track(Memory::MemoryCategory::FBO, Memory::MemoryHeap::Device, id, GetFrameBufferSize(info));
+
+        return id;
     }
 
     bool SR_GRAPH_NS::VulkanTools::MemoryManager::ReAllocateFBO(const VulkanFrameBufferAllocInfo& info) {
@@ -112,10 +116,20 @@ namespace SR_GRAPH_NS::VulkanTools {
             pTextureRef = pFBO->AllocateDepthTextureReference(-1);
         }
 
+        Track(Memory::MemoryCategory::FBO, Memory::MemoryHeap::Device, info.FBO, GetFrameBufferSize(info));
+
         return true;
     }
 
     bool SR_GRAPH_NS::VulkanTools::MemoryManager::FreeDescriptorSet(uint32_t id) {
+        /// память временного набора возвращается сбросом его пула
+        if (auto&& pIt = m_transientSets.find(static_cast<int32_t>(id)); pIt != m_transientSets.end()) SR_UNLIKELY_ATTRIBUTE {
+            auto&& transientPool = m_transientPools[pIt->second];
+            --transientPool.alive;
+            transientPool.releaseFrame = m_transientFrame;
+            return true;
+        }
+
         auto&& descriptorSet = m_descriptorSetPool.RemoveByIndex(static_cast<int32_t>(id));
         if (!m_descriptorManager->FreeDescriptorSet(&descriptorSet)){
             SR_ERROR("MemoryManager::FreeDescriptorSet() : failed free descriptor set!");
@@ -125,26 +139,35 @@ namespace SR_GRAPH_NS::VulkanTools {
     }
 
     bool MemoryManager::FreeSSBO(uint32_t id) {
+        Untrack(Memory::MemoryCategory::SSBO, static_cast<int32_t>(id));
         delete m_ssboPool.RemoveByIndex(static_cast<int32_t>(id));
         return true;
     }
 
     bool MemoryManager::FreeVBO(uint32_t id) {
-        delete m_vboPool.RemoveByIndex(static_cast<int32_t>(id));
+        Untrack(Memory::MemoryCategory::VBO, static_cast<int32_t>(id));
+        auto&& pBuffer = m_vboPool.RemoveByIndex(static_cast<int32_t>(id));
+        m_uploadManager.WaitBuffer(*pBuffer);
+        delete pBuffer;
         return true;
     }
 
     bool MemoryManager::FreeUBO(uint32_t id) {
-        delete m_uboPool.RemoveByIndex(static_cast<int32_t>(id));
+        Untrack(Memory::MemoryCategory::UBO, static_cast<int32_t>(id));
+        m_uniformPages.Free(m_uboPool.RemoveByIndex(static_cast<int32_t>(id)));
         return true;
     }
 
     bool MemoryManager::FreeIBO(uint32_t id) {
-        delete m_iboPool.RemoveByIndex(static_cast<int32_t>(id));
+        Untrack(Memory::MemoryCategory::IBO, static_cast<int32_t>(id));
+        auto&& pBuffer = m_iboPool.RemoveByIndex(static_cast<int32_t>(id));
+        m_uploadManager.WaitBuffer(*pBuffer);
+        delete pBuffer;
         return true;
     }
 
     bool MemoryManager::FreeFBO(uint32_t id) {
+        Untrack(Memory::MemoryCategory::FBO, static_cast<int32_t>(id));
         delete m_fboPool.RemoveByIndex(static_cast<int32_t>(id));
         return true;
     }
@@ -155,26 +178,30 @@ namespace SR_GRAPH_NS::VulkanTools {
     }
 
     bool MemoryManager::FreeTexture(uint32_t id) {
-        delete m_texturePool.RemoveByIndex(static_cast<int32_t>(id));
+        /// копирование в память процессора еще может читать изображение
+        m_uploadManager.FreeReadback(id);
+        Untrack(Memory::MemoryCategory::Texture, static_cast<int32_t>(id));
+        auto&& pTexture = m_texturePool.RemoveByIndex(static_cast<int32_t>(id));
+        if (pTexture) {
+            m_uploadManager.WaitImage(pTexture->GetImage());
+        }
+        delete pTexture;
         return true;
     }
 
     int32_t MemoryManager::AllocateUBO(uint32_t UBOSize) {
         SR_TRACY_ZONE;
 
-        auto&& pBuffer = EvoVulkan::Types::VmaBuffer::Create(
-            m_kernel->GetAllocator(),
-            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-            VMA_MEMORY_USAGE_CPU_TO_GPU,
-            UBOSize
-        );
+        const UniformPages::Slot slot = m_uniformPages.Allocate(UBOSize);
 
-        if (!pBuffer) {
+        if (slot.page == SR_ID_INVALID) {
             SR_ERROR("MemoryManager::AllocateUBO() : failed to create uniform buffer object!");
             return SR_ID_INVALID;
         }
 
-        return m_uboPool.Add(pBuffer);
+        const int32_t id = m_uboPool.Add(slot);
+        Track(Memory::MemoryCategory::UBO, GetMemoryHeap(VMA_MEMORY_USAGE_CPU_TO_GPU), id, UBOSize);
+        return id;
     }
 
     int32_t MemoryManager::AllocateDescriptorSet(uint32_t shaderProgram, const std::vector<uint64_t>& types) {
@@ -192,10 +219,103 @@ namespace SR_GRAPH_NS::VulkanTools {
         return m_descriptorSetPool.Add(pDescriptorSet);
     }
 
+    int32_t MemoryManager::AllocateTransientDescriptorSet(uint32_t shaderProgram) {
+        SR_TRACY_ZONE;
+
+        uint32_t poolIndex = 0;
+        for (; poolIndex < m_transientPools.size(); ++poolIndex) {
+            if (!m_transientPools[poolIndex].isFull) {
+                break;
+            }
+        }
+
+        if (poolIndex == m_transientPools.size()) SR_UNLIKELY_ATTRIBUTE {
+            const std::array<VkDescriptorPoolSize, 4> sizes = {
+                VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, TRANSIENT_POOL_SETS },
+                VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, TRANSIENT_POOL_SETS },
+                VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, TRANSIENT_POOL_SETS * 4 },
+                VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, TRANSIENT_POOL_SETS }
+            };
+
+            VkDescriptorPoolCreateInfo poolInfo = { };
+            poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+            poolInfo.maxSets = TRANSIENT_POOL_SETS;
+            poolInfo.poolSizeCount = static_cast<uint32_t>(sizes.size());
+            poolInfo.pPoolSizes = sizes.data();
+
+            TransientPool transientPool;
+
+            if (vkCreateDescriptorPool(*m_device, &poolInfo, nullptr, &transientPool.pool) != VK_SUCCESS) {
+                SR_ERROR("MemoryManager::AllocateTransientDescriptorSet() : failed to create descriptor pool!");
+                return SR_ID_INVALID;
+            }
+
+            m_transientPools.emplace_back(std::move(transientPool));
+        }
+
+        auto&& transientPool = m_transientPools[poolIndex];
+
+        VkDescriptorSetLayout layout = m_shaderProgramPool.At(static_cast<int32_t>(shaderProgram))->GetDescriptorSetLayout();
+
+        VkDescriptorSetAllocateInfo allocateInfo = { };
+        allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocateInfo.descriptorPool = transientPool.pool;
+        allocateInfo.descriptorSetCount = 1;
+        allocateInfo.pSetLayouts = &layout;
+
+        EvoVulkan::Types::DescriptorSet descriptorSet = { };
+
+        /// в пуле кончились наборы или дескрипторы, следующий набор возьмем из нового пула
+        if (vkAllocateDescriptorSets(*m_device, &allocateInfo, &descriptorSet.descriptorSet) != VK_SUCCESS) SR_UNLIKELY_ATTRIBUTE {
+            transientPool.isFull = true;
+            return transientPool.descriptorSets.empty() ? SR_ID_INVALID : AllocateTransientDescriptorSet(shaderProgram);
+        }
+
+        const int32_t id = m_descriptorSetPool.Add(descriptorSet);
+
+        transientPool.descriptorSets.emplace_back(id);
+        ++transientPool.alive;
+
+        m_transientSets[id] = poolIndex;
+
+        return id;
+    }
+
+    void MemoryManager::ResetTransientDescriptorSets(uint32_t framesInFlight) {
+        SR_TRACY_ZONE;
+
+        ++m_transientFrame;
+
+        for (auto&& transientPool : m_transientPools) {
+            if (transientPool.alive > 0 || transientPool.descriptorSets.empty()) {
+                continue;
+            }
+
+            /// последний отпущенный набор мог быть записан в командные буферы всех кадров в полете
+            if (transientPool.releaseFrame + framesInFlight > m_transientFrame) {
+                continue;
+            }
+
+            for (auto&& id : transientPool.descriptorSets) {
+                m_transientSets.erase(id);
+                m_descriptorSetPool.RemoveByIndex(id);
+            }
+
+            transientPool.descriptorSets.clear();
+            transientPool.isFull = false;
+
+            vkResetDescriptorPool(*m_device, transientPool.pool, 0);
+        }
+    }
+
+    void MemoryManager::UpdateUBO(uint32_t id, const void* pData, uint64_t size) {
+        m_uniformPages.Write(GetUBO(id), pData, size);
+    }
+
     int32_t MemoryManager::AllocateVBO(uint32_t buffSize, void *data) {
         SR_TRACY_ZONE;
 
-        VkBufferUsageFlags bufferUsageFlagBits = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+        VkBufferUsageFlags bufferUsageFlagBits = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 
         if (m_kernel->GetDevice()->IsRayTracingSupported()) {
             bufferUsageFlagBits |= VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR;
@@ -204,8 +324,8 @@ namespace SR_GRAPH_NS::VulkanTools {
         auto&& pVBO = EvoVulkan::Types::VmaBuffer::Create(
             m_kernel->GetAllocator(),
             bufferUsageFlagBits,
-            VMA_MEMORY_USAGE_CPU_TO_GPU,
-            buffSize, data
+            VMA_MEMORY_USAGE_GPU_ONLY,
+            buffSize
         );
 
         if (!pVBO) {
@@ -213,13 +333,21 @@ namespace SR_GRAPH_NS::VulkanTools {
             return SR_ID_INVALID;
         }
 
-        return m_vboPool.Add(pVBO);
+        if (data && !m_uploadManager.Upload(*pVBO, 0, data, buffSize)) {
+            SR_ERROR("MemoryManager::AllocateVBO() : failed to upload vertex data!");
+            delete pVBO;
+            return SR_ID_INVALID;
+        }
+
+        const int32_t id = m_vboPool.Add(pVBO);
+        Track(Memory::MemoryCategory::VBO, GetMemoryHeap(VMA_MEMORY_USAGE_GPU_ONLY), id, buffSize);
+        return id;
     }
 
     int32_t MemoryManager::AllocateIBO(uint32_t buffSize, void *data)  {
         SR_TRACY_ZONE;
 
-        VkBufferUsageFlags bufferUsageFlagBits = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+        VkBufferUsageFlags bufferUsageFlagBits = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 
         if (m_kernel->GetDevice()->IsRayTracingSupported()) {
             bufferUsageFlagBits |= VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR;
@@ -228,8 +356,8 @@ namespace SR_GRAPH_NS::VulkanTools {
         auto&& pIBO = EvoVulkan::Types::VmaBuffer::Create(
             m_kernel->GetAllocator(),
             bufferUsageFlagBits,
-            VMA_MEMORY_USAGE_CPU_TO_GPU,
-            buffSize, data
+            VMA_MEMORY_USAGE_GPU_ONLY,
+            buffSize
         );
 
         if (!pIBO) {
@@ -237,7 +365,15 @@ namespace SR_GRAPH_NS::VulkanTools {
             return SR_ID_INVALID;
         }
 
-        return m_iboPool.Add(pIBO);
+        if (data && !m_uploadManager.Upload(*pIBO, 0, data, buffSize)) {
+            SR_ERROR("MemoryManager::AllocateIBO() : failed to upload index data!");
+            delete pIBO;
+            return SR_ID_INVALID;
+        }
+
+        const int32_t id = m_iboPool.Add(pIBO);
+        Track(Memory::MemoryCategory::IBO, GetMemoryHeap(VMA_MEMORY_USAGE_GPU_ONLY), id, buffSize);
+        return id;
     }
 
     int32_t MemoryManager::AllocateShaderProgram(EvoVulkan::Types::RenderPass renderPass)  {
@@ -270,17 +406,47 @@ namespace SR_GRAPH_NS::VulkanTools {
             return SR_ID_INVALID;
         }
 
-        return m_texturePool.Add(pTexture);
+        const int32_t id = m_texturePool.Add(pTexture);
+        Track(Memory::MemoryCategory::Texture, Memory::MemoryHeap::Device, id, GetImageSize(format, w, h, mipLevels, 6));
+        return id;
     }
 
     int32_t MemoryManager::AllocateTexture(
         const uint8_t *pixels, uint32_t w, uint32_t h,
         VkFormat format,
         VkFilter filter,
-        SR_GRAPH_NS::TextureCompression /*compression*/,
+        SR_GRAPH_NS::TextureCompression compression,
         uint8_t mipLevels,
         bool cpuUsage)
     {
+        /// сжатые блоки не уменьшаются блитом, у них загружается только нулевой уровень
+        const uint32_t blockBytes = SR_GRAPH_NS::GetCompressedBlockBytes(compression);
+        const uint8_t levels = blockBytes != 0 ? 1 : (mipLevels == 0 ? SR_GRAPH_NS::CalculateMipCount(w, h) : mipLevels);
+
+        /// копирование и построение уровней идут в отправке менеджера загрузок, без отдельного ожидания очереди
+        if (!cpuUsage && (levels == 1 || m_uploadManager.IsBlitSupported(format))) SR_LIKELY_ATTRIBUTE {
+            auto&& pTexture = EvoVulkan::Types::Texture::Create(m_device, m_allocator, m_descriptorManager, format, w, h, levels, filter);
+            if (!pTexture) {
+                SR_ERROR("MemoryManager::AllocateTexture() : failed to create Evo Vulkan texture!");
+                return SR_ID_INVALID;
+            }
+
+            const bool isUploaded = blockBytes != 0
+                ? m_uploadManager.UploadImage(pTexture->GetImage(), pixels, { MipLevel { w, h, 0 } }, 4, blockBytes)
+                : m_uploadManager.UploadImage(pTexture->GetImage(), pixels, w, h, static_cast<uint32_t>(GetImageSize(format, 1, 1, 1, 1)), levels);
+
+            if (!isUploaded) {
+                SR_ERROR("MemoryManager::AllocateTexture() : failed to upload texture!");
+                m_uploadManager.WaitImage(pTexture->GetImage());
+                delete pTexture;
+                return SR_ID_INVALID;
+            }
+
+            const int32_t id = m_texturePool.Add(pTexture);
+            Track(Memory::MemoryCategory::Texture, Memory::MemoryHeap::Device, id, GetImageSize(format, w, h, levels, 1));
+            return id;
+        }
+
         EvoVulkan::Types::Texture* pTexture = nullptr;
 
         if (mipLevels == 0) {
@@ -298,7 +464,45 @@ namespace SR_GRAPH_NS::VulkanTools {
             return SR_ID_INVALID;
         }
 
-        return m_texturePool.Add(pTexture);
+        const int32_t id = m_texturePool.Add(pTexture);
+        Track(Memory::MemoryCategory::Texture, Memory::MemoryHeap::Device, id, GetImageSize(format, w, h, mipLevels == 0 ? SR_GRAPH_NS::CalculateMipCount(w, h) : mipLevels, 1));
+        return id;
+    }
+
+    int32_t MemoryManager::AllocateTexture(
+        const uint8_t* pChain,
+        uint64_t size,
+        const std::vector<MipLevel>& levels,
+        VkFormat format,
+        VkFilter filter,
+        SR_GRAPH_NS::TextureCompression compression)
+    {
+        auto&& baseLevel = levels.front();
+
+        /// изображение создается пустым, уровни приходят в него копированием из кольца
+        auto&& pTexture = EvoVulkan::Types::Texture::Create(
+            m_device, m_allocator, m_descriptorManager, format, baseLevel.width, baseLevel.height,
+            static_cast<uint8_t>(levels.size()), filter
+        );
+
+        if (!pTexture) {
+            SR_ERROR("MemoryManager::AllocateTexture() : failed to create Evo Vulkan texture!");
+            return SR_ID_INVALID;
+        }
+
+        const uint32_t blockBytes = SR_GRAPH_NS::GetCompressedBlockBytes(compression);
+        const uint32_t blockSize = blockBytes == 0 ? 1 : 4;
+
+        if (!m_uploadManager.UploadImage(pTexture->GetImage(), pChain, levels, blockSize, blockBytes == 0 ? 4 : blockBytes)) {
+            SR_ERROR("MemoryManager::AllocateTexture() : failed to upload mip chain!");
+            m_uploadManager.WaitImage(pTexture->GetImage());
+            delete pTexture;
+            return SR_ID_INVALID;
+        }
+
+        const int32_t id = m_texturePool.Add(pTexture);
+        Track(Memory::MemoryCategory::Texture, Memory::MemoryHeap::Device, id, size);
+        return id;
     }
 
     void SR_GRAPH_NS::VulkanTools::MemoryManager::Free() {
@@ -307,13 +511,26 @@ namespace SR_GRAPH_NS::VulkanTools {
         SRAssert2(m_iboPool.IsEmpty(), "IBOs are not empty!");
         SRAssert2(m_vboPool.IsEmpty(), "VBOs are not empty!");
         SRAssert2(m_texturePool.IsEmpty(), "Textures are not empty!");
-        SRAssert2(m_descriptorSetPool.IsEmpty(), "Descriptor sets are not empty!");
         SRAssert2(m_shaderProgramPool.IsEmpty(), "Shaders are not empty!");
         SRAssert2(m_ssboPool.IsEmpty(), "SSBOs are not empty!");
+
+        for (auto&& transientPool : m_transientPools) {
+            SRAssert2(transientPool.alive == 0, "Transient descriptor sets are not released!");
+            for (auto&& id : transientPool.descriptorSets) {
+                m_descriptorSetPool.RemoveByIndex(id);
+            }
+            vkDestroyDescriptorPool(*m_device, transientPool.pool, nullptr);
+        }
+        m_transientPools.clear();
+        m_transientSets.clear();
+
+        SRAssert2(m_descriptorSetPool.IsEmpty(), "Descriptor sets are not empty!");
+        m_uniformPages.DeInit();
+        m_uploadManager.DeInit();
         delete this;
     }
 
-    bool MemoryManager::Initialize(EvoVulkan::Core::VulkanKernel *kernel) {
+    bool MemoryManager::Initialize(EvoVulkan::Core::VulkanKernel *kernel, Memory::MemoryBudget* pBudget) {
         SR_TRACY_ZONE;
 
         if (m_isInit) {
@@ -321,6 +538,7 @@ namespace SR_GRAPH_NS::VulkanTools {
         }
 
         m_kernel = kernel;
+        m_budget = pBudget;
         m_descriptorManager = m_kernel->GetDescriptorManager();
         m_allocator = m_kernel->GetAllocator();
         m_device = m_kernel->GetDevice();
@@ -331,6 +549,16 @@ namespace SR_GRAPH_NS::VulkanTools {
             return false;
         }
 
+        if (!m_uploadManager.Init(m_kernel)) {
+            SR_ERROR("MemoryManager::Initialize() : failed to initialize upload manager!");
+            return false;
+        }
+
+        if (!m_uniformPages.Init(m_kernel)) {
+            SR_ERROR("MemoryManager::Initialize() : failed to initialize uniform pages!");
+            return false;
+        }
+
         m_isInit = true;
         return true;
     }
@@ -339,11 +567,16 @@ namespace SR_GRAPH_NS::VulkanTools {
         SR_TRACY_ZONE;
 
         VmaMemoryUsage memoryUsage;
+        VkBufferUsageFlags bufferUsage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 
         switch (usage) {
             case SSBOUsage::Read:
                 memoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU;
                 break;
+            case SSBOUsage::Indirect:
+                memoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+                bufferUsage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+                break;
             case SSBOUsage::Write:
                 memoryUsage = VMA_MEMORY_USAGE_GPU_TO_CPU;
                 break;
@@ -357,7 +590,7 @@ namespace SR_GRAPH_NS::VulkanTools {
 
         auto&& pBuffer = EvoVulkan::Types::VmaBuffer::Create(
             m_kernel->GetAllocator(),
-            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            bufferUsage,
             memoryUsage,
             size,
             /// TODO: я не уверен зачем это нужно
@@ -373,6 +606,185 @@ namespace SR_GRAPH_NS::VulkanTools {
             return SR_ID_INVALID;
         }
 
-        return m_ssboPool.Add(pBuffer);
+        const int32_t id = m_ssboPool.Add(pBuffer);
+        Track(Memory::MemoryCategory::SSBO, GetMemoryHeap(memoryUsage), id, size);
+        return id;
+    }
+
+    void MemoryManager::UpdateBudget() {
+        if (!m_budget || !m_allocator) {
+            return;
+        }
+
+        SR_TRACY_ZONE;
+
+        VmaAllocator vmaAllocator = m_allocator->GetVmaAllocator();
+        if (!vmaAllocator) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        const VkPhysicalDeviceMemoryProperties* pMemoryProperties = nullptr;
+        vmaGetMemoryProperties(vmaAllocator, &pMemoryProperties);
+
+        std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets = { };
+        vmaGetHeapBudgets(vmaAllocator, budgets.data());
+
+        Memory::MemoryBudget::HeapInfo deviceHeap;
+        Memory::MemoryBudget::HeapInfo hostHeap;
+
+        for (uint32_t i = 0; i < pMemoryProperties->memoryHeapCount; ++i) {
+            const bool isDeviceLocal = pMemoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+            auto&& info = isDeviceLocal ? deviceHeap : hostHeap;
+
+            info.usage += budgets[i].usage;
+            info.budget += budgets[i].budget;
+            info.blockBytes += budgets[i].statistics.blockBytes;
+            info.allocationBytes += budgets[i].statistics.allocationBytes;
+        }
+
+        m_budget->SetHeapInfo(Memory::MemoryHeap::Device, deviceHeap);
+        m_budget->SetHeapInfo(Memory::MemoryHeap::Host, hostHeap);
+    }
+
+    void MemoryManager::UpdateFragmentation() {
+        if (!m_budget || !m_allocator) {
+            return;
+        }
+
+        SR_TRACY_ZONE;
+
+        VmaAllocator vmaAllocator = m_allocator->GetVmaAllocator();
+        if (!vmaAllocator) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        const VkPhysicalDeviceMemoryProperties* pMemoryProperties = nullptr;
+        vmaGetMemoryProperties(vmaAllocator, &pMemoryProperties);
+
+        VmaTotalStatistics statistics = { };
+        vmaCalculateStatistics(vmaAllocator, &statistics);
+
+        uint64_t deviceRange = 0;
+        uint64_t hostRange = 0;
+
+        for (uint32_t i = 0; i < pMemoryProperties->memoryHeapCount; ++i) {
+            const bool isDeviceLocal = pMemoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+            auto&& range = isDeviceLocal ? deviceRange : hostRange;
+            range = SR_MAX(range, static_cast<uint64_t>(statistics.memoryHeap[i].unusedRangeSizeMax));
+        }
+
+        m_budget->SetLargestFreeRange(Memory::MemoryHeap::Device, deviceRange);
+        m_budget->SetLargestFreeRange(Memory::MemoryHeap::Host, hostRange);
+    }
+
+    bool MemoryManager::UploadVBO(uint32_t id, const void* pData, uint64_t size, uint64_t offset) {
+        auto&& pVBO = m_vboPool.At(static_cast<int32_t>(id));
+        if (!pVBO) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("MemoryManager::UploadVBO() : vertex buffer object not found! Id: {}", id);
+            return false;
+        }
+
+        return m_uploadManager.Upload(*pVBO, offset, pData, size);
+    }
+
+    bool MemoryManager::UploadIBO(uint32_t id, const void* pData, uint64_t size, uint64_t offset) {
+        auto&& pIBO = m_iboPool.At(static_cast<int32_t>(id));
+        if (!pIBO) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("MemoryManager::UploadIBO() : index buffer object not found! Id: {}", id);
+            return false;
+        }
+
+        return m_uploadManager.Upload(*pIBO, offset, pData, size);
+    }
+
+    void MemoryManager::Track(Memory::MemoryCategory category, Memory::MemoryHeap heap, int32_t id, uint64_t bytes) {
+        if (m_budget && id != SR_ID_INVALID) {
+            m_budget->OnAllocated(category, heap, id, bytes);
+        }
+    }
+
+    void MemoryManager::Untrack(Memory::MemoryCategory category, int32_t id) {
+        if (m_budget) {
+            m_budget->OnFreed(category, id);
+        }
+    }
+
+    Memory::MemoryHeap MemoryManager::GetMemoryHeap(VmaMemoryUsage memoryUsage) {
+        switch (memoryUsage) {
+            case VMA_MEMORY_USAGE_GPU_ONLY:
+            case VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE:
+                return Memory::MemoryHeap::Device;
+            default:
+                return Memory::MemoryHeap::Host;
+        }
+    }
+
+    uint64_t MemoryManager::GetImageSize(VkFormat format, uint32_t width, uint32_t height, uint8_t mipLevels, uint32_t layers) {
+        /// бит на пиксель, сжатые форматы хранят блоки 4x4
+        uint32_t bitsPerPixel = 32;
+
+        switch (format) {
+            case VK_FORMAT_R8_UNORM:
+            case VK_FORMAT_R8_SRGB:
+                bitsPerPixel = 8;
+                break;
+            case VK_FORMAT_R8G8_UNORM:
+            case VK_FORMAT_R16_SFLOAT:
+            case VK_FORMAT_D16_UNORM:
+                bitsPerPixel = 16;
+                break;
+            case VK_FORMAT_R16G16B16A16_SFLOAT:
+            case VK_FORMAT_R32G32_SFLOAT:
+            case VK_FORMAT_D32_SFLOAT_S8_UINT:
+                bitsPerPixel = 64;
+                break;
+            case VK_FORMAT_R32G32B32A32_SFLOAT:
+                bitsPerPixel = 128;
+                break;
+            case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+            case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            case VK_FORMAT_BC4_UNORM_BLOCK:
+                bitsPerPixel = 4;
+                break;
+            case VK_FORMAT_BC2_UNORM_BLOCK:
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+            case VK_FORMAT_BC5_UNORM_BLOCK:
+            case VK_FORMAT_BC7_UNORM_BLOCK:
+            case VK_FORMAT_BC7_SRGB_BLOCK:
+                bitsPerPixel = 8;
+                break;
+            default:
+                break;
+        }
+
+        uint64_t pixels = 0;
+
+        for (uint8_t level = 0; level < SR_MAX(mipLevels, static_cast<uint8_t>(1)); ++level) {
+            pixels += static_cast<uint64_t>(SR_MAX(width >> level, 1U)) * SR_MAX(height >> level, 1U);
+        }
+
+        return pixels * layers * bitsPerPixel / 8;
+    }
+
+    uint64_t MemoryManager::GetFrameBufferSize(const VulkanFrameBufferAllocInfo& info) const {
+        const uint32_t samples = SR_MAX(static_cast<uint32_t>(info.sampleCount), 1U);
+        const uint32_t layers = SR_MAX(info.layersCount, 1U);
+
+        uint64_t bytes = 0;
+
+        for (auto&& format : info.inputColorAttachments) {
+            /// при мультисемплинге к вложению добавляется однократное для resolve
+            bytes += GetImageSize(format, info.width, info.height, 1, layers) * (samples > 1 ? samples + 1 : 1);
+        }
+
+        if (info.pDepth && info.pDepth->format != ImageFormat::None && info.pDepth->aspect != ImageAspect::None) {
+            const VkFormat depthFormat = info.pDepth->format == ImageFormat::Auto ? m_device->GetDepthFormat() : VulkanTools::AbstractTextureFormatToVkFormat(info.pDepth->format);
+            bytes += GetImageSize(depthFormat, info.width, info.height, 1, layers) * samples;
+        }
+
+        return bytes;
     }
 }
@@ -9,6 +9,9 @@
 #include <Graphics/Pipeline/Vulkan/AbstractCasts.h>
 #include <Graphics/Pipeline/Vulkan/VulkanTracy.h>
 #include <Graphics/Pipeline/Vulkan/VulkanMemory.h>
+#include <Graphics/Memory/DescriptorManager.h>
+#include <Graphics/Memory/BindlessTextureTable.h>
+#include <Graphics/Memory/IndirectDrawBuffer.h>
 
 #ifdef SR_USE_IMGUI
     #include <Graphics/Overlay/VulkanImGuiOverlay.h>
@@ -56,6 +59,7 @@ namespace SR_GRAPH_NS {
         SR_TRACY_DESTROY(SR_UTILS_NS::TracyType::Vulkan);
 
         DestroyOverlay();
+        DestroyTimestampPool();
 
         if (m_memory) {
             m_memory->Free();
@@ -255,7 +259,7 @@ namespace SR_GRAPH_NS {
         }
 
         SR_INFO("VulkanPipeline::Init() : creating vulkan memory manager...");
-        m_memory = VulkanTools::MemoryManager::Create(m_kernel);
+        m_memory = VulkanTools::MemoryManager::Create(m_kernel, &m_memoryBudget);
         if (!m_memory) {
             PipelineError("VulkanPipeline::Init() : failed to create vulkan memory manager!");
             return false;
@@ -263,6 +267,31 @@ namespace SR_GRAPH_NS {
 
         m_supportedSampleCount = m_kernel->GetDevice()->GetMSAASamplesCount();
 
+        {
+            VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures = { };
+            indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+
+            VkPhysicalDeviceFeatures2 features = { };
+            features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            features.pNext = &indexingFeatures;
+
+            vkGetPhysicalDeviceFeatures2(*m_kernel->GetDevice(), &features);
+
+            m_isTextureArrayUpdateAfterBind = indexingFeatures.descriptorBindingSampledImageUpdateAfterBind
+                && indexingFeatures.descriptorBindingPartiallyBound
+                && indexingFeatures.descriptorBindingUpdateUnusedWhilePending;
+
+            if (!m_isTextureArrayUpdateAfterBind) {
+                SR_WARN("VulkanPipeline::Init() : update after bind isn't supported, texture arrays are rewritten with command buffers!");
+            }
+
+            m_isMultiDrawIndirect = features.features.multiDrawIndirect == VK_TRUE;
+
+            if (!m_isMultiDrawIndirect) {
+                SR_WARN("VulkanPipeline::Init() : multi draw indirect isn't supported, indirect draws are submitted one by one!");
+            }
+        }
+
         return Super::Init();
     }
 
@@ -270,6 +299,20 @@ namespace SR_GRAPH_NS {
         return m_kernel->GetAllocator() ? m_kernel->GetAllocator()->GetGPUMemoryUsage() : 0;
     }
 
+    void VulkanPipeline::UpdateMemoryBudget() {
+        if (m_memory) {
+            m_memory->UpdateBudget();
+        }
+
+        Super::UpdateMemoryBudget();
+    }
+
+    void VulkanPipeline::UpdateMemoryFragmentation() {
+        if (m_memory) {
+            m_memory->UpdateFragmentation();
+        }
+    }
+
     int32_t VulkanPipeline::AllocateUBO(uint32_t uboSize) {
         if (!m_isRenderState) SR_UNLIKELY_ATTRIBUTE {
             PipelineError("VulkanPipeline::AllocateUBO() : render state isn't active!");
@@ -329,6 +372,25 @@ namespace SR_GRAPH_NS {
         return SR_ID_INVALID;
     }
 
+    int32_t VulkanPipeline::AllocTransientDescriptorSet(const std::vector<DescriptorType>& types) {
+        SR_TRACY_ZONE;
+
+        if (!m_isRenderState || m_state.buildIteration > 0 || m_state.shaderId < 0) SR_UNLIKELY_ATTRIBUTE {
+            return SR_ID_INVALID;
+        }
+
+        ++m_state.operations;
+
+        /// при исчерпании пула кадра набор выделяется обычным путем
+        return m_memory->AllocateTransientDescriptorSet(m_state.shaderId);
+    }
+
+    void VulkanPipeline::ResetTransientDescriptorSets() {
+        if (m_memory) SR_LIKELY_ATTRIBUTE {
+            m_memory->ResetTransientDescriptorSets(static_cast<uint32_t>(GetBuildIterationsCount()) + 1);
+        }
+    }
+
     void* VulkanPipeline::GetCurrentFBOHandle() const {
         if (m_state.pFrameBuffer) SR_LIKELY_ATTRIBUTE {
             auto&& FBO = m_state.pFrameBuffer->GetId();
@@ -391,6 +453,9 @@ namespace SR_GRAPH_NS {
         m_currentVkShader = m_memory->GetShaderProgram(shaderProgram);
         m_currentLayout = m_currentVkShader->GetPipelineLayout();
 
+        auto&& pIt = m_dynamicOffsetsCounts.find(static_cast<int32_t>(shaderProgram));
+        m_dynamicOffsetsCount = pIt == m_dynamicOffsetsCounts.end() ? 0 : pIt->second;
+
         if (m_currentVkShader == m_lastVkShader) {
             m_isShaderChanged = false;
             return;
@@ -466,6 +531,20 @@ namespace SR_GRAPH_NS {
             return SR_ID_INVALID;
         }
 
+        /// слоты массива текстур меняются, пока набор привязан в записанных командах
+        std::vector<VkDescriptorBindingFlags> descriptorBindingFlags(descriptorLayoutBindings.value().size(), 0);
+
+        if (m_isTextureArrayUpdateAfterBind) {
+            for (size_t i = 0; i < descriptorBindingFlags.size(); ++i) {
+                auto&& binding = descriptorLayoutBindings.value()[i];
+                if (binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER && binding.descriptorCount > 1) {
+                    descriptorBindingFlags[i] = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT
+                        | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT
+                        | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+                }
+            }
+        }
+
         std::vector<EvoVulkan::Complexes::SourceShader> vkModules;
         for (auto&& module : modules) {
             VkShaderStageFlagBits stage = VulkanTools::VkShaderShaderTypeToStage(module.m_stage);
@@ -478,6 +557,7 @@ namespace SR_GRAPH_NS {
                 SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("/Cache/Shaders"),
                 vkModules,
                 descriptorLayoutBindings.value(),
+                descriptorBindingFlags,
                 pushConstants
         )) {
             EVK_POP_LOG_LEVEL();
@@ -527,6 +607,18 @@ namespace SR_GRAPH_NS {
 
         EVK_POP_LOG_LEVEL();
 
+        /// блок объекта привязывается со смещением своего участка страницы
+        std::set<uint64_t> dynamicBindings;
+        for (auto&& uniform : createInfo.uniforms) {
+            if (uniform.type == LayoutBinding::DynamicUniform) {
+                dynamicBindings.insert(uniform.binding);
+            }
+        }
+
+        if (!dynamicBindings.empty()) {
+            m_dynamicOffsetsCounts[shaderProgram] = static_cast<uint32_t>(dynamicBindings.size());
+        }
+
         return shaderProgram;
     }
 
@@ -566,6 +658,13 @@ namespace SR_GRAPH_NS {
                 return SR_ID_INVALID;
             }
 
+            /// уровни сжимаются блоками 4x4, обрезка нулевого уровня сломала бы готовую цепочку
+            if (!textureCreateInfo.mipChain.empty() && textureCreateInfo.width % 4 == 0 && textureCreateInfo.height % 4 == 0) {
+                return AllocateTextureMipChain(textureCreateInfo, vkFormat);
+            }
+
+            textureCreateInfo.mipChain.clear();
+
             if (auto&& size = MakeGoodSizes(textureCreateInfo.width, textureCreateInfo.height); size != std::pair(textureCreateInfo.width, textureCreateInfo.height)) {
                 textureCreateInfo.pData = ResizeToLess(textureCreateInfo.width, textureCreateInfo.height, size.first, size.second, textureCreateInfo.pData);
                 textureCreateInfo.width = size.first;
@@ -586,6 +685,10 @@ namespace SR_GRAPH_NS {
             }
         }
 
+        if (!textureCreateInfo.mipChain.empty()) {
+            return AllocateTextureMipChain(textureCreateInfo, vkFormat);
+        }
+
         m_state.allocatedMemory += GetPixelSize(textureCreateInfo.format) * textureCreateInfo.width * textureCreateInfo.height;
 
         auto&& id = m_memory->AllocateTexture(
@@ -606,6 +709,52 @@ namespace SR_GRAPH_NS {
         return id;
     }
 
+    int32_t VulkanPipeline::AllocateTextureMipChain(const SRTextureCreateInfo& createInfo, VkFormat vkFormat) {
+        SR_TRACY_ZONE;
+
+        std::vector<MipLevel> levels = createInfo.mipChain;
+
+        /// число уровней из конфига ограничивает готовую цепочку
+        if (createInfo.mipLevels > 0) {
+            levels.resize(SR_MIN(levels.size(), static_cast<size_t>(createInfo.mipLevels)));
+        }
+
+        auto&& lastLevel = levels.back();
+        uint64_t bytes = lastLevel.offset + static_cast<uint64_t>(lastLevel.width) * lastLevel.height * 4;
+
+        const uint8_t* pChain = createInfo.pData;
+
+        if (createInfo.compression != TextureCompression::None) {
+            std::vector<MipLevel> compressedLevels;
+
+            pChain = Graphics::CompressMipChain(createInfo.pData, levels, createInfo.compression, compressedLevels, bytes);
+            if (!pChain) {
+                PipelineError("VulkanPipeline::AllocateTexture() : failed to compress mip chain!");
+                return SR_ID_INVALID;
+            }
+
+            levels = std::move(compressedLevels);
+        }
+
+        m_state.allocatedMemory += bytes;
+
+        auto&& id = m_memory->AllocateTexture(pChain, bytes, levels, vkFormat,
+            VulkanTools::AbstractTextureFilterToVkFilter(createInfo.filter), createInfo.compression
+        );
+
+        /// данные уже скопированы в кольцо загрузок
+        if (createInfo.compression != TextureCompression::None) {
+            free(const_cast<uint8_t*>(pChain));
+        }
+
+        if (id < 0) {
+            PipelineError("VulkanPipeline::AllocateTexture() : failed to allocate texture with mip chain!");
+            return SR_ID_INVALID;
+        }
+
+        return id;
+    }
+
     void VulkanPipeline::UnUseShader() {
         Super::UnUseShader();
         m_currentVkShader = nullptr;
@@ -627,6 +776,10 @@ namespace SR_GRAPH_NS {
 
         std::vector<VkWriteDescriptorSet> writeDescriptorSets;
 
+        /// участки страниц юниформ, запись ссылается на них до vkUpdateDescriptorSets
+        std::vector<VkDescriptorBufferInfo> bufferInfos;
+        bufferInfos.reserve(updateInfo.size());
+
         for (auto&& info : updateInfo) {
             switch (info.descriptorType) {
                 case DescriptorType::Storage: {
@@ -641,14 +794,22 @@ namespace SR_GRAPH_NS {
 
                     break;
                 }
-                case DescriptorType::Uniform: {
-                    auto&& vkUBODescriptor = m_memory->GetUBO(info.ubo)->GetDescriptorRef();
+                case DescriptorType::Uniform:
+                case DescriptorType::DynamicUniform: {
+                    auto&& slot = m_memory->GetUBO(info.ubo);
+                    const bool isDynamic = info.descriptorType == DescriptorType::DynamicUniform;
+
+                    auto&& bufferInfo = bufferInfos.emplace_back();
+                    bufferInfo.buffer = m_memory->GetUBOBuffer(info.ubo);
+                    /// у динамического биндинга смещение задается при привязке
+                    bufferInfo.offset = isDynamic ? 0 : slot.offset;
+                    bufferInfo.range = slot.size;
 
                     writeDescriptorSets.emplace_back(EvoVulkan::Tools::Initializers::WriteDescriptorSet(
                         vkDescriptorSet,
-                        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                        isDynamic ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
                         info.binding,
-                        vkUBODescriptor
+                        &bufferInfo
                     ));
 
                     break;
@@ -671,7 +832,7 @@ namespace SR_GRAPH_NS {
         SR_TRACY_ZONE;
         SRAssert2(UBO != SR_ID_INVALID, "Invalid UBO ID!");
         Super::UpdateUBO(UBO, pData, size);
-        m_memory->GetUBO(UBO)->CopyToDevice(pData, size);
+        m_memory->UpdateUBO(UBO, pData, size);
     }
 
     void VulkanPipeline::UpdateSSBO(uint32_t SSBO, void *pData, uint64_t size) {
@@ -681,6 +842,20 @@ namespace SR_GRAPH_NS {
         m_memory->GetSSBO(SSBO)->CopyToDevice(pData, size);
     }
 
+    void VulkanPipeline::UpdateVBO(uint32_t VBO, void* pData, uint64_t size, uint64_t offset) {
+        SR_TRACY_ZONE;
+        SRAssert2(VBO != SR_ID_INVALID, "Invalid VBO ID!");
+        Super::UpdateVBO(VBO, pData, size, offset);
+        m_memory->UploadVBO(VBO, pData, size, offset);
+    }
+
+    void VulkanPipeline::UpdateIBO(uint32_t IBO, void* pData, uint64_t size, uint64_t offset) {
+        SR_TRACY_ZONE;
+        SRAssert2(IBO != SR_ID_INVALID, "Invalid IBO ID!");
+        Super::UpdateIBO(IBO, pData, size, offset);
+        m_memory->UploadIBO(IBO, pData, size, offset);
+    }
+
     uint8_t VulkanPipeline::GetBuildIterationsCount() const noexcept {
         return m_kernel ? m_kernel->GetCountBuildIterations() : 0;
     }
@@ -830,6 +1005,16 @@ namespace SR_GRAPH_NS {
             if (!m_memory->ReAllocateFBO(info)) {
                 PipelineError("VulkanPipeline::AllocateFrameBuffer() : failed to re-allocate frame buffer object!");
             }
+
+            /// идентификаторы вложений остались прежними, но образы под ними новые
+            for (auto&& textureId : colorBuffers) {
+                OnTextureReCreated(textureId);
+            }
+            for (auto&& textureId : createInfo.pDepth->subLayers) {
+                OnTextureReCreated(textureId);
+            }
+            OnTextureReCreated(createInfo.pDepth->texture);
+
             EVK_POP_LOG_LEVEL();
             goto success;
         }
@@ -867,6 +1052,36 @@ namespace SR_GRAPH_NS {
         );
     }
 
+    uint64_t VulkanPipeline::RequestTextureReadback(int32_t textureId, const SR_MATH_NS::UVector2& size, uint32_t pixelSize) {
+        SR_TRACY_ZONE;
+
+        ++m_state.operations;
+
+        auto&& pTexture = textureId == SR_ID_INVALID ? nullptr : m_memory->GetTexture(static_cast<uint32_t>(textureId));
+        if (!pTexture) SR_UNLIKELY_ATTRIBUTE {
+            PipelineError("VulkanPipeline::RequestTextureReadback() : texture not found! Id: " + std::to_string(textureId));
+            return 0;
+        }
+
+        /// пока копия кадра в полете, следующие копии идут в другие буферы
+        const uint32_t slotsCount = static_cast<uint32_t>(GetBuildIterationsCount()) + 2;
+
+        return m_memory->GetUploadManager().Readback(
+            static_cast<uint64_t>(textureId),
+            pTexture->GetImage(),
+            pTexture->GetDescriptorRef()->imageLayout,
+            size.x, size.y, pixelSize, slotsCount
+        );
+    }
+
+    uint64_t VulkanPipeline::GetTextureReadback(int32_t textureId, std::vector<uint8_t>& data, SR_MATH_NS::UVector2& size) {
+        if (textureId == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            return 0;
+        }
+
+        return m_memory->GetUploadManager().GetReadback(static_cast<uint64_t>(textureId), data, size.x, size.y);
+    }
+
     bool VulkanPipeline::InitEvoVulkanHooks() {
         SR_TRACY_ZONE;
         SR_GRAPH("VulkanPipeline::InitEvoVulkanHooks() : initializing evo vulkan hooks...");
@@ -962,6 +1177,7 @@ namespace SR_GRAPH_NS {
         m_isShaderChanged = true;
 
         vkBeginCommandBuffer(m_currentCmd, &m_cmdBufInfo);
+        WriteTimestamp(true);
         return Super::BeginCmdBuffer();
     }
 
@@ -973,6 +1189,7 @@ namespace SR_GRAPH_NS {
             return;
         }
 
+        WriteTimestamp(false);
         vkEndCommandBuffer(m_currentCmd);
         Super::EndCmdBuffer();
     }
@@ -1009,6 +1226,11 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::DrawFrame() {
         Super::DrawFrame();
 
+        /// копирования кадра уходят одной отправкой раньше отрисовки
+        m_memory->GetUploadManager().Flush();
+
+        TagTimestampSlots();
+
         switch (m_kernel->NextFrame()) {
             case EvoVulkan::Core::RenderResult::Fatal:
                 SR_UTILS_NS::EventManager::Instance().Broadcast(SR_UTILS_NS::EventManager::Event::FatalError);
@@ -1103,10 +1325,31 @@ namespace SR_GRAPH_NS {
         Super::OnResize(size);
     }
 
+    void VulkanPipeline::OnTextureFreed(int32_t textureId) {
+        if (textureId == SR_ID_INVALID) {
+            return;
+        }
+
+        DescriptorManager::Instance().OnResourceFreed(DescriptorType::CombinedImage, textureId);
+        BindlessTextureTable::Instance().OnTextureFreed(textureId);
+    }
+
+    void VulkanPipeline::OnTextureReCreated(int32_t textureId) {
+        if (textureId == SR_ID_INVALID) {
+            return;
+        }
+
+        /// наборы с отдельной текстурой держат старый образ, а слот массива просто записывается заново
+        DescriptorManager::Instance().OnResourceFreed(DescriptorType::CombinedImage, textureId);
+        BindlessTextureTable::Instance().OnTextureReCreated(textureId);
+    }
+
     bool VulkanPipeline::FreeTexture(int32_t *id) {
         ++m_state.operations;
         ++m_state.deletions;
 
+        OnTextureFreed(*id);
+
         if (!m_memory || !m_memory->FreeTexture(static_cast<uint32_t>(*id))) {
             SR_ERROR("VulkanPipeline::FreeTexture() : failed to free texture!");
             return false;
@@ -1138,6 +1381,18 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         ++m_state.deletions;
 
+        /// слот освободившегося буфера не должен приписать его время новому буферу с тем же id
+        for (auto pIt = m_timestampSlots.begin(); pIt != m_timestampSlots.end(); ) {
+            if (pIt->first.first == *id) {
+                pIt = m_timestampSlots.erase(pIt);
+            }
+            else {
+                ++pIt;
+            }
+        }
+
+        m_recordedTimestampSlots.erase(*id);
+
         const bool result = m_memory->FreeFBO(*id - 1);
         *id = SR_ID_INVALID;
         return result;
@@ -1154,6 +1409,8 @@ namespace SR_GRAPH_NS {
             return false;
         }
 
+        m_dynamicOffsetsCounts.erase(*id);
+
         *id = SR_ID_INVALID;
 
         return true;
@@ -1182,6 +1439,8 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         ++m_state.deletions;
 
+        OnTextureFreed(*id);
+
         const bool result = m_memory->FreeTexture(*id);
 
         *id = SR_ID_INVALID;
@@ -1242,6 +1501,8 @@ namespace SR_GRAPH_NS {
 
         EVK_PUSH_LOG_LEVEL(EvoVulkan::Tools::LogLevel::ErrorsOnly);
 
+        m_textureArraySets.erase(*id);
+
         if (!m_memory->FreeDescriptorSet(*id)) {
             SR_ERROR("Vulkan::FreeDescriptorSet() : failed to free descriptor set!");
             *id = SR_ID_INVALID;
@@ -1298,6 +1559,8 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         ++m_state.deletions;
 
+        DescriptorManager::Instance().OnResourceFreed(DescriptorType::Uniform, *id);
+
         const bool result = m_memory->FreeUBO(*id);
 
         *id = SR_ID_INVALID;
@@ -1335,6 +1598,7 @@ namespace SR_GRAPH_NS {
         /// Чистим старую очередь
 
         m_kernel->ClearSubmitQueue();
+        m_submittedFrameBuffers.clear();
 
         auto&& queues = m_fboQueue.GetQueues();
 
@@ -1415,6 +1679,7 @@ namespace SR_GRAPH_NS {
                 auto&& vkFrameBuffer = m_memory->GetFBO(fbId - 1);
 
                 submitInfo.commandBuffers.emplace_back(vkFrameBuffer->GetCmd());
+                m_submittedFrameBuffers.emplace_back(fbId);
 
                 for (auto&& signalSemaphore : vkFrameBuffer->GetSignalSemaphores()) {
                     submitInfo.AddSignalSemaphore(signalSemaphore);
@@ -1476,8 +1741,8 @@ namespace SR_GRAPH_NS {
         Super::OnMultiSampleChanged();
     }
 
-    bool VulkanPipeline::BindDescriptorSet(uint32_t descriptorSet) {
-        if (!Super::BindDescriptorSet(descriptorSet)) {
+    bool VulkanPipeline::BindDescriptorSet(uint32_t descriptorSet, bool shared) {
+        if (!Super::BindDescriptorSet(descriptorSet, shared)) {
             return false;
         }
 
@@ -1522,16 +1787,25 @@ namespace SR_GRAPH_NS {
 
     void VulkanPipeline::BindVBO(uint32_t VBO) {
         Super::BindVBO(VBO);
+
         vkCmdBindVertexBuffers(m_currentCmd, 0, 1, m_memory->GetVBO(VBO)->GetCRef(), m_offsets);
     }
 
     void VulkanPipeline::BindIBO(uint32_t IBO) {
         Super::BindIBO(IBO);
+
         vkCmdBindIndexBuffer(m_currentCmd, *m_memory->GetIBO(IBO), 0, VK_INDEX_TYPE_UINT32);
     }
 
     void VulkanPipeline::BindUBO(uint32_t UBO) {
         Super::BindUBO(UBO);
+
+        /// набор объекта ссылается на страницу, участок выбирается при привязке набора
+        m_dynamicOffset = static_cast<int32_t>(UBO) == SR_ID_INVALID ? 0 : m_memory->GetUBO(UBO).offset;
+    }
+
+    int32_t VulkanPipeline::GetUBOPage(int32_t UBO) const {
+        return UBO == SR_ID_INVALID ? SR_ID_INVALID : m_memory->GetUBO(static_cast<uint32_t>(UBO)).page;
     }
 
     bool VulkanPipeline::IsSamplerValid(int32_t id) const {
@@ -1571,28 +1845,140 @@ namespace SR_GRAPH_NS {
         vkUpdateDescriptorSets(*m_kernel->GetDevice(), 1, &descriptorSetWrite, 0, nullptr);
     }
 
+    void VulkanPipeline::BindTextureArray(uint8_t binding, const std::vector<int32_t>& textures) {
+        SR_TRACY_ZONE;
+
+        Super::BindTextureArray(binding, textures);
+
+        if (!m_bindedDescriptors.Get(m_state.descriptorSetId, false)) {
+            PipelineError("VulkanPipeline::BindTextureArray() : descriptor set not binded!");
+            return;
+        }
+
+        if (!m_isRenderState || m_state.buildIteration > 0) SR_UNLIKELY_ATTRIBUTE {
+            PipelineError("VulkanPipeline::BindTextureArray() : render state isn't active or not in first build iteration!");
+            SRHaltOnce0();
+            return;
+        }
+
+        auto&& descriptorSet = m_memory->GetDescriptorSet(m_state.descriptorSetId);
+
+        m_imageInfosCache.clear();
+        m_imageInfosCache.reserve(textures.size());
+
+        for (auto&& textureId : textures) {
+            if (!IsSamplerValid(textureId)) SR_UNLIKELY_ATTRIBUTE {
+                break;
+            }
+            m_imageInfosCache.emplace_back(*m_memory->GetTexture(textureId)->GetDescriptorRef());
+        }
+
+        if (m_imageInfosCache.size() != textures.size()) SR_UNLIKELY_ATTRIBUTE {
+            PipelineError("VulkanPipeline::BindTextureArray() : texture array contains invalid textures!");
+            return;
+        }
+
+        if (m_imageInfosCache.empty()) {
+            return;
+        }
+
+        auto&& descriptorSetWrite = EvoVulkan::Tools::Initializers::WriteDescriptorSet(
+                descriptorSet.descriptorSet,
+                VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, binding,
+                m_imageInfosCache.data());
+        descriptorSetWrite.descriptorCount = static_cast<uint32_t>(m_imageInfosCache.size());
+
+        vkUpdateDescriptorSets(*m_kernel->GetDevice(), 1, &descriptorSetWrite, 0, nullptr);
+
+        m_textureArraySets[m_state.descriptorSetId] = binding;
+    }
+
+    bool VulkanPipeline::UpdateTextureArrays(const std::vector<int32_t>& textures, const std::vector<int32_t>& slots) {
+        SR_TRACY_ZONE;
+
+        if (!m_isTextureArrayUpdateAfterBind) {
+            return false;
+        }
+
+        if (m_textureArraySets.empty() || slots.empty()) {
+            return true;
+        }
+
+        m_imageInfosCache.clear();
+        m_imageInfosCache.reserve(slots.size());
+
+        for (auto&& slot : slots) {
+            if (slot < 0 || slot >= static_cast<int32_t>(textures.size()) || !IsSamplerValid(textures[slot])) SR_UNLIKELY_ATTRIBUTE {
+                PipelineError("VulkanPipeline::UpdateTextureArrays() : texture array contains invalid textures!");
+                return false;
+            }
+            m_imageInfosCache.emplace_back(*m_memory->GetTexture(textures[slot])->GetDescriptorRef());
+        }
+
+        m_descriptorWritesCache.clear();
+        m_descriptorWritesCache.reserve(m_textureArraySets.size() * slots.size());
+
+        for (auto&& [descriptorSetId, binding] : m_textureArraySets) {
+            auto&& descriptorSet = m_memory->GetDescriptorSet(descriptorSetId);
+
+            for (size_t i = 0; i < slots.size(); ++i) {
+                auto&& descriptorSetWrite = m_descriptorWritesCache.emplace_back(EvoVulkan::Tools::Initializers::WriteDescriptorSet(
+                    descriptorSet.descriptorSet,
+                    VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, binding,
+                    &m_imageInfosCache[i]
+                ));
+                descriptorSetWrite.dstArrayElement = static_cast<uint32_t>(slots[i]);
+            }
+        }
+
+        vkUpdateDescriptorSets(*m_kernel->GetDevice(), static_cast<uint32_t>(m_descriptorWritesCache.size()), m_descriptorWritesCache.data(), 0, nullptr);
+
+        return true;
+    }
+
     void VulkanPipeline::Draw(uint32_t count) {
         SR_TRACY_ZONE;
 
         Super::Draw(count);
 
         if (m_currentDescriptorSet) {
-            vkCmdBindDescriptorSets(m_currentCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentLayout, 0, 1, &m_currentDescriptorSet, 0, nullptr);
+            vkCmdBindDescriptorSets(m_currentCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentLayout, 0, 1, &m_currentDescriptorSet, m_dynamicOffsetsCount, &m_dynamicOffset);
         }
 
         vkCmdDraw(m_currentCmd, count, 1, 0, 0);
     }
 
-    void VulkanPipeline::DrawIndices(uint32_t count) {
+    void VulkanPipeline::DrawIndices(uint32_t count, uint32_t firstIndex, int32_t vertexOffset) {
         SR_TRACY_ZONE;
 
-        Super::DrawIndices(count);
+        Super::DrawIndices(count, firstIndex, vertexOffset);
 
         if (m_currentDescriptorSet) {
-            vkCmdBindDescriptorSets(m_currentCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentLayout, 0, 1, &m_currentDescriptorSet, 0, nullptr);
+            vkCmdBindDescriptorSets(m_currentCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentLayout, 0, 1, &m_currentDescriptorSet, m_dynamicOffsetsCount, &m_dynamicOffset);
         }
 
-        vkCmdDrawIndexed(m_currentCmd, count, 1, 0, 0, 0);
+        vkCmdDrawIndexed(m_currentCmd, count, 1, firstIndex, vertexOffset, 0);
+    }
+
+    void VulkanPipeline::DrawIndicesIndirect(uint32_t SSBO, uint32_t offset, uint32_t count) {
+        SR_TRACY_ZONE;
+
+        Super::DrawIndicesIndirect(SSBO, offset, count);
+
+        if (m_currentDescriptorSet) {
+            vkCmdBindDescriptorSets(m_currentCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentLayout, 0, 1, &m_currentDescriptorSet, m_dynamicOffsetsCount, &m_dynamicOffset);
+        }
+
+        const VkBuffer buffer = *m_memory->GetSSBO(SSBO);
+
+        if (m_isMultiDrawIndirect || count <= 1) SR_LIKELY_ATTRIBUTE {
+            vkCmdDrawIndexedIndirect(m_currentCmd, buffer, offset, count, Memory::IndirectDrawBuffer::STRIDE);
+            return;
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            vkCmdDrawIndexedIndirect(m_currentCmd, buffer, offset + i * Memory::IndirectDrawBuffer::STRIDE, 1, Memory::IndirectDrawBuffer::STRIDE);
+        }
     }
 
     void VulkanPipeline::SetVSyncEnabled(bool enabled) {
@@ -1794,6 +2180,8 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         ++m_state.deletions;
 
+        DescriptorManager::Instance().OnResourceFreed(DescriptorType::Storage, *id);
+
         const bool result = m_memory->FreeSSBO(*id);
 
         *id = SR_ID_INVALID;
@@ -1847,8 +2235,205 @@ namespace SR_GRAPH_NS {
 
     void VulkanPipeline::ResetSubmitQueue() {
         m_kernel->ClearSubmitQueue();
+        m_submittedFrameBuffers.clear();
         m_kernel->GetWaitSemaphores().emplace_back(m_kernel->GetPresentCompleteSemaphore());
 
         Super::ResetSubmitQueue();
     }
+
+    void VulkanPipeline::SetTimestampsEnabled(bool enabled) {
+        if (enabled == m_timestampsEnabled) {
+            return;
+        }
+
+        if (!enabled) {
+            Super::SetTimestampsEnabled(false);
+            return;
+        }
+
+        if (!m_kernel || !m_kernel->GetDevice()) {
+            PipelineError("VulkanPipeline::SetTimestampsEnabled() : device is not initialized!");
+            return;
+        }
+
+        if (m_timestampPool == VK_NULL_HANDLE) {
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(*m_kernel->GetDevice(), &properties);
+
+            if (!properties.limits.timestampComputeAndGraphics) {
+                SR_WARN("VulkanPipeline::SetTimestampsEnabled() : timestamps are not supported by the device!");
+                return;
+            }
+
+            m_timestampPeriod = properties.limits.timestampPeriod;
+
+            VkQueryPoolCreateInfo createInfo = { };
+            createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+            createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+            createInfo.queryCount = MAX_TIMESTAMP_SLOTS * 2;
+
+            if (vkCreateQueryPool(*m_kernel->GetDevice(), &createInfo, nullptr, &m_timestampPool) != VK_SUCCESS) {
+                PipelineError("VulkanPipeline::SetTimestampsEnabled() : failed to create query pool!");
+                m_timestampPool = VK_NULL_HANDLE;
+                return;
+            }
+        }
+
+        Super::SetTimestampsEnabled(true);
+    }
+
+    void VulkanPipeline::WriteTimestamp(bool begin) {
+        if (!m_timestampsEnabled || m_timestampPool == VK_NULL_HANDLE) SR_LIKELY_ATTRIBUTE {
+            return;
+        }
+
+        if (begin) {
+            const int32_t frameBufferId = m_state.pFrameBuffer ? m_state.pFrameBuffer->GetId() : SR_ID_INVALID;
+            const auto key = std::make_pair(frameBufferId, m_state.buildIteration);
+
+            auto&& pIt = m_timestampSlots.find(key);
+            if (pIt == m_timestampSlots.end()) {
+                if (m_timestampSlots.size() >= MAX_TIMESTAMP_SLOTS) {
+                    SR_WARN("VulkanPipeline::WriteTimestamp() : out of timestamp slots!");
+                    m_currentTimestampSlot = MAX_TIMESTAMP_SLOTS;
+                    return;
+                }
+
+                std::vector<bool> used(MAX_TIMESTAMP_SLOTS, false);
+                for (auto&& [slotKey, slot] : m_timestampSlots) {
+                    used[slot] = true;
+                }
+
+                const uint32_t slot = static_cast<uint32_t>(std::distance(used.begin(), std::find(used.begin(), used.end(), false)));
+                pIt = m_timestampSlots.emplace(key, slot).first;
+
+                /// до первой отправки в слоте могут лежать результаты освобожденного буфера
+                m_timestampFrames.resize(MAX_TIMESTAMP_SLOTS, UINT64_MAX);
+                m_timestampFrames[slot] = UINT64_MAX;
+            }
+
+            m_currentTimestampSlot = pIt->second;
+
+            if (frameBufferId != SR_ID_INVALID) {
+                m_recordedTimestampSlots[frameBufferId] = m_currentTimestampSlot;
+            }
+
+            /// сброс вне прохода рендера, командный буфер сбрасывает свои метки при каждом выполнении
+            vkCmdResetQueryPool(m_currentCmd, m_timestampPool, m_currentTimestampSlot * 2, 2);
+            vkCmdWriteTimestamp(m_currentCmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_timestampPool, m_currentTimestampSlot * 2);
+        }
+        else if (m_currentTimestampSlot < MAX_TIMESTAMP_SLOTS) {
+            vkCmdWriteTimestamp(m_currentCmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_timestampPool, m_currentTimestampSlot * 2 + 1);
+            m_currentTimestampSlot = MAX_TIMESTAMP_SLOTS;
+        }
+    }
+
+    void VulkanPipeline::TagTimestampSlots() {
+        const uint64_t frame = m_timestampFrame++;
+
+        if (!m_timestampsEnabled || m_timestampPool == VK_NULL_HANDLE || m_timestampSlots.empty()) SR_LIKELY_ATTRIBUTE {
+            return;
+        }
+
+        m_timestampFrames.resize(MAX_TIMESTAMP_SLOTS, UINT64_MAX);
+
+        for (const int32_t frameBufferId : m_submittedFrameBuffers) {
+            if (auto&& pIt = m_recordedTimestampSlots.find(frameBufferId); pIt != m_recordedTimestampSlots.end()) {
+                m_timestampFrames[pIt->second] = frame;
+            }
+        }
+    }
+
+    Pipeline::GPUTimings VulkanPipeline::GetGPUTimings() const {
+        if (!m_timestampsEnabled || m_timestampPool == VK_NULL_HANDLE || m_timestampSlots.empty()) {
+            return GPUTimings();
+        }
+
+        /// значение и признак готовности на каждую метку, без ожидания GPU
+        std::vector<uint64_t> results(MAX_TIMESTAMP_SLOTS * 2 * 2, 0);
+
+        const VkResult result = vkGetQueryPoolResults(*m_kernel->GetDevice(), m_timestampPool, 0, MAX_TIMESTAMP_SLOTS * 2,
+            results.size() * sizeof(uint64_t), results.data(), sizeof(uint64_t) * 2,
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT
+        );
+
+        if (result != VK_SUCCESS && result != VK_NOT_READY) {
+            return GPUTimings();
+        }
+
+        auto&& isAvailable = [&results](uint32_t slot) {
+            return results[slot * 4 + 1] != 0 && results[slot * 4 + 3] != 0;
+        };
+
+        /// последний кадр, все буферы которого уже выполнены. Кадры младше него учитывать нельзя:
+        /// их слоты частично перезаписаны, а слоты пропущенных буферов хранят время еще более старых кадров
+        uint64_t completedFrame = UINT64_MAX;
+        std::map<uint64_t, bool> frames;
+
+        for (auto&& [key, slot] : m_timestampSlots) {
+            if (key.first == SR_ID_INVALID || slot >= m_timestampFrames.size() || m_timestampFrames[slot] == UINT64_MAX) {
+                continue;
+            }
+
+            auto&& pIt = frames.emplace(m_timestampFrames[slot], true).first;
+            pIt->second = pIt->second && isAvailable(slot);
+        }
+
+        for (auto pIt = frames.rbegin(); pIt != frames.rend(); ++pIt) {
+            if (pIt->second) {
+                completedFrame = pIt->first;
+                break;
+            }
+        }
+
+        GPUTimings timings;
+        timings.reserve(m_timestampSlots.size());
+
+        /// у SwapChain берется последний выполненный из буферов итераций
+        uint64_t swapChainEnd = 0;
+        float_t swapChainTime = 0.f;
+
+        for (auto&& [key, slot] : m_timestampSlots) {
+            const uint64_t* pBegin = &results[slot * 4];
+            const uint64_t* pEnd = &results[slot * 4 + 2];
+
+            if (!isAvailable(slot) || pEnd[0] < pBegin[0]) {
+                continue;
+            }
+
+            if (key.first != SR_ID_INVALID && (slot >= m_timestampFrames.size() || m_timestampFrames[slot] != completedFrame)) {
+                continue;
+            }
+
+            const float_t milliseconds = static_cast<float_t>(static_cast<double_t>(pEnd[0] - pBegin[0]) * m_timestampPeriod / 1000000.0);
+
+            if (key.first == SR_ID_INVALID) {
+                if (pEnd[0] > swapChainEnd) {
+                    swapChainEnd = pEnd[0];
+                    swapChainTime = milliseconds;
+                }
+                continue;
+            }
+
+            timings.emplace_back(GPUTiming { key.first, milliseconds });
+        }
+
+        if (swapChainEnd > 0) {
+            timings.emplace_back(GPUTiming { SR_ID_INVALID, swapChainTime });
+        }
+
+        return timings;
+    }
+
+    void VulkanPipeline::DestroyTimestampPool() {
+        if (m_timestampPool != VK_NULL_HANDLE && m_kernel && m_kernel->GetDevice()) {
+            vkDestroyQueryPool(*m_kernel->GetDevice(), m_timestampPool, nullptr);
+        }
+
+        m_timestampPool = VK_NULL_HANDLE;
+        m_timestampSlots.clear();
+        m_timestampFrames.clear();
+        m_recordedTimestampSlots.clear();
+        m_timestampsEnabled = false;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,116 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pipeline/Vulkan/VulkanUniformPages.h>
+
+namespace SR_GRAPH_NS::VulkanTools {
+    UniformPages::~UniformPages() {
+        SRAssert2(m_pages.IsEmpty(), "Uniform pages are not de-initialized!");
+    }
+
+    bool UniformPages::Init(EvoVulkan::Core::VulkanKernel* pKernel) {
+        m_allocator = pKernel->GetAllocator()->GetVmaAllocator();
+
+        VkPhysicalDeviceProperties properties = { };
+        vkGetPhysicalDeviceProperties(*pKernel->GetDevice(), &properties);
+
+        m_alignment = SR_MAX(static_cast<VkDeviceSize>(16), properties.limits.minUniformBufferOffsetAlignment);
+
+        return m_allocator != VK_NULL_HANDLE;
+    }
+
+    void UniformPages::DeInit() {
+        std::vector<int32_t> pages;
+
+        m_pages.ForEach([&](int32_t id, Page& page) {
+            vmaDestroyBuffer(m_allocator, page.buffer, page.allocation);
+            pages.emplace_back(id);
+        });
+
+        for (auto&& id : pages) {
+            m_pages.RemoveByIndex(id);
+        }
+
+        m_allocator = VK_NULL_HANDLE;
+    }
+
+    UniformPages::Slot UniformPages::Allocate(uint32_t size) {
+        SR_TRACY_ZONE;
+
+        const auto slotSize = static_cast<uint32_t>((size + m_alignment - 1) / m_alignment * m_alignment);
+
+        int32_t pageId = SR_ID_INVALID;
+
+        m_pages.ForEach([&](int32_t id, Page& page) {
+            if (pageId == SR_ID_INVALID && page.slotSize == slotSize && !page.freeOffsets.empty()) {
+                pageId = id;
+            }
+        });
+
+        if (pageId == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            if (pageId = CreatePage(slotSize); pageId == SR_ID_INVALID) {
+                return Slot();
+            }
+        }
+
+        auto&& page = m_pages.At(pageId);
+
+        Slot slot;
+        slot.page = pageId;
+        slot.offset = page.freeOffsets.back();
+        slot.size = size;
+
+        page.freeOffsets.pop_back();
+
+        return slot;
+    }
+
+    void UniformPages::Free(const Slot& slot) {
+        if (slot.page == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        m_pages.At(slot.page).freeOffsets.emplace_back(slot.offset);
+    }
+
+    void UniformPages::Write(const Slot& slot, const void* pData, uint64_t size) {
+        auto&& page = m_pages.At(slot.page);
+        std::memcpy(page.pData + slot.offset, pData, SR_MIN(size, static_cast<uint64_t>(page.slotSize)));
+    }
+
+    int32_t UniformPages::CreatePage(uint32_t slotSize) {
+        /// крупный блок получает страницу на один участок
+        const uint32_t slotsCount = SR_MAX(1u, PAGE_SIZE / slotSize);
+
+        VkBufferCreateInfo bufferInfo = { };
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = static_cast<VkDeviceSize>(slotsCount) * slotSize;
+        bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo allocationInfo = { };
+        allocationInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
+        allocationInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+        VmaAllocationInfo info = { };
+
+        Page page;
+        page.slotSize = slotSize;
+
+        if (vmaCreateBuffer(m_allocator, &bufferInfo, &allocationInfo, &page.buffer, &page.allocation, &info) != VK_SUCCESS || !info.pMappedData) {
+            SR_ERROR("UniformPages::CreatePage() : failed to create uniform page! Slot size: {}", slotSize);
+            return SR_ID_INVALID;
+        }
+
+        page.pData = static_cast<uint8_t*>(info.pMappedData);
+
+        /// участки выдаются с начала страницы
+        page.freeOffsets.reserve(slotsCount);
+        for (uint32_t i = slotsCount; i > 0; --i) {
+            page.freeOffsets.emplace_back((i - 1) * slotSize);
+        }
+
+        return m_pages.Add(std::move(page));
+    }
+}
@@ -0,0 +1,768 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pipeline/Vulkan/VulkanUploadManager.h>
+
+namespace SR_GRAPH_NS::VulkanTools {
+    UploadManager::~UploadManager() {
+        SRAssert2(m_device == VK_NULL_HANDLE, "Upload manager isn't de-initialized!");
+    }
+
+    bool UploadManager::Init(EvoVulkan::Core::VulkanKernel* pKernel) {
+        SR_TRACY_ZONE;
+
+        auto&& pDevice = pKernel->GetDevice();
+
+        m_device = *pDevice;
+        m_physicalDevice = *pDevice;
+        m_queue = pDevice->GetQueues()->GetGraphicsQueue();
+        m_allocator = pKernel->GetAllocator()->GetVmaAllocator();
+        m_submitThread = std::this_thread::get_id();
+
+        VkCommandPoolCreateInfo poolInfo = { };
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = pDevice->GetQueues()->GetGraphicsIndex();
+
+        if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_commandPool) != VK_SUCCESS) {
+            SR_ERROR("UploadManager::Init() : failed to create command pool!");
+            DeInit();
+            return false;
+        }
+
+        VkBufferCreateInfo bufferInfo = { };
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = RING_SIZE;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo allocationInfo = { };
+        allocationInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
+        allocationInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+        VmaAllocationInfo ringInfo = { };
+
+        if (vmaCreateBuffer(m_allocator, &bufferInfo, &allocationInfo, &m_ringBuffer, &m_ringAllocation, &ringInfo) != VK_SUCCESS || !ringInfo.pMappedData) {
+            SR_ERROR("UploadManager::Init() : failed to create staging ring buffer!");
+            DeInit();
+            return false;
+        }
+
+        m_pRingData = static_cast<uint8_t*>(ringInfo.pMappedData);
+
+        return true;
+    }
+
+    void UploadManager::DeInit() {
+        std::lock_guard lock(m_mutex);
+
+        if (m_device == VK_NULL_HANDLE) {
+            return;
+        }
+
+        if (m_current) {
+            SubmitBatch();
+        }
+
+        Retire(true);
+
+        /// все отправки завершены, ждать копирований не нужно
+        for (auto&& [key, readback] : m_readbacks) {
+            for (auto&& slot : readback.slots) {
+                vmaDestroyBuffer(m_allocator, slot.buffer, slot.allocation);
+            }
+        }
+        m_readbacks.clear();
+
+        for (auto&& batch : m_freeBatches) {
+            vkDestroyFence(m_device, batch.fence, nullptr);
+        }
+        m_freeBatches.clear();
+
+        if (m_ringBuffer != VK_NULL_HANDLE) {
+            vmaDestroyBuffer(m_allocator, m_ringBuffer, m_ringAllocation);
+            m_ringBuffer = VK_NULL_HANDLE;
+            m_ringAllocation = VK_NULL_HANDLE;
+            m_pRingData = nullptr;
+        }
+
+        /// командные буферы освобождаются вместе с пулом
+        if (m_commandPool != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+            m_commandPool = VK_NULL_HANDLE;
+        }
+
+        m_device = VK_NULL_HANDLE;
+        m_head = 0;
+        m_used = 0;
+    }
+
+    bool UploadManager::Upload(VkBuffer destination, VkDeviceSize offset, const void* pData, uint64_t size) {
+        if (!pData || size == 0) {
+            return true;
+        }
+
+        if (destination == VK_NULL_HANDLE || !m_pRingData) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("UploadManager::Upload() : upload manager isn't initialized or destination is invalid!");
+            return false;
+        }
+
+        SR_TRACY_ZONE;
+
+        std::unique_lock lock(m_mutex);
+
+        auto&& pBytes = static_cast<const uint8_t*>(pData);
+
+        /// большие данные копируются частями, каждая часть помещается в кольцо
+        for (uint64_t copied = 0; copied < size; ) {
+            const uint64_t chunk = SR_MIN(size - copied, RING_SIZE / 2);
+
+            /// бюджет соблюдает только поток рендера, остальные копят до ближайшей отправки кадра
+            if (m_current && m_frameBytes > 0 && m_frameBytes + chunk > m_frameBudget && IsSubmitThread()) {
+                SubmitBatch();
+            }
+
+            uint64_t ringOffset = 0;
+            if (!Reserve(chunk, ringOffset, lock)) SR_UNLIKELY_ATTRIBUTE {
+                return false;
+            }
+
+            std::memcpy(m_pRingData + ringOffset, pBytes + copied, chunk);
+
+            VkBufferCopy region = { };
+            region.srcOffset = ringOffset;
+            region.dstOffset = offset + copied;
+            region.size = chunk;
+
+            vkCmdCopyBuffer(m_current->cmd, m_ringBuffer, destination, 1, &region);
+
+            if (std::find(m_current->destinations.begin(), m_current->destinations.end(), destination) == m_current->destinations.end()) {
+                m_current->destinations.emplace_back(destination);
+            }
+
+            m_frameBytes += chunk;
+            m_uploadedBytes += chunk;
+            copied += chunk;
+        }
+
+        return true;
+    }
+
+    bool UploadManager::UploadImage(VkImage image, const uint8_t* pData, const std::vector<MipLevel>& levels, uint32_t blockSize, uint32_t blockBytes) {
+        if (image == VK_NULL_HANDLE || !pData || levels.empty() || blockSize == 0 || blockBytes == 0 || !m_pRingData) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("UploadManager::UploadImage() : upload manager isn't initialized or image is invalid!");
+            return false;
+        }
+
+        SR_TRACY_ZONE;
+
+        std::unique_lock lock(m_mutex);
+
+        if (!m_current && !BeginBatch()) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        VkImageMemoryBarrier imageBarrier = { };
+        imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageBarrier.srcAccessMask = 0;
+        imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        imageBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image = image;
+        imageBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, static_cast<uint32_t>(levels.size()), 0, 1 };
+
+        vkCmdPipelineBarrier(m_current->cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+        for (uint32_t level = 0; level < levels.size(); ++level) {
+            if (!CopyLevel(image, level, pData, levels[level], blockSize, blockBytes, lock)) SR_UNLIKELY_ATTRIBUTE {
+                return false;
+            }
+        }
+
+        /// отправка идет раньше кадра в ту же очередь, шейдеры кадра читают уже готовые уровни
+        imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        imageBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        vkCmdPipelineBarrier(m_current->cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+        return true;
+    }
+
+    bool UploadManager::UploadImage(VkImage image, const uint8_t* pData, uint32_t width, uint32_t height, uint32_t pixelSize, uint32_t mipLevels) {
+        if (image == VK_NULL_HANDLE || !pData || width == 0 || height == 0 || pixelSize == 0 || mipLevels == 0 || !m_pRingData) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("UploadManager::UploadImage() : upload manager isn't initialized or image is invalid!");
+            return false;
+        }
+
+        SR_TRACY_ZONE;
+
+        std::unique_lock lock(m_mutex);
+
+        if (!m_current && !BeginBatch()) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        VkImageMemoryBarrier imageBarrier = { };
+        imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageBarrier.srcAccessMask = 0;
+        imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        imageBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image = image;
+        imageBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, mipLevels, 0, 1 };
+
+        vkCmdPipelineBarrier(m_current->cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+        if (!CopyLevel(image, 0, pData, MipLevel { width, height, 0 }, 1, pixelSize, lock)) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        /// каждый уровень строится из предыдущего в той же отправке, после копирования нулевого
+        imageBarrier.subresourceRange.levelCount = 1;
+
+        for (uint32_t level = 1; level < mipLevels; ++level) {
+            imageBarrier.subresourceRange.baseMipLevel = level - 1;
+            imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+            vkCmdPipelineBarrier(m_current->cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+            VkImageBlit blit = { };
+            blit.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level - 1, 0, 1 };
+            blit.srcOffsets[1] = { static_cast<int32_t>(SR_MAX(width >> (level - 1), 1U)), static_cast<int32_t>(SR_MAX(height >> (level - 1), 1U)), 1 };
+            blit.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+            blit.dstOffsets[1] = { static_cast<int32_t>(SR_MAX(width >> level, 1U)), static_cast<int32_t>(SR_MAX(height >> level, 1U)), 1 };
+
+            vkCmdBlitImage(m_current->cmd, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+        }
+
+        /// все уровни, кроме последнего, остались источниками блита
+        imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        imageBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        imageBarrier.subresourceRange.baseMipLevel = 0;
+        imageBarrier.subresourceRange.levelCount = mipLevels - 1;
+
+        if (mipLevels > 1) {
+            vkCmdPipelineBarrier(m_current->cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+        }
+
+        imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageBarrier.subresourceRange.baseMipLevel = mipLevels - 1;
+        imageBarrier.subresourceRange.levelCount = 1;
+
+        vkCmdPipelineBarrier(m_current->cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+        return true;
+    }
+
+    bool UploadManager::CopyLevel(VkImage image, uint32_t level, const uint8_t* pData, const MipLevel& mipLevel, uint32_t blockSize, uint32_t blockBytes, std::unique_lock<std::recursive_mutex>& lock) {
+        const uint64_t rowBytes = static_cast<uint64_t>((mipLevel.width + blockSize - 1) / blockSize) * blockBytes;
+        const uint32_t rowsCount = (mipLevel.height + blockSize - 1) / blockSize;
+
+        /// большие уровни копируются полосами из целых строк блоков, каждая полоса помещается в кольцо
+        const uint32_t chunkRows = static_cast<uint32_t>(SR_MAX(RING_SIZE / 2 / rowBytes, 1ULL));
+
+        for (uint32_t row = 0; row < rowsCount; row += chunkRows) {
+            const uint32_t rows = SR_MIN(chunkRows, rowsCount - row);
+            const uint64_t chunk = rows * rowBytes;
+
+            if (m_current && m_frameBytes > 0 && m_frameBytes + chunk > m_frameBudget && IsSubmitThread()) {
+                SubmitBatch();
+            }
+
+            uint64_t ringOffset = 0;
+            if (!Reserve(chunk, ringOffset, lock)) SR_UNLIKELY_ATTRIBUTE {
+                return false;
+            }
+
+            std::memcpy(m_pRingData + ringOffset, pData + mipLevel.offset + row * rowBytes, chunk);
+
+            VkBufferImageCopy region = { };
+            region.bufferOffset = ringOffset;
+            region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+            region.imageOffset = { 0, static_cast<int32_t>(row * blockSize), 0 };
+            region.imageExtent = { mipLevel.width, SR_MIN(rows * blockSize, mipLevel.height - row * blockSize), 1 };
+
+            vkCmdCopyBufferToImage(m_current->cmd, m_ringBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+            if (std::find(m_current->images.begin(), m_current->images.end(), image) == m_current->images.end()) {
+                m_current->images.emplace_back(image);
+            }
+
+            m_frameBytes += chunk;
+            m_uploadedBytes += chunk;
+        }
+
+        return true;
+    }
+
+    bool UploadManager::IsBlitSupported(VkFormat format) const {
+        VkFormatProperties properties = { };
+        vkGetPhysicalDeviceFormatProperties(m_physicalDevice, format, &properties);
+
+        constexpr VkFormatFeatureFlags required = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+        return (properties.optimalTilingFeatures & required) == required;
+    }
+
+    uint64_t UploadManager::Flush() {
+        std::lock_guard lock(m_mutex);
+
+        Retire(false);
+
+        const uint64_t value = m_current ? SubmitBatch() : m_submittedValue;
+
+        m_frameBytes = 0;
+
+        m_condition.notify_all();
+
+        return value;
+    }
+
+    uint64_t UploadManager::Readback(uint64_t key, VkImage image, VkImageLayout layout, uint32_t width, uint32_t height, uint32_t pixelSize, uint32_t slotsCount) {
+        if (image == VK_NULL_HANDLE || width == 0 || height == 0 || pixelSize == 0 || !m_pRingData) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("UploadManager::Readback() : upload manager isn't initialized or image is invalid!");
+            return 0;
+        }
+
+        SR_TRACY_ZONE;
+
+        std::unique_lock lock(m_mutex);
+
+        slotsCount = SR_MAX(1u, slotsCount);
+
+        auto&& readback = m_readbacks[key];
+
+        if (readback.width != width || readback.height != height || readback.pixelSize != pixelSize || readback.slots.size() != slotsCount) {
+            DestroyReadback(readback, lock);
+
+            readback.width = width;
+            readback.height = height;
+            readback.pixelSize = pixelSize;
+            readback.slots.resize(slotsCount);
+
+            VkBufferCreateInfo bufferInfo = { };
+            bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size = static_cast<VkDeviceSize>(width) * height * pixelSize;
+            bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            VmaAllocationCreateInfo allocationInfo = { };
+            allocationInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
+            allocationInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+            for (auto&& slot : readback.slots) {
+                VmaAllocationInfo slotInfo = { };
+
+                if (vmaCreateBuffer(m_allocator, &bufferInfo, &allocationInfo, &slot.buffer, &slot.allocation, &slotInfo) != VK_SUCCESS || !slotInfo.pMappedData) {
+                    SR_ERROR("UploadManager::Readback() : failed to create readback buffer!");
+                    DestroyReadback(readback, lock);
+                    m_readbacks.erase(key);
+                    return 0;
+                }
+
+                slot.pData = static_cast<const uint8_t*>(slotInfo.pMappedData);
+            }
+        }
+
+        Retire(false);
+
+        auto&& slot = readback.slots[readback.next];
+
+        /// буфер еще не прочитан видеокартой, кадр ее не ждет и пропускает копию
+        if (slot.isPending || slot.value > m_completedValue) {
+            return 0;
+        }
+
+        if (!m_current && !BeginBatch()) SR_UNLIKELY_ATTRIBUTE {
+            return 0;
+        }
+
+        /// отправка идет в ту же очередь после прошлого кадра, барьер дожидается его записи в изображение
+        VkImageMemoryBarrier imageBarrier = { };
+        imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        imageBarrier.oldLayout = layout;
+        imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image = image;
+        imageBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+        vkCmdPipelineBarrier(m_current->cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+        VkBufferImageCopy region = { };
+        region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+        region.imageExtent = { width, height, 1 };
+
+        vkCmdCopyImageToBuffer(m_current->cmd, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.buffer, 1, &region);
+
+        /// следующий кадр пишет в изображение только после копирования
+        imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        imageBarrier.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+        imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageBarrier.newLayout = layout;
+
+        VkMemoryBarrier hostBarrier = { };
+        hostBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        hostBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        hostBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+
+        vkCmdPipelineBarrier(m_current->cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT | VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &hostBarrier, 0, nullptr, 1, &imageBarrier);
+
+        slot.isPending = true;
+        slot.value = 0;
+        slot.ticket = ++m_readbackTicket;
+
+        m_current->readbacks.emplace_back(key, readback.next);
+
+        readback.next = (readback.next + 1) % slotsCount;
+
+        return slot.ticket;
+    }
+
+    uint64_t UploadManager::GetReadback(uint64_t key, std::vector<uint8_t>& data, uint32_t& width, uint32_t& height) {
+        std::lock_guard lock(m_mutex);
+
+        auto&& pIt = m_readbacks.find(key);
+        if (pIt == m_readbacks.end()) {
+            return 0;
+        }
+
+        Retire(false);
+
+        auto&& readback = pIt->second;
+
+        const ReadbackSlot* pLatest = nullptr;
+
+        for (auto&& slot : readback.slots) {
+            if (slot.isPending || slot.value == 0 || slot.value > m_completedValue) {
+                continue;
+            }
+
+            if (!pLatest || slot.ticket > pLatest->ticket) {
+                pLatest = &slot;
+            }
+        }
+
+        if (!pLatest) {
+            return 0;
+        }
+
+        vmaInvalidateAllocation(m_allocator, pLatest->allocation, 0, VK_WHOLE_SIZE);
+
+        data.resize(static_cast<size_t>(readback.width) * readback.height * readback.pixelSize);
+        std::memcpy(data.data(), pLatest->pData, data.size());
+
+        width = readback.width;
+        height = readback.height;
+
+        return pLatest->ticket;
+    }
+
+    void UploadManager::FreeReadback(uint64_t key) {
+        std::unique_lock lock(m_mutex);
+
+        if (auto&& pIt = m_readbacks.find(key); pIt != m_readbacks.end()) {
+            DestroyReadback(pIt->second, lock);
+            m_readbacks.erase(key);
+        }
+    }
+
+    void UploadManager::DestroyReadback(Readback& readback, std::unique_lock<std::recursive_mutex>& lock) {
+        auto&& isPending = [&readback]() {
+            return std::any_of(readback.slots.begin(), readback.slots.end(), [](const ReadbackSlot& slot) { return slot.isPending; });
+        };
+
+        if (m_current && isPending()) {
+            if (IsSubmitThread()) {
+                SubmitBatch();
+            }
+            else {
+                /// копирование отправит поток рендера на ближайшем кадре
+                m_condition.wait(lock, [&]() { return !m_current || !isPending(); });
+            }
+        }
+
+        uint64_t value = 0;
+
+        for (auto&& slot : readback.slots) {
+            value = SR_MAX(value, slot.value);
+        }
+
+        if (value > 0) {
+            Wait(value);
+        }
+
+        for (auto&& slot : readback.slots) {
+            vmaDestroyBuffer(m_allocator, slot.buffer, slot.allocation);
+        }
+
+        readback.slots.clear();
+        readback.next = 0;
+    }
+
+    void UploadManager::WaitBuffer(VkBuffer buffer) {
+        std::unique_lock lock(m_mutex);
+
+        auto&& hasBuffer = [buffer](const Batch& batch) {
+            return std::find(batch.destinations.begin(), batch.destinations.end(), buffer) != batch.destinations.end();
+        };
+
+        uint64_t value = 0;
+
+        if (m_current && hasBuffer(m_current.value())) {
+            if (IsSubmitThread()) {
+                value = SubmitBatch();
+            }
+            else {
+                /// копирования в буфер отправит поток рендера на ближайшем кадре
+                m_condition.wait(lock, [&]() { return !m_current || !hasBuffer(m_current.value()); });
+            }
+        }
+
+        for (auto&& batch : m_inFlight) {
+            if (hasBuffer(batch)) {
+                value = SR_MAX(value, batch.value);
+            }
+        }
+
+        if (value > 0) {
+            Wait(value);
+        }
+    }
+
+    void UploadManager::WaitImage(VkImage image) {
+        std::unique_lock lock(m_mutex);
+
+        auto&& hasImage = [image](const Batch& batch) {
+            return std::find(batch.images.begin(), batch.images.end(), image) != batch.images.end();
+        };
+
+        uint64_t value = 0;
+
+        if (m_current && hasImage(m_current.value())) {
+            if (IsSubmitThread()) {
+                value = SubmitBatch();
+            }
+            else {
+                /// копирования в изображение отправит поток рендера на ближайшем кадре
+                m_condition.wait(lock, [&]() { return !m_current || !hasImage(m_current.value()); });
+            }
+        }
+
+        for (auto&& batch : m_inFlight) {
+            if (hasImage(batch)) {
+                value = SR_MAX(value, batch.value);
+            }
+        }
+
+        if (value > 0) {
+            Wait(value);
+        }
+    }
+
+    void UploadManager::Wait(uint64_t value) {
+        std::lock_guard lock(m_mutex);
+
+        while (m_completedValue < value && !m_inFlight.empty()) {
+            auto&& batch = m_inFlight.front();
+            vkWaitForFences(m_device, 1, &batch.fence, VK_TRUE, UINT64_MAX);
+            Retire(false);
+        }
+    }
+
+    bool UploadManager::Reserve(uint64_t size, uint64_t& offset, std::unique_lock<std::recursive_mutex>& lock) {
+        const uint64_t alignedSize = (size + RING_ALIGNMENT - 1) & ~(RING_ALIGNMENT - 1);
+
+        for (;;) {
+            /// участок не может переходить через конец кольца, хвост пропускается
+            const uint64_t padding = m_head + alignedSize > RING_SIZE ? RING_SIZE - m_head : 0;
+
+            if (m_used + padding + alignedSize <= RING_SIZE) {
+                if (!m_current && !BeginBatch()) SR_UNLIKELY_ATTRIBUTE {
+                    return false;
+                }
+
+                if (padding > 0) {
+                    m_head = 0;
+                }
+
+                offset = m_head;
+
+                m_head += alignedSize;
+                m_used += padding + alignedSize;
+                m_current->ringBytes += padding + alignedSize;
+
+                return true;
+            }
+
+            /// в кольце нет места, отправить накопленное может только поток рендера, ждем его кадра
+            if (!IsSubmitThread()) {
+                m_condition.wait(lock);
+                Retire(false);
+                continue;
+            }
+
+            /// в кольце нет места, отправляем накопленное и ждем самую старую отправку
+            if (m_current) {
+                SubmitBatch();
+            }
+
+            if (m_inFlight.empty()) SR_UNLIKELY_ATTRIBUTE {
+                SRHalt("UploadManager::Reserve() : ring buffer is too small!");
+                return false;
+            }
+
+            Wait(m_inFlight.front().value);
+        }
+    }
+
+    bool UploadManager::BeginBatch() {
+        Batch batch;
+
+        if (!m_freeBatches.empty()) {
+            batch = std::move(m_freeBatches.back());
+            m_freeBatches.pop_back();
+        }
+        else {
+            VkCommandBufferAllocateInfo allocateInfo = { };
+            allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocateInfo.commandPool = m_commandPool;
+            allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocateInfo.commandBufferCount = 1;
+
+            VkFenceCreateInfo fenceInfo = { };
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+            if (vkAllocateCommandBuffers(m_device, &allocateInfo, &batch.cmd) != VK_SUCCESS || vkCreateFence(m_device, &fenceInfo, nullptr, &batch.fence) != VK_SUCCESS) {
+                SR_ERROR("UploadManager::BeginBatch() : failed to create upload batch!");
+                return false;
+            }
+        }
+
+        VkCommandBufferBeginInfo beginInfo = { };
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        vkResetCommandBuffer(batch.cmd, 0);
+
+        if (vkBeginCommandBuffer(batch.cmd, &beginInfo) != VK_SUCCESS) {
+            SR_ERROR("UploadManager::BeginBatch() : failed to begin command buffer!");
+            m_freeBatches.emplace_back(std::move(batch));
+            return false;
+        }
+
+        /// копирования не должны начаться, пока прошлые кадры читают те же буферы:
+        /// барьер ждет все команды, отправленные в очередь раньше
+        VkMemoryBarrier barrier = { };
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(batch.cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        batch.ringBytes = 0;
+        batch.destinations.clear();
+        batch.images.clear();
+        batch.readbacks.clear();
+
+        m_current = std::move(batch);
+
+        return true;
+    }
+
+    uint64_t UploadManager::SubmitBatch() {
+        SR_TRACY_ZONE;
+
+        auto&& batch = m_current.value();
+
+        /// копирования должны завершиться раньше чтения вершин, индексов и буферов в шейдерах
+        VkMemoryBarrier barrier = { };
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+
+        vkCmdPipelineBarrier(batch.cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+        vkEndCommandBuffer(batch.cmd);
+
+        VkSubmitInfo submitInfo = { };
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &batch.cmd;
+
+        vkResetFences(m_device, 1, &batch.fence);
+
+        if (auto&& result = vkQueueSubmit(m_queue, 1, &submitInfo, batch.fence); result != VK_SUCCESS) SR_UNLIKELY_ATTRIBUTE {
+            SR_ERROR("UploadManager::SubmitBatch() : failed to submit uploads! Reason: " + EvoVulkan::Tools::Convert::result_to_description(result));
+            /// без отправки ждать нечего, место в кольце возвращается сразу
+            m_used -= batch.ringBytes;
+            ResolveReadbacks(batch, 0);
+            m_freeBatches.emplace_back(std::move(batch));
+            m_current.reset();
+            return m_submittedValue;
+        }
+
+        batch.value = ++m_submittedValue;
+        ++m_submitsCount;
+
+        ResolveReadbacks(batch, batch.value);
+
+        m_inFlight.emplace_back(std::move(batch));
+        m_current.reset();
+        m_frameBytes = 0;
+
+        return m_submittedValue;
+    }
+
+    void UploadManager::ResolveReadbacks(const Batch& batch, uint64_t value) {
+        for (auto&& [key, index] : batch.readbacks) {
+            auto&& pIt = m_readbacks.find(key);
+            if (pIt == m_readbacks.end() || index >= pIt->second.slots.size()) SR_UNLIKELY_ATTRIBUTE {
+                continue;
+            }
+
+            /// при неудачной отправке копии нет, буфер снова свободен
+            auto&& slot = pIt->second.slots[index];
+            slot.isPending = false;
+            slot.value = value;
+        }
+    }
+
+    void UploadManager::Retire(bool wait) {
+        while (!m_inFlight.empty()) {
+            auto&& batch = m_inFlight.front();
+
+            if (wait) {
+                vkWaitForFences(m_device, 1, &batch.fence, VK_TRUE, UINT64_MAX);
+            }
+            else if (vkGetFenceStatus(m_device, batch.fence) != VK_SUCCESS) {
+                break;
+            }
+
+            /// отправки завершаются по порядку, поэтому место возвращается с хвоста кольца
+            m_used -= batch.ringBytes;
+            m_completedValue = batch.value;
+
+            m_freeBatches.emplace_back(std::move(batch));
+            m_inFlight.pop_front();
+        }
+
+        if (m_inFlight.empty() && !m_current) {
+            m_head = 0;
+            m_used = 0;
+        }
+    }
+}
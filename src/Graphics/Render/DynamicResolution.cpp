@@ -0,0 +1,90 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Render/DynamicResolution.h>
+
+namespace SR_GRAPH_NS {
+    void DynamicResolution::SetEnabled(bool enabled) {
+        if (m_enabled == enabled) {
+            return;
+        }
+
+        m_enabled = enabled;
+        m_scale = m_maxScale;
+        m_frameTime = 0.f;
+        m_cooldown = COOLDOWN_FRAMES;
+        m_cpuFrameTime = 0.f;
+        m_cpuWorkTime = 0.f;
+        m_workStart = std::nullopt;
+    }
+
+    void DynamicResolution::BeginCPUWork() noexcept {
+        if (m_enabled) {
+            m_workStart = Clock::now();
+        }
+    }
+
+    void DynamicResolution::EndCPUWork() noexcept {
+        if (!m_workStart) {
+            return;
+        }
+
+        m_cpuWorkTime += std::chrono::duration<float_t, std::milli>(Clock::now() - m_workStart.value()).count();
+        m_workStart = std::nullopt;
+    }
+
+    void DynamicResolution::SetBounds(float_t minScale, float_t maxScale) noexcept {
+        /// больше единицы нельзя: буферы выделены под полный размер и рисуется только их часть
+        m_maxScale = std::clamp(maxScale, SCALE_STEP, 1.f);
+        m_minScale = std::clamp(minScale, SCALE_STEP, m_maxScale);
+        m_scale = std::clamp(m_scale, m_minScale, m_maxScale);
+    }
+
+    bool DynamicResolution::Update() {
+        if (!m_enabled) {
+            return false;
+        }
+
+        /// работа прошлого кадра уже завершена, текущий кадр только начался
+        if (m_cpuWorkTime > 0.f) {
+            m_cpuFrameTime = m_cpuWorkTime;
+            m_cpuWorkTime = 0.f;
+        }
+
+        const float_t frameTime = SR_MAX(m_cpuFrameTime, m_gpuFrameTime);
+        if (frameTime <= 0.f) {
+            return false;
+        }
+
+        m_frameTime = m_frameTime <= 0.f ? frameTime : m_frameTime + (frameTime - m_frameTime) * SMOOTHING;
+
+        if (m_cooldown > 0) {
+            --m_cooldown;
+            return false;
+        }
+
+        float_t scale = m_scale;
+
+        if (m_frameTime > m_targetFrameTime * DOWNSCALE_THRESHOLD) {
+            /// время кадра примерно пропорционально площади, поэтому шаг по стороне берется из корня
+            const float_t desired = m_scale * std::sqrt(m_targetFrameTime / m_frameTime);
+            scale = SR_MIN(m_scale - SCALE_STEP, std::floor(desired / SCALE_STEP) * SCALE_STEP);
+        }
+        else if (m_frameTime < m_targetFrameTime * UPSCALE_THRESHOLD) {
+            /// повышаем осторожно, на одну ступень
+            scale = m_scale + SCALE_STEP;
+        }
+
+        scale = std::clamp(scale, m_minScale, m_maxScale);
+
+        if (std::abs(scale - m_scale) < SCALE_STEP * 0.5f) {
+            return false;
+        }
+
+        m_scale = scale;
+        m_cooldown = COOLDOWN_FRAMES;
+
+        return true;
+    }
+}
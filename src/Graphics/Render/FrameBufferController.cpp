@@ -4,6 +4,7 @@
 
 #include <Graphics/Render/FrameBufferController.h>
 #include <Graphics/Types/Framebuffer.h>
+#include <Graphics/Render/RenderContext.h>
 
 namespace SR_GRAPH_NS {
     FrameBufferController::FrameBufferController()
@@ -18,14 +19,75 @@ namespace SR_GRAPH_NS {
     }
 
     void FrameBufferController::OnResize(const SR_MATH_NS::UVector2& size) {
+        /// при перетаскивании края окна память пересоздается только при смене класса размера
         if (m_dynamicResizing && m_framebuffer) {
-            m_framebuffer->SetSize(SR_MATH_NS::IVector2(
+            m_framebuffer->SetContentSize(SR_MATH_NS::IVector2(
                     static_cast<int32_t>(static_cast<SR_MATH_NS::Unit>(size.x) * m_preScale.x),
                     static_cast<int32_t>(static_cast<SR_MATH_NS::Unit>(size.y) * m_preScale.y)
             ));
         }
     }
 
+    ImageFormat FrameBufferController::GetColorFormat(uint32_t index) const noexcept {
+        if (index >= m_colorFormats.size()) SR_UNLIKELY_ATTRIBUTE {
+            return ImageFormat::Unknown;
+        }
+
+        return *std::next(m_colorFormats.begin(), index);
+    }
+
+    void FrameBufferController::SetResolutionScale(float_t scale) {
+        if (!m_dynamicResolution) {
+            return;
+        }
+
+        m_resolutionScale = scale;
+
+        if (m_framebuffer) {
+            m_framebuffer->SetViewportScale(m_resolutionScale);
+        }
+    }
+
+    void FrameBufferController::SetPreScale(const SR_MATH_NS::FVector2& preScale) {
+        if (m_framebuffer) {
+            SR_WARN("FrameBufferController::SetPreScale() : framebuffer is already created, pre scale is ignored!");
+            return;
+        }
+
+        m_preScale = preScale;
+    }
+
+    bool FrameBufferController::IsAliasCompatible(const FrameBufferController& other) const noexcept {
+        auto&& features = m_features;
+        auto&& otherFeatures = other.m_features;
+
+        const bool sameFeatures =
+            features.depthLoad == otherFeatures.depthLoad &&
+            features.colorLoad == otherFeatures.colorLoad &&
+            features.depthTransferSrc == otherFeatures.depthTransferSrc &&
+            features.colorTransferSrc == otherFeatures.colorTransferSrc &&
+            features.depthTransferDst == otherFeatures.depthTransferDst &&
+            features.colorTransferDst == otherFeatures.colorTransferDst &&
+            features.depthShaderRead == otherFeatures.depthShaderRead &&
+            features.colorShaderRead == otherFeatures.colorShaderRead;
+
+        /// при загрузке содержимого вложений память должна пережить кадр, такие буферы не делятся
+        if (!sameFeatures || features.colorLoad || features.depthLoad) {
+            return false;
+        }
+
+        return m_dynamicResizing == other.m_dynamicResizing &&
+            m_dynamicResolution == other.m_dynamicResolution &&
+            m_depthEnabled == other.m_depthEnabled &&
+            m_preScale == other.m_preScale &&
+            m_size == other.m_size &&
+            m_colorFormats == other.m_colorFormats &&
+            m_samples == other.m_samples &&
+            m_layersCount == other.m_layersCount &&
+            m_depthFormat == other.m_depthFormat &&
+            m_depthAspect == other.m_depthAspect;
+    }
+
     bool FrameBufferController::InitializeFramebuffer(RenderContext* pContext) {
         /// fix zero size
         if (m_size.x == 0) {
@@ -44,13 +106,37 @@ namespace SR_GRAPH_NS {
 
         SRAssert(!m_framebuffer);
 
+        /// буфер отпущенной ранее техники с такими же вложениями
+        const uint64_t description = SR_GTYPES_NS::Framebuffer::HashDescription(
+            m_colorFormats, m_depthFormat, m_depthAspect, m_samples, m_layersCount, m_features, m_depthEnabled
+        );
+
+        if ((m_framebuffer = pContext->AcquireFramebuffer(description, size))) {
+            if (m_dynamicResizing) {
+                m_framebuffer->SetContentSize(size);
+            }
+            else if (m_framebuffer->GetSize() != size) {
+                m_framebuffer->SetSize(size);
+            }
+            m_framebuffer->SetViewportScale(m_dynamicResolution ? m_resolutionScale : 1.f);
+            m_framebuffer->AddUsePoint();
+            return true;
+        }
+
         /// initialize framebuffer
-        if ((m_framebuffer = SR_GTYPES_NS::Framebuffer::Create(m_colorFormats, m_depthFormat, size))) {
+        /// память буфера с изменяемым размером выделяется по классу, содержимое занимает ее часть
+        const SR_MATH_NS::IVector2 allocationSize = m_dynamicResizing ? Memory::FramebufferPool::GetSizeClass(size) : size;
+
+        if ((m_framebuffer = SR_GTYPES_NS::Framebuffer::Create(m_colorFormats, m_depthFormat, allocationSize))) {
+            if (m_dynamicResizing) {
+                m_framebuffer->SetContentSize(size);
+            }
             m_framebuffer->SetLayersCount(m_layersCount);
             m_framebuffer->SetSampleCount(m_samples);
             m_framebuffer->SetDepthEnabled(m_depthEnabled);
             m_framebuffer->SetDepthAspect(m_depthAspect);
             m_framebuffer->SetFeatures(m_features);
+            m_framebuffer->SetViewportScale(m_dynamicResolution ? m_resolutionScale : 1.f);
             m_framebuffer->AddUsePoint();
         }
         else {
@@ -69,6 +155,7 @@ namespace SR_GRAPH_NS {
     bool FrameBufferController::LoadFramebufferSettings(const SR_XML_NS::Node& settingsNode) {
         m_dynamicResizing = settingsNode.TryGetAttribute("DynamicResizing").ToBool(true);
         m_depthEnabled = settingsNode.TryGetAttribute("DepthEnabled").ToBool(true);
+        m_dynamicResolution = settingsNode.TryGetAttribute("DynamicResolution").ToBool(false);
         m_samples = settingsNode.TryGetAttribute("SmoothSamples").ToUInt(0);
         m_layersCount = SR_MAX(1, settingsNode.TryGetAttribute("Layers").ToUInt(1));
 
@@ -0,0 +1,234 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Render/FrameProfiler.h>
+
+namespace SR_GRAPH_NS {
+    FrameProfiler::Scope::Scope(FrameProfiler& profiler, SR_UTILS_NS::StringAtom name, std::vector<int32_t> frameBuffers)
+        : m_profiler(profiler)
+        , m_index(profiler.BeginScope(name, std::move(frameBuffers)))
+    { }
+
+    FrameProfiler::Scope::~Scope() {
+        m_profiler.EndScope(m_index);
+    }
+
+    void FrameProfiler::SetEnabled(bool enabled) {
+        if (m_enabled == enabled) {
+            return;
+        }
+
+        m_enabled = enabled;
+        m_captures.clear();
+        m_current = FrameCapture();
+        m_epoch = Clock::now();
+        m_depth = 0;
+        m_isFrameActive = false;
+    }
+
+    void FrameProfiler::BeginFrame() {
+        if (!m_enabled) {
+            return;
+        }
+
+        m_frameStart = Clock::now();
+
+        m_current = FrameCapture();
+        m_current.frame = m_frame++;
+        m_current.start = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(m_frameStart - m_epoch).count());
+
+        m_depth = 0;
+        m_isFrameActive = true;
+    }
+
+    void FrameProfiler::EndFrame(const Pipeline::GPUTimings& timings) {
+        if (!m_enabled || !m_isFrameActive) {
+            return;
+        }
+
+        m_isFrameActive = false;
+        m_current.cpuDuration = GetTime();
+
+        if (!timings.empty()) {
+            m_current.gpuTime = 0.f;
+
+            for (auto&& timing : timings) {
+                m_current.gpuTime += timing.milliseconds;
+
+                if (timing.frameBufferId == SR_ID_INVALID) {
+                    m_current.swapChainGPUTime = timing.milliseconds;
+                }
+            }
+
+            for (auto&& scope : m_current.scopes) {
+                for (auto&& frameBufferId : scope.frameBuffers) {
+                    for (auto&& timing : timings) {
+                        if (timing.frameBufferId != frameBufferId) {
+                            continue;
+                        }
+
+                        scope.gpuTime = SR_MAX(scope.gpuTime, 0.f) + timing.milliseconds;
+                    }
+                }
+            }
+        }
+
+        m_captures.emplace_back(std::move(m_current));
+        m_current = FrameCapture();
+
+        while (m_captures.size() > CAPTURES_COUNT) {
+            m_captures.pop_front();
+        }
+    }
+
+    int32_t FrameProfiler::BeginScope(SR_UTILS_NS::StringAtom name, std::vector<int32_t> frameBuffers) {
+        if (!m_enabled || !m_isFrameActive) {
+            return SR_ID_INVALID;
+        }
+
+        ProfilerScope scope;
+        scope.name = name;
+        scope.depth = m_depth++;
+        scope.cpuStart = GetTime();
+        scope.frameBuffers = std::move(frameBuffers);
+
+        m_current.scopes.emplace_back(std::move(scope));
+
+        return static_cast<int32_t>(m_current.scopes.size()) - 1;
+    }
+
+    void FrameProfiler::EndScope(int32_t index) {
+        if (index == SR_ID_INVALID || !m_isFrameActive || index >= static_cast<int32_t>(m_current.scopes.size())) {
+            return;
+        }
+
+        auto&& scope = m_current.scopes[index];
+        scope.cpuDuration = GetTime() - scope.cpuStart;
+
+        m_depth = scope.depth;
+    }
+
+    const FrameCapture* FrameProfiler::GetLastCapture() const noexcept {
+        return m_captures.empty() ? nullptr : &m_captures.back();
+    }
+
+    FrameProfiler::Statistics FrameProfiler::GetScopeStatistics(SR_UTILS_NS::StringAtom name) const {
+        Statistics statistics;
+
+        uint32_t gpuSamples = 0;
+        float_t gpuTotal = 0.f;
+        float_t cpuTotal = 0.f;
+
+        for (auto&& capture : m_captures) {
+            for (auto&& scope : capture.scopes) {
+                if (scope.name != name) {
+                    continue;
+                }
+
+                const float_t cpuTime = static_cast<float_t>(scope.cpuDuration) / 1000.f;
+
+                ++statistics.samples;
+                cpuTotal += cpuTime;
+                statistics.maxCPU = SR_MAX(statistics.maxCPU, cpuTime);
+
+                if (scope.gpuTime >= 0.f) {
+                    ++gpuSamples;
+                    gpuTotal += scope.gpuTime;
+                    statistics.maxGPU = SR_MAX(statistics.maxGPU, scope.gpuTime);
+                }
+            }
+        }
+
+        if (statistics.samples > 0) {
+            statistics.averageCPU = cpuTotal / static_cast<float_t>(statistics.samples);
+        }
+
+        if (gpuSamples > 0) {
+            statistics.averageGPU = gpuTotal / static_cast<float_t>(gpuSamples);
+        }
+
+        return statistics;
+    }
+
+    std::string FrameProfiler::ToChromeTrace() const {
+        auto&& escape = [](const std::string& str) {
+            std::string result;
+            result.reserve(str.size());
+
+            for (const char c : str) {
+                if (c == '"' || c == '\\') {
+                    result += '\\';
+                }
+                else if (static_cast<unsigned char>(c) < 0x20) {
+                    continue;
+                }
+                result += c;
+            }
+
+            return result;
+        };
+
+        /// tid 1 - CPU, tid 2 - GPU. Порядок выполнения буферов на GPU неизвестен, поэтому они идут друг за другом
+        auto&& event = [&escape](const std::string& name, uint32_t tid, uint64_t ts, uint64_t dur, uint64_t frame) {
+            return "{\"name\":\"" + escape(name) + "\",\"cat\":\"" + (tid == 1 ? "CPU" : "GPU") +
+                "\",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(tid) +
+                ",\"ts\":" + std::to_string(ts) + ",\"dur\":" + std::to_string(dur) +
+                ",\"args\":{\"frame\":" + std::to_string(frame) + "}}";
+        };
+
+        std::vector<std::string> events;
+
+        for (auto&& capture : m_captures) {
+            events.emplace_back(event("Frame " + std::to_string(capture.frame), 1, capture.start, capture.cpuDuration, capture.frame));
+
+            uint64_t gpuCursor = capture.start;
+
+            for (auto&& scope : capture.scopes) {
+                events.emplace_back(event(scope.name.ToStringRef(), 1, capture.start + scope.cpuStart, scope.cpuDuration, capture.frame));
+
+                if (scope.gpuTime >= 0.f) {
+                    const auto duration = static_cast<uint64_t>(scope.gpuTime * 1000.f);
+                    events.emplace_back(event(scope.name.ToStringRef(), 2, gpuCursor, duration, capture.frame));
+                    gpuCursor += duration;
+                }
+            }
+
+            if (capture.swapChainGPUTime >= 0.f) {
+                const auto duration = static_cast<uint64_t>(capture.swapChainGPUTime * 1000.f);
+                events.emplace_back(event("SwapChain", 2, gpuCursor, duration, capture.frame));
+            }
+        }
+
+        std::string trace = "{\"traceEvents\":[\n";
+
+        for (uint64_t i = 0; i < events.size(); ++i) {
+            trace += events[i];
+            trace += i + 1 < events.size() ? ",\n" : "\n";
+        }
+
+        trace += "],\"displayTimeUnit\":\"ms\"}\n";
+
+        return trace;
+    }
+
+    bool FrameProfiler::ExportChromeTrace(const SR_UTILS_NS::Path& path) const {
+        SR_TRACY_ZONE;
+
+        if (m_captures.empty()) {
+            SR_WARN("FrameProfiler::ExportChromeTrace() : there are no captured frames!");
+            return false;
+        }
+
+        if (!path.Create() || !SR_UTILS_NS::FileSystem::WriteToFile(path, ToChromeTrace())) {
+            SR_ERROR("FrameProfiler::ExportChromeTrace() : failed to write file!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        return true;
+    }
+
+    uint64_t FrameProfiler::GetTime() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_frameStart).count());
+    }
+}
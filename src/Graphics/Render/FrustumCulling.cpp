@@ -2,4 +2,72 @@
 // Created by Monika on 07.04.2024.
 //
 
-#include <Graphics/Render/FrustumCulling.h>
\ No newline at end of file
+#include <Graphics/Render/FrustumCulling.h>
+
+namespace SR_GRAPH_NS {
+    void FrustumCulling::UpdateFrustum(const SR_MATH_NS::Matrix4x4& viewProjection) noexcept {
+        auto&& inverse = viewProjection.Inverse();
+
+        /// углы среза на середине глубины и на дальней плоскости, по кругу с левого нижнего
+        SR_MATH_NS::FVector3 corners[8] = {
+            SR_MATH_NS::FVector3(-1.f, -1.f, 0.5f),
+            SR_MATH_NS::FVector3( 1.f, -1.f, 0.5f),
+            SR_MATH_NS::FVector3( 1.f,  1.f, 0.5f),
+            SR_MATH_NS::FVector3(-1.f,  1.f, 0.5f),
+            SR_MATH_NS::FVector3(-1.f, -1.f, 1.f),
+            SR_MATH_NS::FVector3( 1.f, -1.f, 1.f),
+            SR_MATH_NS::FVector3( 1.f,  1.f, 1.f),
+            SR_MATH_NS::FVector3(-1.f,  1.f, 1.f),
+        };
+
+        auto&& inside = SR_MATH_NS::FVector3(0.f);
+
+        for (auto&& corner : corners) {
+            SR_MATH_NS::FVector4 worldCorner = inverse * SR_MATH_NS::FVector4(corner, 1.f);
+            if (std::abs(worldCorner.w) <= SR_FLT_EPSILON) SR_UNLIKELY_ATTRIBUTE {
+                m_isValid = false;
+                return;
+            }
+            corner = (worldCorner / worldCorner.w).XYZ();
+            inside += corner;
+        }
+
+        inside /= 8.f;
+
+        m_frustum.bottomFace = BuildPlane(corners[0], corners[1], corners[4], inside);
+        m_frustum.rightFace = BuildPlane(corners[1], corners[2], corners[5], inside);
+        m_frustum.topFace = BuildPlane(corners[2], corners[3], corners[6], inside);
+        m_frustum.leftFace = BuildPlane(corners[3], corners[0], corners[7], inside);
+        m_frustum.farFace = BuildPlane(corners[4], corners[5], corners[6], inside);
+
+        m_isValid = true;
+    }
+
+    bool FrustumCulling::IsSphereInFrustum(const SR_MATH_NS::FVector3& center, float_t radius) const noexcept {
+        if (!m_isValid) SR_UNLIKELY_ATTRIBUTE {
+            return true;
+        }
+
+        for (auto&& pPlane : { &m_frustum.bottomFace, &m_frustum.rightFace, &m_frustum.topFace, &m_frustum.leftFace, &m_frustum.farFace }) {
+            if (pPlane->normal.Dot(center) + pPlane->distance < -radius) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    FrustumPlane FrustumCulling::BuildPlane(const SR_MATH_NS::FVector3& a, const SR_MATH_NS::FVector3& b, const SR_MATH_NS::FVector3& c, const SR_MATH_NS::FVector3& inside) noexcept {
+        FrustumPlane plane;
+
+        plane.normal = (b - a).Cross(c - a).Normalize();
+        plane.distance = -plane.normal.Dot(a);
+
+        if (plane.normal.Dot(inside) + plane.distance < 0.f) {
+            plane.normal = -plane.normal;
+            plane.distance = -plane.distance;
+        }
+
+        return plane;
+    }
+}
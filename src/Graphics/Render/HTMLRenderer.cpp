@@ -430,7 +430,7 @@ namespace SR_GRAPH_NS {
                 return;
             }
 
-            memInfo.virtualDescriptor = m_descriptorManager.AllocateDescriptorSet(SR_ID_INVALID);
+            memInfo.virtualDescriptor = m_descriptorManager.AllocateDescriptorSet(SR_ID_INVALID, true);
             if (memInfo.virtualDescriptor == SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
                 SR_ERROR("HTMLRenderContainer::DrawElement() : failed to allocate descriptor set!");
                 return;
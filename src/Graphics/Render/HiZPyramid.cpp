@@ -0,0 +1,128 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Render/HiZPyramid.h>
+
+namespace SR_GRAPH_NS {
+    void HiZPyramid::Build(std::vector<float_t>&& depth, uint32_t width, uint32_t height, const SR_MATH_NS::Matrix4x4& viewProjection) {
+        SR_TRACY_ZONE;
+
+        m_levels.clear();
+
+        if (width == 0 || height == 0 || depth.size() != static_cast<size_t>(width) * height) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        m_viewProjection = viewProjection;
+
+        Level base;
+        base.width = width;
+        base.height = height;
+        base.depth = std::move(depth);
+        m_levels.emplace_back(std::move(base));
+
+        while (m_levels.back().width > 1 || m_levels.back().height > 1) {
+            const Level& previous = m_levels.back();
+
+            Level level;
+            level.width = SR_MAX(1u, (previous.width + 1) / 2);
+            level.height = SR_MAX(1u, (previous.height + 1) / 2);
+            level.depth.resize(static_cast<size_t>(level.width) * level.height);
+
+            for (uint32_t y = 0; y < level.height; ++y) {
+                /// у нечетной стороны последний тексель не имеет пары и берется дважды
+                const uint32_t y0 = SR_MIN(y * 2, previous.height - 1);
+                const uint32_t y1 = SR_MIN(y * 2 + 1, previous.height - 1);
+
+                for (uint32_t x = 0; x < level.width; ++x) {
+                    const uint32_t x0 = SR_MIN(x * 2, previous.width - 1);
+                    const uint32_t x1 = SR_MIN(x * 2 + 1, previous.width - 1);
+
+                    level.depth[y * level.width + x] = SR_MAX(
+                        SR_MAX(previous.depth[y0 * previous.width + x0], previous.depth[y0 * previous.width + x1]),
+                        SR_MAX(previous.depth[y1 * previous.width + x0], previous.depth[y1 * previous.width + x1])
+                    );
+                }
+            }
+
+            m_levels.emplace_back(std::move(level));
+        }
+    }
+
+    void HiZPyramid::Clear() {
+        m_levels.clear();
+    }
+
+    bool HiZPyramid::IsSphereOccluded(const SR_MATH_NS::FVector3& center, float_t radius) const {
+        if (!IsValid() || radius <= 0.f) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        float_t minX = 1.f, minY = 1.f, maxX = -1.f, maxY = -1.f;
+        float_t nearestDepth = 1.f;
+
+        /// углы описанного куба, их проекция покрывает проекцию сферы
+        for (uint8_t i = 0; i < 8; ++i) {
+            const SR_MATH_NS::FVector4 corner(
+                center.x + ((i & 1) ? radius : -radius),
+                center.y + ((i & 2) ? radius : -radius),
+                center.z + ((i & 4) ? radius : -radius),
+                1.f
+            );
+
+            const SR_MATH_NS::FVector4 clip = m_viewProjection * corner;
+
+            /// объект пересекает ближнюю плоскость, его нельзя спроецировать
+            if (clip.w <= SR_FLT_EPSILON) {
+                return false;
+            }
+
+            const float_t x = clip.x / clip.w;
+            const float_t y = clip.y / clip.w;
+
+            minX = SR_MIN(minX, x);
+            minY = SR_MIN(minY, y);
+            maxX = SR_MAX(maxX, x);
+            maxY = SR_MAX(maxY, y);
+            nearestDepth = SR_MIN(nearestDepth, clip.z / clip.w);
+        }
+
+        /// вне экрана прошлого кадра глубины нет, такие объекты отсекает пирамида камеры
+        if (nearestDepth <= 0.f || maxX < -1.f || maxY < -1.f || minX > 1.f || minY > 1.f) {
+            return false;
+        }
+
+        const Level& base = m_levels.front();
+
+        /// прямоугольник в текселях нижнего уровня, расширенный на тексель:
+        /// буфер глубины растеризован в низком разрешении и может не покрыть край перекрывающего объекта
+        const float_t x0 = SR_MAX(0.f, (minX * 0.5f + 0.5f) * static_cast<float_t>(base.width) - 1.f);
+        const float_t y0 = SR_MAX(0.f, (minY * 0.5f + 0.5f) * static_cast<float_t>(base.height) - 1.f);
+        const float_t x1 = SR_MIN(static_cast<float_t>(base.width), (maxX * 0.5f + 0.5f) * static_cast<float_t>(base.width) + 1.f);
+        const float_t y1 = SR_MIN(static_cast<float_t>(base.height), (maxY * 0.5f + 0.5f) * static_cast<float_t>(base.height) + 1.f);
+
+        /// уровень, на котором прямоугольник занимает не больше 2x2 текселей
+        const float_t extent = SR_MAX(x1 - x0, y1 - y0);
+        uint32_t levelIndex = extent <= 1.f ? 0 : static_cast<uint32_t>(std::ceil(std::log2(extent)));
+        levelIndex = SR_MIN(levelIndex, static_cast<uint32_t>(m_levels.size()) - 1);
+
+        const Level& level = m_levels[levelIndex];
+        const float_t texelSize = static_cast<float_t>(1u << levelIndex);
+
+        const uint32_t ix0 = SR_MIN(static_cast<uint32_t>(x0 / texelSize), level.width - 1);
+        const uint32_t iy0 = SR_MIN(static_cast<uint32_t>(y0 / texelSize), level.height - 1);
+        const uint32_t ix1 = SR_MIN(static_cast<uint32_t>(SR_MAX(0.f, x1 - 1.f) / texelSize), level.width - 1);
+        const uint32_t iy1 = SR_MIN(static_cast<uint32_t>(SR_MAX(0.f, y1 - 1.f) / texelSize), level.height - 1);
+
+        float_t farthestDepth = 0.f;
+
+        for (uint32_t y = iy0; y <= iy1; ++y) {
+            for (uint32_t x = ix0; x <= ix1; ++x) {
+                farthestDepth = SR_MAX(farthestDepth, level.depth[y * level.width + x]);
+            }
+        }
+
+        return nearestDepth > farthestDepth + DEPTH_BIAS;
+    }
+}
@@ -8,6 +8,8 @@
 #include <Graphics/Render/RenderContext.h>
 #include <Graphics/Pass/GroupPass.h>
 #include <Graphics/Pass/IColorBufferPass.h>
+#include <Graphics/Pass/MeshDrawerPass.h>
+#include <Graphics/Render/RenderQueue.h>
 
 namespace SR_GRAPH_NS {
     IRenderTechnique::IRenderTechnique()
@@ -56,6 +58,8 @@ namespace SR_GRAPH_NS {
             return;
         }
 
+        FrameProfiler::Scope scope(m_context->GetFrameProfiler(), GetName());
+
         GroupPass::Update();
     }
 
@@ -176,6 +180,30 @@ namespace SR_GRAPH_NS {
         GroupPass::OnMultisampleChanged();
     }
 
+    void IRenderTechnique::SetResolutionScale(float_t scale) {
+        for (auto&& [name, pController] : m_frameBufferControllers) {
+            pController->SetResolutionScale(scale);
+        }
+    }
+
+    bool IRenderTechnique::HasVisibleChanges() const {
+        bool hasChanges = false;
+
+        ForEachPass([&hasChanges](BasePass* pPass) -> bool {
+            if (auto&& pMeshDrawerPass = dynamic_cast<MeshDrawerPass*>(pPass)) {
+                for (auto&& pRenderQueue : pMeshDrawerPass->GetRenderQueues()) {
+                    if (pRenderQueue->HasVisibleChanges()) {
+                        hasChanges = true;
+                        return false;
+                    }
+                }
+            }
+            return true;
+        });
+
+        return hasChanges;
+    }
+
     IRenderTechnique::FrameBufferControllerPtr IRenderTechnique::GetFrameBufferController(SR_UTILS_NS::StringAtom name) const {
         auto&& pIt = m_frameBufferControllers.find(name);
         if (pIt != m_frameBufferControllers.end()) {
@@ -186,7 +214,11 @@ namespace SR_GRAPH_NS {
     }
 
     bool IRenderTechnique::Init() {
+        const float_t resolutionScale = GetRenderContext()->GetDynamicResolution().GetScale();
+
         for (auto&& [name, pController] : m_frameBufferControllers) {
+            pController->SetResolutionScale(resolutionScale);
+
             if (!pController->InitializeFramebuffer(GetRenderContext())) {
                 SR_ERROR("RenderTechnique::Init() : failed to initialize \"" + name.ToStringRef() + "\" framebuffer controller!");
             }
@@ -199,10 +231,15 @@ namespace SR_GRAPH_NS {
             }
         }
 
+        /// проходы инициализированы, их кадровые буферы известны
+        m_renderGraph.Build(this);
+
         return true;
     }
 
     void IRenderTechnique::ReleaseFrameBufferControllers() {
+        m_renderGraph.Clear();
+
         for (auto&& [name, pController] : m_frameBufferControllers) {
             pController.AutoFree();
         }
@@ -0,0 +1,161 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Render/OffScreenCameraScheduler.h>
+#include <Graphics/Render/IRenderTechnique.h>
+#include <Graphics/Types/Camera.h>
+
+namespace SR_GRAPH_NS {
+    bool OffScreenCameraScheduler::Schedule(const std::vector<CameraPtr>& cameras, bool all) {
+        SR_TRACY_ZONE;
+
+        ++m_frame;
+
+        bool changed = false;
+
+        std::vector<CameraState*> budgetCameras;
+
+        for (auto&& pCamera : cameras) {
+            if (!pCamera) {
+                continue;
+            }
+
+            auto&& pTechnique = pCamera->GetRenderTechnique();
+            if (!pTechnique) {
+                continue;
+            }
+
+            auto&& [pIt, isInserted] = m_cameras.try_emplace(pCamera.Get());
+            auto&& state = pIt->second;
+
+            state.aliveFrame = m_frame;
+
+            /// камера сравнивается всегда, чтобы после полной перестройки не сработать на старом положении
+            const bool isCameraChanged = IsCameraChanged(pCamera.Get(), state);
+
+            if (all || isInserted) {
+                state.trailing = false;
+                Apply(state, true, changed);
+                continue;
+            }
+
+            auto&& policy = pTechnique->GetUpdatePolicy();
+
+            switch (policy.mode) {
+                case CameraUpdateMode::Interval:
+                    Apply(state, m_frame - state.lastFrame >= SR_MAX(policy.interval, 1u), changed);
+                    break;
+                case CameraUpdateMode::OnChange: {
+                    const bool isVisibleChanged = isCameraChanged || pTechnique->HasVisibleChanges();
+                    Apply(state, isVisibleChanged || state.trailing, changed);
+                    state.trailing = isVisibleChanged;
+                    break;
+                }
+                case CameraUpdateMode::Budget:
+                    budgetCameras.emplace_back(&state);
+                    break;
+                case CameraUpdateMode::EveryFrame:
+                default:
+                    Apply(state, true, changed);
+                    break;
+            }
+        }
+
+        if (!budgetCameras.empty()) {
+            const uint64_t count = budgetCameras.size();
+            float_t spent = 0.f;
+            uint64_t scheduled = 0;
+
+            for (uint64_t i = 0; i < count; ++i) {
+                auto&& state = *budgetCameras[(m_budgetCursor + i) % count];
+                const float_t cost = state.statistics.updateTime;
+
+                /// первая по очереди камера обновляется всегда, иначе дорогая камера не обновится никогда
+                const bool isAllowed = scheduled == 0 || spent + cost <= m_budget;
+                if (isAllowed) {
+                    spent += cost;
+                    ++scheduled;
+                }
+
+                Apply(state, isAllowed, changed);
+            }
+
+            m_budgetCursor = (m_budgetCursor + scheduled) % count;
+        }
+
+        for (auto pIt = m_cameras.begin(); pIt != m_cameras.end(); ) {
+            if (pIt->second.aliveFrame != m_frame) {
+                pIt = m_cameras.erase(pIt);
+            }
+            else {
+                ++pIt;
+            }
+        }
+
+        return changed;
+    }
+
+    void OffScreenCameraScheduler::OnUpdated(const SR_GTYPES_NS::Camera* pCamera, float_t milliseconds) {
+        auto&& pIt = m_cameras.find(pCamera);
+        if (pIt == m_cameras.end()) {
+            return;
+        }
+
+        auto&& updateTime = pIt->second.statistics.updateTime;
+        updateTime = updateTime <= 0.f ? milliseconds : updateTime + (milliseconds - updateTime) * SMOOTHING;
+    }
+
+    bool OffScreenCameraScheduler::IsScheduled(const SR_GTYPES_NS::Camera* pCamera) const {
+        /// неизвестные планировщику камеры, например главная, обновляются каждый кадр
+        auto&& pIt = m_cameras.find(pCamera);
+        return pIt == m_cameras.end() || pIt->second.scheduled;
+    }
+
+    std::map<const SR_GTYPES_NS::Camera*, OffScreenCameraScheduler::Statistics> OffScreenCameraScheduler::GetStatistics() const {
+        std::map<const SR_GTYPES_NS::Camera*, Statistics> statistics;
+
+        for (auto&& [pCamera, state] : m_cameras) {
+            statistics.emplace(pCamera, state.statistics);
+        }
+
+        return statistics;
+    }
+
+    bool OffScreenCameraScheduler::IsCameraChanged(const SR_GTYPES_NS::Camera* pCamera, CameraState& state) const {
+        if (state.position != pCamera->GetPosition()) {
+            goto changed;
+        }
+
+        if (state.rotation != pCamera->GetRotation()) {
+            goto changed;
+        }
+
+        if (state.size != pCamera->GetSize()) {
+            goto changed;
+        }
+
+        return false;
+
+    changed:
+
+        state.position = pCamera->GetPosition();
+        state.rotation = pCamera->GetRotation();
+        state.size = pCamera->GetSize();
+
+        return true;
+    }
+
+    void OffScreenCameraScheduler::Apply(CameraState& state, bool scheduled, bool& changed) const {
+        changed |= state.scheduled != scheduled;
+        state.scheduled = scheduled;
+
+        if (scheduled) {
+            state.lastFrame = m_frame;
+            ++state.statistics.rendered;
+        }
+        else {
+            ++state.statistics.skipped;
+        }
+    }
+}
@@ -9,6 +9,11 @@
 #include <Graphics/Window/Window.h>
 #include <Graphics/Memory/ShaderProgramManager.h>
 #include <Graphics/Memory/DescriptorManager.h>
+#include <Graphics/Memory/BindlessTextureTable.h>
+#include <Graphics/Memory/TextureStreamer.h>
+#include <Graphics/Memory/GeometryPool.h>
+#include <Graphics/Utils/MeshOptimizer.h>
+#include <Graphics/Utils/MeshCache.h>
 #include <Graphics/Memory/UBOManager.h>
 #include <Graphics/Memory/SSBOManager.h>
 #include <Graphics/Pipeline/Vulkan/VulkanPipeline.h>
@@ -37,21 +42,40 @@ namespace SR_GRAPH_NS {
 
         bool dirty = false;
 
-        m_updateState = static_cast<RCUpdateQueueState>(static_cast<uint8_t>(m_updateState) + 1);
-
-        switch (m_updateState) {
-            case RCUpdateQueueState::Framebuffers: dirty |= Update(m_framebuffers); break;
-            case RCUpdateQueueState::Shaders: dirty |= Update(m_shaders); break;
-            case RCUpdateQueueState::Textures: dirty |= Update(m_textures); break;
-            case RCUpdateQueueState::Techniques: dirty |= Update(m_techniques); break;
-            case RCUpdateQueueState::Materials: dirty |= Update(m_materials); break;
-            case RCUpdateQueueState::Skyboxes: dirty |= Update(m_skyboxes); break;
-            case RCUpdateQueueState::End:
-                m_updateState = RCUpdateQueueState::Begin;
-                break;
-            default:
-                SRHaltOnce0();
-                break;
+        /// при закрытии контекста ресурсы освобождаются без ожидания кадров, в том числе те, что не попали в очередь
+        if (m_isClosed) {
+            ScheduleAllResources();
+        }
+
+        for (auto&& [pResource, type] : m_releaseQueue.TakeScheduled()) {
+            switch (type) {
+                case RCResourceType::Framebuffer: dirty |= Retire(m_framebuffers, static_cast<FramebufferPtr>(pResource), type); break;
+                case RCResourceType::Shader: dirty |= Retire(m_shaders, static_cast<ShaderPtr>(pResource), type); break;
+                case RCResourceType::Texture: dirty |= Retire(m_textures, static_cast<TexturePtr>(pResource), type); break;
+                case RCResourceType::Technique: dirty |= Retire(m_techniques, static_cast<IRenderTechnique*>(pResource), type); break;
+                case RCResourceType::Material: dirty |= Retire(m_materials, static_cast<MaterialPtr>(pResource), type); break;
+                case RCResourceType::Skybox: dirty |= Retire(m_skyboxes, static_cast<SkyboxPtr>(pResource), type); break;
+                default:
+                    SRHaltOnce0();
+                    break;
+            }
+        }
+
+        const uint32_t framesInFlight = m_isClosed ? 0 : static_cast<uint32_t>(m_pipeline->GetBuildIterationsCount()) + 1;
+
+        /// освобожденные ресурсы могли отпустить свои зависимости, поэтому при закрытии обновление повторяется
+        bool released = m_releaseQueue.Release(framesInFlight, [this](const Memory::ResourceReleaseQueue::Entry& entry) -> bool {
+            return ReleaseResource(entry);
+        }) > 0;
+
+        for (auto&& pFramebuffer : m_framebufferPool.Trim(m_releaseQueue.GetFrame(), m_isClosed)) {
+            pFramebuffer->Execute([pFramebuffer]() -> bool {
+                pFramebuffer->FreeVideoMemory();
+                pFramebuffer->DeInitGraphicsResource();
+                pFramebuffer->RemoveUsePoint();
+                return true;
+            });
+            released = true;
         }
 
         for (auto pIt = std::begin(m_scenes); pIt != std::end(m_scenes); ) {
@@ -78,7 +102,9 @@ namespace SR_GRAPH_NS {
 
             pRenderScene->DeInit();
 
-            Update(m_techniques);
+            for (auto&& pTechnique : m_techniques) {
+                ScheduleRelease(pTechnique);
+            }
 
             /// Как только уничтожается основная сцена, уничтожаем сцену рендера
             SR_LOG("RenderContext::Update() : destroy render scene...");
@@ -86,7 +112,7 @@ namespace SR_GRAPH_NS {
             pIt = m_scenes.erase(pIt);
         }
 
-        return dirty;
+        return dirty || released;
     }
 
     bool RenderContext::Init() {
@@ -108,12 +134,31 @@ namespace SR_GRAPH_NS {
             return false;
         }
 
+        auto&& memoryBudget = m_pipeline->GetMemoryBudget();
+
+        memoryBudget.SetSoftCallback([this](Memory::MemoryHeap, const Memory::MemoryBudget::HeapInfo&) {
+            GarbageCollect();
+        });
+
+        memoryBudget.SetHardCallback([this](Memory::MemoryHeap, const Memory::MemoryBudget::HeapInfo&) {
+            GarbageCollect();
+            Defragment();
+        });
+
+        m_defragmentationThreshold = SR_UTILS_NS::Features::Instance().Enabled("VideoMemoryDefragmentation", true) ? 0.3f : 1.f;
+
+        m_dynamicResolution.SetEnabled(SR_UTILS_NS::Features::Instance().Enabled("DynamicResolution", false));
+
+        SetProfilerEnabled(SR_UTILS_NS::Features::Instance().Enabled("FrameProfiler", false));
+
         Memory::UBOManager::Instance().SetPipeline(m_pipeline);
         Memory::CameraManager::Instance().SetPipeline(m_pipeline);
         Memory::ShaderProgramManager::Instance().SetPipeline(m_pipeline);
 
         SR_GRAPH_NS::SSBOManager::Instance().SetPipeline(m_pipeline);
         SR_GRAPH_NS::DescriptorManager::Instance().SetPipeline(m_pipeline);
+        SR_GRAPH_NS::TextureStreamer::Instance().Start(m_pipeline);
+        SR_GRAPH_NS::GeometryPool::Instance().SetPipeline(m_pipeline);
 
         /// ----------------------------------------------------------------------------
 
@@ -155,6 +200,8 @@ namespace SR_GRAPH_NS {
         SRAssert2(!m_isClosed, "Render context is already closed!");
         m_isClosed = true;
 
+        SR_GRAPH_NS::TextureStreamer::Instance().Stop();
+
         if (m_noneTexture) {
             m_noneTexture->RemoveUsePoint();
             m_noneTexture = nullptr;
@@ -246,6 +293,7 @@ namespace SR_GRAPH_NS {
             return;
         }
         m_framebuffers.emplace_back(pResource);
+        ScheduleRelease(pResource);
     }
 
     void RenderContext::Register(SR_GTYPES_NS::Shader *pResource) {
@@ -253,6 +301,7 @@ namespace SR_GRAPH_NS {
             return;
         }
         m_shaders.emplace_back(pResource);
+        ScheduleRelease(pResource);
     }
 
     void RenderContext::Register(SR_GTYPES_NS::Texture* pResource) {
@@ -260,6 +309,7 @@ namespace SR_GRAPH_NS {
             return;
         }
         m_textures.emplace_back(pResource);
+        ScheduleRelease(pResource);
     }
 
     void RenderContext::Register(IRenderTechnique* pResource) {
@@ -267,6 +317,7 @@ namespace SR_GRAPH_NS {
             return;
         }
         m_techniques.emplace_back(pResource);
+        ScheduleRelease(pResource);
     }
 
     void RenderContext::Register(RenderContext::MaterialPtr pResource) {
@@ -274,6 +325,7 @@ namespace SR_GRAPH_NS {
             return;
         }
         m_materials.emplace_back(pResource);
+        ScheduleRelease(pResource);
     }
 
     void RenderContext::Register(RenderContext::SkyboxPtr pResource) {
@@ -281,6 +333,85 @@ namespace SR_GRAPH_NS {
             return;
         }
         m_skyboxes.emplace_back(pResource);
+        ScheduleRelease(pResource);
+    }
+
+    void RenderContext::ScheduleRelease(SR_GTYPES_NS::Framebuffer* pResource) {
+        m_releaseQueue.Schedule(pResource, RCResourceType::Framebuffer);
+    }
+
+    void RenderContext::ScheduleRelease(SR_GTYPES_NS::Shader* pResource) {
+        m_releaseQueue.Schedule(pResource, RCResourceType::Shader);
+    }
+
+    void RenderContext::ScheduleRelease(SR_GTYPES_NS::Texture* pResource) {
+        m_releaseQueue.Schedule(pResource, RCResourceType::Texture);
+    }
+
+    void RenderContext::ScheduleRelease(IRenderTechnique* pResource) {
+        m_releaseQueue.Schedule(pResource, RCResourceType::Technique);
+    }
+
+    void RenderContext::ScheduleRelease(RenderContext::MaterialPtr pResource) {
+        m_releaseQueue.Schedule(pResource, RCResourceType::Material);
+    }
+
+    void RenderContext::ScheduleRelease(RenderContext::SkyboxPtr pResource) {
+        m_releaseQueue.Schedule(pResource, RCResourceType::Skybox);
+    }
+
+    void RenderContext::ScheduleAllResources() {
+        for (auto&& pResource : m_framebuffers) { ScheduleRelease(pResource); }
+        for (auto&& pResource : m_shaders) { ScheduleRelease(pResource); }
+        for (auto&& pResource : m_textures) { ScheduleRelease(pResource); }
+        for (auto&& pResource : m_techniques) { ScheduleRelease(pResource); }
+        for (auto&& pResource : m_materials) { ScheduleRelease(pResource); }
+        for (auto&& pResource : m_skyboxes) { ScheduleRelease(pResource); }
+    }
+
+    bool RenderContext::ReleaseResource(const Memory::ResourceReleaseQueue::Entry& entry) {
+        auto&& pResource = entry.pResource;
+
+        return pResource->Execute([&]() -> bool {
+            /// ресурс снова начали использовать, пока он ждал освобождения
+            if (pResource->GetCountUses() != 1) {
+                ReviveResource(entry);
+                return false;
+            }
+
+            /// кадровый буфер с памятью откладывается, его может запросить контроллер с тем же описанием
+            if (entry.type == RCResourceType::Framebuffer && !m_isClosed) {
+                if (m_framebufferPool.Put(static_cast<FramebufferPtr>(entry.pRenderResource), m_releaseQueue.GetFrame())) {
+                    return true;
+                }
+            }
+
+            /// Ресурс необязательно имеет видеопамять, а лишь содержит другие ресурсы, например материал.
+            if (entry.pGraphicsResource) {
+                entry.pGraphicsResource->FreeVideoMemory();
+                entry.pGraphicsResource->DeInitGraphicsResource();
+            }
+
+            pResource->RemoveUsePoint();
+
+            return true;
+        });
+    }
+
+    void RenderContext::ReviveResource(const Memory::ResourceReleaseQueue::Entry& entry) {
+        switch (entry.type) {
+            case RCResourceType::Framebuffer: m_framebuffers.emplace_back(static_cast<FramebufferPtr>(entry.pRenderResource)); break;
+            case RCResourceType::Shader: m_shaders.emplace_back(static_cast<ShaderPtr>(entry.pRenderResource)); break;
+            case RCResourceType::Texture: m_textures.emplace_back(static_cast<TexturePtr>(entry.pRenderResource)); break;
+            case RCResourceType::Technique: m_techniques.emplace_back(static_cast<IRenderTechnique*>(entry.pRenderResource)); break;
+            case RCResourceType::Material: m_materials.emplace_back(static_cast<MaterialPtr>(entry.pRenderResource)); break;
+            case RCResourceType::Skybox: m_skyboxes.emplace_back(static_cast<SkyboxPtr>(entry.pRenderResource)); break;
+            default:
+                SRHaltOnce0();
+                break;
+        }
+
+        SetDirty();
     }
 
     bool RenderContext::IsEmpty() const {
@@ -295,7 +426,25 @@ namespace SR_GRAPH_NS {
             m_materials.empty() &&
             m_skyboxes.empty() &&
             m_scenes.empty() &&
-            m_techniques.empty();
+            m_techniques.empty() &&
+            m_releaseQueue.IsEmpty() &&
+            m_framebufferPool.IsEmpty();
+    }
+
+    RenderContext::FramebufferPtr RenderContext::AcquireFramebuffer(uint64_t description, const SR_MATH_NS::IVector2& size) {
+        if (m_isClosed) {
+            return nullptr;
+        }
+
+        auto&& pFramebuffer = m_framebufferPool.Take(description, size);
+        if (!pFramebuffer) {
+            return nullptr;
+        }
+
+        m_framebuffers.emplace_back(pFramebuffer);
+        SetDirty();
+
+        return pFramebuffer;
     }
 
     const RenderContext::PipelinePtr& RenderContext::GetPipeline() const {
@@ -429,12 +578,137 @@ namespace SR_GRAPH_NS {
             m_isNeedGarbageCollection = true;
         }
 
+        auto&& geometryPool = SR_GRAPH_NS::GeometryPool::Instance();
+
+        if (geometryPool.IsEnabled()) {
+            geometryPool.NextFrame(static_cast<uint32_t>(m_pipeline->GetBuildIterationsCount()) + 1);
+        }
+
         if (m_isNeedGarbageCollection) {
             SR_GRAPH_NS::Memory::ShaderProgramManager::Instance().CollectUnused();
             SR_GRAPH_NS::Memory::UBOManager::Instance().CollectUnused();
             SR_GRAPH_NS::DescriptorManager::Instance().CollectUnused();
+
+            /// смещения мешей изменились, командные буферы нужно перезаписать
+            if (geometryPool.IsEnabled() && geometryPool.Compact(0.5f)) {
+                for (auto&& [pScene, pRenderScene] : m_scenes) {
+                    pRenderScene->SetDirty();
+                }
+            }
+
             m_isNeedGarbageCollection = false;
         }
+
+        auto&& bindlessTable = SR_GRAPH_NS::BindlessTextureTable::Instance();
+
+        if (bindlessTable.GetFallbackTexture() == SR_ID_INVALID && m_noneTexture) SR_UNLIKELY_ATTRIBUTE {
+            bindlessTable.SetFallbackTexture(m_noneTexture->GetId());
+        }
+
+        /// измененные слоты дописываются в записанные наборы, командные буферы остаются прежними
+        if (bindlessTable.NextFrame(static_cast<uint32_t>(m_pipeline->GetBuildIterationsCount()) + 1)) {
+            if (!m_pipeline->UpdateTextureArrays(bindlessTable.GetTextures(), bindlessTable.GetDirtySlots())) {
+                bindlessTable.Invalidate();
+                for (auto&& [pScene, pRenderScene] : m_scenes) {
+                    pRenderScene->SetDirty();
+                }
+            }
+            bindlessTable.ClearDirtySlots();
+        }
+
+        auto&& textureStreamer = SR_GRAPH_NS::TextureStreamer::Instance();
+
+        if (textureStreamer.IsEnabled()) {
+            if (textureStreamer.GetPlaceholderTexture() == SR_ID_INVALID && m_noneTexture) SR_UNLIKELY_ATTRIBUTE {
+                textureStreamer.SetPlaceholderTexture(m_noneTexture->GetId());
+            }
+
+            textureStreamer.Update();
+        }
+
+        SR_GRAPH_NS::DescriptorManager::Instance().NextFrame();
+
+        m_pipeline->UpdateMemoryBudget();
+        UpdateDefragmentation();
+        UpdateDynamicResolution();
+
+        m_releaseQueue.NextFrame();
+    }
+
+    void RenderContext::UpdateDynamicResolution() {
+        if (auto&& pCapture = m_frameProfiler.GetLastCapture(); pCapture && pCapture->gpuTime >= 0.f) {
+            m_dynamicResolution.SetGPUFrameTime(pCapture->gpuTime);
+        }
+
+        if (!m_dynamicResolution.Update()) {
+            return;
+        }
+
+        SR_TRACY_ZONE;
+
+        for (auto&& pTechnique : m_techniques) {
+            pTechnique->SetResolutionScale(m_dynamicResolution.GetScale());
+        }
+
+        /// область вывода записана в командных буферах
+        for (auto&& [pScene, pRenderScene] : m_scenes) {
+            pRenderScene->SetDirty();
+        }
+    }
+
+    void RenderContext::SetProfilerEnabled(bool enabled) {
+        m_frameProfiler.SetEnabled(enabled);
+
+        if (!m_pipeline || m_pipeline->IsTimestampsEnabled() == enabled) {
+            return;
+        }
+
+        m_pipeline->SetTimestampsEnabled(enabled);
+
+        for (auto&& [pScene, pRenderScene] : m_scenes) {
+            pRenderScene->SetDirty();
+        }
+    }
+
+    void RenderContext::Defragment() {
+        SR_TRACY_ZONE;
+
+        m_lastDefragmentationFrame = m_releaseQueue.GetFrame();
+
+        auto&& geometryPool = SR_GRAPH_NS::GeometryPool::Instance();
+        if (!geometryPool.IsEnabled()) {
+            return;
+        }
+
+        /// смещения мешей меняются, поэтому командные буферы перезаписываются
+        if (geometryPool.Compact(m_defragmentationThreshold)) {
+            SR_LOG("RenderContext::Defragment() : geometry pool is compacted");
+            SetDirty();
+        }
+    }
+
+    void RenderContext::UpdateDefragmentation() {
+        const uint64_t frame = m_releaseQueue.GetFrame();
+
+        if (m_lastDefragmentationFrame && m_lastDefragmentationFrame.value() + DEFRAGMENTATION_INTERVAL > frame) {
+            return;
+        }
+
+        auto&& memoryBudget = m_pipeline->GetMemoryBudget();
+
+        /// пока памяти хватает, дробление свободного места ничему не мешает, а перенос не бесплатен
+        if (memoryBudget.GetState(Memory::MemoryHeap::Device) == Memory::MemoryBudgetState::Normal) {
+            return;
+        }
+
+        m_lastDefragmentationFrame = frame;
+        m_pipeline->UpdateMemoryFragmentation();
+
+        if (memoryBudget.GetFragmentation(Memory::MemoryHeap::Device) < m_defragmentationThreshold) {
+            return;
+        }
+
+        Defragment();
     }
 
     const std::vector<SR_GTYPES_NS::Shader*>& RenderContext::GetShaders() const noexcept {
@@ -477,9 +751,17 @@ namespace SR_GRAPH_NS {
         SRAssert2(IsEmpty(), "Render context is not empty!");
 
         if (m_pipeline) {
+            SR_GRAPH_NS::DescriptorManager::Instance().Clear();
+            SR_GRAPH_NS::BindlessTextureTable::Instance().Clear();
+            SR_GRAPH_NS::GeometryPool::Instance().Clear();
             m_pipeline->Destroy();
         }
 
+        /// итог оптимизации геометрии за сеанс, по нему проверяется выигрыш в кэше вершин
+        SR_GRAPH_NS::MeshOptimizer::Instance().LogStatistics();
+        SR_GRAPH_NS::MeshOptimizer::Instance().Clear();
+        SR_GRAPH_NS::MeshCache::Instance().Clear();
+
         m_pipeline.AutoFree();
     }
 
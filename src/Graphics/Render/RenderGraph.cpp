@@ -0,0 +1,200 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Render/RenderGraph.h>
+#include <Graphics/Render/IRenderTechnique.h>
+#include <Graphics/Render/FrameBufferController.h>
+#include <Graphics/Pass/ISamplersPass.h>
+#include <Graphics/Pass/IMeshClusterPass.h>
+
+namespace SR_GRAPH_NS {
+    void RenderGraph::Clear() {
+        m_resources.clear();
+        m_levels.clear();
+
+        m_transientCount = 0;
+        m_aliasSlotsCount = 0;
+        m_hazardsCount = 0;
+    }
+
+    void RenderGraph::Build(const IRenderTechnique* pTechnique) {
+        SR_TRACY_ZONE;
+
+        Clear();
+
+        for (auto&& [name, pController] : pTechnique->GetFrameBufferControllers()) {
+            if (!pController || !pController->GetFramebuffer()) {
+                continue;
+            }
+
+            auto&& resource = m_resources[FindOrAddResource(pController->GetFramebuffer())];
+            resource.name = name;
+            resource.pController = pController.Get();
+        }
+
+        auto&& queues = pTechnique->GetQueues();
+
+        std::vector<uint32_t> writes;
+        std::vector<uint32_t> reads;
+
+        for (uint32_t depth = 0; depth < queues.size(); ++depth) {
+            for (auto&& pPass : queues[depth]) {
+                writes.clear();
+                reads.clear();
+
+                for (auto&& pFrameBuffer : pPass->GetFrameBuffers()) {
+                    if (pFrameBuffer) {
+                        writes.emplace_back(FindOrAddResource(pFrameBuffer));
+                    }
+                }
+
+                std::vector<SR_UTILS_NS::StringAtom> readNames;
+
+                if (auto&& pSamplersPass = dynamic_cast<const ISamplersPass*>(pPass)) {
+                    auto&& names = pSamplersPass->GetSamplersFrameBuffers();
+                    readNames.insert(readNames.end(), names.begin(), names.end());
+                }
+
+                if (auto&& pClusterPass = dynamic_cast<const IMeshClusterPass*>(pPass)) {
+                    auto&& names = pClusterPass->GetSamplersFrameBuffers();
+                    readNames.insert(readNames.end(), names.begin(), names.end());
+                }
+
+                for (auto&& name : readNames) {
+                    auto&& pController = pTechnique->GetFrameBufferController(name);
+                    if (!pController || !pController->GetFramebuffer()) {
+                        continue;
+                    }
+
+                    const uint32_t index = FindOrAddResource(pController->GetFramebuffer());
+
+                    /// чтение собственного буфера - это данные прошлого кадра, зависимости нет
+                    if (std::find(writes.begin(), writes.end(), index) == writes.end()) {
+                        reads.emplace_back(index);
+                    }
+                }
+
+                uint32_t level = depth;
+
+                for (const uint32_t index : reads) {
+                    auto&& resource = m_resources[index];
+
+                    /// буфер пишется позже в кадре, читается содержимое прошлого кадра
+                    if (resource.writeLevel == SR_UINT32_MAX) {
+                        continue;
+                    }
+
+                    if (resource.writeLevel >= depth) {
+                        ++m_hazardsCount;
+                        SR_WARN("RenderGraph::Build() : pass \"{}\" reads \"{}\" before it is written, moved to the next level",
+                            pPass->GetName().ToStringRef(), resource.name.ToStringRef());
+                    }
+
+                    level = SR_MAX(level, resource.writeLevel + 1);
+                }
+
+                for (const uint32_t index : writes) {
+                    if (auto&& writeLevel = m_resources[index].writeLevel; writeLevel != SR_UINT32_MAX) {
+                        level = SR_MAX(level, writeLevel);
+                    }
+                }
+
+                m_levels[pPass] = level;
+
+                for (const uint32_t index : writes) {
+                    auto&& resource = m_resources[index];
+                    ++resource.writes;
+                    resource.writeLevel = level;
+                    resource.firstLevel = SR_MIN(resource.firstLevel, level);
+                    resource.lastLevel = SR_MAX(resource.lastLevel, level);
+                }
+
+                for (const uint32_t index : reads) {
+                    auto&& resource = m_resources[index];
+                    ++resource.reads;
+                    resource.firstLevel = SR_MIN(resource.firstLevel, level);
+                    resource.lastLevel = SR_MAX(resource.lastLevel, level);
+                }
+            }
+        }
+
+        BuildAliasing();
+
+        SR_LOG("RenderGraph::Build() : \"{}\" has {} framebuffers, {} transient fit into {} slots, {} hazards",
+            pTechnique->GetName().ToStringRef(), m_resources.size(), m_transientCount, m_aliasSlotsCount, m_hazardsCount);
+    }
+
+    uint32_t RenderGraph::GetLevel(const BasePass* pPass, uint32_t queueDepth) const {
+        if (auto&& pIt = m_levels.find(pPass); pIt != m_levels.end()) {
+            return SR_MAX(pIt->second, queueDepth);
+        }
+
+        return queueDepth;
+    }
+
+    uint32_t RenderGraph::FindOrAddResource(FramebufferPtr pFrameBuffer) {
+        for (uint32_t i = 0; i < m_resources.size(); ++i) {
+            if (m_resources[i].pFrameBuffer == pFrameBuffer) {
+                return i;
+            }
+        }
+
+        auto&& resource = m_resources.emplace_back();
+        resource.pFrameBuffer = pFrameBuffer;
+
+        return static_cast<uint32_t>(m_resources.size() - 1);
+    }
+
+    void RenderGraph::BuildAliasing() {
+        /// промежуточный буфер пишется и читается внутри техники, буферы без читателей - результат техники
+        std::vector<uint32_t> transient;
+
+        for (uint32_t i = 0; i < m_resources.size(); ++i) {
+            auto&& resource = m_resources[i];
+            if (resource.pController && resource.writes > 0 && resource.reads > 0) {
+                transient.emplace_back(i);
+            }
+        }
+
+        std::stable_sort(transient.begin(), transient.end(), [this](uint32_t a, uint32_t b) {
+            return m_resources[a].firstLevel < m_resources[b].firstLevel;
+        });
+
+        struct Slot {
+            uint32_t resource = 0;
+            uint32_t lastLevel = 0;
+        };
+
+        std::vector<Slot> slots;
+
+        for (const uint32_t index : transient) {
+            auto&& resource = m_resources[index];
+
+            for (uint32_t slotIndex = 0; slotIndex < slots.size(); ++slotIndex) {
+                auto&& slot = slots[slotIndex];
+
+                /// уровни выполняются по порядку, время жизни не пересекается только между уровнями
+                if (slot.lastLevel >= resource.firstLevel) {
+                    continue;
+                }
+
+                if (!resource.pController->IsAliasCompatible(*m_resources[slot.resource].pController)) {
+                    continue;
+                }
+
+                resource.aliasSlot = slotIndex;
+                slot.lastLevel = resource.lastLevel;
+                break;
+            }
+
+            if (resource.aliasSlot == SR_UINT32_MAX) {
+                resource.aliasSlot = static_cast<uint32_t>(slots.size());
+                slots.emplace_back(Slot { index, resource.lastLevel });
+            }
+        }
+
+        m_transientCount = static_cast<uint32_t>(transient.size());
+        m_aliasSlotsCount = static_cast<uint32_t>(slots.size());
+    }
+}
@@ -6,6 +6,9 @@
 #include <Graphics/Render/RenderQueue.h>
 #include <Graphics/Render/RenderContext.h>
 #include <Graphics/Render/RenderScene.h>
+#include <Graphics/Memory/TextureStreamer.h>
+#include <Graphics/Material/BaseMaterial.h>
+#include <Graphics/Types/Camera.h>
 
 #include <Utils/ECS/LayerManager.h>
 
@@ -20,6 +23,7 @@ namespace SR_GRAPH_NS {
         m_renderContext = pStrategy->GetRenderContext();
         m_renderScene = pStrategy->GetRenderScene();
         m_pipeline = m_renderContext->GetPipeline().Get();
+        m_indirectDraws.SetPipeline(m_pipeline);
         m_meshes.reserve(512);
     }
 
@@ -36,6 +40,8 @@ namespace SR_GRAPH_NS {
                 }
             }
         }
+
+        m_indirectDraws.Free();
     }
 
     void RenderQueue::Register(const MeshRegistrationInfo& info) {
@@ -86,12 +92,28 @@ namespace SR_GRAPH_NS {
             return;
         }
 
+        if (!m_meshDrawerPass->IsMaterialAllowed(info.pMaterial)) {
+            return;
+        }
+
         MeshInfo meshInfo;
         meshInfo.pMesh = info.pMesh;
         meshInfo.shaderUseInfo = GetShaderUseInfo(info);
         meshInfo.vbo = info.VBO.has_value() ? info.VBO.value() : SR_ID_INVALID;
         meshInfo.priority = info.priority.value_or(0);
 
+        m_clusterRanges.erase(info.pMesh);
+        m_submittedBounds.erase(info.pMesh);
+
+        /// очередь камеры, обновляемой не каждый кадр, может хранить меш до своего обновления
+        m_meshes.erase(std::remove_if(m_meshes.begin(), m_meshes.end(), [&info](auto&& element) {
+            return element.first == info.pMesh;
+        }), m_meshes.end());
+
+        for (auto pIt = m_dirtyMeshes.begin(); pIt != m_dirtyMeshes.end(); ) {
+            pIt = pIt->first == info.pMesh ? m_dirtyMeshes.erase(pIt) : std::next(pIt);
+        }
+
         auto&& queues = info.pMesh->GetRenderQueues();
         queues.Remove({ this, meshInfo.shaderUseInfo });
 
@@ -120,6 +142,23 @@ namespace SR_GRAPH_NS {
 
         m_shaders.Clear();
 
+        m_isClusterCulling = m_meshDrawerPass->GetCamera() && m_meshDrawerPass->IsClusterCullingEnabled();
+        m_isOcclusionCulling = m_meshDrawerPass->IsOcclusionCullingEnabled();
+
+        uint32_t indirectDrawsCount = 0;
+        for (auto&& [layer, queue] : m_queues) {
+            for (auto&& info : queue) {
+                indirectDrawsCount += GetDrawSlotsCount(info.pMesh);
+            }
+        }
+
+        m_nextDrawSlot = 0;
+
+        /// без буфера меши рисуются исходным уровнем
+        if (indirectDrawsCount > 0) {
+            m_indirectDraws.Reserve(indirectDrawsCount, m_renderContext->GetReleaseQueue().GetFrame());
+        }
+
         for (auto&& [layer, queue] : m_queues) {
             Render(layer, queue);
         }
@@ -136,10 +175,54 @@ namespace SR_GRAPH_NS {
 
         UpdateShaders();
         UpdateMeshes();
+        UpdateLods();
+        UpdateClusters();
+        UpdateOcclusion();
+        UpdateIndirectDraws();
+        UpdateTextureStreaming();
     }
 
     void RenderQueue::OnMeshDirty(MeshPtr pMesh, ShaderUseInfo info) {
-        m_meshes.emplace_back(pMesh, info);
+        /// другая очередь могла очистить флаг меша, и он пометится снова
+        if (m_dirtyMeshes.emplace(pMesh, info.pShader).second) {
+            m_meshes.emplace_back(pMesh, info);
+        }
+    }
+
+    bool RenderQueue::HasVisibleChanges() const {
+        if (m_meshes.empty()) {
+            return false;
+        }
+
+        auto&& pCamera = m_meshDrawerPass->GetCamera();
+
+        /// без отсечения проход видит геометрию вне пирамиды, например тени
+        if (!pCamera || !m_meshDrawerPass->IsClusterCullingEnabled()) {
+            return true;
+        }
+
+        FrustumCulling frustumCulling;
+        frustumCulling.UpdateFrustum(pCamera->GetProjection() * pCamera->GetViewTranslate());
+
+        for (auto&& [pMesh, info] : m_meshes) {
+            const SR_MATH_NS::FVector4 sphere = GetBoundingSphere(pMesh);
+            if (sphere.w <= 0.f) {
+                return true;
+            }
+
+            if (frustumCulling.IsSphereInFrustum(sphere.XYZ(), sphere.w)) {
+                return true;
+            }
+
+            /// меш ушел из пирамиды, но на экране остался с прошлого вывода
+            if (auto&& pIt = m_submittedBounds.find(pMesh); pIt != m_submittedBounds.end()) {
+                if (frustumCulling.IsSphereInFrustum(pIt->second.XYZ(), pIt->second.w)) {
+                    return true;
+                }
+            }
+        }
+
+        return false;
     }
 
     void RenderQueue::UpdateShaders() {
@@ -179,10 +262,388 @@ namespace SR_GRAPH_NS {
             if (m_uboManager.BindNoDublicateUBO(virtualUbo) == Memory::UBOManager::BindResult::Success) SR_UNLIKELY_ATTRIBUTE {
                 m_meshDrawerPass->UseUniforms(info, pMesh);
                 SR_MAYBE_UNUSED_VAR info.pShader->Flush();
+                m_submittedBounds[pMesh] = GetBoundingSphere(pMesh);
             }
         }
 
         m_meshes.clear();
+        m_dirtyMeshes.clear();
+    }
+
+    void RenderQueue::UpdateLods() {
+        SR_TRACY_ZONE;
+
+        auto&& pCamera = m_meshDrawerPass->GetCamera();
+        if (!pCamera || pCamera->GetSize().y == 0) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        /// сколько пикселей экрана занимает единица длины на расстоянии 1
+        const float_t pixelsPerUnit = static_cast<float_t>(pCamera->GetSize().y) / (2.f * std::tan(SR_RAD(pCamera->GetFOV()) * 0.5f));
+        const SR_MATH_NS::FVector3 cameraPosition = pCamera->GetPosition();
+
+        for (auto&& [layer, queue] : m_queues) {
+            for (auto&& info : queue) {
+                if (info.pMesh->GetLodCount() <= 1) SR_LIKELY_ATTRIBUTE {
+                    continue;
+                }
+
+                info.lod = SelectLod(info, cameraPosition, pixelsPerUnit);
+            }
+        }
+    }
+
+    void RenderQueue::UpdateClusters() {
+        SR_TRACY_ZONE;
+
+        auto&& pCamera = m_meshDrawerPass->GetCamera();
+        const bool isClusterCulling = pCamera && m_meshDrawerPass->IsClusterCullingEnabled();
+
+        /// число слотов меша записано в командах
+        if (isClusterCulling != m_isClusterCulling) SR_UNLIKELY_ATTRIBUTE {
+            m_renderScene->SetDirty();
+        }
+
+        if (!isClusterCulling) SR_UNLIKELY_ATTRIBUTE {
+            m_clusterRanges.clear();
+            m_clustersCount = m_visibleClustersCount = 0;
+            return;
+        }
+
+        m_frustumCulling.UpdateFrustum(pCamera->GetProjection() * pCamera->GetViewTranslate());
+
+        const SR_MATH_NS::FVector3 cameraPosition = pCamera->GetPosition();
+
+        m_clustersCount = m_visibleClustersCount = 0;
+
+        for (auto&& [layer, queue] : m_queues) {
+            for (auto&& info : queue) {
+                auto&& pMeshlets = info.pMesh->GetMeshlets();
+
+                /// кластеры есть только у исходного уровня
+                if (!pMeshlets || GetDrawLod(info) > 0) SR_LIKELY_ATTRIBUTE {
+                    m_clusterRanges.erase(info.pMesh);
+                    continue;
+                }
+
+                CullClusters(info.pMesh, *pMeshlets, cameraPosition, m_clusterRanges[info.pMesh]);
+            }
+        }
+    }
+
+    void RenderQueue::UpdateIndirectDraws() {
+        SR_TRACY_ZONE;
+
+        m_submittedTrianglesCount = 0;
+
+        const bool hasIndirectDraws = m_indirectDraws.GetBuffer() != SR_ID_INVALID;
+
+        for (auto&& [layer, queue] : m_queues) {
+            for (auto&& info : queue) {
+                if (info.state != QUEUE_STATE_OK) SR_UNLIKELY_ATTRIBUTE {
+                    continue;
+                }
+
+                if (info.drawSlot == SR_UINT32_MAX || !hasIndirectDraws) SR_LIKELY_ATTRIBUTE {
+                    m_submittedTrianglesCount += info.pMesh->GetIndicesCount() / 3;
+                    continue;
+                }
+
+                m_submittedTrianglesCount += WriteDrawSlots(info);
+            }
+        }
+
+        if (hasIndirectDraws) SR_UNLIKELY_ATTRIBUTE {
+            m_indirectDraws.Flush(m_renderContext->GetReleaseQueue().GetFrame(), m_pipeline->GetBuildIterationsCount() + 1);
+        }
+    }
+
+    void RenderQueue::UpdateOcclusion() {
+        SR_TRACY_ZONE;
+
+        const bool isEnabled = m_meshDrawerPass->IsOcclusionCullingEnabled();
+
+        /// число слотов меша записано в командах
+        if (isEnabled != m_isOcclusionCulling) SR_UNLIKELY_ATTRIBUTE {
+            m_renderScene->SetDirty();
+        }
+
+        m_occludedMeshesCount = 0;
+
+        for (auto&& [layer, queue] : m_queues) {
+            for (auto&& info : queue) {
+                bool isOccluded = false;
+
+                /// меш без слотов рисуется напрямую, скрыть его можно только перезаписью команд
+                if (isEnabled && info.drawSlot != SR_UINT32_MAX) SR_LIKELY_ATTRIBUTE {
+                    auto&& matrix = info.pMesh->GetMatrix();
+                    auto&& scale = matrix.GetScale();
+
+                    const float_t maxScale = SR_MAX(SR_MAX(std::abs(scale.x), std::abs(scale.y)), std::abs(scale.z));
+
+                    isOccluded = IsClusterOccluded(matrix.GetTranslate(), info.pMesh->GetBoundingRadius() * maxScale);
+                }
+
+                /// пирамида отстает на несколько кадров, поэтому скрывается только меш, закрытый несколько обновлений подряд,
+                /// а показывается сразу, как только открылся
+                info.occludedUpdates = isOccluded ? static_cast<uint8_t>(SR_MIN(info.occludedUpdates + 1, OCCLUSION_CONFIRM_UPDATES)) : 0;
+                isOccluded = info.occludedUpdates >= OCCLUSION_CONFIRM_UPDATES;
+
+                if (isOccluded != info.occluded) {
+                    info.occluded = isOccluded;
+
+                    /// пока меш не рисовался, его юниформы не обновлялись
+                    if (!isOccluded) {
+                        info.pMesh->MarkUniformsDirty(true);
+                    }
+                }
+
+                m_occludedMeshesCount += isOccluded ? 1 : 0;
+            }
+        }
+    }
+
+    bool RenderQueue::IsClusterOccluded(const SR_MATH_NS::FVector3& center, float_t radius) const {
+        return m_meshDrawerPass->IsOccluded(center, radius);
+    }
+
+    void RenderQueue::CullClusters(MeshPtr pMesh, const Meshlets& meshlets, const SR_MATH_NS::FVector3& cameraPosition, IndexRanges& ranges) {
+        auto&& matrix = pMesh->GetMatrix();
+        auto&& scale = matrix.GetScale();
+
+        const float_t maxScale = SR_MAX(SR_MAX(std::abs(scale.x), std::abs(scale.y)), std::abs(scale.z));
+        const float_t minScale = SR_MIN(SR_MIN(std::abs(scale.x), std::abs(scale.y)), std::abs(scale.z));
+        const bool isConeValid = maxScale - minScale <= maxScale * CLUSTER_SCALE_TOLERANCE;
+
+        IndexRanges visible;
+        visible.reserve(ranges.size() + 1);
+
+        for (auto&& meshlet : meshlets) {
+            const SR_MATH_NS::FVector4 worldCenter = matrix * SR_MATH_NS::FVector4(meshlet.center.x, meshlet.center.y, meshlet.center.z, 1.f);
+            const SR_MATH_NS::FVector3 center = worldCenter.XYZ();
+            const float_t radius = meshlet.radius * maxScale;
+
+            ++m_clustersCount;
+
+            if (!m_frustumCulling.IsSphereInFrustum(center, radius)) {
+                continue;
+            }
+
+            /// камера внутри конуса за кластером - все его треугольники повернуты к ней обратной стороной
+            if (isConeValid && meshlet.coneCutoff < 1.f) {
+                const SR_MATH_NS::FVector3 axis = (matrix * SR_MATH_NS::FVector4(meshlet.coneAxis.x, meshlet.coneAxis.y, meshlet.coneAxis.z, 0.f)).XYZ().Normalize();
+                const SR_MATH_NS::FVector3 direction = center - cameraPosition;
+
+                if (direction.Dot(axis) >= meshlet.coneCutoff * direction.Length() + radius) {
+                    continue;
+                }
+            }
+
+            if (IsClusterOccluded(center, radius)) {
+                continue;
+            }
+
+            ++m_visibleClustersCount;
+
+            /// соседние видимые кластеры рисуются одним вызовом
+            if (!visible.empty() && visible.back().firstIndex + visible.back().indicesCount == meshlet.firstIndex) {
+                visible.back().indicesCount += meshlet.indicesCount;
+            }
+            else {
+                visible.emplace_back(IndexRange { meshlet.firstIndex, meshlet.indicesCount });
+            }
+        }
+
+        ranges = std::move(visible);
+    }
+
+    void RenderQueue::UpdateTextureStreaming() {
+        SR_TRACY_ZONE;
+
+        auto&& streamer = TextureStreamer::Instance();
+        auto&& pCamera = m_meshDrawerPass->GetCamera();
+
+        if (!streamer.IsEnabled() || !pCamera || pCamera->GetSize().y == 0) SR_LIKELY_ATTRIBUTE {
+            return;
+        }
+
+        const float_t pixelsPerUnit = static_cast<float_t>(pCamera->GetSize().y) / (2.f * std::tan(SR_RAD(pCamera->GetFOV()) * 0.5f));
+        const SR_MATH_NS::FVector3 cameraPosition = pCamera->GetPosition();
+
+        /// без отсечения кластеров пирамида в этом кадре еще не обновлялась
+        m_frustumCulling.UpdateFrustum(pCamera->GetProjection() * pCamera->GetViewTranslate());
+
+        m_materialScreenSizes.clear();
+
+        for (auto&& [layer, queue] : m_queues) {
+            for (auto&& info : queue) {
+                auto&& pMaterial = info.pMesh->GetMaterial();
+                if (!pMaterial) {
+                    continue;
+                }
+
+                auto&& screenSize = m_materialScreenSizes[pMaterial];
+
+                const SR_MATH_NS::FVector4 sphere = GetBoundingSphere(info.pMesh);
+
+                /// скрытые и вне пирамиды меши держат текстуры на заглушке, даже если они рядом с камерой
+                if (info.occluded || (sphere.w > 0.f && !m_frustumCulling.IsSphereInFrustum(sphere.XYZ(), sphere.w))) {
+                    screenSize = SR_MAX(screenSize, 1U);
+                    continue;
+                }
+
+                screenSize = SR_MAX(screenSize, CalculateScreenSize(info, cameraPosition, pixelsPerUnit));
+            }
+        }
+
+        for (auto&& [pMaterial, screenSize] : m_materialScreenSizes) {
+            pMaterial->ForEachTexture([&streamer, screenSize = screenSize](SR_GTYPES_NS::Texture* pTexture) {
+                streamer.Touch(pTexture, screenSize);
+            });
+        }
+    }
+
+    uint32_t RenderQueue::CalculateScreenSize(const MeshInfo& info, const SR_MATH_NS::FVector3& cameraPosition, float_t pixelsPerUnit) const {
+        auto&& matrix = info.pMesh->GetMatrix();
+        auto&& translation = matrix.GetTranslate();
+        auto&& scale = matrix.GetScale();
+
+        const float_t maxScale = SR_MAX(SR_MAX(std::abs(scale.x), std::abs(scale.y)), std::abs(scale.z));
+        const float_t radius = info.pMesh->GetBoundingRadius() * maxScale;
+
+        const float_t dx = translation.x - cameraPosition.x;
+        const float_t dy = translation.y - cameraPosition.y;
+        const float_t dz = translation.z - cameraPosition.z;
+
+        const float_t distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        if (distance <= radius) {
+            return UINT32_MAX;
+        }
+
+        const float_t pixels = 2.f * radius * pixelsPerUnit / distance;
+
+        return static_cast<uint32_t>(SR_MAX(1.f, SR_MIN(pixels, static_cast<float_t>(UINT16_MAX))));
+    }
+
+    SR_MATH_NS::FVector4 RenderQueue::GetBoundingSphere(MeshPtr pMesh) {
+        auto&& matrix = pMesh->GetMatrix();
+        auto&& scale = matrix.GetScale();
+
+        const float_t maxScale = SR_MAX(SR_MAX(std::abs(scale.x), std::abs(scale.y)), std::abs(scale.z));
+
+        return SR_MATH_NS::FVector4(matrix.GetTranslate(), pMesh->GetBoundingRadius() * maxScale);
+    }
+
+    bool RenderQueue::IsVertexFormatCompatible(MeshPtr pMesh, ShaderPtr pShader) {
+        const Vertices::VertexType vertexType = pMesh->GetVertexType();
+        if (vertexType == Vertices::VertexType::Unknown) {
+            return true;
+        }
+
+        const bool isQuantizedShader = pShader->GetVertexFormat() == SR_SRSL_NS::VertexFormat::Quantized;
+        return Vertices::IsQuantizedVertexType(vertexType) == isQuantizedShader;
+    }
+
+    uint8_t RenderQueue::GetDrawLod(const MeshInfo& info) const {
+        const int32_t lod = static_cast<int32_t>(info.lod) + m_meshDrawerPass->GetLodBias();
+        return static_cast<uint8_t>(SR_MAX(0, SR_MIN(lod, static_cast<int32_t>(info.pMesh->GetLodCount()) - 1)));
+    }
+
+    uint32_t RenderQueue::GetDrawSlotsCount(MeshPtr pMesh) const {
+        if (!pMesh->IsSupportVBO()) {
+            return 0;
+        }
+
+        if (auto&& pMeshlets = pMesh->GetMeshlets(); pMeshlets && m_isClusterCulling) {
+            return static_cast<uint32_t>(pMeshlets->size());
+        }
+
+        /// перекрытый меш скрывается пустой командой в слоте, а не перезаписью команд
+        return pMesh->GetLodCount() > 1 || m_isOcclusionCulling ? 1 : 0;
+    }
+
+    Memory::DrawIndexedCommand RenderQueue::GetDrawCommand(MeshPtr pMesh, const IndexRange& range) const {
+        Memory::DrawIndexedCommand command;
+        command.indicesCount = range.indicesCount;
+        command.instancesCount = 1;
+        command.firstIndex = pMesh->GetFirstIndex() + range.firstIndex;
+        command.vertexOffset = pMesh->GetVertexOffset();
+
+        return command;
+    }
+
+    uint32_t RenderQueue::WriteDrawSlots(const MeshInfo& info) {
+        /// перекрытый меш остается в командах, но ничего не рисует
+        if (info.occluded) SR_UNLIKELY_ATTRIBUTE {
+            for (uint32_t i = 0; i < info.drawSlotsCount; ++i) {
+                m_indirectDraws.Set(info.drawSlot + i, Memory::DrawIndexedCommand());
+            }
+            return 0;
+        }
+
+        const uint8_t lod = GetDrawLod(info);
+
+        uint32_t written = 0;
+        uint32_t indicesCount = 0;
+
+        auto&& writeRange = [&](const IndexRange& range) {
+            m_indirectDraws.Set(info.drawSlot + written++, GetDrawCommand(info.pMesh, range));
+            indicesCount += range.indicesCount;
+        };
+
+        if (auto&& pIt = m_clusterRanges.find(info.pMesh); pIt != m_clusterRanges.end() && lod == 0) {
+            /// соседние кластеры склеены, поэтому участков не больше, чем слотов
+            for (auto&& range : pIt->second) {
+                if (written == info.drawSlotsCount) SR_UNLIKELY_ATTRIBUTE {
+                    break;
+                }
+                writeRange(range);
+            }
+        }
+        else {
+            writeRange(info.pMesh->GetLodRange(lod));
+        }
+
+        for (; written < info.drawSlotsCount; ++written) {
+            m_indirectDraws.Set(info.drawSlot + written, Memory::DrawIndexedCommand());
+        }
+
+        return indicesCount / 3;
+    }
+
+    uint8_t RenderQueue::SelectLod(const MeshInfo& info, const SR_MATH_NS::FVector3& cameraPosition, float_t pixelsPerUnit) const {
+        auto&& matrix = info.pMesh->GetMatrix();
+        auto&& translation = matrix.GetTranslate();
+        auto&& scale = matrix.GetScale();
+
+        const float_t maxScale = SR_MAX(SR_MAX(std::abs(scale.x), std::abs(scale.y)), std::abs(scale.z));
+
+        const float_t dx = translation.x - cameraPosition.x;
+        const float_t dy = translation.y - cameraPosition.y;
+        const float_t dz = translation.z - cameraPosition.z;
+
+        /// расстояние до ближайшей точки ограничивающей сферы
+        const float_t distance = std::sqrt(dx * dx + dy * dy + dz * dz) - info.pMesh->GetBoundingRadius() * maxScale;
+
+        if (distance <= 0.f) {
+            return 0;
+        }
+
+        const float_t errorScale = maxScale * pixelsPerUnit / distance;
+        const uint8_t lodCount = info.pMesh->GetLodCount();
+
+        uint8_t lod = 0;
+
+        for (uint8_t i = 1; i < lodCount; ++i) {
+            const float_t threshold = i > info.lod ? LOD_PIXEL_ERROR * (1.f - LOD_HYSTERESIS) : LOD_PIXEL_ERROR;
+            if (info.pMesh->GetLodError(i) * errorScale > threshold) {
+                break;
+            }
+            lod = i;
+        }
+
+        return lod;
     }
 
     bool RenderQueue::IsSuitable(const MeshRegistrationInfo &info) const {
@@ -196,6 +657,10 @@ namespace SR_GRAPH_NS {
             return false;
         }
 
+        if (!m_meshDrawerPass->IsMaterialAllowed(info.pMaterial)) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
         return true;
     }
 
@@ -204,12 +669,16 @@ namespace SR_GRAPH_NS {
 
         ShaderPtr pCurrentShader = nullptr;
         VBO currentVBO = 0;
+        int32_t currentIBO = SR_ID_INVALID;
 
         MeshInfo* pStart = queue.data();
         const MeshInfo* pEnd = pStart + queue.size();
         bool shaderOk = false;
 
         for (MeshInfo* pElement = pStart; pElement < pEnd; ) {
+            pElement->drawSlot = SR_UINT32_MAX;
+            pElement->drawSlotsCount = 0;
+
             const MeshInfo info = *pElement;
 
             const bool invalidVBO = info.vbo == SR_ID_INVALID && info.pMesh->IsSupportVBO();
@@ -219,10 +688,23 @@ namespace SR_GRAPH_NS {
                 continue;
             }
 
+            /// формат вершин выбирается по шейдеру материала, а проход может рисовать своим
+            if (!IsVertexFormatCompatible(info.pMesh, info.shaderUseInfo.pShader)) SR_UNLIKELY_ATTRIBUTE {
+                if (pElement->state != QUEUE_STATE_FORMAT_ERROR) {
+                    SR_WARN("RenderQueue::Render() : mesh vertex format doesn't match the pass shader, the mesh is skipped!"
+                        "\n\tPass: {}\n\tMesh: {}\n\tShader: {}", m_meshDrawerPass->GetName().ToStringRef(),
+                        info.pMesh->GetGeometryName(), info.shaderUseInfo.pShader->GetResourcePath().ToStringRef());
+                }
+                pElement->state = QUEUE_STATE_FORMAT_ERROR;
+                ++pElement;
+                continue;
+            }
+
             if (info.shaderUseInfo.pShader != pCurrentShader) SR_UNLIKELY_ATTRIBUTE {
                 pCurrentShader = info.shaderUseInfo.pShader;
                 shaderOk = UseShader(info.shaderUseInfo);
                 currentVBO = SR_ID_INVALID;
+                currentIBO = SR_ID_INVALID;
                 if (!shaderOk) SR_UNLIKELY_ATTRIBUTE {
                     pElement->state = QUEUE_STATE_SHADER_ERROR;
                     pElement = FindNextShader(queue, pElement);
@@ -242,6 +724,24 @@ namespace SR_GRAPH_NS {
                     continue;
                 }
                 currentVBO = info.vbo;
+                currentIBO = info.pMesh->GetIBO();
+            }
+            else if (info.pMesh->IsSupportVBO()) {
+                /// меши из общего буфера геометрии делят VBO, но индексы могут лежать в разных страницах
+                if (auto&& IBO = info.pMesh->GetIBO(); IBO != currentIBO && IBO != SR_ID_INVALID) SR_UNLIKELY_ATTRIBUTE {
+                    m_pipeline->BindIBO(IBO);
+                    currentIBO = IBO;
+                }
+            }
+
+            /// уровень и видимые кластеры меняются без перезаписи команд: в них только ссылка на слоты
+            if (const uint32_t slotsCount = GetDrawSlotsCount(info.pMesh); slotsCount > 0 && m_indirectDraws.GetBuffer() != SR_ID_INVALID) {
+                pElement->drawSlot = m_nextDrawSlot;
+                pElement->drawSlotsCount = slotsCount;
+                m_nextDrawSlot += slotsCount;
+
+                WriteDrawSlots(*pElement);
+                info.pMesh->SetIndirectDraws(m_indirectDraws.GetBuffer(), Memory::IndirectDrawBuffer::GetOffset(pElement->drawSlot), slotsCount);
             }
 
             if (m_customMeshDraw) SR_UNLIKELY_ATTRIBUTE {
@@ -251,6 +751,10 @@ namespace SR_GRAPH_NS {
                 info.pMesh->Draw();
             }
 
+            info.pMesh->SetIndirectDraws(SR_ID_INVALID, 0, 0);
+
+            m_submittedBounds[info.pMesh] = GetBoundingSphere(info.pMesh);
+
             pElement->state = QUEUE_STATE_OK;
             ++pElement;
             m_rendered = true;
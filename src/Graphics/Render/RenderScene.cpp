@@ -9,6 +9,7 @@
 #include <Graphics/Render/RenderContext.h>
 #include <Graphics/Render/RenderStrategy.h>
 #include <Graphics/Memory/CameraManager.h>
+#include <Graphics/Memory/GeometryPool.h>
 #include <Graphics/Types/Camera.h>
 #include <Graphics/Types/Geometry/DebugLine.h>
 #include <Graphics/Render/RenderTechnique.h>
@@ -55,8 +56,12 @@ namespace SR_GRAPH_NS {
     void RenderScene::Render() {
         SR_TRACY_ZONE_N("Render scene");
 
+        m_context->GetDynamicResolution().BeginCPUWork();
+
         PrepareFrame();
 
+        m_context->GetFrameProfiler().BeginFrame();
+
         PrepareRender();
 
         /// ImGui будет нарисован поверх независимо от порядка отрисовки.
@@ -66,7 +71,12 @@ namespace SR_GRAPH_NS {
 
         auto&& pPipeline = GetPipeline();
 
-        if (IsDirty() || pPipeline->IsDirty()) {
+        const bool isDirty = IsDirty() || pPipeline->IsDirty();
+
+        /// после перестройки все камеры рисуются заново, иначе их текстуры останутся пустыми
+        const bool isScheduleChanged = m_cameraScheduler.Schedule(m_offScreenCameras, isDirty);
+
+        if (isDirty) {
             Build();
             if (pPipeline->IsFBOQueueValid()) {
                 pPipeline->SetDirty(false);
@@ -76,6 +86,9 @@ namespace SR_GRAPH_NS {
                 m_hasDrawData = false;
             }
         }
+        else if (isScheduleChanged) {
+            RebuildSubmitQueue();
+        }
 
         Update();
         PostUpdate();
@@ -113,6 +126,11 @@ namespace SR_GRAPH_NS {
         m_queues.clear();
 
         ForEachTechnique([&](IRenderTechnique* pTechnique) {
+            /// пропущенная камера не отправляет буферы, ее текстура хранит прошлый кадр
+            if (!m_cameraScheduler.IsScheduled(pTechnique->GetCamera())) {
+                return;
+            }
+
             auto&& queues = pTechnique->GetQueues();
             for (uint32_t depth = 0; depth < queues.size(); ++depth) {
                 if (m_queues.size() < depth + 1) {
@@ -120,14 +138,18 @@ namespace SR_GRAPH_NS {
                 }
                 for (auto&& pPass : queues[depth]) {
                     m_queues[depth].emplace_back(pPass);
+                    /// граф может отодвинуть проход, если он читает буфер, записанный на том же уровне
+                    const uint32_t level = pTechnique->GetRenderGraph().GetLevel(pPass, depth);
                     for (auto&& pFrameBuffer : pPass->GetFrameBuffers()) {
-                        GetPipeline()->GetQueue().AddQueue(pFrameBuffer, depth);
+                        GetPipeline()->GetQueue().AddQueue(pFrameBuffer, level);
                     }
                 }
                 SRAssert(!m_queues[depth].empty());
             }
         });
 
+        GetPipeline()->GetQueue().RemoveEmptyLevels();
+
         /// if (!m_queues.empty()) {
         ///     std::string log = "RenderScene::BuildQueue() : \n";
         ///     for (auto&& queue : m_queues) {
@@ -141,6 +163,23 @@ namespace SR_GRAPH_NS {
         /// }
     }
 
+    void RenderScene::RebuildSubmitQueue() {
+        SR_TRACY_ZONE;
+
+        auto&& pPipeline = GetPipeline();
+
+        pPipeline->ClearFrameBuffersQueue();
+
+        BuildQueue();
+
+        if (pPipeline->IsFBOQueueValid()) {
+            pPipeline->SetDirty(false);
+        }
+        else {
+            SetDirty();
+        }
+    }
+
     void RenderScene::Build() {
         SR_TRACY_ZONE_N("Build render");
 
@@ -164,7 +203,28 @@ namespace SR_GRAPH_NS {
     void RenderScene::Update() {
         SR_TRACY_ZONE_N("Update render");
 
-        SR_RENDER_TECHNIQUES_CALL(Update)
+        for (auto&& pCamera : m_offScreenCameras) {
+            if (!pCamera || !m_cameraScheduler.IsScheduled(pCamera.Get())) {
+                continue;
+            }
+
+            if (auto&& pRenderTechnique = pCamera->GetRenderTechnique()) {
+                const auto start = std::chrono::steady_clock::now();
+                pRenderTechnique->Update();
+                const auto duration = std::chrono::duration<float_t, std::milli>(std::chrono::steady_clock::now() - start);
+                m_cameraScheduler.OnUpdated(pCamera.Get(), duration.count());
+            }
+        }
+
+        if (m_mainCamera) {
+            if (auto&& pRenderTechnique = m_mainCamera->GetRenderTechnique()) {
+                pRenderTechnique->Update();
+            }
+        }
+
+        if (m_technique) {
+            m_technique->Update();
+        }
     }
 
     void RenderScene::PostUpdate() {
@@ -180,7 +240,16 @@ namespace SR_GRAPH_NS {
     void RenderScene::Submit() {
         SR_TRACY_ZONE_N("Submit frame");
 
+        /// меши рассчитываются при построении кадра, их геометрия должна попасть в буферы до отправки
+        GeometryPool::Instance().Flush();
+
+        /// дальше ожидание свободного кадра и вертикальной синхронизации
+        m_context->GetDynamicResolution().EndCPUWork();
+
         GetPipeline()->DrawFrame();
+
+        /// метки GPU прошлых кадров, текущий кадр еще выполняется
+        m_context->GetFrameProfiler().EndFrame(GetPipeline()->GetGPUTimings());
     }
 
     void RenderScene::SetTechnique(IRenderTechnique *pTechnique) {
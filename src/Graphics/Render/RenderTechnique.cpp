@@ -100,6 +100,9 @@ namespace SR_GRAPH_NS {
 
         SetName(node.GetAttribute("Name").ToString());
 
+        m_updatePolicy.mode = SR_UTILS_NS::EnumReflector::FromString<CameraUpdateMode>(node.TryGetAttribute("UpdateMode").ToString("EveryFrame"));
+        m_updatePolicy.interval = SR_MAX(node.TryGetAttribute("UpdateInterval").ToUInt(1), 1u);
+
         for (auto&& passNode : node.GetNodes()) {
             ProcessNode(passNode);
         }
@@ -117,6 +120,7 @@ namespace SR_GRAPH_NS {
 
         DeInitPasses();
         m_queues.clear();
+        m_updatePolicy = CameraUpdatePolicy();
         SetName(SR_UTILS_NS::StringAtom());
     }
 
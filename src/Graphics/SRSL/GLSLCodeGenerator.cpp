@@ -72,6 +72,14 @@ namespace SR_SRSL_NS {
         /// code += "#extension GL_EXT_shader_atomic_float : enable\n\n";
         /// code += "#extension GL_ARB_shader_image_load_store : enable\n\n";
 
+        /// индекс в BINDLESS_TEXTURES может отличаться в пределах одного вызова
+        for (auto&& [name, sampler] : m_shader->GetSamplers()) {
+            if (sampler.count > 1 && sampler.stages.count(stage) == 1) {
+                code += "#extension GL_EXT_nonuniform_qualifier : enable\n\n";
+                break;
+            }
+        }
+
         if (auto&& vertexLocations = GenerateInputLocations(stage); !vertexLocations.empty()) {
             code += vertexLocations + "\n";
         }
@@ -124,9 +132,17 @@ namespace SR_SRSL_NS {
             preCode += GenerateTab(1) + "vec4 OUT_POSITION;\n";
         }
 
-        auto&& vertexInfo = Vertices::GetVertexInfo(m_shader->GetVertexType());
-        for (auto&& vertexAttribute : vertexInfo.m_names) {
-            preCode += SR_FORMAT("{}{} = {}_INPUT;\n", GenerateTab(1).c_str(), vertexAttribute.c_str(), vertexAttribute.c_str());
+        const auto vertexType = m_shader->GetVertexType();
+        auto&& vertexInfo = Vertices::GetVertexInfo(Vertices::GetDecodedVertexType(vertexType));
+
+        if (Vertices::IsQuantizedVertexType(vertexType)) {
+            code += GenerateVertexDecodeFunctions();
+            preCode += GenerateVertexDecode(vertexType);
+        }
+        else {
+            for (auto&& vertexAttribute : vertexInfo.m_names) {
+                preCode += SR_FORMAT("{}{} = {}_INPUT;\n", GenerateTab(1).c_str(), vertexAttribute.c_str(), vertexAttribute.c_str());
+            }
         }
 
         if (m_shader->GetUseStack()->IsVariableUsedInEntryPoints("VERTEX_INDEX")) {
@@ -210,9 +226,11 @@ namespace SR_SRSL_NS {
     std::string GLSLCodeGenerator::GenerateInputLocations(ShaderStage stage) const {
         std::string code;
 
-        auto&& vertexInfo = Vertices::GetVertexInfo(m_shader->GetVertexType());
+        auto&& vertexInfo = Vertices::GetVertexInfo(Vertices::GetDecodedVertexType(m_shader->GetVertexType()));
         auto&& pFunction = m_shader->GetUseStack()->FindFunction(SR_SRSL_ENTRY_POINTS.at(stage));
 
+        const bool isQuantized = Vertices::IsQuantizedVertexType(m_shader->GetVertexType());
+
         for (auto&& [name, pVariable] : m_shader->GetConstants()) {
             if (pFunction->IsVariableUsed(name)) {
                 auto&& type = ReplaceToken(SRSLTypeInfo::Instance().GetTypeName(pVariable->pType));
@@ -230,13 +248,23 @@ namespace SR_SRSL_NS {
                 code += SR_FORMAT("layout (location = {}) in {} {}{};\n", location, type.c_str(), vertexAttribute.c_str(), arraySize.c_str());
             }
 
-            if (stage == ShaderStage::Vertex) {
+            if (stage == ShaderStage::Vertex && !isQuantized) {
                 code += SR_FORMAT("layout (location = {}) in {} {}_INPUT{};\n", location, type.c_str(), vertexAttribute.c_str(), arraySize.c_str());
             }
 
             location += vertexInfo.m_types[location].second;
         }
 
+        /// сжатые атрибуты распаковываются в начале вершинного шейдера, см. GenerateVertexDecode
+        if (stage == ShaderStage::Vertex && isQuantized) {
+            auto&& packedInfo = Vertices::GetVertexInfo(m_shader->GetVertexType());
+
+            for (uint32_t i = 0; i < packedInfo.m_names.size(); ++i) {
+                std::string type = VertexAttributeToString(packedInfo.m_types[i].first);
+                code += SR_FORMAT("layout (location = {}) in {} {}_INPUT;\n", i, type.c_str(), packedInfo.m_names[i].c_str());
+            }
+        }
+
         if (stage != ShaderStage::Vertex) {
             auto&& pVertexFunction = m_shader->GetUseStack()->FindFunction(SR_SRSL_ENTRY_POINTS.at(ShaderStage::Vertex));
 
@@ -267,7 +295,7 @@ namespace SR_SRSL_NS {
     std::string GLSLCodeGenerator::GenerateOutputLocations(ShaderStage stage) const {
         std::string code;
 
-        auto&& vertexInfo = Vertices::GetVertexInfo(m_shader->GetVertexType());
+        auto&& vertexInfo = Vertices::GetVertexInfo(Vertices::GetDecodedVertexType(m_shader->GetVertexType()));
         auto&& pFunction = m_shader->GetUseStack()->FindFunction(SR_SRSL_ENTRY_POINTS.at(stage));
 
         uint32_t location = 0;
@@ -523,12 +551,15 @@ namespace SR_SRSL_NS {
 
         std::string uniformsCode;
 
+        const bool isVertexDecodeUsed = stage == ShaderStage::Vertex && m_shader->GetVertexFormat() == VertexFormat::Quantized;
+
         for (auto&& [name, uniformBlock] : m_shader->GetUniformBlocks()) {
             std::string blockCode = SR_SPRINTF("layout (std140, binding = %d) uniform %s {\n", uniformBlock.binding, name.c_str());
             bool hasUsage = false;
 
             for (auto&& field : uniformBlock.fields) {
                 hasUsage |= pFunction->IsVariableUsed(field.name);
+                hasUsage |= isVertexDecodeUsed && SR_SRSL_QUANTIZED_VERTEX_UNIFORMS.count(field.name.ToStringRef()) == 1;
 
                 auto&& typeName = ReplaceToken(SRSLTypeInfo::Instance().GetTypeName(field.type));
                 auto&& dimension = SRSLTypeInfo::Instance().GetDimension(field.type, nullptr);
@@ -596,10 +627,16 @@ namespace SR_SRSL_NS {
                     layout = SR_FORMAT("(binding = {})", sampler.binding);
                 }
 
-                samplersCode += SR_FORMAT("layout {} uniform {} {}; // (sampler) {}\n",
+                std::string dimension;
+                if (sampler.count > 1) {
+                    dimension = "[" + std::to_string(sampler.count) + "]";
+                }
+
+                samplersCode += SR_FORMAT("layout {} uniform {} {}{}; // (sampler) {}\n",
                         layout.c_str(),
                         sampler.type.c_str(),
                         name.c_str(),
+                        dimension.c_str(),
                         sampler.isPublic ? "public" : "private"
                 );
             }
@@ -656,6 +693,46 @@ namespace SR_SRSL_NS {
         return code;
     }
 
+    std::string GLSLCodeGenerator::GenerateVertexDecodeFunctions() const {
+        std::string code;
+
+        code += "vec3 SRDecodeOctahedral(vec2 e) {\n";
+        code += GenerateTab(1) + "vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));\n";
+        code += GenerateTab(1) + "float t = max(-n.z, 0.0);\n";
+        code += GenerateTab(1) + "n.x += n.x >= 0.0 ? -t : t;\n";
+        code += GenerateTab(1) + "n.y += n.y >= 0.0 ? -t : t;\n";
+        code += GenerateTab(1) + "return normalize(n);\n";
+        code += "}\n\n";
+
+        return code;
+    }
+
+    std::string GLSLCodeGenerator::GenerateVertexDecode(Vertices::VertexType vertexType) const {
+        std::string code;
+
+        code += GenerateTab(1) + "VERTEX = VERTEX_BOUNDS_MIN + VERTEX_INPUT.xyz * VERTEX_BOUNDS_SIZE;\n";
+        code += GenerateTab(1) + "UV = UV_INPUT;\n";
+        code += GenerateTab(1) + "NORMAL = SRDecodeOctahedral(NORMAL_INPUT);\n";
+        code += GenerateTab(1) + "TANGENT = SRDecodeOctahedral(TANGENT_INPUT);\n";
+        /// в w позиции хранится знак битангенса
+        code += GenerateTab(1) + "BITANGENT = cross(NORMAL, TANGENT) * (VERTEX_INPUT.w * 2.0 - 1.0);\n";
+
+        if (vertexType == Vertices::VertexType::QuantizedSkinnedMeshVertex) {
+            code += GenerateTab(1) + "WEIGHTS_COUNT = 0u;\n";
+            code += GenerateTab(1) + SR_FORMAT("for (int i = 0; i < {}; ++i) {{\n", SR_MAX_BONES_ON_VERTEX);
+            code += GenerateTab(2) + "WEIGHTS[i] = vec2(0.0);\n";
+            code += GenerateTab(1) + "}\n";
+            code += GenerateTab(1) + SR_FORMAT("for (int i = 0; i < {}; ++i) {{\n", Vertices::SR_QUANTIZED_BONES_ON_VERTEX);
+            code += GenerateTab(2) + "WEIGHTS[i] = vec2(float(BONES_INPUT[i]), BONE_WEIGHTS_INPUT[i]);\n";
+            code += GenerateTab(2) + "if (BONE_WEIGHTS_INPUT[i] > 0.0) {\n";
+            code += GenerateTab(3) + "WEIGHTS_COUNT = uint(i + 1);\n";
+            code += GenerateTab(2) + "}\n";
+            code += GenerateTab(1) + "}\n";
+        }
+
+        return code;
+    }
+
     std::string GLSLCodeGenerator::VertexAttributeToString(Vertices::Attribute attribute) const {
         switch (attribute) {
             case Vertices::Attribute::FLOAT_R32G32B32A32: return "vec4";
@@ -666,6 +743,11 @@ namespace SR_SRSL_NS {
             case Vertices::Attribute::INT_R32G32: return "ivec2";
             case Vertices::Attribute::UINT_R32: return "uint";
             case Vertices::Attribute::INT_R32: return "uint";
+            case Vertices::Attribute::HALF_R16G16: return "vec2";
+            case Vertices::Attribute::UNORM_R16G16B16A16: return "vec4";
+            case Vertices::Attribute::SNORM_R16G16: return "vec2";
+            case Vertices::Attribute::UNORM_R8G8B8A8: return "vec4";
+            case Vertices::Attribute::UINT_R8G8B8A8: return "uvec4";
             case Vertices::Attribute::Unknown:
             default:
                 SRHalt0();
@@ -178,8 +178,14 @@ namespace SR_SRSL_NS {
         switch (GetType()) {
             case ShaderType::Spatial:
             case ShaderType::SpatialCustom:
+                if (m_vertexFormat == VertexFormat::Quantized) {
+                    return Vertices::VertexType::QuantizedStaticMeshVertex;
+                }
                 return Vertices::VertexType::StaticMeshVertex;
             case ShaderType::Skinned:
+                if (m_vertexFormat == VertexFormat::Quantized) {
+                    return Vertices::VertexType::QuantizedSkinnedMeshVertex;
+                }
                 return Vertices::VertexType::SkinnedMeshVertex;
             case ShaderType::PostProcessing:
                 return Vertices::VertexType::None;
@@ -210,6 +216,9 @@ namespace SR_SRSL_NS {
                 if (varName == "ShaderType") {
                     m_type = SR_UTILS_NS::EnumReflector::FromString<SR_SRSL_NS::ShaderType>(varValue);
                 }
+                else if (varName == "VertexFormat") {
+                    m_vertexFormat = SR_UTILS_NS::EnumReflector::FromString<SR_SRSL_NS::VertexFormat>(varValue);
+                }
                 else if (varName == "PolygonMode") {
                     m_createInfo.polygonMode = SR_UTILS_NS::EnumReflector::FromString<PolygonMode>(varValue);
                 }
@@ -239,6 +248,11 @@ namespace SR_SRSL_NS {
             return false;
         }
 
+        if (m_vertexFormat == VertexFormat::Quantized && GetType() != ShaderType::Spatial && GetType() != ShaderType::SpatialCustom && GetType() != ShaderType::Skinned) {
+            SR_WARN("SRSLShader::PrepareSettings() : quantized vertices are supported only by spatial and skinned shaders!");
+            m_vertexFormat = VertexFormat::Full;
+        }
+
         return true;
     }
 
@@ -365,6 +379,30 @@ namespace SR_SRSL_NS {
             }
         }
 
+        /// используются кодом распаковки, а не исходником шейдера
+        if (m_vertexFormat == VertexFormat::Quantized) {
+            auto&& uniformBlock = m_uniformBlocks["BLOCK"];
+
+            for (auto&& [quantizedUniform, type] : SR_SRSL_QUANTIZED_VERTEX_UNIFORMS) {
+                const bool isExists = std::any_of(uniformBlock.fields.begin(), uniformBlock.fields.end(), [&quantizedUniform](auto&& field) {
+                    return field.name.ToStringRef() == quantizedUniform;
+                });
+
+                if (isExists) {
+                    continue;
+                }
+
+                SRSLUniformBlock::Field field;
+
+                field.name = quantizedUniform;
+                field.type = type;
+                field.isPublic = false;
+
+                uniformBlock.fields.emplace_back(field);
+                uniformBlock.stages.insert(ShaderStage::Vertex);
+            }
+        }
+
         for (auto&& [defaultPushConstant, type] : SR_SRSL_DEFAULT_PUSH_CONSTANTS) {
             auto&& usedStages = m_useStack->IsVariableUsedInEntryPointsExt(defaultPushConstant);
             if (!usedStages.empty()) {
@@ -448,6 +486,10 @@ namespace SR_SRSL_NS {
             sampler.isPublic = false;
             sampler.stages = stages;
 
+            if (defaultSampler == SHADER_BINDLESS_TEXTURES.ToStringRef()) {
+                sampler.count = SHADER_BINDLESS_TEXTURES_CAPACITY;
+            }
+
             m_samplers[defaultSampler] = sampler;
         }
 
@@ -531,7 +573,8 @@ namespace SR_SRSL_NS {
                 uniform.binding = block.binding;
                 uniform.size = block.size;
                 uniform.stage = stage;
-                uniform.type = LayoutBinding::Uniform;
+                /// блок объекта лежит в общей странице, общий блок шейдера - нет
+                uniform.type = name.ToStringRef() == "BLOCK" ? LayoutBinding::DynamicUniform : LayoutBinding::Uniform;
 
                 m_createInfo.uniforms.emplace_back(uniform);
             }
@@ -561,6 +604,7 @@ namespace SR_SRSL_NS {
                 uniform.binding = sampler.binding;
                 uniform.size = 0;
                 uniform.stage = stage;
+                uniform.count = sampler.count;
 
                 if (sampler.attachment >= 0) {
                     uniform.type = LayoutBinding::Attachhment;
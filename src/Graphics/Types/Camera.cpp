@@ -9,6 +9,7 @@
 #include <Graphics/Types/Camera.h>
 #include <Graphics/Memory/CameraManager.h>
 #include <Graphics/Render/RenderTechnique.h>
+#include <Graphics/Render/RenderContext.h>
 
 #include <Graphics/Window/Window.h>
 
@@ -22,7 +23,7 @@ namespace SR_GTYPES_NS {
     Camera::~Camera() {
         if (m_renderTechnique.pTechnique) {
             if (auto&& pResource = dynamic_cast<SR_UTILS_NS::IResource*>(m_renderTechnique.pTechnique)) {
-                pResource->RemoveUsePoint();
+                ReleaseRenderTechnique(pResource);
             }
             else {
                 SRHalt0();
@@ -115,6 +116,23 @@ namespace SR_GTYPES_NS {
         return m_renderTechnique.pTechnique;
     }
 
+    void Camera::ReleaseRenderTechnique(SR_UTILS_NS::IResource* pResource) {
+        auto&& pContext = m_renderTechnique.pTechnique->GetRenderContext();
+        bool isUnused = false;
+
+        /// как и в ContextResource, решение принимается по результату снятия точки под блокировкой ресурса
+        pResource->Execute([&]() -> bool {
+            pResource->RemoveUsePoint();
+            isUnused = pResource->GetCountUses() == 1;
+            return true;
+        });
+
+        /// техника, зарегистрированная в контексте, живет до его обновления
+        if (isUnused && pContext) {
+            pContext->ScheduleRelease(m_renderTechnique.pTechnique);
+        }
+    }
+
     const SR_UTILS_NS::Path& Camera::GetRenderTechniquePath() {
         /// default technique
         if (m_renderTechnique.path.IsEmpty()) {
@@ -286,7 +304,7 @@ namespace SR_GTYPES_NS {
     void Camera::SetRenderTechnique(const SR_UTILS_NS::Path& path) {
         if (m_renderTechnique.pTechnique) {
             if (auto&& pResource = dynamic_cast<SR_UTILS_NS::IResource*>(m_renderTechnique.pTechnique)) {
-                pResource->RemoveUsePoint();
+                ReleaseRenderTechnique(pResource);
             }
             else {
                 SRHalt("Render technique is not a resource! Memory leak possible.");
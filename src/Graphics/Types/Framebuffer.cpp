@@ -4,6 +4,7 @@
 
 #include <Graphics/Types/Framebuffer.h>
 #include <Graphics/Types/Shader.h>
+#include <Graphics/Render/RenderContext.h>
 
 namespace SR_GTYPES_NS {
     Framebuffer::Framebuffer()
@@ -76,6 +77,42 @@ namespace SR_GTYPES_NS {
         return Create(colors, depth, SR_MATH_NS::IVector2(0, 0));
     }
 
+    uint64_t Framebuffer::HashDescription(const std::list<ImageFormat>& colors, ImageFormat depth, ImageAspect depthAspect,
+        uint8_t samples, uint32_t layersCount, const FrameBufferFeatures& features, bool depthEnabled)
+    {
+        uint64_t hash = SR_UTILS_NS::HashCombine(static_cast<uint64_t>(depth), static_cast<uint64_t>(colors.size()));
+
+        for (auto&& format : colors) {
+            hash = SR_UTILS_NS::HashCombine(static_cast<uint64_t>(format), hash);
+        }
+
+        hash = SR_UTILS_NS::HashCombine(static_cast<uint64_t>(depthAspect), hash);
+        hash = SR_UTILS_NS::HashCombine(samples, hash);
+        hash = SR_UTILS_NS::HashCombine(layersCount, hash);
+        hash = SR_UTILS_NS::HashCombine(depthEnabled, hash);
+
+        for (const bool feature : {
+            features.depthLoad, features.colorLoad,
+            features.depthTransferSrc, features.colorTransferSrc,
+            features.depthTransferDst, features.colorTransferDst,
+            features.depthShaderRead, features.colorShaderRead
+        }) {
+            hash = SR_UTILS_NS::HashCombine(feature, hash);
+        }
+
+        return hash;
+    }
+
+    uint64_t Framebuffer::GetDescriptionHash() const {
+        std::list<ImageFormat> colors;
+
+        for (auto&& layer : m_colors) {
+            colors.emplace_back(layer.format);
+        }
+
+        return HashDescription(colors, m_depth.format, m_depth.aspect, m_sampleCount, m_layersCount, m_features, m_depthEnabled);
+    }
+
     bool Framebuffer::Bind() {
         if (m_hasErrors) {
             return false;
@@ -172,9 +209,26 @@ namespace SR_GTYPES_NS {
 
     void Framebuffer::SetSize(const SR_MATH_NS::IVector2 &size) {
         m_size = size;
+        m_contentSize = SR_MATH_NS::IVector2();
         SetDirty();
     }
 
+    void Framebuffer::SetContentSize(const SR_MATH_NS::IVector2& size) {
+        m_contentSize = size;
+
+        const SR_MATH_NS::IVector2 sizeClass = Memory::FramebufferPool::GetSizeClass(size);
+        constexpr int32_t step = Memory::FramebufferPool::SIZE_CLASS_STEP;
+
+        const bool isFits = m_size.x >= size.x && m_size.y >= size.y;
+        /// запас в один шаг, чтобы размер на границе класса не пересоздавал память туда и обратно
+        const bool isTooLarge = m_size.x > sizeClass.x + step || m_size.y > sizeClass.y + step;
+
+        if (!isFits || isTooLarge) {
+            m_size = sizeClass;
+            SetDirty();
+        }
+    }
+
     bool Framebuffer::BeginCmdBuffer(const ClearColors& clearColors, std::optional<float_t> depth) {
         m_pipeline->ClearBuffers(clearColors, depth);
 
@@ -314,8 +368,34 @@ namespace SR_GTYPES_NS {
     }
 
     void Framebuffer::SetViewportScissor() {
-        m_pipeline->SetViewport(m_size.x, m_size.y);
-        m_pipeline->SetScissor(m_size.x, m_size.y);
+        const SR_MATH_NS::IVector2 size = GetViewportSize();
+        m_pipeline->SetViewport(size.x, size.y);
+        m_pipeline->SetScissor(size.x, size.y);
+    }
+
+    void Framebuffer::SetViewportScale(float_t scale) {
+        m_viewportScale = std::clamp(scale, 0.f, 1.f);
+    }
+
+    SR_MATH_NS::IVector2 Framebuffer::GetViewportSize() const {
+        const SR_MATH_NS::IVector2 contentSize = GetContentSize();
+
+        if (m_viewportScale >= 1.f) {
+            return contentSize;
+        }
+
+        return SR_MATH_NS::IVector2(
+            SR_MAX(1, static_cast<int32_t>(std::ceil(static_cast<float_t>(contentSize.x) * m_viewportScale))),
+            SR_MAX(1, static_cast<int32_t>(std::ceil(static_cast<float_t>(contentSize.y) * m_viewportScale)))
+        );
+    }
+
+    SR_MATH_NS::FVector2 Framebuffer::GetViewportUVScale() const {
+        if (m_size.HasZero()) SR_UNLIKELY_ATTRIBUTE {
+            return SR_MATH_NS::FVector2(1.f);
+        }
+
+        return GetViewportSize().Cast<float_t>() / m_size.Cast<float_t>();
     }
 
     void Framebuffer::SetFeatures(const FrameBufferFeatures& features) {
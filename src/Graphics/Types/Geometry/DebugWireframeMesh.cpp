@@ -25,6 +25,7 @@ namespace SR_GTYPES_NS {
             SR_LOG("DebugWireframeMesh::Calculate() : calculating \"" + GetGeometryName() + "\"...");
         }
 
+        /// отладочные каркасы не оптимизируются и не упрощаются в уровни детализации
         if (!CalculateVBO<Vertices::VertexType::SimpleVertex, Vertices::SimpleVertex>([this]() {
             return Vertices::CastVertices<Vertices::SimpleVertex>(GetVertices());
         })) {
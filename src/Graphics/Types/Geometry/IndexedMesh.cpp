@@ -4,6 +4,7 @@
 
 #include <Utils/Types/RawMesh.h>
 #include <Graphics/Types/Geometry/IndexedMesh.h>
+#include <Graphics/Types/Shader.h>
 
 namespace SR_GTYPES_NS {
     IndexedMesh::~IndexedMesh() {
@@ -17,6 +18,8 @@ namespace SR_GTYPES_NS {
             return false;
         }
 
+        UpdateLods();
+
         return Mesh::Calculate();
     }
 
@@ -28,41 +31,55 @@ namespace SR_GTYPES_NS {
 
         using namespace Memory;
 
+        m_isPooled = GeometryPool::Instance().IsEnabled();
+
+        const MeshManager::Hash alias = IsUniqueMesh() ? 0 : MeshManager::HashIdentifier(GetMeshIdentifier(), Vertices::VertexType::Unknown);
+
         if (!IsUniqueMesh()) {
-            m_IBO = MeshManager::Instance().CopyIfExists<Vertices::VertexType::Unknown, MeshMemoryType::IBO>(GetMeshIdentifier());
+            m_IBO = MeshManager::Instance().CopyByAlias<MeshMemoryType::IBO>(alias);
         }
 
-        if (m_IBO == SR_ID_INVALID) {
-            auto&& indices = GetIndices();
+        if (m_IBO != SR_ID_INVALID) {
+            m_countIndices = MeshManager::Instance().Size<MeshMemoryType::IBO>(m_IBO);
+            return true;
+        }
 
-            if ((m_countIndices = indices.size()) == 0) {
-                SR_ERROR("IndexedMesh::CalculateIBO() : invalid indices! \n\tIdentifier: " + GetMeshIdentifier());
-                return false;
-            }
+        auto&& indices = GetIndices();
 
-            if (m_IBO = m_pipeline->AllocateIBO((void *) indices.data(), sizeof(uint32_t), m_countIndices, m_VBO); m_IBO == SR_ID_INVALID) {
-                SR_ERROR("IndexedMesh::CalculateIBO() : failed calculate IBO \"" + GetGeometryName() + "\" mesh!");
-                m_hasErrors = true;
-                return false;
-            }
-            else if (IsUniqueMesh()) {
-                return Mesh::Calculate();
+        if ((m_countIndices = indices.size()) == 0) {
+            SR_ERROR("IndexedMesh::CalculateIBO() : invalid indices! \n\tIdentifier: " + GetMeshIdentifier());
+            return false;
+        }
+
+        MeshManager::Hash key = 0;
+
+        /// одинаковые индексы разных мешей лежат в одном буфере, байты для сравнения есть только в общем буфере геометрии
+        if (!IsUniqueMesh() && m_isPooled) {
+            key = MeshManager::HashContent(indices.data(), indices.size() * sizeof(uint32_t), Vertices::VertexType::Unknown);
+
+            if ((m_IBO = CopyIfEqual<MeshMemoryType::IBO>(key, indices.data(), indices.size() * sizeof(uint32_t))) != SR_ID_INVALID) {
+                MeshManager::Instance().AddAlias<MeshMemoryType::IBO>(key, alias);
+                return true;
             }
+        }
 
-            return MeshManager::Instance().Register<Vertices::VertexType::Unknown, MeshMemoryType::IBO>(
-                GetMeshIdentifier(),
-                m_countIndices,
-                m_IBO
-            );
+        if (m_isPooled) {
+            m_IBO = GeometryPool::Instance().AllocateIndices(indices.data(), m_countIndices);
+        }
+        else {
+            m_IBO = m_pipeline->AllocateIBO((void *) indices.data(), sizeof(uint32_t), m_countIndices, m_VBO);
         }
 
-        if (!IsUniqueMesh()) {
-            m_countIndices = MeshManager::Instance().Size<Vertices::VertexType::Unknown, MeshMemoryType::IBO>(
-                GetMeshIdentifier()
-            );
+        if (m_IBO == SR_ID_INVALID) {
+            SR_ERROR("IndexedMesh::CalculateIBO() : failed calculate IBO \"" + GetGeometryName() + "\" mesh!");
+            m_hasErrors = true;
+            return false;
+        }
+        else if (IsUniqueMesh()) {
+            return Mesh::Calculate();
         }
 
-        return true;
+        return MeshManager::Instance().Register<MeshMemoryType::IBO>(key, alias, m_countIndices, m_IBO);
     }
 
     bool IndexedMesh::FreeIBO() {
@@ -76,7 +93,10 @@ namespace SR_GTYPES_NS {
 
         const bool isAllowFree = IsUniqueMesh() || manager.Free<MeshMemoryType::IBO>(m_IBO) == MeshManager::FreeResult::Freed;
 
-        if (isAllowFree && !m_pipeline->FreeIBO(&m_IBO)) {
+        if (isAllowFree && m_isPooled) {
+            GeometryPool::Instance().Free(m_IBO);
+        }
+        else if (isAllowFree && !m_pipeline->FreeIBO(&m_IBO)) {
             SR_ERROR("IndexedMesh:FreeVideoMemory() : failed free IBO! Something went wrong...");
             return false;
         }
@@ -97,7 +117,10 @@ namespace SR_GTYPES_NS {
 
         const bool isAllowFree = IsUniqueMesh() || manager.Free<MeshMemoryType::VBO>(m_VBO) == MeshManager::FreeResult::Freed;
 
-        if (isAllowFree && !m_pipeline->FreeVBO(&m_VBO)) {
+        if (isAllowFree && m_isPooled) {
+            GeometryPool::Instance().Free(m_VBO);
+        }
+        else if (isAllowFree && !m_pipeline->FreeVBO(&m_VBO)) {
             SR_ERROR("IndexedMesh::FreeVideoMemory() : failed free VBO! Something went wrong...");
             return false;
         }
@@ -122,18 +145,182 @@ namespace SR_GTYPES_NS {
     }
 
     int32_t IndexedMesh::GetVBO() {
-        if (!IsCalculated() && !Calculate()) SR_UNLIKELY_ATTRIBUTE {
+        if ((!IsCalculated() || IsVertexFormatOutdated()) && !Calculate()) SR_UNLIKELY_ATTRIBUTE {
             return SR_ID_INVALID;
         }
 
+        if (m_isPooled) {
+            return GeometryPool::Instance().GetBuffer(m_VBO);
+        }
+
         return m_VBO;
     }
 
     int32_t IndexedMesh::GetIBO() {
-        if (!IsCalculated() && !Calculate()) SR_UNLIKELY_ATTRIBUTE {
+        if ((!IsCalculated() || IsVertexFormatOutdated()) && !Calculate()) SR_UNLIKELY_ATTRIBUTE {
             return SR_ID_INVALID;
         }
 
+        if (m_isPooled) {
+            return GeometryPool::Instance().GetBuffer(m_IBO);
+        }
+
         return m_IBO;
     }
-}
\ No newline at end of file
+
+    uint32_t IndexedMesh::GetFirstIndex() {
+        return m_isPooled ? GeometryPool::Instance().GetOffset(m_IBO) : 0;
+    }
+
+    uint32_t IndexedMesh::GetIndicesCount() const {
+        if (m_lods.empty()) {
+            return m_countIndices;
+        }
+
+        return m_lods.front().indicesCount;
+    }
+
+    IndexRange IndexedMesh::GetLodRange(uint8_t lod) const {
+        if (m_lods.empty()) {
+            return IndexRange { 0, m_countIndices };
+        }
+
+        auto&& level = m_lods[SR_MIN(static_cast<size_t>(lod), m_lods.size() - 1)];
+        return IndexRange { level.firstIndex, level.indicesCount };
+    }
+
+    float_t IndexedMesh::GetLodError(uint8_t lod) const {
+        if (m_lods.empty()) {
+            return 0.f;
+        }
+
+        return m_lods[SR_MIN(static_cast<size_t>(lod), m_lods.size() - 1)].error;
+    }
+
+    void IndexedMesh::UpdateLods() {
+        m_lods.clear();
+        m_meshlets.clear();
+        m_boundingRadius = 0.f;
+
+        auto&& pOptimized = GetOptimizedMesh();
+
+        /// буфер индексов мог быть собран до того, как оптимизация была включена
+        if (!pOptimized || pOptimized->indices.size() != m_countIndices) {
+            return;
+        }
+
+        m_boundingRadius = pOptimized->boundingRadius;
+
+        if (pOptimized->lods.size() > 1) {
+            m_lods = pOptimized->lods;
+        }
+
+        if (IsClusterCullingSupported()) {
+            m_meshlets = pOptimized->meshlets;
+        }
+    }
+
+    int32_t IndexedMesh::GetVertexOffset() {
+        return m_isPooled ? static_cast<int32_t>(GeometryPool::Instance().GetOffset(m_VBO)) : 0;
+    }
+
+    bool IndexedMesh::IsQuantizationRequired() const {
+        if (!IsQuantizationSupported()) {
+            return false;
+        }
+
+        auto&& pShader = GetShader();
+        return pShader && pShader->GetVertexFormat() == SR_SRSL_NS::VertexFormat::Quantized;
+    }
+
+    bool IndexedMesh::IsVertexFormatOutdated() const {
+        if (!IsCalculated() || m_vertexType == Vertices::VertexType::Unknown) {
+            return false;
+        }
+
+        return Vertices::IsQuantizedVertexType(m_vertexType) != IsQuantizationRequired();
+    }
+
+    void IndexedMesh::UseQuantizationBounds() {
+        if (!Vertices::IsQuantizedVertexType(m_vertexType)) {
+            return;
+        }
+
+        auto&& pShader = m_pipeline->GetCurrentShader();
+        if (!pShader) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        pShader->SetVec3(SHADER_VERTEX_BOUNDS_MIN, SR_MATH_NS::FVector3(m_quantizationBounds.min.x, m_quantizationBounds.min.y, m_quantizationBounds.min.z));
+        pShader->SetVec3(SHADER_VERTEX_BOUNDS_SIZE, SR_MATH_NS::FVector3(m_quantizationBounds.size.x, m_quantizationBounds.size.y, m_quantizationBounds.size.z));
+    }
+
+    MeshOptimizer::OptimizedMeshPtr IndexedMesh::GetOptimizedMesh() const {
+        if (!IsOptimizable()) {
+            return nullptr;
+        }
+
+        if (auto&& pBaked = GetBakedMesh()) {
+            return pBaked->pOptimized;
+        }
+
+        return OptimizeSourceMesh();
+    }
+
+    MeshOptimizer::OptimizedMeshPtr IndexedMesh::OptimizeSourceMesh() const {
+        return MeshOptimizer::Instance().Optimize(GetMeshIdentifier(),
+            [this]() { return GetSourceVertices(); },
+            [this]() { return GetSourceIndices(); }
+        );
+    }
+
+    MeshCache::BakedMeshPtr IndexedMesh::GetBakedMesh() const {
+        if (!IsOptimizable()) {
+            return nullptr;
+        }
+
+        return MeshCache::Instance().Load(GetMeshIdentifier(), GetBakedMeshSource(), GetBakedMeshIndex(), [this]() -> std::shared_ptr<MeshCache::BakedMesh> {
+            /// запекается результат оптимизации, без нее кэшировать нечего
+            auto&& pOptimized = OptimizeSourceMesh();
+            if (!pOptimized) {
+                return nullptr;
+            }
+
+            auto&& pBaked = std::make_shared<MeshCache::BakedMesh>();
+            pBaked->pOptimized = pOptimized;
+            pBaked->bounds = Vertices::CalculateQuantizationBounds(MeshOptimizer::RemapVertices(*pOptimized, GetSourceVertices()));
+
+            OnMeshBaked(*pBaked);
+
+            return pBaked;
+        });
+    }
+
+    MeshCache::BakedMeshPtr IndexedMesh::FindBakedMesh() const {
+        if (!IsOptimizable()) {
+            return nullptr;
+        }
+
+        return MeshCache::Instance().Find(GetMeshIdentifier(), GetBakedMeshSource(), GetBakedMeshIndex());
+    }
+
+    std::vector<SR_UTILS_NS::Vertex> IndexedMesh::GetOptimizedVertices() const {
+        SR_TRACY_ZONE;
+
+        if (auto&& pOptimized = GetOptimizedMesh()) {
+            return MeshOptimizer::RemapVertices(*pOptimized, GetSourceVertices());
+        }
+
+        return GetSourceVertices();
+    }
+
+    std::vector<uint32_t> IndexedMesh::GetOptimizedIndices() const {
+        SR_TRACY_ZONE;
+
+        if (auto&& pOptimized = GetOptimizedMesh()) {
+            return pOptimized->indices;
+        }
+
+        return GetSourceIndices();
+    }
+}
@@ -5,6 +5,7 @@
 #include <Utils/Types/RawMesh.h>
 #include <Utils/Types/DataStorage.h>
 #include <Utils/ECS/ComponentManager.h>
+#include <Utils/Resources/ResourceManager.h>
 
 #include <Graphics/Types/Geometry/Mesh3D.h>
 #include <Graphics/Material/BaseMaterial.h>
@@ -18,7 +19,7 @@ namespace SR_GTYPES_NS {
     { }
 
     bool Mesh3D::Calculate()  {
-        if (IsCalculated()) {
+        if (IsCalculated() && !IsVertexFormatOutdated()) {
             return true;
         }
 
@@ -26,6 +27,11 @@ namespace SR_GTYPES_NS {
 
         FreeVideoMemory();
 
+        /// кэша нет или он устарел, геометрию придется собрать из исходника
+        if (!GetRawMesh() && !m_meshPath.IsEmpty() && !IsBakedMeshComplete()) {
+            SetRawMesh(m_meshPath);
+        }
+
         if (!IsCalculatable()) {
             return false;
         }
@@ -34,9 +40,18 @@ namespace SR_GTYPES_NS {
             SR_LOG("Mesh3D::Calculate() : calculating \"" + GetGeometryName() + "\"...");
         }
 
-        if (!CalculateVBO<Vertices::VertexType::StaticMeshVertex, Vertices::StaticMeshVertex>([this]() {
-            return Vertices::CastVertices<Vertices::StaticMeshVertex>(GetVertices());
-        })) {
+        bool isVBOCalculated = false;
+
+        if (IsQuantizationRequired()) {
+            isVBOCalculated = CalculateQuantizedVBO<Vertices::VertexType::QuantizedStaticMeshVertex, Vertices::QuantizedStaticMeshVertex>();
+        }
+        else {
+            isVBOCalculated = CalculateBakedVBO<Vertices::VertexType::StaticMeshVertex, Vertices::StaticMeshVertex>([this]() {
+                return Vertices::CastVertices<Vertices::StaticMeshVertex>(GetOptimizedVertices());
+            });
+        }
+
+        if (!isVBOCalculated) {
             return false;
         }
 
@@ -44,14 +59,72 @@ namespace SR_GTYPES_NS {
     }
 
     std::vector<uint32_t> Mesh3D::GetIndices() const {
+        return GetOptimizedIndices();
+    }
+
+    std::vector<SR_UTILS_NS::Vertex> Mesh3D::GetSourceVertices() const {
+        if (!GetRawMesh()) SR_UNLIKELY_ATTRIBUTE {
+            return { };
+        }
+
+        return GetVertices();
+    }
+
+    std::vector<uint32_t> Mesh3D::GetSourceIndices() const {
         SR_TRACY_ZONE;
-        return GetRawMesh()->GetIndices(GetMeshId());
+
+        if (auto&& pRawMesh = GetRawMesh()) SR_LIKELY_ATTRIBUTE {
+            return pRawMesh->GetIndices(GetMeshId());
+        }
+
+        return { };
+    }
+
+    SR_UTILS_NS::Path Mesh3D::GetBakedMeshSource() const {
+        if (m_meshPath.IsEmpty()) {
+            return SR_UTILS_NS::Path();
+        }
+
+        return SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat(m_meshPath);
+    }
+
+    bool Mesh3D::IsBakedMeshComplete() const {
+        auto&& pBaked = FindBakedMesh();
+        if (!pBaked) {
+            return false;
+        }
+
+        const auto vertexType = IsQuantizationRequired() ? Vertices::VertexType::QuantizedStaticMeshVertex : Vertices::VertexType::StaticMeshVertex;
+        return pBaked->FindStream(vertexType) != nullptr;
     }
 
     bool Mesh3D::IsCalculatable() const {
+        /// без исходника меш считается из кэша, а при его отсутствии исходник загрузится в Calculate
+        if (!GetRawMesh()) {
+            return !m_meshPath.IsEmpty() && Super::IsCalculatable();
+        }
+
         return IsValidMeshId() && Super::IsCalculatable();
     }
 
+    void Mesh3D::SetMeshPath(const SR_UTILS_NS::Path& path) {
+        if (m_meshPath == path) {
+            return;
+        }
+
+        m_meshPath = path;
+
+        if (GetRawMesh()) {
+            SetRawMesh(static_cast<SR_HTYPES_NS::RawMesh*>(nullptr));
+            return;
+        }
+
+        ReRegisterMesh();
+
+        MarkMaterialDirty();
+        m_isCalculated = false;
+    }
+
     void Mesh3D::UseMaterial() {
         Super::UseMaterial();
         UseModelMatrix();
@@ -60,11 +133,16 @@ namespace SR_GTYPES_NS {
     void Mesh3D::UseModelMatrix() {
         auto&& pShader = GetRenderContext()->GetCurrentShader();
         pShader->SetMat4(SHADER_MODEL_MATRIX, GetMatrix());
+        UseQuantizationBounds();
     }
 
     void Mesh3D::OnRawMeshChanged() {
         IRawMeshHolder::OnRawMeshChanged();
 
+        if (auto&& pRawMesh = GetRawMesh()) {
+            m_meshPath = pRawMesh->GetResourcePath();
+        }
+
         if (GetRawMesh() && IsValidMeshId()) {
             SetGeometryName(GetRawMesh()->GetGeometryName(GetMeshId()));
         }
@@ -82,6 +160,10 @@ namespace SR_GTYPES_NS {
             return SR_FORMAT("{}|{}|{}", pRawMesh->GetResourceId().c_str(), GetMeshId(), pRawMesh->GetReloadCount());
         }
 
+        if (!m_meshPath.IsEmpty()) {
+            return SR_FORMAT("{}|{}|0", m_meshPath.ToStringRef().c_str(), GetMeshId());
+        }
+
         return Super::GetMeshIdentifier();
     }
 
@@ -98,10 +180,10 @@ namespace SR_GTYPES_NS {
         m_properties.AddCustomProperty<SR_UTILS_NS::PathProperty>("Mesh")
             .AddFileFilter("Mesh", SR_GRAPH_NS::SR_SUPPORTED_MESH_FORMATS)
             .SetGetter([this]()-> SR_UTILS_NS::Path {
-                return GetRawMesh() ? GetRawMesh()->GetResourcePath() : SR_UTILS_NS::Path();
+                return m_meshPath;
             })
             .SetSetter([this](const SR_UTILS_NS::Path& path) {
-                SetRawMesh(path);
+                SetMeshPath(path);
             });
 
         m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Index")
@@ -98,7 +98,7 @@ namespace SR_GTYPES_NS {
                 SR_FALLTHROUGH;
             case Memory::UBOManager::BindResult::Success:
                 pShader->FlushConstants();
-                m_pipeline->DrawIndices(m_countIndices);
+                m_pipeline->DrawIndices(m_countIndices, GetFirstIndex(), GetVertexOffset());
                 break;
             case Memory::UBOManager::BindResult::Failed:
             default:
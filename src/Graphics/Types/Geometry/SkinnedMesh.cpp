@@ -2,6 +2,8 @@
 // Created by Igor on 27/11/2022.
 //
 
+#include <Utils/Resources/ResourceManager.h>
+
 #include <Graphics/Types/Geometry/SkinnedMesh.h>
 
 namespace SR_GTYPES_NS {
@@ -22,12 +24,17 @@ namespace SR_GTYPES_NS {
     bool SkinnedMesh::Calculate()  {
         SR_TRACY_ZONE;
 
-        if (IsCalculated()) {
+        if (IsCalculated() && !IsVertexFormatOutdated()) {
             return true;
         }
 
         FreeVideoMemory();
 
+        /// кэша нет или он устарел, геометрию и таблицы скелета придется собрать из исходника
+        if (!GetRawMesh() && !m_meshPath.IsEmpty() && !IsBakedMeshComplete()) {
+            SetRawMesh(m_meshPath);
+        }
+
         if (!IsCalculatable()) {
             return false;
         }
@@ -36,14 +43,41 @@ namespace SR_GTYPES_NS {
             SR_LOG("SkinnedMesh::Calculate() : calculating \"" + m_geometryName + "\"...");
         }
 
-        if (!CalculateVBO<Vertices::VertexType::SkinnedMeshVertex, Vertices::SkinnedMeshVertex>([this]() {
-            return Vertices::CastVertices<Vertices::SkinnedMeshVertex>(GetVertices());
-        })) {
+        bool isVBOCalculated = false;
+
+        if (IsQuantizationRequired()) {
+            isVBOCalculated = CalculateQuantizedVBO<Vertices::VertexType::QuantizedSkinnedMeshVertex, Vertices::QuantizedSkinnedMeshVertex>();
+        }
+        else {
+            isVBOCalculated = CalculateBakedVBO<Vertices::VertexType::SkinnedMeshVertex, Vertices::SkinnedMeshVertex>([this]() {
+                return Vertices::CastVertices<Vertices::SkinnedMeshVertex>(GetOptimizedVertices());
+            });
+        }
+
+        if (!isVBOCalculated) {
+            return false;
+        }
+
+        m_bones.clear();
+        m_boneOffsets.clear();
+
+        if (auto&& pBaked = GetBakedMesh()) SR_LIKELY_ATTRIBUTE {
+            for (auto&& [name, index] : pBaked->bones) {
+                m_bones.emplace(SR_UTILS_NS::StringAtom(name), index);
+            }
+            m_boneOffsets = pBaked->boneOffsets;
+        }
+        else if (auto&& pRawMesh = GetRawMesh()) {
+            m_bones = pRawMesh->GetOptimizedBones();
+            m_boneOffsets = pRawMesh->GetBoneOffsets();
+        }
+        else {
+            SR_ERROR("SkinnedMesh::Calculate() : no skeleton tables for \"" + m_geometryName + "\"!");
             return false;
         }
 
-        const uint32_t sizeBones = GetRawMesh()->GetOptimizedBones().size() * sizeof(SR_MATH_NS::Matrix4x4);
-        const uint32_t sizeOffsets = GetRawMesh()->GetBoneOffsets().size() * sizeof(SR_MATH_NS::Matrix4x4);
+        const uint32_t sizeBones = m_bones.size() * sizeof(SR_MATH_NS::Matrix4x4);
+        const uint32_t sizeOffsets = m_boneOffsets.size() * sizeof(SR_MATH_NS::Matrix4x4);
 
         m_ssboBones = GetPipeline()->AllocateSSBO(sizeBones, SSBOUsage::Write);
         m_ssboOffsets = GetPipeline()->AllocateSSBO(sizeOffsets, SSBOUsage::Write);
@@ -62,13 +96,59 @@ namespace SR_GTYPES_NS {
     }
 
     std::vector<uint32_t> SkinnedMesh::GetIndices() const {
-        return GetRawMesh()->GetIndices(GetMeshId());
+        return GetOptimizedIndices();
+    }
+
+    std::vector<SR_UTILS_NS::Vertex> SkinnedMesh::GetSourceVertices() const {
+        if (!GetRawMesh()) SR_UNLIKELY_ATTRIBUTE {
+            return { };
+        }
+
+        return GetVertices();
+    }
+
+    std::vector<uint32_t> SkinnedMesh::GetSourceIndices() const {
+        if (auto&& pRawMesh = GetRawMesh()) SR_LIKELY_ATTRIBUTE {
+            return pRawMesh->GetIndices(GetMeshId());
+        }
+
+        return { };
     }
 
     bool SkinnedMesh::IsCalculatable() const {
+        /// без исходника меш считается из кэша, а при его отсутствии исходник загрузится в Calculate
+        if (!GetRawMesh()) {
+            return !m_meshPath.IsEmpty() && Mesh::IsCalculatable();
+        }
+
         return IsValidMeshId() && Mesh::IsCalculatable();
     }
 
+    bool SkinnedMesh::IsBakedMeshComplete() const {
+        auto&& pBaked = FindBakedMesh();
+        if (!pBaked) {
+            return false;
+        }
+
+        const auto vertexType = IsQuantizationRequired() ? Vertices::VertexType::QuantizedSkinnedMeshVertex : Vertices::VertexType::SkinnedMeshVertex;
+        return pBaked->FindStream(vertexType) != nullptr;
+    }
+
+    void SkinnedMesh::SetMeshPath(const SR_UTILS_NS::Path& path) {
+        if (m_meshPath == path) {
+            return;
+        }
+
+        m_meshPath = path;
+
+        if (GetRawMesh()) {
+            SetRawMesh(static_cast<SR_HTYPES_NS::RawMesh*>(nullptr));
+            return;
+        }
+
+        OnMeshSourceChanged();
+    }
+
     bool SkinnedMesh::IsSkeletonUsable() const {
         return GetSkeleton().GetComponent<SR_ANIMATIONS_NS::Skeleton>();
     }
@@ -118,6 +198,7 @@ namespace SR_GTYPES_NS {
         SRAssert(pShader);
 
         pShader->SetMat4(SHADER_MODEL_MATRIX, GetMatrix());
+        UseQuantizationBounds();
 
         auto&& pSkeleton = GetSkeleton().GetComponent<SR_ANIMATIONS_NS::Skeleton>();
         auto&& pRenderScene = GetRenderScene();
@@ -162,12 +243,31 @@ namespace SR_GTYPES_NS {
         return changed;
     }
 
+    SR_UTILS_NS::Path SkinnedMesh::GetBakedMeshSource() const {
+        if (m_meshPath.IsEmpty()) {
+            return SR_UTILS_NS::Path();
+        }
+
+        return SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat(m_meshPath);
+    }
+
+    void SkinnedMesh::OnMeshBaked(MeshCache::BakedMesh& bakedMesh) const {
+        auto&& pRawMesh = GetRawMesh();
+        if (!pRawMesh) SR_UNLIKELY_ATTRIBUTE {
+            return;
+        }
+
+        for (auto&& [name, index] : pRawMesh->GetOptimizedBones()) {
+            bakedMesh.bones.emplace_back(name.ToStringRef(), index);
+        }
+
+        bakedMesh.boneOffsets = pRawMesh->GetBoneOffsets();
+    }
+
     bool SkinnedMesh::PopulateSkeletonMatrices() {
         SR_TRACY_ZONE;
 
-        auto&& bones = GetRawMesh()->GetOptimizedBones();
-
-        if (bones.empty()) {
+        if (m_bones.empty()) {
             return false;
         }
 
@@ -177,8 +277,8 @@ namespace SR_GTYPES_NS {
             return false;
         }
 
-        pSkeleton->SetOptimizedBones(GetRawMesh()->GetOptimizedBones());
-        pSkeleton->SetBonesOffsets(GetRawMesh()->GetBoneOffsets());
+        pSkeleton->SetOptimizedBones(m_bones);
+        pSkeleton->SetBonesOffsets(m_boneOffsets);
 
         return true;
     }
@@ -186,10 +286,18 @@ namespace SR_GTYPES_NS {
     void SkinnedMesh::OnRawMeshChanged() {
         IRawMeshHolder::OnRawMeshChanged();
 
+        if (auto&& pRawMesh = GetRawMesh()) {
+            m_meshPath = pRawMesh->GetResourcePath();
+        }
+
         if (GetRawMesh() && IsValidMeshId()) {
             SetGeometryName(GetRawMesh()->GetGeometryName(GetMeshId()));
         }
 
+        OnMeshSourceChanged();
+    }
+
+    void SkinnedMesh::OnMeshSourceChanged() {
         if (GetSkeleton().IsValid()) {
             if (auto&& pSkeleton = GetSkeleton().GetComponent<SR_ANIMATIONS_NS::Skeleton>()) {
                 pSkeleton->ResetSkeleton();
@@ -207,6 +315,10 @@ namespace SR_GTYPES_NS {
             return SR_FORMAT("{}|{}|{}", pRawMesh->GetResourceId().c_str(), GetMeshId(), pRawMesh->GetReloadCount());
         }
 
+        if (!m_meshPath.IsEmpty()) {
+            return SR_FORMAT("{}|{}|0", m_meshPath.ToStringRef().c_str(), GetMeshId());
+        }
+
         return Super::GetMeshIdentifier();
     }
 
@@ -214,10 +326,10 @@ namespace SR_GTYPES_NS {
         m_properties.AddCustomProperty<SR_UTILS_NS::PathProperty>("Mesh")
             .AddFileFilter("Mesh", SR_GRAPH_NS::SR_SUPPORTED_MESH_FORMATS)
             .SetGetter([this]()-> SR_UTILS_NS::Path {
-                return GetRawMesh() ? GetRawMesh()->GetResourcePath() : SR_UTILS_NS::Path();
+                return m_meshPath;
             })
             .SetSetter([this](const SR_UTILS_NS::Path& path) {
-                SetRawMesh(path);
+                SetMeshPath(path);
             });
 
         m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Index")
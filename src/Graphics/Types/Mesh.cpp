@@ -11,6 +11,7 @@
 #include <Graphics/Render/RenderStrategy.h>
 #include <Graphics/Render/RenderQueue.h>
 #include <Graphics/Utils/MeshUtils.h>
+#include <Graphics/Memory/IndirectDrawBuffer.h>
 #include <Graphics/Material/FileMaterial.h>
 
 namespace SR_GTYPES_NS {
@@ -192,8 +193,12 @@ namespace SR_GTYPES_NS {
         }
 
         if (result != DescriptorManager::BindResult::Failed) SR_UNLIKELY_ATTRIBUTE {
-            if (IsSupportVBO()) {
-                m_pipeline->DrawIndices(GetIndicesCount());
+            if (IsSupportVBO() && m_indirectBuffer != SR_ID_INVALID) {
+                /// все слоты меша лежат подряд и отправляются одним вызовом
+                m_pipeline->DrawIndicesIndirect(m_indirectBuffer, m_indirectOffset, m_indirectDrawsCount);
+            }
+            else if (IsSupportVBO()) {
+                m_pipeline->DrawIndices(GetIndicesCount(), GetFirstIndex(), GetVertexOffset());
             }
             else {
                 m_pipeline->Draw(GetIndicesCount());
@@ -203,6 +208,12 @@ namespace SR_GTYPES_NS {
         m_dirtyMaterial = false;
     }
 
+    void Mesh::SetIndirectDraws(int32_t buffer, uint32_t offset, uint32_t count) noexcept {
+        m_indirectBuffer = buffer;
+        m_indirectOffset = offset;
+        m_indirectDrawsCount = count;
+    }
+
     void Mesh::UseSamplers() {
         if (auto&& pMaterial = m_materialProperty.GetMaterial()) {
             pMaterial->UseSamplers();
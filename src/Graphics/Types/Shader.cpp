@@ -12,12 +12,13 @@
 #include <Graphics/Types/Texture.h>
 #include <Graphics/Render/RenderContext.h>
 #include <Graphics/Types/Shader.h>
+#include <Graphics/Memory/BindlessTextureTable.h>
 #include <Graphics/SRSL/Shader.h>
 #include <Graphics/SRSL/TypeInfo.h>
 
 namespace SR_GRAPH_NS::Types {
     Shader::Shader()
-        : IResource(SR_COMPILE_TIME_CRC32_TYPE_NAME(Shader))
+        : Memory::ContextResource<Shader>(SR_COMPILE_TIME_CRC32_TYPE_NAME(Shader))
         , m_manager(Memory::ShaderProgramManager::Instance())
         , m_uboManager(Memory::UBOManager::Instance())
     { }
@@ -251,6 +252,10 @@ namespace SR_GRAPH_NS::Types {
     void Shader::SetConstVec2(uint64_t hashId, const SR_MATH_NS::FVector2& v) noexcept { SetValue<true>(hashId, &v); }
     void Shader::SetConstIVec2(uint64_t hashId, const SR_MATH_NS::IVector2& v) noexcept { SetValue<true>(hashId, &v); }
 
+    void Shader::SetUniformRange(uint32_t offset, const void* pData, uint32_t size) noexcept {
+        m_uniformBlock.SetRange(offset, pData, size);
+    }
+
     void Shader::SetSampler(SR_UTILS_NS::StringAtom name, int32_t sampler) noexcept {
         m_samplers.at(name).samplerId = sampler;
     }
@@ -423,6 +428,7 @@ namespace SR_GRAPH_NS::Types {
 
         m_shaderCreateInfo = pShader->GetCreateInfo();
         m_type = pShader->GetType();
+        m_vertexFormat = pShader->GetVertexFormat();
         m_includes = pShader->GetIncludes();
 
         if (m_includes.empty()) {
@@ -499,6 +505,8 @@ namespace SR_GRAPH_NS::Types {
             m_samplers[name].binding = sampler.binding;
             m_samplers[name].isAttachment = sampler.attachment >= 0;
             m_samplers[name].isArray = sampler.type.Contains("Array");
+            m_samplers[name].isBindless = sampler.count > 1;
+            m_hasBindlessTextures |= m_samplers[name].isBindless;
             m_samplers[name].defaultValue = sampler.defaultValue;
 
             if (!sampler.defaultValue.empty()) {
@@ -546,6 +554,7 @@ namespace SR_GRAPH_NS::Types {
         m_includes.clear();
         m_properties.clear();
         m_samplers.clear();
+        m_hasBindlessTextures = false;
 
         UnloadDefaultSamplers();
 
@@ -578,6 +587,11 @@ namespace SR_GRAPH_NS::Types {
 
     void Shader::FlushSamplers() {
         for (auto&& [hashName, samplerInfo] : m_samplers) {
+            /// массив перезаписывается только при смене поколения таблицы, см. AttachDescriptorSets
+            if (samplerInfo.isBindless) {
+                continue;
+            }
+
             if (samplerInfo.isAttachment) {
                 m_pipeline->BindAttachment(samplerInfo.binding, samplerInfo.samplerId);
             }
@@ -684,7 +698,10 @@ namespace SR_GRAPH_NS::Types {
         SR_TRACY_ZONE;
 
         for (auto&& [hashName, samplerInfo] : m_samplers) {
-            if (samplerInfo.isAttachment) {
+            if (samplerInfo.isBindless) {
+                m_pipeline->BindTextureArray(samplerInfo.binding, BindlessTextureTable::Instance().GetTextures());
+            }
+            else if (samplerInfo.isAttachment) {
                 m_pipeline->BindAttachment(samplerInfo.binding, samplerInfo.samplerId);
             }
             else {
@@ -703,7 +720,7 @@ namespace SR_GRAPH_NS::Types {
             SRDescriptorUpdateInfo updateInfo;
             updateInfo.binding = m_uniformBlock.m_binding;
             updateInfo.ubo = ubo;
-            updateInfo.descriptorType = DescriptorType::Uniform;
+            updateInfo.descriptorType = DescriptorType::DynamicUniform;
 
             GetPipeline()->UpdateDescriptorSets(descriptorSet, { updateInfo });
         }
@@ -732,4 +749,59 @@ namespace SR_GRAPH_NS::Types {
             ssbo.ssbo = SR_ID_INVALID;
         }
     }
+
+    void Shader::CollectDescriptorBindings(DescriptorBindings& bindings) const {
+        for (auto&& [hashName, samplerInfo] : m_samplers) {
+            /// содержимое массива определяется поколением таблицы
+            if (samplerInfo.isBindless) {
+                bindings.emplace_back(DescriptorBinding {
+                    .binding = samplerInfo.binding,
+                    .type = DescriptorType::CombinedImage,
+                    .generation = BindlessTextureTable::Instance().GetGeneration()
+                });
+                continue;
+            }
+
+            bindings.emplace_back(DescriptorBinding {
+                .binding = samplerInfo.binding,
+                .type = DescriptorType::CombinedImage,
+                .resource = static_cast<int32_t>(samplerInfo.samplerId),
+                .isAttachment = samplerInfo.isAttachment
+            });
+        }
+
+        /// буфер объекта выбирается смещением при привязке, в ключ входит только его страница,
+        /// поэтому объекты одного материала получают один набор
+        if (m_uniformBlock.Valid()) SR_LIKELY_ATTRIBUTE {
+            bindings.emplace_back(DescriptorBinding {
+                .binding = m_uniformBlock.GetBinding(),
+                .type = DescriptorType::DynamicUniform,
+                .resource = GetPipeline()->GetUBOPage(GetPipeline()->GetCurrentUBO()),
+                .range = m_uniformBlock.GetSize()
+            });
+        }
+
+        if (m_uniformSharedBlock.Valid()) {
+            bindings.emplace_back(DescriptorBinding {
+                .binding = m_uniformSharedBlock.GetBinding(),
+                .type = DescriptorType::Uniform,
+                .resource = m_uboManager.GetUBO(m_virtualUBO.first),
+                .range = m_uniformSharedBlock.GetSize()
+            });
+        }
+
+        for (auto&& ssbo : m_ssboBindings) {
+            bindings.emplace_back(DescriptorBinding {
+                .binding = ssbo.binding,
+                .type = DescriptorType::Storage,
+                .resource = static_cast<int32_t>(ssbo.ssbo)
+            });
+        }
+    }
+
+    void Shader::DiscardSSBOBindings() noexcept {
+        for (auto&& ssbo : m_ssboBindings) {
+            ssbo.ssbo = SR_ID_INVALID;
+        }
+    }
 }
\ No newline at end of file
@@ -15,10 +15,11 @@
 #include <Graphics/Memory/UBOManager.h>
 #include <Graphics/Memory/DescriptorManager.h>
 #include <Graphics/Pipeline/Pipeline.h>
+#include <Graphics/Render/RenderContext.h>
 
 namespace SR_GTYPES_NS {
     Skybox::Skybox()
-        : IResource(SR_COMPILE_TIME_CRC32_TYPE_NAME(Skybox))
+        : Memory::ContextResource<Skybox>(SR_COMPILE_TIME_CRC32_TYPE_NAME(Skybox))
         , m_uboManager(Memory::UBOManager::Instance())
         , m_descriptorManager(DescriptorManager::Instance())
     { }
@@ -8,13 +8,19 @@
 #include <Graphics/Types/Texture.h>
 #include <Graphics/Loaders/TextureLoader.h>
 #include <Graphics/Render/RenderContext.h>
+#include <Graphics/Memory/BindlessTextureTable.h>
+#include <Graphics/Memory/TextureStreamer.h>
 
 namespace SR_GTYPES_NS {
     Texture::Texture()
-        : IResource(SR_COMPILE_TIME_CRC32_TYPE_NAME(Texture))
+        : Memory::ContextResource<Texture>(SR_COMPILE_TIME_CRC32_TYPE_NAME(Texture))
     { }
 
     Texture::~Texture() {
+        if (m_isStreamed) {
+            TextureStreamer::Instance().Unregister(this);
+        }
+
         FreeTextureData();
     }
 
@@ -90,6 +96,11 @@ namespace SR_GTYPES_NS {
     bool Texture::Unload() {
         bool hasErrors = !IResource::Unload();
 
+        if (m_isStreamed) {
+            TextureStreamer::Instance().Unregister(this);
+            m_isStreamed = false;
+        }
+
         FreeTextureData();
 
         m_isCalculated = false;
@@ -112,8 +123,12 @@ namespace SR_GTYPES_NS {
                 path = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat(path);
             }
 
-            m_textureData = TextureLoader::Load(path);
-            if (!m_textureData) {
+            /// данные декодируются в фоне, до загрузки в видеопамять используется заглушка
+            if (!m_config.m_cpuUsage && TextureStreamer::Instance().IsEnabled()) {
+                m_isStreamed = TextureStreamer::Instance().Register(this, path);
+            }
+
+            if (!m_isStreamed && !(m_textureData = TextureLoader::Load(path, m_config))) {
                 SR_ERROR("Texture::Load() : failed to load texture!");
                 hasErrors |= true;
             }
@@ -177,6 +192,12 @@ namespace SR_GTYPES_NS {
         createInfo.mipLevels = m_config.m_mipLevels;
         createInfo.filter = m_config.m_filter;
 
+        if (m_textureData->HasMipChain()) {
+            for (uint8_t level = 0; level < m_textureData->GetMipCount(); ++level) {
+                createInfo.mipChain.emplace_back(m_textureData->GetMipLevel(level));
+            }
+        }
+
         m_id = m_pipeline->AllocateTexture(createInfo);
 
         EVK_POP_LOG_LEVEL();
@@ -212,6 +233,10 @@ namespace SR_GTYPES_NS {
             SR_ERROR("Texture::FreeVideoMemory() : failed to free texture!");
         }
 
+        if (m_isStreamed) {
+            TextureStreamer::Instance().OnFreeVideoMemory(this);
+        }
+
         IGraphicsResource::FreeVideoMemory();
     }
 
@@ -234,6 +259,11 @@ namespace SR_GTYPES_NS {
             return SR_ID_INVALID;
         }
 
+        if (m_isStreamed) {
+            TextureStreamer::Instance().Touch(this);
+            return m_id == SR_ID_INVALID ? TextureStreamer::Instance().GetPlaceholderTexture() : m_id;
+        }
+
         if (!m_isCalculated && !Calculate()) {
             SR_ERROR("Texture::GetId() : failed to calculate the texture!");
             m_hasErrors = true;
@@ -243,6 +273,10 @@ namespace SR_GTYPES_NS {
         return m_id;
     }
 
+    int32_t Texture::GetBindlessSlot() noexcept {
+        return BindlessTextureTable::Instance().Acquire(GetId());
+    }
+
     Texture* Texture::LoadFromMemory(const std::string& data, const Memory::TextureConfig &config) {
         SR_TRACY_ZONE;
 
@@ -281,17 +315,36 @@ namespace SR_GTYPES_NS {
         m_textureData.Reset();
     }
 
-    SR_UTILS_NS::IResource::RemoveUPResult Texture::RemoveUsePoint() {
-        SRAssert2(!(IsCalculated() && GetCountUses() == 1), "Possible multi threading error!");
-        return IResource::RemoveUsePoint();
+    int32_t Texture::OnStreamed(int32_t id, uint32_t width, uint32_t height) {
+        if (!m_context) {
+            if (!SRVerifyFalse2(!(m_context = SR_THIS_THREAD->GetContext()->GetValue<RenderContextPtr>()), "Is not render context!")) {
+                return id;
+            }
+
+            m_context.Do([this](RenderContext* ptr) {
+                ptr->Register(this);
+            });
+        }
+
+        const int32_t previousId = m_id;
+
+        m_id = id;
+        m_streamedSize = SR_MATH_NS::UVector2(width, height);
+        m_isCalculated = true;
+
+        m_context.Do([](RenderContext* ptr) {
+            ptr->SetDirty();
+        });
+
+        return previousId;
     }
 
     uint32_t Texture::GetWidth() const noexcept {
-        return m_textureData ? m_textureData->GetWidth() : 0;
+        return m_textureData ? m_textureData->GetWidth() : m_streamedSize.x;
     }
 
     uint32_t Texture::GetHeight() const noexcept {
-        return m_textureData ? m_textureData->GetHeight() : 0;
+        return m_textureData ? m_textureData->GetHeight() : m_streamedSize.y;
     }
 
     uint32_t Texture::GetChannels() const noexcept {
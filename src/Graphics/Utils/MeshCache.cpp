@@ -0,0 +1,369 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Common/Features.h>
+#include <Utils/Common/ToString.h>
+#include <Utils/FileSystem/FileSystem.h>
+#include <Utils/Resources/ResourceManager.h>
+
+#include <Graphics/Utils/MeshCache.h>
+
+#include <filesystem>
+
+namespace SR_GRAPH_NS {
+    const MeshCache::Stream* MeshCache::BakedMesh::FindStream(Vertices::VertexType type) const {
+        for (auto&& stream : streams) {
+            if (stream.type == type) {
+                return &stream;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool MeshCache::IsEnabled() const {
+        return SR_UTILS_NS::Features::Instance().Enabled("MeshCaching", true);
+    }
+
+    MeshCache::BakedMeshPtr MeshCache::Load(const std::string& identifier, const SR_UTILS_NS::Path& source, uint32_t index, const BakeFn& bake) {
+        if (!IsEnabled() || source.IsEmpty()) {
+            return nullptr;
+        }
+
+        if (auto&& pBaked = Find(identifier, source, index)) {
+            return pBaked;
+        }
+
+        SR_TRACY_ZONE;
+
+        auto&& pNewMesh = bake();
+        if (pNewMesh) {
+            pNewMesh->cachePath = GetCachePath(source, index);
+            pNewMesh->sourceHash = GetSourceHash(source);
+
+            if (!Save(*pNewMesh)) {
+                SR_ERROR("MeshCache::Load() : failed to save mesh to cache \"" + pNewMesh->cachePath.ToStringRef() + "\"!");
+            }
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        /// другой поток мог успеть загрузить тот же меш
+        if (auto&& pIt = m_cache.find(identifier); pIt != m_cache.end()) {
+            return pIt->second;
+        }
+
+        m_cache[identifier] = pNewMesh;
+
+        return pNewMesh;
+    }
+
+    MeshCache::BakedMeshPtr MeshCache::Find(const std::string& identifier, const SR_UTILS_NS::Path& source, uint32_t index) {
+        if (!IsEnabled() || source.IsEmpty()) {
+            return nullptr;
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (auto&& pIt = m_cache.find(identifier); pIt != m_cache.end() && pIt->second) {
+                return pIt->second;
+            }
+        }
+
+        SR_TRACY_ZONE;
+
+        auto&& cachePath = GetCachePath(source, index);
+        if (!cachePath.Exists(SR_UTILS_NS::Path::Type::File)) {
+            return nullptr;
+        }
+
+        auto&& pBaked = LoadFromFile(cachePath, GetSourceHash(source));
+        if (!pBaked) {
+            return nullptr;
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        auto&& [pIt, isInserted] = m_cache.try_emplace(identifier, pBaked);
+        if (!isInserted && pIt->second) {
+            return pIt->second;
+        }
+
+        pIt->second = pBaked;
+
+        MeshOptimizer::Instance().AddStatistics(*pBaked->pOptimized);
+
+        return pBaked;
+    }
+
+    SR_UTILS_NS::Path MeshCache::GetCachePath(const SR_UTILS_NS::Path& source, uint32_t index) {
+        /// каждый меш файла лежит в отдельном файле кэша
+        const uint64_t hashName = SR_UTILS_NS::HashCombine(index, SR_HASH(source.ConvertToFileName()));
+
+        return SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Meshes")
+            .Concat(source.GetBaseNameAndExt() + "." + SR_UTILS_NS::ToString(hashName))
+            .ConcatExt(".mesh");
+    }
+
+    uint64_t MeshCache::GetSourceHash(const SR_UTILS_NS::Path& source) {
+        std::error_code error;
+
+        const int64_t writeTime = static_cast<int64_t>(std::filesystem::last_write_time(source.ToStringRef(), error).time_since_epoch().count());
+        const uint64_t fileSize = error ? 0 : static_cast<uint64_t>(std::filesystem::file_size(source.ToStringRef(), error));
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (auto&& pIt = m_sourceHashes.find(source.ToStringRef()); !error && pIt != m_sourceHashes.end()) {
+                if (pIt->second.writeTime == writeTime && pIt->second.fileSize == fileSize) {
+                    return pIt->second.hash;
+                }
+            }
+        }
+
+        SR_TRACY_ZONE;
+
+        const uint64_t hash = SR_UTILS_NS::HashCombine(MESH_CACHE_VERSION, source.GetFileHash());
+
+        if (!error) {
+            std::lock_guard lock(m_mutex);
+            m_sourceHashes[source.ToStringRef()] = SourceHash { writeTime, fileSize, hash };
+        }
+
+        return hash;
+    }
+
+    void MeshCache::AddStream(const std::string& identifier, const BakedMeshPtr& pBaked, Vertices::VertexType type, const void* pData, uint32_t stride, uint32_t count) {
+        if (!pBaked || !pData || count == 0 || pBaked->FindStream(type)) {
+            return;
+        }
+
+        SR_TRACY_ZONE;
+
+        std::lock_guard lock(m_mutex);
+
+        auto&& pIt = m_cache.find(identifier);
+
+        /// меш мог быть перезапечен, а поток - уже дописан другим мешем с тем же идентификатором
+        if (pIt == m_cache.end() || !pIt->second || pIt->second->sourceHash != pBaked->sourceHash || pIt->second->FindStream(type)) {
+            return;
+        }
+
+        auto&& pNewMesh = std::make_shared<BakedMesh>(*pIt->second);
+
+        auto&& stream = pNewMesh->streams.emplace_back();
+        stream.type = type;
+        stream.stride = stride;
+        stream.count = count;
+        stream.data.assign(static_cast<const uint8_t*>(pData), static_cast<const uint8_t*>(pData) + static_cast<size_t>(stride) * count);
+
+        if (!Save(*pNewMesh)) {
+            SR_ERROR("MeshCache::AddStream() : failed to save mesh to cache \"" + pNewMesh->cachePath.ToStringRef() + "\"!");
+        }
+
+        pIt->second = pNewMesh;
+    }
+
+    void MeshCache::Clear() {
+        std::lock_guard lock(m_mutex);
+        m_cache.clear();
+        m_sourceHashes.clear();
+    }
+
+    bool MeshCache::Save(const BakedMesh& mesh) {
+        SR_TRACY_ZONE;
+
+        if (!mesh.pOptimized) SR_UNLIKELY_ATTRIBUTE {
+            return false;
+        }
+
+        if (!mesh.cachePath.Create()) {
+            SR_ERROR("MeshCache::Save() : failed to create path! \nPath: \"" + mesh.cachePath.GetFolder().ToString() + "\".");
+            return false;
+        }
+
+        auto&& optimized = *mesh.pOptimized;
+        auto&& marshal = SR_HTYPES_NS::Marshal();
+
+        marshal.Write<uint32_t>(MESH_CACHE_MAGIC);
+        marshal.Write<uint32_t>(MESH_CACHE_VERSION);
+        marshal.Write<uint64_t>(mesh.sourceHash);
+
+        marshal.Write<float_t>(mesh.bounds.min.x);
+        marshal.Write<float_t>(mesh.bounds.min.y);
+        marshal.Write<float_t>(mesh.bounds.min.z);
+        marshal.Write<float_t>(mesh.bounds.size.x);
+        marshal.Write<float_t>(mesh.bounds.size.y);
+        marshal.Write<float_t>(mesh.bounds.size.z);
+        marshal.Write<float_t>(optimized.boundingRadius);
+
+        /// статистика кэша вершин сохраняется, чтобы меши из кэша тоже попадали в MeshOptimizer::GetStatistics
+        for (auto&& statistics : { optimized.before, optimized.after }) {
+            marshal.Write<float_t>(statistics.acmr);
+            marshal.Write<float_t>(statistics.atvr);
+            marshal.Write<uint32_t>(statistics.vertices);
+            marshal.Write<uint32_t>(statistics.triangles);
+        }
+
+        marshal.Write<uint32_t>(static_cast<uint32_t>(optimized.lods.size()));
+        for (auto&& lod : optimized.lods) {
+            marshal.Write<uint32_t>(lod.firstIndex);
+            marshal.Write<uint32_t>(lod.indicesCount);
+            marshal.Write<float_t>(lod.error);
+        }
+
+        marshal.WriteBlock(optimized.indices.data(), optimized.indices.size() * sizeof(uint32_t));
+        marshal.WriteBlock(optimized.vertexRemap.data(), optimized.vertexRemap.size() * sizeof(uint32_t));
+        marshal.WriteBlock(optimized.meshlets.data(), optimized.meshlets.size() * sizeof(Meshlet));
+
+        /// потоки пишутся как есть, при загрузке они копируются в VBO без преобразования
+        marshal.Write<uint32_t>(static_cast<uint32_t>(mesh.streams.size()));
+        for (auto&& stream : mesh.streams) {
+            marshal.Write<uint32_t>(static_cast<uint32_t>(stream.type));
+            marshal.Write<uint32_t>(stream.stride);
+            marshal.Write<uint32_t>(stream.count);
+            marshal.WriteBlock(stream.data.data(), stream.data.size());
+        }
+
+        marshal.Write<uint32_t>(static_cast<uint32_t>(mesh.bones.size()));
+        for (auto&& [name, boneIndex] : mesh.bones) {
+            marshal.Write<std::string>(name);
+            marshal.Write<uint16_t>(boneIndex);
+        }
+
+        marshal.WriteBlock(mesh.boneOffsets.data(), mesh.boneOffsets.size() * sizeof(SR_MATH_NS::Matrix4x4));
+
+        return marshal.Save(mesh.cachePath);
+    }
+
+    MeshCache::BakedMeshPtr MeshCache::LoadFromFile(const SR_UTILS_NS::Path& path, uint64_t sourceHash) {
+        SR_TRACY_ZONE;
+
+        std::error_code error;
+        const uint64_t fileSize = static_cast<uint64_t>(std::filesystem::file_size(path.ToStringRef(), error));
+        if (error) {
+            SR_ERROR("MeshCache::LoadFromFile() : failed to get file size \"" + path.ToString() + "\"!");
+            return nullptr;
+        }
+
+        /// весь файл читается одним блоком
+        auto&& marshal = SR_HTYPES_NS::Marshal::Load(path);
+        if (!marshal) {
+            SR_ERROR("MeshCache::LoadFromFile() : failed to load marshal from path \"" + path.ToString() + "\"!");
+            return nullptr;
+        }
+
+        if (marshal.Read<uint32_t>() != MESH_CACHE_MAGIC || marshal.Read<uint32_t>() != MESH_CACHE_VERSION) {
+            SR_WARN("MeshCache::LoadFromFile() : invalid mesh cache format \"" + path.ToString() + "\"!");
+            return nullptr;
+        }
+
+        /// исходник изменился, меш будет запечен заново
+        if (marshal.Read<uint64_t>() != sourceHash) {
+            return nullptr;
+        }
+
+        /// размеры берутся из файла, поэтому не могут превышать его длину, иначе файл испорчен
+        auto&& isCountValid = [fileSize](uint64_t count, uint64_t elementSize) -> bool {
+            return count <= fileSize / elementSize;
+        };
+
+        auto&& readBlock = [&marshal, fileSize](auto& data, uint64_t elementSize) -> bool {
+            auto&& size = marshal.Read<uint64_t>();
+            if (size > fileSize || size % elementSize != 0) {
+                return false;
+            }
+
+            data.resize(size / elementSize);
+
+            if (size > 0) {
+                marshal.Stream::Read(reinterpret_cast<uint8_t*>(data.data()), size);
+            }
+
+            return true;
+        };
+
+        auto&& pMesh = std::make_shared<BakedMesh>();
+        auto&& pOptimized = std::make_shared<MeshOptimizer::OptimizedMesh>();
+
+        pMesh->cachePath = path;
+        pMesh->sourceHash = sourceHash;
+
+        pMesh->bounds.min.x = marshal.Read<float_t>();
+        pMesh->bounds.min.y = marshal.Read<float_t>();
+        pMesh->bounds.min.z = marshal.Read<float_t>();
+        pMesh->bounds.size.x = marshal.Read<float_t>();
+        pMesh->bounds.size.y = marshal.Read<float_t>();
+        pMesh->bounds.size.z = marshal.Read<float_t>();
+        pOptimized->boundingRadius = marshal.Read<float_t>();
+
+        for (auto* pStatistics : { &pOptimized->before, &pOptimized->after }) {
+            pStatistics->acmr = marshal.Read<float_t>();
+            pStatistics->atvr = marshal.Read<float_t>();
+            pStatistics->vertices = marshal.Read<uint32_t>();
+            pStatistics->triangles = marshal.Read<uint32_t>();
+        }
+
+        const uint32_t lodsCount = marshal.Read<uint32_t>();
+        if (!isCountValid(lodsCount, sizeof(uint32_t) * 2 + sizeof(float_t))) {
+            SR_WARN("MeshCache::LoadFromFile() : mesh cache is corrupted \"" + path.ToString() + "\"!");
+            return nullptr;
+        }
+
+        pOptimized->lods.resize(lodsCount);
+        for (auto&& lod : pOptimized->lods) {
+            lod.firstIndex = marshal.Read<uint32_t>();
+            lod.indicesCount = marshal.Read<uint32_t>();
+            lod.error = marshal.Read<float_t>();
+        }
+
+        bool isValid = readBlock(pOptimized->indices, sizeof(uint32_t)) && readBlock(pOptimized->vertexRemap, sizeof(uint32_t))
+            && readBlock(pOptimized->meshlets, sizeof(Meshlet));
+
+        const uint32_t streamsCount = isValid ? marshal.Read<uint32_t>() : 0;
+        isValid &= isCountValid(streamsCount, sizeof(uint32_t) * 3 + sizeof(uint64_t));
+
+        pMesh->streams.resize(isValid ? streamsCount : 0);
+        for (auto&& stream : pMesh->streams) {
+            stream.type = static_cast<Vertices::VertexType>(marshal.Read<uint32_t>());
+            stream.stride = marshal.Read<uint32_t>();
+            stream.count = marshal.Read<uint32_t>();
+
+            isValid = readBlock(stream.data, 1) && stream.count == pOptimized->vertexRemap.size();
+
+            if (!isValid) {
+                break;
+            }
+        }
+
+        const uint32_t bonesCount = isValid ? marshal.Read<uint32_t>() : 0;
+        isValid &= isCountValid(bonesCount, sizeof(uint16_t));
+
+        if (isValid) {
+            pMesh->bones.resize(bonesCount);
+            for (auto&& [name, boneIndex] : pMesh->bones) {
+                name = marshal.Read<std::string>();
+                boneIndex = marshal.Read<uint16_t>();
+            }
+
+            isValid = readBlock(pMesh->boneOffsets, sizeof(SR_MATH_NS::Matrix4x4));
+        }
+
+        for (auto&& lod : pOptimized->lods) {
+            isValid &= static_cast<uint64_t>(lod.firstIndex) + lod.indicesCount <= pOptimized->indices.size();
+        }
+
+        for (auto&& meshlet : pOptimized->meshlets) {
+            isValid &= static_cast<uint64_t>(meshlet.firstIndex) + meshlet.indicesCount <= pOptimized->indices.size();
+        }
+
+        if (!isValid || pOptimized->indices.empty() || pOptimized->vertexRemap.empty()) {
+            SR_WARN("MeshCache::LoadFromFile() : mesh cache is corrupted \"" + path.ToString() + "\"!");
+            return nullptr;
+        }
+
+        pMesh->pOptimized = pOptimized;
+
+        return pMesh;
+    }
+}
@@ -0,0 +1,622 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Common/Features.h>
+
+#include <Graphics/Utils/MeshOptimizer.h>
+#include <Graphics/Utils/MeshSimplifier.h>
+
+namespace SR_GRAPH_NS {
+    bool MeshOptimizer::IsEnabled() const {
+        return SR_UTILS_NS::Features::Instance().Enabled("MeshOptimizer", true);
+    }
+
+    MeshOptimizer::OptimizedMeshPtr MeshOptimizer::Optimize(const std::string& identifier, const VerticesGetter& getVertices, const IndicesGetter& getIndices) {
+        SR_TRACY_ZONE;
+
+        if (!IsEnabled()) {
+            return nullptr;
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (auto&& pIt = m_cache.find(identifier); pIt != m_cache.end()) {
+                return pIt->second;
+            }
+        }
+
+        auto&& vertices = getVertices();
+        auto&& indices = getIndices();
+
+        bool isValid = !vertices.empty() && !indices.empty() && indices.size() % 3 == 0;
+
+        for (uint32_t i = 0; isValid && i < indices.size(); ++i) {
+            isValid = indices[i] < vertices.size();
+        }
+
+        OptimizedMeshPtr pMesh;
+
+        if (isValid) SR_LIKELY_ATTRIBUTE {
+            pMesh = std::make_shared<OptimizedMesh>(Build(vertices, indices));
+        }
+        else {
+            SR_WARN("MeshOptimizer::Optimize() : invalid geometry, optimization skipped!\n\tIdentifier: " + identifier);
+        }
+
+        if (pMesh && SR_UTILS_NS::Debug::Instance().GetLevel() >= SR_UTILS_NS::Debug::Level::High) {
+            SR_LOG(SR_FORMAT("MeshOptimizer::Optimize() : \"{}\" ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, vertices {} -> {}, LODs {}, meshlets {}",
+                identifier.c_str(), pMesh->before.acmr, pMesh->after.acmr, pMesh->before.atvr, pMesh->after.atvr,
+                pMesh->before.vertices, pMesh->after.vertices, pMesh->lods.size(), pMesh->meshlets.size()
+            ));
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        /// другой поток мог успеть оптимизировать тот же меш
+        if (auto&& pIt = m_cache.find(identifier); pIt != m_cache.end()) {
+            return pIt->second;
+        }
+
+        m_cache[identifier] = pMesh;
+
+        if (pMesh) {
+            AccumulateStatistics(*pMesh);
+        }
+
+        return pMesh;
+    }
+
+    void MeshOptimizer::AddStatistics(const OptimizedMesh& mesh) {
+        std::lock_guard lock(m_mutex);
+        AccumulateStatistics(mesh);
+    }
+
+    void MeshOptimizer::AccumulateStatistics(const OptimizedMesh& mesh) {
+        auto&& accumulate = [](CacheStatistics& total, const CacheStatistics& statistics) {
+            const uint32_t triangles = total.triangles + statistics.triangles;
+            const uint32_t vertices = total.vertices + statistics.vertices;
+
+            if (triangles > 0) {
+                total.acmr = (total.acmr * total.triangles + statistics.acmr * statistics.triangles) / static_cast<float_t>(triangles);
+            }
+
+            if (vertices > 0) {
+                total.atvr = (total.atvr * total.vertices + statistics.atvr * statistics.vertices) / static_cast<float_t>(vertices);
+            }
+
+            total.triangles = triangles;
+            total.vertices = vertices;
+        };
+
+        ++m_statistics.meshes;
+        m_statistics.weldedVertices += mesh.before.vertices - mesh.after.vertices;
+        accumulate(m_statistics.before, mesh.before);
+        accumulate(m_statistics.after, mesh.after);
+    }
+
+    void MeshOptimizer::LogStatistics() const {
+        const Statistics statistics = GetStatistics();
+
+        if (statistics.meshes == 0) {
+            return;
+        }
+
+        SR_LOG(SR_FORMAT("MeshOptimizer::LogStatistics() : {} meshes, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, vertices {} -> {}, welded {}",
+            statistics.meshes, statistics.before.acmr, statistics.after.acmr, statistics.before.atvr, statistics.after.atvr,
+            statistics.before.vertices, statistics.after.vertices, statistics.weldedVertices
+        ));
+    }
+
+    std::vector<SR_UTILS_NS::Vertex> MeshOptimizer::RemapVertices(const OptimizedMesh& mesh, const std::vector<SR_UTILS_NS::Vertex>& vertices) {
+        SR_TRACY_ZONE;
+
+        std::vector<SR_UTILS_NS::Vertex> result;
+        result.reserve(mesh.vertexRemap.size());
+
+        for (auto&& source : mesh.vertexRemap) {
+            if (source >= vertices.size()) SR_UNLIKELY_ATTRIBUTE {
+                SR_ERROR("MeshOptimizer::RemapVertices() : vertex remap doesn't match the mesh!");
+                return { };
+            }
+            result.emplace_back(vertices[source]);
+        }
+
+        return result;
+    }
+
+    void MeshOptimizer::Clear() {
+        std::lock_guard lock(m_mutex);
+        m_cache.clear();
+        m_statistics = Statistics();
+    }
+
+    MeshOptimizer::Statistics MeshOptimizer::GetStatistics() const {
+        std::lock_guard lock(m_mutex);
+        return m_statistics;
+    }
+
+    MeshOptimizer::CacheStatistics MeshOptimizer::AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize) {
+        CacheStatistics statistics;
+
+        statistics.vertices = vertexCount;
+        statistics.triangles = static_cast<uint32_t>(indices.size() / 3);
+
+        if (statistics.triangles == 0 || vertexCount == 0) {
+            return statistics;
+        }
+
+        std::vector<uint32_t> timestamps(vertexCount, 0);
+        uint32_t timestamp = cacheSize + 1;
+        uint32_t misses = 0;
+
+        for (auto&& index : indices) {
+            if (index >= vertexCount) SR_UNLIKELY_ATTRIBUTE {
+                continue;
+            }
+
+            /// FIFO: вершина вытеснена, если после нее в кэш попало cacheSize других
+            if (timestamp - timestamps[index] > cacheSize) {
+                timestamps[index] = timestamp++;
+                ++misses;
+            }
+        }
+
+        statistics.acmr = static_cast<float_t>(misses) / static_cast<float_t>(statistics.triangles);
+        statistics.atvr = static_cast<float_t>(misses) / static_cast<float_t>(vertexCount);
+
+        return statistics;
+    }
+
+    MeshOptimizer::OptimizedMesh MeshOptimizer::Build(const std::vector<SR_UTILS_NS::Vertex>& vertices, const std::vector<uint32_t>& indices) {
+        SR_TRACY_ZONE;
+
+        OptimizedMesh result;
+        result.before = AnalyzeVertexCache(indices, static_cast<uint32_t>(vertices.size()));
+
+        std::vector<uint32_t> weldRemap;
+        const uint32_t uniqueCount = WeldVertices(vertices, weldRemap);
+
+        /// первая исходная вершина для каждой уникальной
+        std::vector<uint32_t> sources(uniqueCount);
+        for (uint32_t i = static_cast<uint32_t>(vertices.size()); i-- > 0;) {
+            sources[weldRemap[i]] = i;
+        }
+
+        std::vector<glm::vec3> positions(uniqueCount);
+        for (uint32_t i = 0; i < uniqueCount; ++i) {
+            positions[i] = *reinterpret_cast<const glm::vec3*>((const void*)&vertices[sources[i]].position);
+        }
+
+        std::vector<uint32_t> weldedIndices(indices.size());
+        for (uint32_t i = 0; i < indices.size(); ++i) {
+            weldedIndices[i] = weldRemap[indices[i]];
+        }
+
+        std::vector<uint32_t> clusters;
+        auto&& cacheOptimized = OptimizeVertexCache(weldedIndices, uniqueCount, clusters);
+        auto&& overdrawOptimized = OptimizeOverdraw(cacheOptimized, positions, SplitClusters(cacheOptimized, uniqueCount, clusters));
+
+        std::vector<uint32_t> fetchRemap;
+        const uint32_t usedCount = OptimizeVertexFetch(overdrawOptimized, uniqueCount, fetchRemap);
+
+        std::vector<glm::vec3> fetchedPositions(usedCount);
+
+        result.vertexRemap.resize(usedCount);
+        for (uint32_t i = 0; i < uniqueCount; ++i) {
+            if (fetchRemap[i] != SR_UINT32_MAX) {
+                result.vertexRemap[fetchRemap[i]] = sources[i];
+                fetchedPositions[fetchRemap[i]] = positions[i];
+                result.boundingRadius = SR_MAX(result.boundingRadius, glm::length(positions[i]));
+            }
+        }
+
+        result.indices.resize(overdrawOptimized.size());
+        for (uint32_t i = 0; i < overdrawOptimized.size(); ++i) {
+            result.indices[i] = fetchRemap[overdrawOptimized[i]];
+        }
+
+        result.after = AnalyzeVertexCache(result.indices, usedCount);
+
+        result.lods.emplace_back(Lod {
+            .firstIndex = 0,
+            .indicesCount = static_cast<uint32_t>(result.indices.size()),
+            .error = 0.f,
+        });
+
+        /// кластеры строятся только для исходного уровня, упрощенные видны издалека и рисуются целиком
+        result.meshlets = MeshletBuilder::Build(fetchedPositions, result.indices, 0, static_cast<uint32_t>(result.indices.size()));
+
+        /// упрощенные уровни ссылаются только на вершины исходного, поэтому fetchRemap подходит и им
+        for (auto&& [lodIndices, error] : GenerateLods(overdrawOptimized, positions)) {
+            result.lods.emplace_back(Lod {
+                .firstIndex = static_cast<uint32_t>(result.indices.size()),
+                .indicesCount = static_cast<uint32_t>(lodIndices.size()),
+                .error = error,
+            });
+
+            for (auto&& index : lodIndices) {
+                result.indices.emplace_back(fetchRemap[index]);
+            }
+        }
+
+        return result;
+    }
+
+    uint64_t MeshOptimizer::HashVertex(const SR_UTILS_NS::Vertex& vertex) {
+        /// FNV-1a по байтам вершины
+        const auto* pBytes = reinterpret_cast<const uint8_t*>(&vertex);
+
+        uint64_t hash = 14695981039346656037ULL;
+
+        for (uint32_t i = 0; i < sizeof(SR_UTILS_NS::Vertex); ++i) {
+            hash ^= pBytes[i];
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    uint32_t MeshOptimizer::WeldVertices(const std::vector<SR_UTILS_NS::Vertex>& vertices, std::vector<uint32_t>& remap) {
+        SR_TRACY_ZONE;
+
+        const auto count = static_cast<uint32_t>(vertices.size());
+
+        remap.assign(count, SR_UINT32_MAX);
+
+        uint32_t tableSize = 1;
+        while (tableSize < count + count / 4 + 1) {
+            tableSize <<= 1;
+        }
+
+        const uint32_t mask = tableSize - 1;
+        std::vector<uint32_t> table(tableSize, SR_UINT32_MAX);
+
+        uint32_t uniqueCount = 0;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            auto bucket = static_cast<uint32_t>(HashVertex(vertices[i]) & mask);
+
+            /// треугольные пробы обходят всю таблицу размера степени двойки
+            for (uint32_t probe = 0; probe <= mask; ++probe) {
+                const uint32_t slot = table[bucket];
+
+                if (slot == SR_UINT32_MAX) {
+                    table[bucket] = i;
+                    remap[i] = uniqueCount++;
+                    break;
+                }
+
+                /// склеиваем только побитово равные вершины, чтобы не терять швы UV и нормалей
+                if (std::memcmp(&vertices[slot], &vertices[i], sizeof(SR_UTILS_NS::Vertex)) == 0) {
+                    remap[i] = remap[slot];
+                    break;
+                }
+
+                bucket = (bucket + probe + 1) & mask;
+            }
+        }
+
+        return uniqueCount;
+    }
+
+    std::vector<uint32_t> MeshOptimizer::OptimizeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount, std::vector<uint32_t>& clusters) {
+        SR_TRACY_ZONE;
+
+        const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+        /// треугольники, смежные каждой вершине
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (auto&& index : indices) {
+            ++offsets[index + 1];
+        }
+
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+
+        std::vector<uint32_t> adjacency(indices.size());
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+
+        for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+            for (uint32_t k = 0; k < 3; ++k) {
+                adjacency[fill[indices[triangle * 3 + k]]++] = triangle;
+            }
+        }
+
+        /// число еще не выведенных треугольников у вершины
+        std::vector<uint32_t> live(vertexCount);
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            live[i] = offsets[i + 1] - offsets[i];
+        }
+
+        std::vector<uint32_t> timestamps(vertexCount, 0);
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<uint32_t> deadEnd;
+        deadEnd.reserve(indices.size());
+
+        std::vector<uint32_t> result;
+        result.reserve(indices.size());
+
+        clusters.clear();
+
+        uint32_t timestamp = VERTEX_CACHE_SIZE + 1;
+        uint32_t cursor = 0;
+
+        while (cursor < vertexCount && live[cursor] == 0) {
+            ++cursor;
+        }
+
+        uint32_t current = cursor < vertexCount ? cursor : SR_UINT32_MAX;
+        bool isNewCluster = true;
+
+        while (current != SR_UINT32_MAX) {
+            if (isNewCluster) {
+                clusters.emplace_back(static_cast<uint32_t>(result.size() / 3));
+                isNewCluster = false;
+            }
+
+            const auto candidatesBegin = static_cast<uint32_t>(deadEnd.size());
+
+            for (uint32_t i = offsets[current]; i < offsets[current + 1]; ++i) {
+                const uint32_t triangle = adjacency[i];
+
+                if (emitted[triangle]) {
+                    continue;
+                }
+
+                for (uint32_t k = 0; k < 3; ++k) {
+                    const uint32_t vertex = indices[triangle * 3 + k];
+
+                    result.emplace_back(vertex);
+                    deadEnd.emplace_back(vertex);
+
+                    --live[vertex];
+
+                    if (timestamp - timestamps[vertex] > VERTEX_CACHE_SIZE) {
+                        timestamps[vertex] = timestamp++;
+                    }
+                }
+
+                emitted[triangle] = true;
+            }
+
+            /// следующей берем вершину, которая останется в кэше, пока выводятся все ее треугольники
+            uint32_t next = SR_UINT32_MAX;
+            int32_t bestPriority = -1;
+
+            for (uint32_t i = candidatesBegin; i < deadEnd.size(); ++i) {
+                const uint32_t vertex = deadEnd[i];
+
+                if (live[vertex] == 0) {
+                    continue;
+                }
+
+                const uint32_t age = timestamp - timestamps[vertex];
+                const int32_t priority = age + 2 * live[vertex] <= VERTEX_CACHE_SIZE ? static_cast<int32_t>(age) : 0;
+
+                if (priority > bestPriority) {
+                    bestPriority = priority;
+                    next = vertex;
+                }
+            }
+
+            /// тупик: возвращаемся по стеку недавних вершин, иначе ищем по порядку. Это жесткая граница кластера
+            if (next == SR_UINT32_MAX) {
+                isNewCluster = true;
+
+                while (!deadEnd.empty() && next == SR_UINT32_MAX) {
+                    const uint32_t vertex = deadEnd.back();
+                    deadEnd.pop_back();
+
+                    if (live[vertex] > 0) {
+                        next = vertex;
+                    }
+                }
+
+                while (next == SR_UINT32_MAX && cursor < vertexCount) {
+                    if (live[cursor] > 0) {
+                        next = cursor;
+                    }
+                    else {
+                        ++cursor;
+                    }
+                }
+            }
+
+            current = next;
+        }
+
+        return result;
+    }
+
+    std::vector<std::pair<std::vector<uint32_t>, float_t>> MeshOptimizer::GenerateLods(const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions) {
+        SR_TRACY_ZONE;
+
+        std::vector<std::pair<std::vector<uint32_t>, float_t>> lods;
+
+        if (indices.size() / 3 < LOD_MIN_TRIANGLES) {
+            return lods;
+        }
+
+        lods.reserve(MAX_LODS);
+
+        const std::vector<uint32_t>* pPrevious = &indices;
+        float_t error = 0.f;
+
+        for (uint8_t level = 1; level < MAX_LODS; ++level) {
+            const auto target = static_cast<uint32_t>(static_cast<float_t>(pPrevious->size() / 3) * LOD_REDUCTION) * 3;
+
+            float_t lodError = 0.f;
+            auto&& simplified = MeshSimplifier::Simplify(positions, *pPrevious, target, lodError);
+
+            /// сетка почти не упростилась (швы, границы), дальше пользы нет
+            if (simplified.empty() || static_cast<float_t>(simplified.size()) > static_cast<float_t>(pPrevious->size()) * 0.8f) {
+                break;
+            }
+
+            std::vector<uint32_t> clusters;
+            simplified = OptimizeVertexCache(simplified, static_cast<uint32_t>(positions.size()), clusters);
+
+            /// каждый уровень упрощается из предыдущего, ошибки складываются
+            error += lodError;
+
+            lods.emplace_back(std::move(simplified), error);
+            pPrevious = &lods.back().first;
+        }
+
+        return lods;
+    }
+
+    std::vector<uint32_t> MeshOptimizer::SplitClusters(const std::vector<uint32_t>& indices, uint32_t vertexCount, const std::vector<uint32_t>& clusters) {
+        SR_TRACY_ZONE;
+
+        const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+        std::vector<uint32_t> timestamps(vertexCount, 0);
+        uint32_t timestamp = VERTEX_CACHE_SIZE + 1;
+
+        auto&& simulate = [&](uint32_t triangle) -> uint32_t {
+            uint32_t misses = 0;
+
+            for (uint32_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = indices[triangle * 3 + k];
+
+                if (timestamp - timestamps[vertex] > VERTEX_CACHE_SIZE) {
+                    timestamps[vertex] = timestamp++;
+                    ++misses;
+                }
+            }
+
+            return misses;
+        };
+
+        std::vector<uint32_t> result;
+        result.reserve(clusters.size());
+
+        for (uint32_t cluster = 0; cluster < clusters.size(); ++cluster) {
+            const uint32_t begin = clusters[cluster];
+            const uint32_t end = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangleCount;
+
+            if (begin >= end) {
+                continue;
+            }
+
+            uint32_t clusterMisses = 0;
+            for (uint32_t triangle = begin; triangle < end; ++triangle) {
+                clusterMisses += simulate(triangle);
+            }
+
+            const float_t threshold = OVERDRAW_THRESHOLD * static_cast<float_t>(clusterMisses) / static_cast<float_t>(end - begin);
+
+            /// сброс кэша
+            timestamp += VERTEX_CACHE_SIZE + 1;
+
+            uint32_t misses = 0;
+            uint32_t faces = 0;
+
+            /// мягкая граница: кластер закрывается, как только его ACMR дошел до допустимого
+            for (uint32_t triangle = begin; triangle < end; ++triangle) {
+                misses += simulate(triangle);
+                ++faces;
+
+                if (static_cast<float_t>(misses) / static_cast<float_t>(faces) <= threshold) {
+                    result.emplace_back(triangle + 1 - faces);
+                    timestamp += VERTEX_CACHE_SIZE + 1;
+                    misses = 0;
+                    faces = 0;
+                }
+            }
+
+            if (faces != 0) {
+                result.emplace_back(end - faces);
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<uint32_t> MeshOptimizer::OptimizeOverdraw(const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& clusters) {
+        SR_TRACY_ZONE;
+
+        if (clusters.size() <= 1 || indices.empty()) {
+            return indices;
+        }
+
+        const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+        glm::vec3 meshCentroid(0.f);
+        for (auto&& index : indices) {
+            meshCentroid += positions[index];
+        }
+        meshCentroid /= static_cast<float_t>(indices.size());
+
+        /// (ключ, кластер)
+        std::vector<std::pair<float_t, uint32_t>> order(clusters.size());
+
+        for (uint32_t cluster = 0; cluster < clusters.size(); ++cluster) {
+            const uint32_t begin = clusters[cluster];
+            const uint32_t end = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangleCount;
+
+            glm::vec3 centroid(0.f);
+            glm::vec3 normal(0.f);
+            float_t area = 0.f;
+
+            for (uint32_t triangle = begin; triangle < end; ++triangle) {
+                const glm::vec3& p0 = positions[indices[triangle * 3 + 0]];
+                const glm::vec3& p1 = positions[indices[triangle * 3 + 1]];
+                const glm::vec3& p2 = positions[indices[triangle * 3 + 2]];
+
+                const glm::vec3 cross = glm::cross(p1 - p0, p2 - p0);
+                const float_t triangleArea = glm::length(cross);
+
+                centroid += (p0 + p1 + p2) * (triangleArea / 3.f);
+                normal += cross;
+                area += triangleArea;
+            }
+
+            const float_t normalLength = glm::length(normal);
+
+            float_t key = 0.f;
+
+            if (area > 0.f && normalLength > 0.f) {
+                key = glm::dot(centroid / area - meshCentroid, normal / normalLength);
+            }
+
+            order[cluster] = std::make_pair(key, cluster);
+        }
+
+        /// кластеры, смотрящие наружу, рисуются первыми и закрывают собой внутренние
+        std::stable_sort(order.begin(), order.end(), [](auto&& left, auto&& right) {
+            return left.first > right.first;
+        });
+
+        std::vector<uint32_t> result;
+        result.reserve(indices.size());
+
+        for (auto&& [key, cluster] : order) {
+            const uint32_t begin = clusters[cluster];
+            const uint32_t end = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangleCount;
+
+            result.insert(result.end(), indices.begin() + begin * 3, indices.begin() + end * 3);
+        }
+
+        return result;
+    }
+
+    uint32_t MeshOptimizer::OptimizeVertexFetch(const std::vector<uint32_t>& indices, uint32_t vertexCount, std::vector<uint32_t>& remap) {
+        SR_TRACY_ZONE;
+
+        remap.assign(vertexCount, SR_UINT32_MAX);
+
+        uint32_t usedCount = 0;
+
+        for (auto&& index : indices) {
+            if (remap[index] == SR_UINT32_MAX) {
+                remap[index] = usedCount++;
+            }
+        }
+
+        return usedCount;
+    }
+}
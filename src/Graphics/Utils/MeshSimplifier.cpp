@@ -0,0 +1,332 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Utils/MeshSimplifier.h>
+
+namespace SR_GRAPH_NS {
+    void MeshSimplifier::Quadric::AddPlane(const glm::vec3& normal, float_t distance) {
+        a2 += normal.x * normal.x; ab += normal.x * normal.y; ac += normal.x * normal.z; ad += normal.x * distance;
+        b2 += normal.y * normal.y; bc += normal.y * normal.z; bd += normal.y * distance;
+        c2 += normal.z * normal.z; cd += normal.z * distance;
+        d2 += distance * distance;
+    }
+
+    void MeshSimplifier::Quadric::Add(const Quadric& other) {
+        a2 += other.a2; ab += other.ab; ac += other.ac; ad += other.ad;
+        b2 += other.b2; bc += other.bc; bd += other.bd;
+        c2 += other.c2; cd += other.cd;
+        d2 += other.d2;
+    }
+
+    float_t MeshSimplifier::Quadric::Evaluate(const glm::vec3& point) const {
+        const double_t x = point.x;
+        const double_t y = point.y;
+        const double_t z = point.z;
+
+        const double_t error =
+            a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x +
+            b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y +
+            c2 * z * z + 2.0 * cd * z +
+            d2;
+
+        return static_cast<float_t>(SR_MAX(error, 0.0));
+    }
+
+    std::vector<uint32_t> MeshSimplifier::Simplify(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, uint32_t targetIndexCount, float_t& error) {
+        SR_TRACY_ZONE;
+
+        error = 0.f;
+
+        if (indices.size() <= targetIndexCount || indices.size() % 3 != 0 || positions.empty()) {
+            return indices;
+        }
+
+        const auto vertexCount = static_cast<uint32_t>(positions.size());
+
+        auto&& positionRemap = BuildPositionRemap(positions);
+        auto&& locks = BuildLocks(positionRemap, indices);
+
+        std::vector<Quadric> quadrics(vertexCount);
+
+        for (uint32_t triangle = 0; triangle < indices.size() / 3; ++triangle) {
+            const glm::vec3& p0 = positions[indices[triangle * 3 + 0]];
+            const glm::vec3& p1 = positions[indices[triangle * 3 + 1]];
+            const glm::vec3& p2 = positions[indices[triangle * 3 + 2]];
+
+            const glm::vec3 cross = glm::cross(p1 - p0, p2 - p0);
+            const float_t length = glm::length(cross);
+
+            if (length <= 0.f) {
+                continue;
+            }
+
+            const glm::vec3 normal = cross / length;
+            const float_t distance = -glm::dot(normal, p0);
+
+            for (uint32_t k = 0; k < 3; ++k) {
+                quadrics[positionRemap[indices[triangle * 3 + k]]].AddPlane(normal, distance);
+            }
+        }
+
+        std::vector<uint32_t> result = indices;
+
+        std::vector<uint32_t> remap(vertexCount);
+        std::vector<uint32_t> offsets(vertexCount + 1);
+        std::vector<uint32_t> fill;
+        std::vector<uint32_t> adjacency;
+        std::vector<bool> touched(vertexCount);
+        std::vector<Collapse> collapses;
+
+        float_t maxCost = 0.f;
+
+        while (result.size() > targetIndexCount) {
+            const auto triangleCount = static_cast<uint32_t>(result.size() / 3);
+
+            /// треугольники, смежные каждой позиции
+            std::fill(offsets.begin(), offsets.end(), 0);
+            for (auto&& index : result) {
+                ++offsets[positionRemap[index] + 1];
+            }
+
+            for (uint32_t i = 0; i < vertexCount; ++i) {
+                offsets[i + 1] += offsets[i];
+            }
+
+            adjacency.resize(result.size());
+            fill.assign(offsets.begin(), offsets.end() - 1);
+
+            for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+                for (uint32_t k = 0; k < 3; ++k) {
+                    adjacency[fill[positionRemap[result[triangle * 3 + k]]]++] = triangle;
+                }
+            }
+
+            collapses.clear();
+
+            for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+                for (uint32_t k = 0; k < 3; ++k) {
+                    const uint32_t v0 = result[triangle * 3 + k];
+                    const uint32_t v1 = result[triangle * 3 + (k + 1) % 3];
+
+                    if (positionRemap[v0] == positionRemap[v1]) {
+                        continue;
+                    }
+
+                    for (auto&& [from, to] : { std::make_pair(v0, v1), std::make_pair(v1, v0) }) {
+                        if (locks[positionRemap[from]]) {
+                            continue;
+                        }
+
+                        Quadric quadric = quadrics[positionRemap[from]];
+                        quadric.Add(quadrics[positionRemap[to]]);
+
+                        collapses.emplace_back(Collapse { from, to, quadric.Evaluate(positions[to]) });
+                    }
+                }
+            }
+
+            if (collapses.empty()) {
+                break;
+            }
+
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& left, const Collapse& right) {
+                return left.cost < right.cost;
+            });
+
+            for (uint32_t i = 0; i < vertexCount; ++i) {
+                remap[i] = i;
+            }
+            std::fill(touched.begin(), touched.end(), false);
+
+            const auto trianglesToRemove = static_cast<uint32_t>((result.size() - targetIndexCount) / 3);
+            uint32_t removed = 0;
+            uint32_t applied = 0;
+
+            for (auto&& collapse : collapses) {
+                const uint32_t fromPosition = positionRemap[collapse.from];
+                const uint32_t toPosition = positionRemap[collapse.to];
+
+                if (touched[fromPosition] || touched[toPosition]) {
+                    continue;
+                }
+
+                const glm::vec3& target = positions[collapse.to];
+
+                bool isValid = true;
+                uint32_t shared = 0;
+
+                for (uint32_t i = offsets[fromPosition]; i < offsets[fromPosition + 1]; ++i) {
+                    const uint32_t triangle = adjacency[i];
+
+                    const bool isShared =
+                        positionRemap[result[triangle * 3 + 0]] == toPosition ||
+                        positionRemap[result[triangle * 3 + 1]] == toPosition ||
+                        positionRemap[result[triangle * 3 + 2]] == toPosition;
+
+                    if (isShared) {
+                        ++shared;
+                    }
+                    else if (IsFlipped(positions, positionRemap, result, triangle, fromPosition, target)) {
+                        isValid = false;
+                        break;
+                    }
+                }
+
+                if (!isValid) {
+                    continue;
+                }
+
+                remap[collapse.from] = collapse.to;
+
+                /// треугольники вокруг стянутой вершины изменились, их вершины не трогаем до следующего прохода
+                for (uint32_t i = offsets[fromPosition]; i < offsets[fromPosition + 1]; ++i) {
+                    for (uint32_t k = 0; k < 3; ++k) {
+                        touched[positionRemap[result[adjacency[i] * 3 + k]]] = true;
+                    }
+                }
+
+                quadrics[toPosition].Add(quadrics[fromPosition]);
+                maxCost = SR_MAX(maxCost, collapse.cost);
+
+                ++applied;
+
+                if ((removed += shared) >= trianglesToRemove) {
+                    break;
+                }
+            }
+
+            if (applied == 0) {
+                break;
+            }
+
+            /// переписываем индексы и выбрасываем вырожденные треугольники
+            uint32_t write = 0;
+
+            for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+                const uint32_t a = remap[result[triangle * 3 + 0]];
+                const uint32_t b = remap[result[triangle * 3 + 1]];
+                const uint32_t c = remap[result[triangle * 3 + 2]];
+
+                const uint32_t pa = positionRemap[a];
+                const uint32_t pb = positionRemap[b];
+                const uint32_t pc = positionRemap[c];
+
+                if (pa == pb || pb == pc || pa == pc) {
+                    continue;
+                }
+
+                result[write++] = a;
+                result[write++] = b;
+                result[write++] = c;
+            }
+
+            result.resize(write);
+        }
+
+        error = std::sqrt(maxCost);
+
+        return result;
+    }
+
+    std::vector<uint32_t> MeshSimplifier::BuildPositionRemap(const std::vector<glm::vec3>& positions) {
+        SR_TRACY_ZONE;
+
+        const auto count = static_cast<uint32_t>(positions.size());
+
+        std::vector<uint32_t> remap(count);
+
+        uint32_t tableSize = 1;
+        while (tableSize < count + count / 4 + 1) {
+            tableSize <<= 1;
+        }
+
+        const uint32_t mask = tableSize - 1;
+        std::vector<uint32_t> table(tableSize, SR_UINT32_MAX);
+
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t bits[3];
+            std::memcpy(bits, &positions[i], sizeof(bits));
+
+            auto bucket = static_cast<uint32_t>((bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u)) & mask;
+
+            for (uint32_t probe = 0; probe <= mask; ++probe) {
+                const uint32_t slot = table[bucket];
+
+                if (slot == SR_UINT32_MAX) {
+                    table[bucket] = i;
+                    remap[i] = i;
+                    break;
+                }
+
+                if (std::memcmp(&positions[slot], &positions[i], sizeof(glm::vec3)) == 0) {
+                    remap[i] = slot;
+                    break;
+                }
+
+                bucket = (bucket + probe + 1) & mask;
+            }
+        }
+
+        return remap;
+    }
+
+    std::vector<bool> MeshSimplifier::BuildLocks(const std::vector<uint32_t>& positionRemap, const std::vector<uint32_t>& indices) {
+        SR_TRACY_ZONE;
+
+        std::vector<bool> locks(positionRemap.size(), false);
+
+        /// шов: в одной позиции несколько вершин с разными атрибутами
+        for (uint32_t i = 0; i < positionRemap.size(); ++i) {
+            if (positionRemap[i] != i) {
+                locks[i] = true;
+                locks[positionRemap[i]] = true;
+            }
+        }
+
+        auto&& edgeKey = [](uint32_t from, uint32_t to) -> uint64_t {
+            return (static_cast<uint64_t>(from) << 32) | to;
+        };
+
+        std::unordered_set<uint64_t> edges;
+        edges.reserve(indices.size());
+
+        for (uint32_t i = 0; i < indices.size(); i += 3) {
+            for (uint32_t k = 0; k < 3; ++k) {
+                edges.insert(edgeKey(positionRemap[indices[i + k]], positionRemap[indices[i + (k + 1) % 3]]));
+            }
+        }
+
+        /// граница: у ребра нет встречного
+        for (uint32_t i = 0; i < indices.size(); i += 3) {
+            for (uint32_t k = 0; k < 3; ++k) {
+                const uint32_t from = positionRemap[indices[i + k]];
+                const uint32_t to = positionRemap[indices[i + (k + 1) % 3]];
+
+                if (edges.count(edgeKey(to, from)) == 0) {
+                    locks[from] = true;
+                    locks[to] = true;
+                }
+            }
+        }
+
+        return locks;
+    }
+
+    bool MeshSimplifier::IsFlipped(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& positionRemap, const std::vector<uint32_t>& indices, uint32_t triangle, uint32_t from, const glm::vec3& target) {
+        glm::vec3 before[3];
+        glm::vec3 after[3];
+
+        for (uint32_t k = 0; k < 3; ++k) {
+            const uint32_t vertex = indices[triangle * 3 + k];
+            before[k] = positions[vertex];
+            after[k] = positionRemap[vertex] == from ? target : before[k];
+        }
+
+        const glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+        const glm::vec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+
+        /// треугольник не должен перевернуться или выродиться
+        return glm::dot(normalBefore, normalAfter) <= 0.f;
+    }
+}
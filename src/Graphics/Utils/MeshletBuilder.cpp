@@ -0,0 +1,128 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Utils/MeshletBuilder.h>
+
+namespace SR_GRAPH_NS {
+    Meshlets MeshletBuilder::Build(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, uint32_t firstIndex, uint32_t indicesCount) {
+        SR_TRACY_ZONE;
+
+        if (indicesCount % 3 != 0 || indicesCount / 3 < MIN_TRIANGLES || static_cast<uint64_t>(firstIndex) + indicesCount > indices.size()) {
+            return { };
+        }
+
+        Meshlets meshlets;
+        meshlets.reserve(indicesCount / (3 * MAX_TRIANGLES) + 1);
+
+        /// номер кластера, в который последний раз попала вершина
+        std::vector<uint32_t> stamps(positions.size(), SR_UINT32_MAX);
+
+        Meshlet current;
+        current.firstIndex = firstIndex;
+
+        uint32_t vertices = 0;
+
+        auto&& flush = [&]() {
+            CalculateBounds(positions, indices, current);
+            meshlets.emplace_back(current);
+
+            current = Meshlet();
+            current.firstIndex = meshlets.back().firstIndex + meshlets.back().indicesCount;
+            vertices = 0;
+        };
+
+        for (uint32_t i = firstIndex; i < firstIndex + indicesCount; i += 3) {
+            const auto stamp = static_cast<uint32_t>(meshlets.size());
+
+            uint32_t newVertices = 0;
+            for (uint32_t j = 0; j < 3; ++j) {
+                newVertices += stamps[indices[i + j]] != stamp ? 1 : 0;
+            }
+
+            /// одинаковые индексы в вырожденном треугольнике посчитаны дважды, это только раньше закроет кластер
+            if (vertices + newVertices > MAX_VERTICES || current.indicesCount / 3 >= MAX_TRIANGLES) {
+                flush();
+            }
+
+            for (uint32_t j = 0; j < 3; ++j) {
+                auto&& vertexStamp = stamps[indices[i + j]];
+                if (vertexStamp != static_cast<uint32_t>(meshlets.size())) {
+                    vertexStamp = static_cast<uint32_t>(meshlets.size());
+                    ++vertices;
+                }
+            }
+
+            current.indicesCount += 3;
+        }
+
+        if (current.indicesCount > 0) {
+            flush();
+        }
+
+        return meshlets;
+    }
+
+    void MeshletBuilder::CalculateBounds(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, Meshlet& meshlet) {
+        glm::vec3 min = glm::vec3(std::numeric_limits<float_t>::max());
+        glm::vec3 max = glm::vec3(std::numeric_limits<float_t>::lowest());
+
+        const uint32_t lastIndex = meshlet.firstIndex + meshlet.indicesCount;
+
+        for (uint32_t i = meshlet.firstIndex; i < lastIndex; ++i) {
+            min = glm::min(min, positions[indices[i]]);
+            max = glm::max(max, positions[indices[i]]);
+        }
+
+        meshlet.center = (min + max) * 0.5f;
+        meshlet.radius = 0.f;
+
+        for (uint32_t i = meshlet.firstIndex; i < lastIndex; ++i) {
+            meshlet.radius = SR_MAX(meshlet.radius, glm::length(positions[indices[i]] - meshlet.center));
+        }
+
+        std::vector<glm::vec3> normals;
+        normals.reserve(meshlet.indicesCount / 3);
+
+        glm::vec3 axis = glm::vec3(0.f);
+
+        for (uint32_t i = meshlet.firstIndex; i < lastIndex; i += 3) {
+            const glm::vec3& p0 = positions[indices[i + 0]];
+            const glm::vec3& p1 = positions[indices[i + 1]];
+            const glm::vec3& p2 = positions[indices[i + 2]];
+
+            const glm::vec3 cross = glm::cross(p1 - p0, p2 - p0);
+            const float_t length = glm::length(cross);
+
+            if (length <= 0.f) {
+                continue;
+            }
+
+            normals.emplace_back(cross / length);
+            axis += normals.back();
+        }
+
+        meshlet.coneAxis = glm::vec3(0.f);
+        meshlet.coneCutoff = 1.f;
+
+        const float_t axisLength = glm::length(axis);
+        if (normals.empty() || axisLength <= 0.f) {
+            return;
+        }
+
+        axis /= axisLength;
+
+        float_t minDot = 1.f;
+        for (auto&& normal : normals) {
+            minDot = SR_MIN(minDot, glm::dot(axis, normal));
+        }
+
+        /// при таком разбросе нормалей конус почти полусфера и ничего не отсекает
+        if (minDot <= 0.1f) {
+            return;
+        }
+
+        meshlet.coneAxis = axis;
+        meshlet.coneCutoff = std::sqrt(1.f - minDot * minDot);
+    }
+}
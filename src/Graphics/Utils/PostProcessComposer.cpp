@@ -0,0 +1,176 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Utils/PostProcessComposer.h>
+#include <Graphics/SRSL/ShaderVariables.h>
+#include <Graphics/SRSL/Lexer.h>
+
+namespace SR_GRAPH_NS {
+    std::vector<PostProcessEffects> PostProcessComposer::Split(const PostProcessEffects& effects) {
+        std::vector<PostProcessEffects> segments;
+
+        for (auto&& effect : effects) {
+            if (segments.empty() || (effect.neighborhood && !segments.back().empty())) {
+                segments.emplace_back();
+            }
+
+            segments.back().emplace_back(effect);
+        }
+
+        return segments;
+    }
+
+    std::string PostProcessComposer::Generate(const SR_UTILS_NS::Path& base, const PostProcessEffects& effects) {
+        std::string code = "#include <" + base.ToString() + ">\n";
+
+        for (uint32_t i = 0; i < effects.size(); ++i) {
+            auto&& effectCode = ScopeEffect(effects[i], i);
+            if (effectCode.empty()) {
+                return std::string();
+            }
+
+            code += "\n" + effectCode + "\n";
+        }
+
+        code += "\nvoid fragment() {\n";
+        code += "    vec2 uv = GetSourceUV();\n";
+        code += "    vec4 color = SampleSource(uv);\n";
+
+        for (uint32_t i = 0; i < effects.size(); ++i) {
+            code += "    color = " + GetScopedName(i, effects[i].function) + "(color, uv);\n";
+        }
+
+        code += "    " + SR_SRSL_NS::SR_SRSL_MAIN_OUT_LAYER + " = color;\n";
+        code += "}\n";
+
+        return code;
+    }
+
+    std::string PostProcessComposer::GetScopedName(uint32_t effectIndex, const std::string& name) {
+        return "PP" + std::to_string(effectIndex) + "_" + name;
+    }
+
+    std::string PostProcessComposer::ScopeEffect(const PostProcessEffect& effect, uint32_t effectIndex) {
+        auto&& path = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat(effect.path);
+
+        std::string code = SR_UTILS_NS::FileSystem::ReadAllText(path.ToString());
+        if (code.empty()) {
+            SR_ERROR("PostProcessComposer::ScopeEffect() : failed to read effect \"{}\"!\n\tPath: {}", effect.name.ToStringRef(), path.ToStringRef());
+            return std::string();
+        }
+
+        auto&& lexems = SR_SRSL_NS::SRSLLexer::Instance().ParseString(code, 0);
+
+        std::set<std::string> declared;
+        std::vector<const SR_SRSL_NS::Lexem*> identifiers;
+
+        int32_t braces = 0;
+        int32_t brackets = 0;
+        int32_t squareBrackets = 0;
+        bool isInclude = false;
+        /// между "=" и ";" глобального объявления только выражение, в нем ничего не объявляется
+        bool isInitializer = false;
+
+        for (uint64_t i = 0; i < lexems.size(); ++i) {
+            auto&& lexem = lexems[i];
+
+            switch (lexem.kind) {
+                case SR_SRSL_NS::LexemKind::Macro: isInclude = true; continue;
+                case SR_SRSL_NS::LexemKind::ClosingAngleBracket: isInclude = false; continue;
+                case SR_SRSL_NS::LexemKind::OpeningCurlyBracket: ++braces; continue;
+                case SR_SRSL_NS::LexemKind::ClosingCurlyBracket: --braces; continue;
+                case SR_SRSL_NS::LexemKind::OpeningBracket: ++brackets; continue;
+                case SR_SRSL_NS::LexemKind::ClosingBracket: --brackets; continue;
+                case SR_SRSL_NS::LexemKind::OpeningSquareBracket: ++squareBrackets; continue;
+                case SR_SRSL_NS::LexemKind::ClosingSquareBracket: --squareBrackets; continue;
+                case SR_SRSL_NS::LexemKind::Assign:
+                    isInitializer |= braces == 0 && brackets == 0 && squareBrackets == 0;
+                    continue;
+                case SR_SRSL_NS::LexemKind::Semicolon:
+                    isInitializer &= braces != 0 || brackets != 0 || squareBrackets != 0;
+                    continue;
+                case SR_SRSL_NS::LexemKind::Identifier: break;
+                default: continue;
+            }
+
+            /// путь подключаемого файла не переименовывается
+            if (isInclude) {
+                continue;
+            }
+
+            identifiers.emplace_back(&lexem);
+
+            /// глобальное объявление: имя сразу после типа, вне тел, аргументов, декораторов и инициализаторов,
+            /// за которым идет "(", ";", "=" или "["
+            if (braces != 0 || brackets != 0 || squareBrackets != 0 || isInitializer || i == 0 || i + 1 >= lexems.size()) {
+                continue;
+            }
+
+            if (lexems[i - 1].kind != SR_SRSL_NS::LexemKind::Identifier) {
+                continue;
+            }
+
+            switch (lexems[i + 1].kind) {
+                case SR_SRSL_NS::LexemKind::OpeningBracket:
+                case SR_SRSL_NS::LexemKind::Semicolon:
+                case SR_SRSL_NS::LexemKind::Assign:
+                case SR_SRSL_NS::LexemKind::OpeningSquareBracket:
+                    declared.insert(lexem.value);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        if (declared.count(effect.function) == 0) {
+            SR_ERROR("PostProcessComposer::ScopeEffect() : function \"{}\" isn't declared in effect \"{}\"!", effect.function, effect.name.ToStringRef());
+            return std::string();
+        }
+
+        /// с конца, чтобы смещения еще не замененных имен оставались верными
+        for (auto pIt = identifiers.rbegin(); pIt != identifiers.rend(); ++pIt) {
+            if (declared.count((*pIt)->value) == 1) {
+                code.replace((*pIt)->offset, (*pIt)->length, GetScopedName(effectIndex, (*pIt)->value));
+            }
+        }
+
+        return code;
+    }
+
+    SR_UTILS_NS::Path PostProcessComposer::Compose(const SR_UTILS_NS::Path& base, const PostProcessEffects& effects) {
+        SR_TRACY_ZONE;
+
+        if (effects.empty()) {
+            SR_ERROR("PostProcessComposer::Compose() : effects list is empty!");
+            return SR_UTILS_NS::Path();
+        }
+
+        for (auto&& effect : effects) {
+            if (effect.function.empty()) {
+                SR_ERROR("PostProcessComposer::Compose() : effect \"{}\" has no function!", effect.name.ToStringRef());
+                return SR_UTILS_NS::Path();
+            }
+        }
+
+        const std::string code = Generate(base, effects);
+        if (code.empty()) {
+            return SR_UTILS_NS::Path();
+        }
+
+        /// имя файла - хэш кода, одинаковые цепочки разных техник используют один шейдер
+        auto&& path = SR_UTILS_NS::Path(GENERATED_PATH).Concat(SR_UTILS_NS::ToString(SR_HASH(code))).ConcatExt("srsl");
+        auto&& absPath = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat(path);
+
+        if (absPath.Exists(SR_UTILS_NS::Path::Type::File)) {
+            return path;
+        }
+
+        if (!absPath.Create() || !SR_UTILS_NS::FileSystem::WriteToFile(absPath, code)) {
+            SR_ERROR("PostProcessComposer::Compose() : failed to write file!\n\tPath: " + absPath.ToString());
+            return SR_UTILS_NS::Path();
+        }
+
+        return path;
+    }
+}